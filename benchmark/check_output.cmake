@@ -0,0 +1,185 @@
+# Checks that the outputs of the generator do not depend on how the work is
+# scheduled or on the order of elements in vk.xml. Every registry is first
+# generated serially, then on all cores and with its elements shuffled, and
+# all runs must write the same files byte for byte. Invoked by the
+# check_output target and test with SYNTHESIZE, GENERATOR, WORK_DIR and SEEDS
+# defined. If REFERENCE_DIR is set, the serial outputs of REGISTRY must also
+# match the files in it. Both default to the trimmed registry in fixture and
+# the outputs expected for it, which are regenerated along with changes that
+# are meant to alter the outputs.
+#
+# Every <name>.txt in PROFILE_DIR is applied to REGISTRY with --profile, and
+# the outputs must match the files in the <name> directory next to it.
+#
+# If INCLUDE_DIR holds vulkan.h for REGISTRY, the serial and profile outputs
+# are also compiled: the C++ sources and headers with CXX_COMPILER, the
+# layout program with C_COMPILER, and, if RUSTC is set, the Rust bindings
+# with every feature enabled. LIBLOADING is a stand-in for the crate of the
+# same name that the bindings use.
+
+if(NOT DEFINED REGISTRY)
+  set(REGISTRY ${CMAKE_CURRENT_LIST_DIR}/fixture/vk.xml)
+  if(NOT DEFINED REFERENCE_DIR)
+    set(REFERENCE_DIR ${CMAKE_CURRENT_LIST_DIR}/fixture/expected)
+  endif()
+  if(NOT DEFINED PROFILE_DIR)
+    set(PROFILE_DIR ${CMAKE_CURRENT_LIST_DIR}/fixture/profiles)
+  endif()
+  if(NOT DEFINED INCLUDE_DIR)
+    set(INCLUDE_DIR ${CMAKE_CURRENT_LIST_DIR}/fixture/include)
+  endif()
+endif()
+if(NOT DEFINED LIBLOADING)
+  set(LIBLOADING ${CMAKE_CURRENT_LIST_DIR}/fixture/libloading.rs)
+endif()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# The generator waits for input after an error, so it reads from an empty file
+file(WRITE ${WORK_DIR}/no_input "")
+
+function(generate registry out_dir)
+  file(MAKE_DIRECTORY ${out_dir})
+  execute_process(COMMAND ${GENERATOR} ${registry} --out=${out_dir} ${ARGN}
+    INPUT_FILE ${WORK_DIR}/no_input
+    OUTPUT_QUIET
+    RESULT_VARIABLE result
+  )
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "The generator failed on ${registry} with ${ARGN}")
+  endif()
+endfunction()
+
+function(compare expected_dir actual_dir)
+  file(GLOB_RECURSE expected RELATIVE ${expected_dir} ${expected_dir}/*)
+  file(GLOB_RECURSE actual RELATIVE ${actual_dir} ${actual_dir}/*)
+  list(SORT expected)
+  list(SORT actual)
+  if(NOT expected STREQUAL actual)
+    message(FATAL_ERROR "${actual_dir} and ${expected_dir} do not contain the same files")
+  endif()
+
+  foreach(file ${expected})
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${expected_dir}/${file} ${actual_dir}/${file}
+      RESULT_VARIABLE result
+    )
+    if(NOT result EQUAL 0)
+      message(FATAL_ERROR "${actual_dir}/${file} differs from ${expected_dir}/${file}")
+    endif()
+  endforeach()
+endfunction()
+
+function(run what)
+  execute_process(COMMAND ${ARGN} RESULT_VARIABLE result OUTPUT_VARIABLE output ERROR_VARIABLE output)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Failed to ${what}:\n${output}")
+  endif()
+endfunction()
+
+# Compiles the outputs in out_dir, working in a copy so that the files
+# compiling them writes do not end up next to the outputs
+function(compile_outputs out_dir)
+  get_filename_component(name ${out_dir} NAME)
+  set(dir ${WORK_DIR}/${name}_compile)
+  file(COPY ${out_dir}/ DESTINATION ${dir})
+  message(STATUS "Compiling ${out_dir}")
+
+  if(CXX_COMPILER_ID STREQUAL "MSVC")
+    set(cxx ${CXX_COMPILER} /nologo /c /EHsc /I${dir} /I${INCLUDE_DIR} /Fo${dir}/)
+    set(c ${C_COMPILER} /nologo /I${INCLUDE_DIR} /Fe${dir}/vulkan_layout.exe /Fo${dir}/)
+  else()
+    set(cxx ${CXX_COMPILER} -std=c++11 -c -I${dir} -I${INCLUDE_DIR})
+    set(c ${C_COMPILER} -I${INCLUDE_DIR} -o ${dir}/vulkan_layout.exe)
+  endif()
+
+  # Headers on their own, so that each includes what it uses
+  file(GLOB headers RELATIVE ${dir} ${dir}/*.h)
+  foreach(header ${headers})
+    string(MAKE_C_IDENTIFIER ${header} tu)
+    file(WRITE ${dir}/${tu}.cpp "#include \"${header}\"\n")
+    run("compile ${out_dir}/${header}" ${cxx} ${dir}/${tu}.cpp WORKING_DIRECTORY ${dir})
+  endforeach()
+  file(GLOB sources ${out_dir}/*.cpp)
+  foreach(source ${sources})
+    get_filename_component(source ${source} NAME)
+    run("compile ${out_dir}/${source}" ${cxx} ${dir}/${source} WORKING_DIRECTORY ${dir})
+  endforeach()
+
+  if(NOT EXISTS ${dir}/vulkan.rs)
+    return()
+  endif()
+  run("compile ${out_dir}/vulkan_layout.c" ${c} ${dir}/vulkan_layout.c WORKING_DIRECTORY ${dir})
+  run("run ${out_dir}/vulkan_layout.c" ${dir}/vulkan_layout.exe ${dir}/vulkan_layout.rs)
+
+  if(NOT RUSTC)
+    return()
+  endif()
+  set(features)
+  file(STRINGS ${dir}/vulkan_features.toml lines REGEX "^[A-Za-z0-9_]+ =")
+  foreach(line ${lines})
+    string(REGEX REPLACE " =.*" "" feature "${line}")
+    list(APPEND features --cfg "feature=\"${feature}\"")
+  endforeach()
+  run("compile ${out_dir}/vulkan.rs"
+    ${RUSTC} --edition 2018 --crate-type lib --emit=metadata --out-dir ${dir}
+      --extern libloading=${WORK_DIR}/liblibloading.rlib ${features} ${dir}/vulkan.rs
+    WORKING_DIRECTORY ${dir}
+  )
+endfunction()
+
+if(INCLUDE_DIR AND RUSTC)
+  run("compile ${LIBLOADING}"
+    ${RUSTC} --edition 2018 --crate-type rlib --crate-name libloading -o ${WORK_DIR}/liblibloading.rlib ${LIBLOADING}
+  )
+endif()
+
+# The synthetic registry exercises extension chains and platform protection
+# beyond what the configured vk.xml has
+set(synthetic ${WORK_DIR}/vk_synthetic.xml)
+execute_process(COMMAND ${SYNTHESIZE} ${synthetic} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "Failed to synthesize a registry")
+endif()
+
+foreach(registry ${REGISTRY} ${synthetic})
+  get_filename_component(name ${registry} NAME_WE)
+  set(serial ${WORK_DIR}/${name}_serial)
+
+  message(STATUS "Checking ${registry}")
+  generate(${registry} ${serial} --threads=1)
+
+  if(registry STREQUAL REGISTRY)
+    if(REFERENCE_DIR)
+      compare(${REFERENCE_DIR} ${serial})
+    endif()
+    if(INCLUDE_DIR)
+      compile_outputs(${serial})
+    endif()
+  endif()
+
+  generate(${registry} ${WORK_DIR}/${name}_threaded)
+  compare(${serial} ${WORK_DIR}/${name}_threaded)
+
+  foreach(seed ${SEEDS})
+    generate(${registry} ${WORK_DIR}/${name}_shuffle_${seed} --shuffle=${seed})
+    compare(${serial} ${WORK_DIR}/${name}_shuffle_${seed})
+  endforeach()
+endforeach()
+
+if(PROFILE_DIR)
+  file(GLOB profiles ${PROFILE_DIR}/*.txt)
+endif()
+foreach(profile ${profiles})
+  get_filename_component(name ${profile} NAME_WE)
+  set(out_dir ${WORK_DIR}/profile_${name})
+
+  message(STATUS "Checking ${profile}")
+  generate(${REGISTRY} ${out_dir} --threads=1 --profile=${profile})
+  compare(${PROFILE_DIR}/${name} ${out_dir})
+  if(INCLUDE_DIR)
+    compile_outputs(${out_dir})
+  endif()
+endforeach()
+
+message(STATUS "All outputs match")
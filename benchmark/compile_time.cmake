@@ -0,0 +1,81 @@
+# Measures what including each generated header costs a translation unit.
+# For every header a source file including only that header is compiled
+# REPEAT times, and the fastest compile is printed next to that of an empty
+# source file. Invoked by the benchmark_compile_time target with COMPILER,
+# COMPILER_ID, FLAGS, VULKAN_DIR, WORK_DIR, HEADERS and REPEAT defined.
+# Headers that do not compile on their own, such as vulkan.hpp without the
+# Vulkan SDK, are skipped.
+
+if(CMAKE_VERSION VERSION_LESS 3.23)
+  message(WARNING "Timing compiles needs CMake 3.23 or newer")
+  return()
+endif()
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+separate_arguments(FLAGS)
+
+# Microseconds since the epoch, cut to the last 12 digits so that they fit
+# in the integers math() uses
+function(now out)
+  string(TIMESTAMP micros "%s%f" UTC)
+  string(LENGTH "${micros}" length)
+  math(EXPR begin "${length} - 12")
+  string(SUBSTRING "${micros}" ${begin} -1 micros)
+  math(EXPR micros "${micros}")
+  set(${out} ${micros} PARENT_SCOPE)
+endfunction()
+
+# Fastest of REPEAT compiles of source in milliseconds, or an empty string if
+# it does not compile
+function(time_compile source out)
+  if(COMPILER_ID STREQUAL "MSVC")
+    set(command ${COMPILER} ${FLAGS} /nologo /c /I${VULKAN_DIR} /Fo${WORK_DIR}/tu.obj ${source})
+  else()
+    set(command ${COMPILER} ${FLAGS} -c -I${VULKAN_DIR} -o ${WORK_DIR}/tu.o ${source})
+  endif()
+
+  set(best "")
+  foreach(i RANGE 1 ${REPEAT})
+    now(begin)
+    execute_process(COMMAND ${command} RESULT_VARIABLE result OUTPUT_QUIET ERROR_QUIET)
+    now(end)
+    if(NOT result EQUAL 0)
+      set(${out} "" PARENT_SCOPE)
+      return()
+    endif()
+    math(EXPR elapsed "${end} - ${begin}")
+    if(elapsed GREATER_EQUAL 0 AND (best STREQUAL "" OR elapsed LESS best))
+      set(best ${elapsed})
+    endif()
+  endforeach()
+
+  math(EXPR whole "${best} / 1000")
+  math(EXPR tenths "${best} % 1000 / 100")
+  set(${out} "${whole}.${tenths}" PARENT_SCOPE)
+endfunction()
+
+file(WRITE ${WORK_DIR}/empty.cpp "")
+time_compile(${WORK_DIR}/empty.cpp empty)
+if(empty STREQUAL "")
+  message(FATAL_ERROR "Failed to compile an empty source file with ${COMPILER}")
+endif()
+
+message("")
+message("header\tms")
+message("(none)\t${empty}")
+foreach(header ${HEADERS})
+  if(NOT EXISTS ${VULKAN_DIR}/${header})
+    continue()
+  endif()
+  string(MAKE_C_IDENTIFIER ${header} name)
+  file(WRITE ${WORK_DIR}/${name}.cpp "#include \"${header}\"\n")
+  time_compile(${WORK_DIR}/${name}.cpp ms)
+  if(ms STREQUAL "")
+    message("${header}\tdoes not compile on its own, skipped")
+  else()
+    message("${header}\t${ms}")
+  endif()
+endforeach()
+message("")
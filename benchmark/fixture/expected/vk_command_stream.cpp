@@ -0,0 +1,99 @@
+#include "vk_command_stream.h"
+
+namespace vkgen {
+
+CommandStream::~CommandStream() {
+  for (auto& chunk : _chunks) {
+    std::free(chunk.data);
+  }
+}
+
+void CommandStream::reset() {
+  for (auto& chunk : _chunks) {
+    chunk.used = 0;
+  }
+  _current = 0;
+}
+
+void CommandStream::_new_chunk(size_t capacity) {
+  void* data = std::malloc(capacity);
+  if (!data) {
+    throw std::bad_alloc();
+  }
+  Chunk chunk = { static_cast<unsigned char*>(data), capacity, 0 };
+  _chunks.push_back(chunk);
+}
+
+void CommandStream::replay(CommandBufferFunctions const& command_buffer) const {
+  for (size_t i = 0; i < _chunks.size() && i <= _current; ++i) {
+    unsigned char const* data = _chunks[i].data;
+    for (size_t offset = 0; offset < _chunks[i].used;) {
+      detail::command_header const* header = reinterpret_cast<detail::command_header const*>(data + offset);
+      switch (header->op) {
+      case CommandOp::vkCmdBindPipeline: {
+        detail::vkCmdBindPipeline_record const* record = reinterpret_cast<detail::vkCmdBindPipeline_record const*>(header);
+        command_buffer.vkCmdBindPipeline(record->pipelineBindPoint, record->pipeline);
+        break;
+      }
+      case CommandOp::vkCmdSetViewport: {
+        detail::vkCmdSetViewport_record const* record = reinterpret_cast<detail::vkCmdSetViewport_record const*>(header);
+        command_buffer.vkCmdSetViewport(record->firstViewport, record->viewportCount, record->pViewports);
+        break;
+      }
+      case CommandOp::vkCmdSetScissor: {
+        detail::vkCmdSetScissor_record const* record = reinterpret_cast<detail::vkCmdSetScissor_record const*>(header);
+        command_buffer.vkCmdSetScissor(record->firstScissor, record->scissorCount, record->pScissors);
+        break;
+      }
+      case CommandOp::vkCmdSetLineWidth: {
+        detail::vkCmdSetLineWidth_record const* record = reinterpret_cast<detail::vkCmdSetLineWidth_record const*>(header);
+        command_buffer.vkCmdSetLineWidth(record->lineWidth);
+        break;
+      }
+      case CommandOp::vkCmdSetBlendConstants: {
+        detail::vkCmdSetBlendConstants_record const* record = reinterpret_cast<detail::vkCmdSetBlendConstants_record const*>(header);
+        command_buffer.vkCmdSetBlendConstants(record->blendConstants);
+        break;
+      }
+      case CommandOp::vkCmdSetStencilReference: {
+        detail::vkCmdSetStencilReference_record const* record = reinterpret_cast<detail::vkCmdSetStencilReference_record const*>(header);
+        command_buffer.vkCmdSetStencilReference(record->faceMask, record->reference);
+        break;
+      }
+      case CommandOp::vkCmdBindDescriptorSets: {
+        detail::vkCmdBindDescriptorSets_record const* record = reinterpret_cast<detail::vkCmdBindDescriptorSets_record const*>(header);
+        command_buffer.vkCmdBindDescriptorSets(record->pipelineBindPoint, record->layout, record->firstSet, record->descriptorSetCount, record->pDescriptorSets, record->dynamicOffsetCount, record->pDynamicOffsets);
+        break;
+      }
+      case CommandOp::vkCmdBindIndexBuffer: {
+        detail::vkCmdBindIndexBuffer_record const* record = reinterpret_cast<detail::vkCmdBindIndexBuffer_record const*>(header);
+        command_buffer.vkCmdBindIndexBuffer(record->buffer, record->offset, record->indexType);
+        break;
+      }
+      case CommandOp::vkCmdBindVertexBuffers: {
+        detail::vkCmdBindVertexBuffers_record const* record = reinterpret_cast<detail::vkCmdBindVertexBuffers_record const*>(header);
+        command_buffer.vkCmdBindVertexBuffers(record->firstBinding, record->bindingCount, record->pBuffers, record->pOffsets);
+        break;
+      }
+      case CommandOp::vkCmdDraw: {
+        detail::vkCmdDraw_record const* record = reinterpret_cast<detail::vkCmdDraw_record const*>(header);
+        command_buffer.vkCmdDraw(record->vertexCount, record->instanceCount, record->firstVertex, record->firstInstance);
+        break;
+      }
+      case CommandOp::vkCmdDrawIndexed: {
+        detail::vkCmdDrawIndexed_record const* record = reinterpret_cast<detail::vkCmdDrawIndexed_record const*>(header);
+        command_buffer.vkCmdDrawIndexed(record->indexCount, record->instanceCount, record->firstIndex, record->vertexOffset, record->firstInstance);
+        break;
+      }
+      case CommandOp::vkCmdPushConstants: {
+        detail::vkCmdPushConstants_record const* record = reinterpret_cast<detail::vkCmdPushConstants_record const*>(header);
+        command_buffer.vkCmdPushConstants(record->layout, record->stageFlags, record->offset, record->size, record->pValues);
+        break;
+      }
+      }
+      offset += header->size;
+    }
+  }
+}
+
+} // vkgen
@@ -0,0 +1,345 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Command streams for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_COMMAND_STREAM_INCLUDE
+#define VK_COMMAND_STREAM_INCLUDE
+
+#include "vk_deep_copy.h"
+#include "vk_dispatch_tables.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace vkgen {
+
+// vkgen::CommandStream records commands for a command buffer without calling
+// into the driver, so that commands can be prepared on any thread and handed
+// to the threads that own the command buffers. Recording a command bumps a
+// pointer and stores the arguments; arrays, strings and structs the command
+// reads are copied into the stream the way vkgen::deep_copy copies them, so
+// the caller's data may go away right after recording. Other pointers, such
+// as pointers to data of unknown size, are stored as they are and must stay
+// valid until the stream has been replayed.
+//
+// replay calls the recorded commands, in order, on the command buffer of a
+// dispatch table. It may be called any number of times, from any thread and
+// concurrently, as long as nothing is being recorded at the same time. reset
+// empties the stream but keeps its memory for recording again.
+//
+// Opcodes depend on the platform defines of the build, so streams are only
+// meant to be replayed by the program that recorded them.
+
+enum class CommandOp : uint32_t {
+  vkCmdBindPipeline,
+  vkCmdSetViewport,
+  vkCmdSetScissor,
+  vkCmdSetLineWidth,
+  vkCmdSetBlendConstants,
+  vkCmdSetStencilReference,
+  vkCmdBindDescriptorSets,
+  vkCmdBindIndexBuffer,
+  vkCmdBindVertexBuffers,
+  vkCmdDraw,
+  vkCmdDrawIndexed,
+  vkCmdPushConstants,
+};
+
+namespace detail {
+
+// Records are packed at the alignment of the largest Vulkan scalars. Untyped
+// data such as push constants is copied byte by byte and needs no more.
+static size_t const record_alignment = 8;
+
+// Begins every record. |size| includes the data copied behind the record and
+// the padding up to the next record.
+struct command_header {
+  CommandOp op;
+  uint32_t size;
+};
+
+struct vkCmdBindPipeline_record {
+  command_header header;
+  VkPipelineBindPoint pipelineBindPoint;
+  VkPipeline pipeline;
+};
+
+struct vkCmdSetViewport_record {
+  command_header header;
+  uint32_t firstViewport;
+  uint32_t viewportCount;
+  const VkViewport* pViewports;
+};
+
+struct vkCmdSetScissor_record {
+  command_header header;
+  uint32_t firstScissor;
+  uint32_t scissorCount;
+  const VkRect2D* pScissors;
+};
+
+struct vkCmdSetLineWidth_record {
+  command_header header;
+  float lineWidth;
+};
+
+struct vkCmdSetBlendConstants_record {
+  command_header header;
+  float blendConstants[4];
+};
+
+struct vkCmdSetStencilReference_record {
+  command_header header;
+  VkStencilFaceFlags faceMask;
+  uint32_t reference;
+};
+
+struct vkCmdBindDescriptorSets_record {
+  command_header header;
+  VkPipelineBindPoint pipelineBindPoint;
+  VkPipelineLayout layout;
+  uint32_t firstSet;
+  uint32_t descriptorSetCount;
+  const VkDescriptorSet* pDescriptorSets;
+  uint32_t dynamicOffsetCount;
+  const uint32_t* pDynamicOffsets;
+};
+
+struct vkCmdBindIndexBuffer_record {
+  command_header header;
+  VkBuffer buffer;
+  VkDeviceSize offset;
+  VkIndexType indexType;
+};
+
+struct vkCmdBindVertexBuffers_record {
+  command_header header;
+  uint32_t firstBinding;
+  uint32_t bindingCount;
+  const VkBuffer* pBuffers;
+  const VkDeviceSize* pOffsets;
+};
+
+struct vkCmdDraw_record {
+  command_header header;
+  uint32_t vertexCount;
+  uint32_t instanceCount;
+  uint32_t firstVertex;
+  uint32_t firstInstance;
+};
+
+struct vkCmdDrawIndexed_record {
+  command_header header;
+  uint32_t indexCount;
+  uint32_t instanceCount;
+  uint32_t firstIndex;
+  int32_t vertexOffset;
+  uint32_t firstInstance;
+};
+
+struct vkCmdPushConstants_record {
+  command_header header;
+  VkPipelineLayout layout;
+  VkShaderStageFlags stageFlags;
+  uint32_t offset;
+  uint32_t size;
+  const void* pValues;
+};
+
+} // detail
+
+class CommandStream {
+public:
+  explicit CommandStream(size_t chunk_size = 64 * 1024) : _chunk_size(chunk_size) {}
+  ~CommandStream();
+  CommandStream(CommandStream const&) = delete;
+  CommandStream& operator=(CommandStream const&) = delete;
+
+  void vkCmdBindPipeline(VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline);
+  void vkCmdSetViewport(uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports);
+  void vkCmdSetScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors);
+  void vkCmdSetLineWidth(float lineWidth);
+  void vkCmdSetBlendConstants(const float blendConstants[4]);
+  void vkCmdSetStencilReference(VkStencilFaceFlags faceMask, uint32_t reference);
+  void vkCmdBindDescriptorSets(VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets);
+  void vkCmdBindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType);
+  void vkCmdBindVertexBuffers(uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets);
+  void vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
+  void vkCmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance);
+  void vkCmdPushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues);
+
+  void replay(CommandBufferFunctions const& command_buffer) const;
+  void reset();
+  bool empty() const { return _chunks.empty() || (_current == 0 && _chunks[0].used == 0); }
+
+private:
+  // Records are laid out back to back in each chunk, and chunks are replayed
+  // in order up to the current one. Chunks never move, so pointers into them
+  // stay valid while more commands are recorded.
+  struct Chunk {
+    unsigned char* data;
+    size_t capacity;
+    size_t used;
+  };
+
+  // Returns a block of |size| bytes beginning with the header of a record
+  void* _record(CommandOp op, size_t size) {
+    size = detail::align(size, detail::record_alignment);
+    while (_current < _chunks.size() && _chunks[_current].used + size > _chunks[_current].capacity) {
+      ++_current;
+    }
+    if (_current == _chunks.size()) {
+      _new_chunk(std::max(size, _chunk_size));
+    }
+
+    Chunk& chunk = _chunks[_current];
+    detail::command_header* header = reinterpret_cast<detail::command_header*>(chunk.data + chunk.used);
+    header->op = op;
+    header->size = static_cast<uint32_t>(size);
+    chunk.used += size;
+    return header;
+  }
+
+  void _new_chunk(size_t capacity);
+
+private:
+  std::vector<Chunk> _chunks;
+  size_t _current = 0;
+  size_t _chunk_size;
+};
+
+inline void CommandStream::vkCmdBindPipeline(VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+  size_t record_size = sizeof(detail::vkCmdBindPipeline_record);
+  detail::cursor block(_record(CommandOp::vkCmdBindPipeline, record_size));
+  detail::vkCmdBindPipeline_record* record = block.take<detail::vkCmdBindPipeline_record>(1);
+  record->pipelineBindPoint = pipelineBindPoint;
+  record->pipeline = pipeline;
+}
+
+inline void CommandStream::vkCmdSetViewport(uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) {
+  size_t record_size = sizeof(detail::vkCmdSetViewport_record);
+  record_size = detail::size_each<deep_copier<VkViewport>>(record_size, pViewports, viewportCount);
+  detail::cursor block(_record(CommandOp::vkCmdSetViewport, record_size));
+  detail::vkCmdSetViewport_record* record = block.take<detail::vkCmdSetViewport_record>(1);
+  record->firstViewport = firstViewport;
+  record->viewportCount = viewportCount;
+  record->pViewports = detail::copy_each<deep_copier<VkViewport>>(block, pViewports, viewportCount);
+}
+
+inline void CommandStream::vkCmdSetScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) {
+  size_t record_size = sizeof(detail::vkCmdSetScissor_record);
+  record_size = detail::size_each<deep_copier<VkRect2D>>(record_size, pScissors, scissorCount);
+  detail::cursor block(_record(CommandOp::vkCmdSetScissor, record_size));
+  detail::vkCmdSetScissor_record* record = block.take<detail::vkCmdSetScissor_record>(1);
+  record->firstScissor = firstScissor;
+  record->scissorCount = scissorCount;
+  record->pScissors = detail::copy_each<deep_copier<VkRect2D>>(block, pScissors, scissorCount);
+}
+
+inline void CommandStream::vkCmdSetLineWidth(float lineWidth) {
+  size_t record_size = sizeof(detail::vkCmdSetLineWidth_record);
+  detail::cursor block(_record(CommandOp::vkCmdSetLineWidth, record_size));
+  detail::vkCmdSetLineWidth_record* record = block.take<detail::vkCmdSetLineWidth_record>(1);
+  record->lineWidth = lineWidth;
+}
+
+inline void CommandStream::vkCmdSetBlendConstants(const float blendConstants[4]) {
+  size_t record_size = sizeof(detail::vkCmdSetBlendConstants_record);
+  detail::cursor block(_record(CommandOp::vkCmdSetBlendConstants, record_size));
+  detail::vkCmdSetBlendConstants_record* record = block.take<detail::vkCmdSetBlendConstants_record>(1);
+  std::memcpy(record->blendConstants, blendConstants, sizeof(record->blendConstants));
+}
+
+inline void CommandStream::vkCmdSetStencilReference(VkStencilFaceFlags faceMask, uint32_t reference) {
+  size_t record_size = sizeof(detail::vkCmdSetStencilReference_record);
+  detail::cursor block(_record(CommandOp::vkCmdSetStencilReference, record_size));
+  detail::vkCmdSetStencilReference_record* record = block.take<detail::vkCmdSetStencilReference_record>(1);
+  record->faceMask = faceMask;
+  record->reference = reference;
+}
+
+inline void CommandStream::vkCmdBindDescriptorSets(VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) {
+  size_t record_size = sizeof(detail::vkCmdBindDescriptorSets_record);
+  record_size = detail::size_range(record_size, pDescriptorSets, descriptorSetCount);
+  record_size = detail::size_range(record_size, pDynamicOffsets, dynamicOffsetCount);
+  detail::cursor block(_record(CommandOp::vkCmdBindDescriptorSets, record_size));
+  detail::vkCmdBindDescriptorSets_record* record = block.take<detail::vkCmdBindDescriptorSets_record>(1);
+  record->pipelineBindPoint = pipelineBindPoint;
+  record->layout = layout;
+  record->firstSet = firstSet;
+  record->descriptorSetCount = descriptorSetCount;
+  record->pDescriptorSets = detail::copy_range(block, pDescriptorSets, descriptorSetCount);
+  record->dynamicOffsetCount = dynamicOffsetCount;
+  record->pDynamicOffsets = detail::copy_range(block, pDynamicOffsets, dynamicOffsetCount);
+}
+
+inline void CommandStream::vkCmdBindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
+  size_t record_size = sizeof(detail::vkCmdBindIndexBuffer_record);
+  detail::cursor block(_record(CommandOp::vkCmdBindIndexBuffer, record_size));
+  detail::vkCmdBindIndexBuffer_record* record = block.take<detail::vkCmdBindIndexBuffer_record>(1);
+  record->buffer = buffer;
+  record->offset = offset;
+  record->indexType = indexType;
+}
+
+inline void CommandStream::vkCmdBindVertexBuffers(uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {
+  size_t record_size = sizeof(detail::vkCmdBindVertexBuffers_record);
+  record_size = detail::size_range(record_size, pBuffers, bindingCount);
+  record_size = detail::size_range(record_size, pOffsets, bindingCount);
+  detail::cursor block(_record(CommandOp::vkCmdBindVertexBuffers, record_size));
+  detail::vkCmdBindVertexBuffers_record* record = block.take<detail::vkCmdBindVertexBuffers_record>(1);
+  record->firstBinding = firstBinding;
+  record->bindingCount = bindingCount;
+  record->pBuffers = detail::copy_range(block, pBuffers, bindingCount);
+  record->pOffsets = detail::copy_range(block, pOffsets, bindingCount);
+}
+
+inline void CommandStream::vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+  size_t record_size = sizeof(detail::vkCmdDraw_record);
+  detail::cursor block(_record(CommandOp::vkCmdDraw, record_size));
+  detail::vkCmdDraw_record* record = block.take<detail::vkCmdDraw_record>(1);
+  record->vertexCount = vertexCount;
+  record->instanceCount = instanceCount;
+  record->firstVertex = firstVertex;
+  record->firstInstance = firstInstance;
+}
+
+inline void CommandStream::vkCmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+  size_t record_size = sizeof(detail::vkCmdDrawIndexed_record);
+  detail::cursor block(_record(CommandOp::vkCmdDrawIndexed, record_size));
+  detail::vkCmdDrawIndexed_record* record = block.take<detail::vkCmdDrawIndexed_record>(1);
+  record->indexCount = indexCount;
+  record->instanceCount = instanceCount;
+  record->firstIndex = firstIndex;
+  record->vertexOffset = vertexOffset;
+  record->firstInstance = firstInstance;
+}
+
+inline void CommandStream::vkCmdPushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) {
+  size_t record_size = sizeof(detail::vkCmdPushConstants_record);
+  record_size = detail::size_range(record_size, pValues, size);
+  detail::cursor block(_record(CommandOp::vkCmdPushConstants, record_size));
+  detail::vkCmdPushConstants_record* record = block.take<detail::vkCmdPushConstants_record>(1);
+  record->layout = layout;
+  record->stageFlags = stageFlags;
+  record->offset = offset;
+  record->size = size;
+  record->pValues = detail::copy_range(block, pValues, size);
+}
+
+} // vkgen
+
+#endif // VK_COMMAND_STREAM_INCLUDE
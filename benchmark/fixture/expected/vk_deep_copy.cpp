@@ -0,0 +1,57 @@
+#include "vk_deep_copy.h"
+
+namespace vkgen {
+
+template VkApplicationInfo* deep_copy<VkApplicationInfo>(VkApplicationInfo const&, Arena&);
+template VkInstanceCreateInfo* deep_copy<VkInstanceCreateInfo>(VkInstanceCreateInfo const&, Arena&);
+template VkAllocationCallbacks* deep_copy<VkAllocationCallbacks>(VkAllocationCallbacks const&, Arena&);
+template VkPhysicalDeviceFeatures* deep_copy<VkPhysicalDeviceFeatures>(VkPhysicalDeviceFeatures const&, Arena&);
+template VkExtent3D* deep_copy<VkExtent3D>(VkExtent3D const&, Arena&);
+template VkQueueFamilyProperties* deep_copy<VkQueueFamilyProperties>(VkQueueFamilyProperties const&, Arena&);
+template VkDeviceQueueCreateInfo* deep_copy<VkDeviceQueueCreateInfo>(VkDeviceQueueCreateInfo const&, Arena&);
+template VkDeviceCreateInfo* deep_copy<VkDeviceCreateInfo>(VkDeviceCreateInfo const&, Arena&);
+template VkExtensionProperties* deep_copy<VkExtensionProperties>(VkExtensionProperties const&, Arena&);
+template VkLayerProperties* deep_copy<VkLayerProperties>(VkLayerProperties const&, Arena&);
+template VkSubmitInfo* deep_copy<VkSubmitInfo>(VkSubmitInfo const&, Arena&);
+template VkSamplerCreateInfo* deep_copy<VkSamplerCreateInfo>(VkSamplerCreateInfo const&, Arena&);
+template VkDescriptorSetLayoutBinding* deep_copy<VkDescriptorSetLayoutBinding>(VkDescriptorSetLayoutBinding const&, Arena&);
+template VkDescriptorSetLayoutCreateInfo* deep_copy<VkDescriptorSetLayoutCreateInfo>(VkDescriptorSetLayoutCreateInfo const&, Arena&);
+template VkPushConstantRange* deep_copy<VkPushConstantRange>(VkPushConstantRange const&, Arena&);
+template VkPipelineLayoutCreateInfo* deep_copy<VkPipelineLayoutCreateInfo>(VkPipelineLayoutCreateInfo const&, Arena&);
+template VkShaderModuleCreateInfo* deep_copy<VkShaderModuleCreateInfo>(VkShaderModuleCreateInfo const&, Arena&);
+template VkSpecializationMapEntry* deep_copy<VkSpecializationMapEntry>(VkSpecializationMapEntry const&, Arena&);
+template VkSpecializationInfo* deep_copy<VkSpecializationInfo>(VkSpecializationInfo const&, Arena&);
+template VkPipelineShaderStageCreateInfo* deep_copy<VkPipelineShaderStageCreateInfo>(VkPipelineShaderStageCreateInfo const&, Arena&);
+template VkVertexInputBindingDescription* deep_copy<VkVertexInputBindingDescription>(VkVertexInputBindingDescription const&, Arena&);
+template VkVertexInputAttributeDescription* deep_copy<VkVertexInputAttributeDescription>(VkVertexInputAttributeDescription const&, Arena&);
+template VkPipelineVertexInputStateCreateInfo* deep_copy<VkPipelineVertexInputStateCreateInfo>(VkPipelineVertexInputStateCreateInfo const&, Arena&);
+template VkPipelineInputAssemblyStateCreateInfo* deep_copy<VkPipelineInputAssemblyStateCreateInfo>(VkPipelineInputAssemblyStateCreateInfo const&, Arena&);
+template VkPipelineTessellationStateCreateInfo* deep_copy<VkPipelineTessellationStateCreateInfo>(VkPipelineTessellationStateCreateInfo const&, Arena&);
+template VkViewport* deep_copy<VkViewport>(VkViewport const&, Arena&);
+template VkOffset2D* deep_copy<VkOffset2D>(VkOffset2D const&, Arena&);
+template VkExtent2D* deep_copy<VkExtent2D>(VkExtent2D const&, Arena&);
+template VkRect2D* deep_copy<VkRect2D>(VkRect2D const&, Arena&);
+template VkPipelineViewportStateCreateInfo* deep_copy<VkPipelineViewportStateCreateInfo>(VkPipelineViewportStateCreateInfo const&, Arena&);
+template VkPipelineRasterizationStateCreateInfo* deep_copy<VkPipelineRasterizationStateCreateInfo>(VkPipelineRasterizationStateCreateInfo const&, Arena&);
+template VkPipelineMultisampleStateCreateInfo* deep_copy<VkPipelineMultisampleStateCreateInfo>(VkPipelineMultisampleStateCreateInfo const&, Arena&);
+template VkStencilOpState* deep_copy<VkStencilOpState>(VkStencilOpState const&, Arena&);
+template VkPipelineDepthStencilStateCreateInfo* deep_copy<VkPipelineDepthStencilStateCreateInfo>(VkPipelineDepthStencilStateCreateInfo const&, Arena&);
+template VkPipelineColorBlendAttachmentState* deep_copy<VkPipelineColorBlendAttachmentState>(VkPipelineColorBlendAttachmentState const&, Arena&);
+template VkPipelineColorBlendStateCreateInfo* deep_copy<VkPipelineColorBlendStateCreateInfo>(VkPipelineColorBlendStateCreateInfo const&, Arena&);
+template VkPipelineDynamicStateCreateInfo* deep_copy<VkPipelineDynamicStateCreateInfo>(VkPipelineDynamicStateCreateInfo const&, Arena&);
+template VkGraphicsPipelineCreateInfo* deep_copy<VkGraphicsPipelineCreateInfo>(VkGraphicsPipelineCreateInfo const&, Arena&);
+template VkCommandPoolCreateInfo* deep_copy<VkCommandPoolCreateInfo>(VkCommandPoolCreateInfo const&, Arena&);
+template VkCommandBufferAllocateInfo* deep_copy<VkCommandBufferAllocateInfo>(VkCommandBufferAllocateInfo const&, Arena&);
+template VkCommandBufferInheritanceInfo* deep_copy<VkCommandBufferInheritanceInfo>(VkCommandBufferInheritanceInfo const&, Arena&);
+template VkCommandBufferBeginInfo* deep_copy<VkCommandBufferBeginInfo>(VkCommandBufferBeginInfo const&, Arena&);
+template VkClearColorValue* deep_copy<VkClearColorValue>(VkClearColorValue const&, Arena&);
+template VkSurfaceCapabilitiesKHR* deep_copy<VkSurfaceCapabilitiesKHR>(VkSurfaceCapabilitiesKHR const&, Arena&);
+template VkSurfaceFormatKHR* deep_copy<VkSurfaceFormatKHR>(VkSurfaceFormatKHR const&, Arena&);
+template VkSwapchainCreateInfoKHR* deep_copy<VkSwapchainCreateInfoKHR>(VkSwapchainCreateInfoKHR const&, Arena&);
+template VkPresentInfoKHR* deep_copy<VkPresentInfoKHR>(VkPresentInfoKHR const&, Arena&);
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+template VkXlibSurfaceCreateInfoKHR* deep_copy<VkXlibSurfaceCreateInfoKHR>(VkXlibSurfaceCreateInfoKHR const&, Arena&);
+#endif
+template VkValidationFlagsEXT* deep_copy<VkValidationFlagsEXT>(VkValidationFlagsEXT const&, Arena&);
+
+} // vkgen
@@ -0,0 +1,476 @@
+#include "vk_dispatch_tables.h"
+
+#include <stdexcept>
+#if defined(_WIN32)
+#include <Windows.h>
+#elif defined(__linux__)
+#include <dlfcn.h>
+#endif
+
+namespace vkgen {
+
+/*
+ * ------------------------------------------------------
+ * GlobalFunctions
+ * ------------------------------------------------------
+*/
+
+GlobalFunctions::GlobalFunctions(std::string const& vulkan_library) {
+#if defined(_WIN32)
+  library_ = LoadLibraryA(vulkan_library.c_str());
+#elif defined(__linux__)
+  library_ = dlopen(vulkan_library.c_str(), RTLD_NOW);
+#else
+#error "Unsupported OS"
+#endif
+
+  if (!library_) {
+    throw std::runtime_error("Could not load Vulkan loader.");
+  }
+
+#if defined(_WIN32)
+  vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
+      GetProcAddress(static_cast<HMODULE>(library_), "vkGetInstanceProcAddr"));
+#elif defined(__linux__)
+  vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
+      dlsym(library_, "vkGetInstanceProcAddr"));
+#else
+#error "Unsupported OS"
+#endif
+
+  if (!vkGetInstanceProcAddr_) {
+    throw VulkanProcNotFound("vkGetInstanceProcAddr");
+  }
+
+  vkCreateInstance_ = reinterpret_cast<PFN_vkCreateInstance>(this->vkGetInstanceProcAddr(nullptr, "vkCreateInstance"));
+  if (!vkCreateInstance_) {
+    throw VulkanProcNotFound("vkCreateInstance");
+  }
+  vkEnumerateInstanceExtensionProperties_ = reinterpret_cast<PFN_vkEnumerateInstanceExtensionProperties>(this->vkGetInstanceProcAddr(nullptr, "vkEnumerateInstanceExtensionProperties"));
+  if (!vkEnumerateInstanceExtensionProperties_) {
+    throw VulkanProcNotFound("vkEnumerateInstanceExtensionProperties");
+  }
+  vkEnumerateInstanceLayerProperties_ = reinterpret_cast<PFN_vkEnumerateInstanceLayerProperties>(this->vkGetInstanceProcAddr(nullptr, "vkEnumerateInstanceLayerProperties"));
+  if (!vkEnumerateInstanceLayerProperties_) {
+    throw VulkanProcNotFound("vkEnumerateInstanceLayerProperties");
+  }
+}
+
+GlobalFunctions::~GlobalFunctions() {
+#if defined(_WIN32)
+  FreeLibrary(static_cast<HMODULE>(library_));
+#elif defined(__linux__)
+  dlclose(library_);
+#else
+#error "Unsupported OS"
+#endif
+}
+
+PFN_vkVoidFunction GlobalFunctions::vkGetInstanceProcAddr(VkInstance instance, const char* pName) const {
+  return this->vkGetInstanceProcAddr_(instance, pName);
+}
+
+VkResult GlobalFunctions::vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) const {
+  return this->vkCreateInstance_(pCreateInfo, pAllocator, pInstance);
+}
+
+VkResult GlobalFunctions::vkEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) const {
+  return this->vkEnumerateInstanceExtensionProperties_(pLayerName, pPropertyCount, pProperties);
+}
+
+VkResult GlobalFunctions::vkEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties) const {
+  return this->vkEnumerateInstanceLayerProperties_(pPropertyCount, pProperties);
+}
+
+/*
+ * ------------------------------------------------------
+ * InstanceFunctions
+ * ------------------------------------------------------
+*/
+
+PFN_vkVoidFunction InstanceFunctions::vkGetInstanceProcAddr(const char* pName) const {
+  return this->vkGetInstanceProcAddr_(instance_, pName);
+}
+
+void InstanceFunctions::vkDestroyInstance(const VkAllocationCallbacks* pAllocator) const {
+  return this->vkDestroyInstance_(instance_, pAllocator);
+}
+
+VkResult InstanceFunctions::vkEnumeratePhysicalDevices(uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) const {
+  return this->vkEnumeratePhysicalDevices_(instance_, pPhysicalDeviceCount, pPhysicalDevices);
+}
+
+void InstanceFunctions::vkDestroySurfaceKHR(VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator) const {
+  return this->vkDestroySurfaceKHR_(instance_, surface, pAllocator);
+}
+
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+VkResult InstanceFunctions::vkCreateXlibSurfaceKHR(const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const {
+  return this->vkCreateXlibSurfaceKHR_(instance_, pCreateInfo, pAllocator, pSurface);
+}
+#endif
+
+InstanceFunctions::InstanceFunctions(VkInstance instance, GlobalFunctions* globals) {
+  instance_ = instance;
+  vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(globals->vkGetInstanceProcAddr(instance, "vkGetInstanceProcAddr"));
+  if (!vkGetInstanceProcAddr_) {
+    throw VulkanProcNotFound("vkGetInstanceProcAddr");
+  }
+  vkDestroyInstance_ = reinterpret_cast<PFN_vkDestroyInstance>(this->vkGetInstanceProcAddr("vkDestroyInstance"));
+  if (!vkDestroyInstance_) {
+    throw VulkanProcNotFound("vkDestroyInstance");
+  }
+  vkEnumeratePhysicalDevices_ = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(this->vkGetInstanceProcAddr("vkEnumeratePhysicalDevices"));
+  if (!vkEnumeratePhysicalDevices_) {
+    throw VulkanProcNotFound("vkEnumeratePhysicalDevices");
+  }
+  vkDestroySurfaceKHR_ = reinterpret_cast<PFN_vkDestroySurfaceKHR>(this->vkGetInstanceProcAddr("vkDestroySurfaceKHR"));
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  vkCreateXlibSurfaceKHR_ = reinterpret_cast<PFN_vkCreateXlibSurfaceKHR>(this->vkGetInstanceProcAddr("vkCreateXlibSurfaceKHR"));
+#endif
+}
+
+/*
+ * ------------------------------------------------------
+ * PhysicalDeviceFunctions
+ * ------------------------------------------------------
+*/
+
+void PhysicalDeviceFunctions::vkGetPhysicalDeviceFeatures(VkPhysicalDeviceFeatures* pFeatures) const {
+  return this->vkGetPhysicalDeviceFeatures_(physical_device_, pFeatures);
+}
+
+void PhysicalDeviceFunctions::vkGetPhysicalDeviceQueueFamilyProperties(uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) const {
+  return this->vkGetPhysicalDeviceQueueFamilyProperties_(physical_device_, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+VkResult PhysicalDeviceFunctions::vkCreateDevice(const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const {
+  return this->vkCreateDevice_(physical_device_, pCreateInfo, pAllocator, pDevice);
+}
+
+VkResult PhysicalDeviceFunctions::vkEnumerateDeviceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) const {
+  return this->vkEnumerateDeviceExtensionProperties_(physical_device_, pLayerName, pPropertyCount, pProperties);
+}
+
+VkResult PhysicalDeviceFunctions::vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) const {
+  return this->vkGetPhysicalDeviceSurfaceCapabilitiesKHR_(physical_device_, surface, pSurfaceCapabilities);
+}
+
+VkResult PhysicalDeviceFunctions::vkGetPhysicalDeviceSurfaceFormatsKHR(VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) const {
+  return this->vkGetPhysicalDeviceSurfaceFormatsKHR_(physical_device_, surface, pSurfaceFormatCount, pSurfaceFormats);
+}
+
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+VkBool32 PhysicalDeviceFunctions::vkGetPhysicalDeviceXlibPresentationSupportKHR(uint32_t queueFamilyIndex, Display* dpy, VisualID visualID) const {
+  return this->vkGetPhysicalDeviceXlibPresentationSupportKHR_(physical_device_, queueFamilyIndex, dpy, visualID);
+}
+#endif
+
+PhysicalDeviceFunctions::PhysicalDeviceFunctions(VkPhysicalDevice physical_device, InstanceFunctions* instance) {
+  physical_device_ = physical_device;
+  vkGetPhysicalDeviceFeatures_ = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures>(instance->vkGetInstanceProcAddr("vkGetPhysicalDeviceFeatures"));
+  if (!vkGetPhysicalDeviceFeatures_) {
+    throw VulkanProcNotFound("vkGetPhysicalDeviceFeatures");
+  }
+  vkGetPhysicalDeviceQueueFamilyProperties_ = reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties>(instance->vkGetInstanceProcAddr("vkGetPhysicalDeviceQueueFamilyProperties"));
+  if (!vkGetPhysicalDeviceQueueFamilyProperties_) {
+    throw VulkanProcNotFound("vkGetPhysicalDeviceQueueFamilyProperties");
+  }
+  vkCreateDevice_ = reinterpret_cast<PFN_vkCreateDevice>(instance->vkGetInstanceProcAddr("vkCreateDevice"));
+  if (!vkCreateDevice_) {
+    throw VulkanProcNotFound("vkCreateDevice");
+  }
+  vkEnumerateDeviceExtensionProperties_ = reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(instance->vkGetInstanceProcAddr("vkEnumerateDeviceExtensionProperties"));
+  if (!vkEnumerateDeviceExtensionProperties_) {
+    throw VulkanProcNotFound("vkEnumerateDeviceExtensionProperties");
+  }
+  vkGetPhysicalDeviceSurfaceCapabilitiesKHR_ = reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR>(instance->vkGetInstanceProcAddr("vkGetPhysicalDeviceSurfaceCapabilitiesKHR"));
+  vkGetPhysicalDeviceSurfaceFormatsKHR_ = reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceFormatsKHR>(instance->vkGetInstanceProcAddr("vkGetPhysicalDeviceSurfaceFormatsKHR"));
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  vkGetPhysicalDeviceXlibPresentationSupportKHR_ = reinterpret_cast<PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR>(instance->vkGetInstanceProcAddr("vkGetPhysicalDeviceXlibPresentationSupportKHR"));
+#endif
+}
+
+/*
+ * ------------------------------------------------------
+ * DeviceFunctions
+ * ------------------------------------------------------
+*/
+
+PFN_vkVoidFunction DeviceFunctions::vkGetDeviceProcAddr(const char* pName) const {
+  return this->vkGetDeviceProcAddr_(device_, pName);
+}
+
+void DeviceFunctions::vkDestroyDevice(const VkAllocationCallbacks* pAllocator) const {
+  return this->vkDestroyDevice_(device_, pAllocator);
+}
+
+void DeviceFunctions::vkGetDeviceQueue(uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) const {
+  return this->vkGetDeviceQueue_(device_, queueFamilyIndex, queueIndex, pQueue);
+}
+
+VkResult DeviceFunctions::vkDeviceWaitIdle() const {
+  return this->vkDeviceWaitIdle_(device_);
+}
+
+VkResult DeviceFunctions::vkCreateSampler(const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) const {
+  return this->vkCreateSampler_(device_, pCreateInfo, pAllocator, pSampler);
+}
+
+void DeviceFunctions::vkDestroySampler(VkSampler sampler, const VkAllocationCallbacks* pAllocator) const {
+  return this->vkDestroySampler_(device_, sampler, pAllocator);
+}
+
+VkResult DeviceFunctions::vkCreateDescriptorSetLayout(const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) const {
+  return this->vkCreateDescriptorSetLayout_(device_, pCreateInfo, pAllocator, pSetLayout);
+}
+
+VkResult DeviceFunctions::vkCreatePipelineLayout(const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) const {
+  return this->vkCreatePipelineLayout_(device_, pCreateInfo, pAllocator, pPipelineLayout);
+}
+
+VkResult DeviceFunctions::vkCreateShaderModule(const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const {
+  return this->vkCreateShaderModule_(device_, pCreateInfo, pAllocator, pShaderModule);
+}
+
+VkResult DeviceFunctions::vkCreateGraphicsPipelines(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const {
+  return this->vkCreateGraphicsPipelines_(device_, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+void DeviceFunctions::vkDestroyPipeline(VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) const {
+  return this->vkDestroyPipeline_(device_, pipeline, pAllocator);
+}
+
+VkResult DeviceFunctions::vkCreateCommandPool(const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) const {
+  return this->vkCreateCommandPool_(device_, pCreateInfo, pAllocator, pCommandPool);
+}
+
+VkResult DeviceFunctions::vkAllocateCommandBuffers(const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) const {
+  return this->vkAllocateCommandBuffers_(device_, pAllocateInfo, pCommandBuffers);
+}
+
+VkResult DeviceFunctions::vkCreateSwapchainKHR(const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) const {
+  return this->vkCreateSwapchainKHR_(device_, pCreateInfo, pAllocator, pSwapchain);
+}
+
+void DeviceFunctions::vkDestroySwapchainKHR(VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) const {
+  return this->vkDestroySwapchainKHR_(device_, swapchain, pAllocator);
+}
+
+VkResult DeviceFunctions::vkGetSwapchainImagesKHR(VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) const {
+  return this->vkGetSwapchainImagesKHR_(device_, swapchain, pSwapchainImageCount, pSwapchainImages);
+}
+
+DeviceFunctions::DeviceFunctions(VkDevice device, InstanceFunctions* instance) {
+  device_ = device;
+  vkGetDeviceProcAddr_ = reinterpret_cast<PFN_vkGetDeviceProcAddr>(instance->vkGetInstanceProcAddr("vkGetDeviceProcAddr"));
+  if (!vkGetDeviceProcAddr_) {
+    throw VulkanProcNotFound("vkGetDeviceProcAddr");
+  }
+  vkDestroyDevice_ = reinterpret_cast<PFN_vkDestroyDevice>(this->vkGetDeviceProcAddr("vkDestroyDevice"));
+  if (!vkDestroyDevice_) {
+    throw VulkanProcNotFound("vkDestroyDevice");
+  }
+  vkGetDeviceQueue_ = reinterpret_cast<PFN_vkGetDeviceQueue>(this->vkGetDeviceProcAddr("vkGetDeviceQueue"));
+  if (!vkGetDeviceQueue_) {
+    throw VulkanProcNotFound("vkGetDeviceQueue");
+  }
+  vkDeviceWaitIdle_ = reinterpret_cast<PFN_vkDeviceWaitIdle>(this->vkGetDeviceProcAddr("vkDeviceWaitIdle"));
+  if (!vkDeviceWaitIdle_) {
+    throw VulkanProcNotFound("vkDeviceWaitIdle");
+  }
+  vkCreateSampler_ = reinterpret_cast<PFN_vkCreateSampler>(this->vkGetDeviceProcAddr("vkCreateSampler"));
+  if (!vkCreateSampler_) {
+    throw VulkanProcNotFound("vkCreateSampler");
+  }
+  vkDestroySampler_ = reinterpret_cast<PFN_vkDestroySampler>(this->vkGetDeviceProcAddr("vkDestroySampler"));
+  if (!vkDestroySampler_) {
+    throw VulkanProcNotFound("vkDestroySampler");
+  }
+  vkCreateDescriptorSetLayout_ = reinterpret_cast<PFN_vkCreateDescriptorSetLayout>(this->vkGetDeviceProcAddr("vkCreateDescriptorSetLayout"));
+  if (!vkCreateDescriptorSetLayout_) {
+    throw VulkanProcNotFound("vkCreateDescriptorSetLayout");
+  }
+  vkCreatePipelineLayout_ = reinterpret_cast<PFN_vkCreatePipelineLayout>(this->vkGetDeviceProcAddr("vkCreatePipelineLayout"));
+  if (!vkCreatePipelineLayout_) {
+    throw VulkanProcNotFound("vkCreatePipelineLayout");
+  }
+  vkCreateShaderModule_ = reinterpret_cast<PFN_vkCreateShaderModule>(this->vkGetDeviceProcAddr("vkCreateShaderModule"));
+  if (!vkCreateShaderModule_) {
+    throw VulkanProcNotFound("vkCreateShaderModule");
+  }
+  vkCreateGraphicsPipelines_ = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(this->vkGetDeviceProcAddr("vkCreateGraphicsPipelines"));
+  if (!vkCreateGraphicsPipelines_) {
+    throw VulkanProcNotFound("vkCreateGraphicsPipelines");
+  }
+  vkDestroyPipeline_ = reinterpret_cast<PFN_vkDestroyPipeline>(this->vkGetDeviceProcAddr("vkDestroyPipeline"));
+  if (!vkDestroyPipeline_) {
+    throw VulkanProcNotFound("vkDestroyPipeline");
+  }
+  vkCreateCommandPool_ = reinterpret_cast<PFN_vkCreateCommandPool>(this->vkGetDeviceProcAddr("vkCreateCommandPool"));
+  if (!vkCreateCommandPool_) {
+    throw VulkanProcNotFound("vkCreateCommandPool");
+  }
+  vkAllocateCommandBuffers_ = reinterpret_cast<PFN_vkAllocateCommandBuffers>(this->vkGetDeviceProcAddr("vkAllocateCommandBuffers"));
+  if (!vkAllocateCommandBuffers_) {
+    throw VulkanProcNotFound("vkAllocateCommandBuffers");
+  }
+  vkCreateSwapchainKHR_ = reinterpret_cast<PFN_vkCreateSwapchainKHR>(this->vkGetDeviceProcAddr("vkCreateSwapchainKHR"));
+  vkDestroySwapchainKHR_ = reinterpret_cast<PFN_vkDestroySwapchainKHR>(this->vkGetDeviceProcAddr("vkDestroySwapchainKHR"));
+  vkGetSwapchainImagesKHR_ = reinterpret_cast<PFN_vkGetSwapchainImagesKHR>(this->vkGetDeviceProcAddr("vkGetSwapchainImagesKHR"));
+}
+
+/*
+ * ------------------------------------------------------
+ * QueueFunctions
+ * ------------------------------------------------------
+*/
+
+VkResult QueueFunctions::vkQueueSubmit(uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const {
+  return this->vkQueueSubmit_(queue_, submitCount, pSubmits, fence);
+}
+
+VkResult QueueFunctions::vkQueueWaitIdle() const {
+  return this->vkQueueWaitIdle_(queue_);
+}
+
+VkResult QueueFunctions::vkQueuePresentKHR(const VkPresentInfoKHR* pPresentInfo) const {
+  return this->vkQueuePresentKHR_(queue_, pPresentInfo);
+}
+
+QueueFunctions::QueueFunctions(VkQueue queue, DeviceFunctions* device) {
+  queue_ = queue;
+  vkQueueSubmit_ = reinterpret_cast<PFN_vkQueueSubmit>(device->vkGetDeviceProcAddr("vkQueueSubmit"));
+  if (!vkQueueSubmit_) {
+    throw VulkanProcNotFound("vkQueueSubmit");
+  }
+  vkQueueWaitIdle_ = reinterpret_cast<PFN_vkQueueWaitIdle>(device->vkGetDeviceProcAddr("vkQueueWaitIdle"));
+  if (!vkQueueWaitIdle_) {
+    throw VulkanProcNotFound("vkQueueWaitIdle");
+  }
+  vkQueuePresentKHR_ = reinterpret_cast<PFN_vkQueuePresentKHR>(device->vkGetDeviceProcAddr("vkQueuePresentKHR"));
+}
+
+/*
+ * ------------------------------------------------------
+ * CommandBufferFunctions
+ * ------------------------------------------------------
+*/
+
+VkResult CommandBufferFunctions::vkBeginCommandBuffer(const VkCommandBufferBeginInfo* pBeginInfo) const {
+  return this->vkBeginCommandBuffer_(command_buffer_, pBeginInfo);
+}
+
+VkResult CommandBufferFunctions::vkEndCommandBuffer() const {
+  return this->vkEndCommandBuffer_(command_buffer_);
+}
+
+void CommandBufferFunctions::vkCmdBindPipeline(VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) const {
+  return this->vkCmdBindPipeline_(command_buffer_, pipelineBindPoint, pipeline);
+}
+
+void CommandBufferFunctions::vkCmdSetViewport(uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) const {
+  return this->vkCmdSetViewport_(command_buffer_, firstViewport, viewportCount, pViewports);
+}
+
+void CommandBufferFunctions::vkCmdSetScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) const {
+  return this->vkCmdSetScissor_(command_buffer_, firstScissor, scissorCount, pScissors);
+}
+
+void CommandBufferFunctions::vkCmdSetLineWidth(float lineWidth) const {
+  return this->vkCmdSetLineWidth_(command_buffer_, lineWidth);
+}
+
+void CommandBufferFunctions::vkCmdSetBlendConstants(const float blendConstants[4]) const {
+  return this->vkCmdSetBlendConstants_(command_buffer_, blendConstants);
+}
+
+void CommandBufferFunctions::vkCmdSetStencilReference(VkStencilFaceFlags faceMask, uint32_t reference) const {
+  return this->vkCmdSetStencilReference_(command_buffer_, faceMask, reference);
+}
+
+void CommandBufferFunctions::vkCmdBindDescriptorSets(VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) const {
+  return this->vkCmdBindDescriptorSets_(command_buffer_, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+
+void CommandBufferFunctions::vkCmdBindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) const {
+  return this->vkCmdBindIndexBuffer_(command_buffer_, buffer, offset, indexType);
+}
+
+void CommandBufferFunctions::vkCmdBindVertexBuffers(uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) const {
+  return this->vkCmdBindVertexBuffers_(command_buffer_, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+
+void CommandBufferFunctions::vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const {
+  return this->vkCmdDraw_(command_buffer_, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void CommandBufferFunctions::vkCmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const {
+  return this->vkCmdDrawIndexed_(command_buffer_, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+
+void CommandBufferFunctions::vkCmdPushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) const {
+  return this->vkCmdPushConstants_(command_buffer_, layout, stageFlags, offset, size, pValues);
+}
+
+CommandBufferFunctions::CommandBufferFunctions(VkCommandBuffer command_buffer, DeviceFunctions* device) {
+  command_buffer_ = command_buffer;
+  vkBeginCommandBuffer_ = reinterpret_cast<PFN_vkBeginCommandBuffer>(device->vkGetDeviceProcAddr("vkBeginCommandBuffer"));
+  if (!vkBeginCommandBuffer_) {
+    throw VulkanProcNotFound("vkBeginCommandBuffer");
+  }
+  vkEndCommandBuffer_ = reinterpret_cast<PFN_vkEndCommandBuffer>(device->vkGetDeviceProcAddr("vkEndCommandBuffer"));
+  if (!vkEndCommandBuffer_) {
+    throw VulkanProcNotFound("vkEndCommandBuffer");
+  }
+  vkCmdBindPipeline_ = reinterpret_cast<PFN_vkCmdBindPipeline>(device->vkGetDeviceProcAddr("vkCmdBindPipeline"));
+  if (!vkCmdBindPipeline_) {
+    throw VulkanProcNotFound("vkCmdBindPipeline");
+  }
+  vkCmdSetViewport_ = reinterpret_cast<PFN_vkCmdSetViewport>(device->vkGetDeviceProcAddr("vkCmdSetViewport"));
+  if (!vkCmdSetViewport_) {
+    throw VulkanProcNotFound("vkCmdSetViewport");
+  }
+  vkCmdSetScissor_ = reinterpret_cast<PFN_vkCmdSetScissor>(device->vkGetDeviceProcAddr("vkCmdSetScissor"));
+  if (!vkCmdSetScissor_) {
+    throw VulkanProcNotFound("vkCmdSetScissor");
+  }
+  vkCmdSetLineWidth_ = reinterpret_cast<PFN_vkCmdSetLineWidth>(device->vkGetDeviceProcAddr("vkCmdSetLineWidth"));
+  if (!vkCmdSetLineWidth_) {
+    throw VulkanProcNotFound("vkCmdSetLineWidth");
+  }
+  vkCmdSetBlendConstants_ = reinterpret_cast<PFN_vkCmdSetBlendConstants>(device->vkGetDeviceProcAddr("vkCmdSetBlendConstants"));
+  if (!vkCmdSetBlendConstants_) {
+    throw VulkanProcNotFound("vkCmdSetBlendConstants");
+  }
+  vkCmdSetStencilReference_ = reinterpret_cast<PFN_vkCmdSetStencilReference>(device->vkGetDeviceProcAddr("vkCmdSetStencilReference"));
+  if (!vkCmdSetStencilReference_) {
+    throw VulkanProcNotFound("vkCmdSetStencilReference");
+  }
+  vkCmdBindDescriptorSets_ = reinterpret_cast<PFN_vkCmdBindDescriptorSets>(device->vkGetDeviceProcAddr("vkCmdBindDescriptorSets"));
+  if (!vkCmdBindDescriptorSets_) {
+    throw VulkanProcNotFound("vkCmdBindDescriptorSets");
+  }
+  vkCmdBindIndexBuffer_ = reinterpret_cast<PFN_vkCmdBindIndexBuffer>(device->vkGetDeviceProcAddr("vkCmdBindIndexBuffer"));
+  if (!vkCmdBindIndexBuffer_) {
+    throw VulkanProcNotFound("vkCmdBindIndexBuffer");
+  }
+  vkCmdBindVertexBuffers_ = reinterpret_cast<PFN_vkCmdBindVertexBuffers>(device->vkGetDeviceProcAddr("vkCmdBindVertexBuffers"));
+  if (!vkCmdBindVertexBuffers_) {
+    throw VulkanProcNotFound("vkCmdBindVertexBuffers");
+  }
+  vkCmdDraw_ = reinterpret_cast<PFN_vkCmdDraw>(device->vkGetDeviceProcAddr("vkCmdDraw"));
+  if (!vkCmdDraw_) {
+    throw VulkanProcNotFound("vkCmdDraw");
+  }
+  vkCmdDrawIndexed_ = reinterpret_cast<PFN_vkCmdDrawIndexed>(device->vkGetDeviceProcAddr("vkCmdDrawIndexed"));
+  if (!vkCmdDrawIndexed_) {
+    throw VulkanProcNotFound("vkCmdDrawIndexed");
+  }
+  vkCmdPushConstants_ = reinterpret_cast<PFN_vkCmdPushConstants>(device->vkGetDeviceProcAddr("vkCmdPushConstants"));
+  if (!vkCmdPushConstants_) {
+    throw VulkanProcNotFound("vkCmdPushConstants");
+  }
+}
+
+} // vkgen
@@ -0,0 +1,219 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Dispatch tables for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_DISPATCH_TABLES_INCLUDE
+#define VK_DISPATCH_TABLES_INCLUDE
+
+#include "vulkan_include.inl"
+#include <stdexcept>
+#include <string>
+
+namespace vkgen {
+
+class VulkanProcNotFound: public std::exception {
+public:
+  VulkanProcNotFound(std::string const& proc) : proc_(proc) {}
+  virtual const char* what() const throw() {
+    return "Write better error message here";
+  }
+
+private:
+  std::string proc_;
+};
+
+class GlobalFunctions {
+  // HMODULE on Windows. Kept opaque so that platform headers are only
+  // included by the implementation.
+  typedef void* library_handle;
+
+public:
+  GlobalFunctions(std::string const& vulkan_library);
+  ~GlobalFunctions();
+  PFN_vkVoidFunction vkGetInstanceProcAddr(VkInstance instance, const char* pName) const;
+  VkResult vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) const;
+  VkResult vkEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) const;
+  VkResult vkEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties) const;
+
+private:
+  GlobalFunctions(GlobalFunctions& other) = delete;
+  void operator=(GlobalFunctions& rhs) = delete;
+
+private:
+  library_handle library_ = nullptr;
+  PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr_ = nullptr;
+  PFN_vkCreateInstance vkCreateInstance_ = nullptr;
+  PFN_vkEnumerateInstanceExtensionProperties vkEnumerateInstanceExtensionProperties_ = nullptr;
+  PFN_vkEnumerateInstanceLayerProperties vkEnumerateInstanceLayerProperties_ = nullptr;
+};
+
+class InstanceFunctions {
+public:
+  VkInstance instance() const { return instance_; }
+  PFN_vkVoidFunction vkGetInstanceProcAddr(const char* pName) const;
+  void vkDestroyInstance(const VkAllocationCallbacks* pAllocator) const;
+  VkResult vkEnumeratePhysicalDevices(uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) const;
+  void vkDestroySurfaceKHR(VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator) const;
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  VkResult vkCreateXlibSurfaceKHR(const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const;
+#endif
+
+protected:
+  InstanceFunctions(VkInstance instance, GlobalFunctions* globals);
+
+private:
+  VkInstance instance_ = VK_NULL_HANDLE;
+  PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr_ = nullptr;
+  PFN_vkDestroyInstance vkDestroyInstance_ = nullptr;
+  PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices_ = nullptr;
+  PFN_vkDestroySurfaceKHR vkDestroySurfaceKHR_ = nullptr;
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  PFN_vkCreateXlibSurfaceKHR vkCreateXlibSurfaceKHR_ = nullptr;
+#endif
+};
+
+class PhysicalDeviceFunctions {
+public:
+  VkPhysicalDevice physical_device() const { return physical_device_; }
+  void vkGetPhysicalDeviceFeatures(VkPhysicalDeviceFeatures* pFeatures) const;
+  void vkGetPhysicalDeviceQueueFamilyProperties(uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) const;
+  VkResult vkCreateDevice(const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const;
+  VkResult vkEnumerateDeviceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) const;
+  VkResult vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) const;
+  VkResult vkGetPhysicalDeviceSurfaceFormatsKHR(VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) const;
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  VkBool32 vkGetPhysicalDeviceXlibPresentationSupportKHR(uint32_t queueFamilyIndex, Display* dpy, VisualID visualID) const;
+#endif
+
+protected:
+  PhysicalDeviceFunctions(VkPhysicalDevice physical_device, InstanceFunctions* instance);
+
+private:
+  VkPhysicalDevice physical_device_ = VK_NULL_HANDLE;
+  PFN_vkGetPhysicalDeviceFeatures vkGetPhysicalDeviceFeatures_ = nullptr;
+  PFN_vkGetPhysicalDeviceQueueFamilyProperties vkGetPhysicalDeviceQueueFamilyProperties_ = nullptr;
+  PFN_vkCreateDevice vkCreateDevice_ = nullptr;
+  PFN_vkEnumerateDeviceExtensionProperties vkEnumerateDeviceExtensionProperties_ = nullptr;
+  PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR vkGetPhysicalDeviceSurfaceCapabilitiesKHR_ = nullptr;
+  PFN_vkGetPhysicalDeviceSurfaceFormatsKHR vkGetPhysicalDeviceSurfaceFormatsKHR_ = nullptr;
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR vkGetPhysicalDeviceXlibPresentationSupportKHR_ = nullptr;
+#endif
+};
+
+class DeviceFunctions {
+public:
+  VkDevice device() const { return device_; }
+  PFN_vkVoidFunction vkGetDeviceProcAddr(const char* pName) const;
+  void vkDestroyDevice(const VkAllocationCallbacks* pAllocator) const;
+  void vkGetDeviceQueue(uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) const;
+  VkResult vkDeviceWaitIdle() const;
+  VkResult vkCreateSampler(const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) const;
+  void vkDestroySampler(VkSampler sampler, const VkAllocationCallbacks* pAllocator) const;
+  VkResult vkCreateDescriptorSetLayout(const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) const;
+  VkResult vkCreatePipelineLayout(const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) const;
+  VkResult vkCreateShaderModule(const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const;
+  VkResult vkCreateGraphicsPipelines(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const;
+  void vkDestroyPipeline(VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) const;
+  VkResult vkCreateCommandPool(const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) const;
+  VkResult vkAllocateCommandBuffers(const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) const;
+  VkResult vkCreateSwapchainKHR(const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) const;
+  void vkDestroySwapchainKHR(VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) const;
+  VkResult vkGetSwapchainImagesKHR(VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) const;
+
+protected:
+  DeviceFunctions(VkDevice device, InstanceFunctions* instance);
+
+private:
+  VkDevice device_ = VK_NULL_HANDLE;
+  PFN_vkGetDeviceProcAddr vkGetDeviceProcAddr_ = nullptr;
+  PFN_vkDestroyDevice vkDestroyDevice_ = nullptr;
+  PFN_vkGetDeviceQueue vkGetDeviceQueue_ = nullptr;
+  PFN_vkDeviceWaitIdle vkDeviceWaitIdle_ = nullptr;
+  PFN_vkCreateSampler vkCreateSampler_ = nullptr;
+  PFN_vkDestroySampler vkDestroySampler_ = nullptr;
+  PFN_vkCreateDescriptorSetLayout vkCreateDescriptorSetLayout_ = nullptr;
+  PFN_vkCreatePipelineLayout vkCreatePipelineLayout_ = nullptr;
+  PFN_vkCreateShaderModule vkCreateShaderModule_ = nullptr;
+  PFN_vkCreateGraphicsPipelines vkCreateGraphicsPipelines_ = nullptr;
+  PFN_vkDestroyPipeline vkDestroyPipeline_ = nullptr;
+  PFN_vkCreateCommandPool vkCreateCommandPool_ = nullptr;
+  PFN_vkAllocateCommandBuffers vkAllocateCommandBuffers_ = nullptr;
+  PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR_ = nullptr;
+  PFN_vkDestroySwapchainKHR vkDestroySwapchainKHR_ = nullptr;
+  PFN_vkGetSwapchainImagesKHR vkGetSwapchainImagesKHR_ = nullptr;
+};
+
+class QueueFunctions {
+public:
+  VkQueue queue() const { return queue_; }
+  VkResult vkQueueSubmit(uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const;
+  VkResult vkQueueWaitIdle() const;
+  VkResult vkQueuePresentKHR(const VkPresentInfoKHR* pPresentInfo) const;
+
+protected:
+  QueueFunctions(VkQueue queue, DeviceFunctions* device);
+
+private:
+  VkQueue queue_ = VK_NULL_HANDLE;
+  PFN_vkQueueSubmit vkQueueSubmit_ = nullptr;
+  PFN_vkQueueWaitIdle vkQueueWaitIdle_ = nullptr;
+  PFN_vkQueuePresentKHR vkQueuePresentKHR_ = nullptr;
+};
+
+class CommandBufferFunctions {
+public:
+  VkCommandBuffer command_buffer() const { return command_buffer_; }
+  VkResult vkBeginCommandBuffer(const VkCommandBufferBeginInfo* pBeginInfo) const;
+  VkResult vkEndCommandBuffer() const;
+  void vkCmdBindPipeline(VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) const;
+  void vkCmdSetViewport(uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) const;
+  void vkCmdSetScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) const;
+  void vkCmdSetLineWidth(float lineWidth) const;
+  void vkCmdSetBlendConstants(const float blendConstants[4]) const;
+  void vkCmdSetStencilReference(VkStencilFaceFlags faceMask, uint32_t reference) const;
+  void vkCmdBindDescriptorSets(VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) const;
+  void vkCmdBindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) const;
+  void vkCmdBindVertexBuffers(uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) const;
+  void vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const;
+  void vkCmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const;
+  void vkCmdPushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) const;
+
+protected:
+  CommandBufferFunctions(VkCommandBuffer command_buffer, DeviceFunctions* device);
+
+private:
+  VkCommandBuffer command_buffer_ = VK_NULL_HANDLE;
+  PFN_vkBeginCommandBuffer vkBeginCommandBuffer_ = nullptr;
+  PFN_vkEndCommandBuffer vkEndCommandBuffer_ = nullptr;
+  PFN_vkCmdBindPipeline vkCmdBindPipeline_ = nullptr;
+  PFN_vkCmdSetViewport vkCmdSetViewport_ = nullptr;
+  PFN_vkCmdSetScissor vkCmdSetScissor_ = nullptr;
+  PFN_vkCmdSetLineWidth vkCmdSetLineWidth_ = nullptr;
+  PFN_vkCmdSetBlendConstants vkCmdSetBlendConstants_ = nullptr;
+  PFN_vkCmdSetStencilReference vkCmdSetStencilReference_ = nullptr;
+  PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets_ = nullptr;
+  PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer_ = nullptr;
+  PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers_ = nullptr;
+  PFN_vkCmdDraw vkCmdDraw_ = nullptr;
+  PFN_vkCmdDrawIndexed vkCmdDrawIndexed_ = nullptr;
+  PFN_vkCmdPushConstants vkCmdPushConstants_ = nullptr;
+};
+
+} // vkgen
+
+#endif // VK_DISPATCH_TABLES_INCLUDE
+
@@ -0,0 +1,338 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Dispatchers for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_DISPATCHER_INCLUDE
+#define VK_DISPATCHER_INCLUDE
+
+#include "vk_dispatch_tables.h"
+
+namespace vkgen {
+
+// Calls the prototypes exported by the Vulkan loader. Wrappers use this as
+// the default dispatcher, which is the same as calling the commands directly:
+//
+//   template <typename Dispatch = vkgen::DispatchLoaderStatic>
+//   void pushConstants(..., Dispatch const& d = Dispatch()) const {
+//     d.vkCmdPushConstants(m_commandBuffer, ...);
+//   }
+#if !defined(VK_NO_PROTOTYPES)
+class DispatchLoaderStatic {
+public:
+  PFN_vkVoidFunction vkGetInstanceProcAddr(VkInstance instance, const char* pName) const { return ::vkGetInstanceProcAddr(instance, pName); }
+  VkResult vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) const { return ::vkCreateInstance(pCreateInfo, pAllocator, pInstance); }
+  VkResult vkEnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) const { return ::vkEnumerateInstanceExtensionProperties(pLayerName, pPropertyCount, pProperties); }
+  VkResult vkEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties) const { return ::vkEnumerateInstanceLayerProperties(pPropertyCount, pProperties); }
+  void vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) const { return ::vkDestroyInstance(instance, pAllocator); }
+  VkResult vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) const { return ::vkEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices); }
+  void vkGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) const { return ::vkGetPhysicalDeviceFeatures(physicalDevice, pFeatures); }
+  void vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) const { return ::vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties); }
+  PFN_vkVoidFunction vkGetDeviceProcAddr(VkDevice device, const char* pName) const { return ::vkGetDeviceProcAddr(device, pName); }
+  VkResult vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const { return ::vkCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice); }
+  VkResult vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) const { return ::vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties); }
+  void vkDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks* pAllocator) const { return ::vkDestroySurfaceKHR(instance, surface, pAllocator); }
+  VkResult vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) const { return ::vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities); }
+  VkResult vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) const { return ::vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats); }
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  VkResult vkCreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) const { return ::vkCreateXlibSurfaceKHR(instance, pCreateInfo, pAllocator, pSurface); }
+#endif
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  VkBool32 vkGetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display* dpy, VisualID visualID) const { return ::vkGetPhysicalDeviceXlibPresentationSupportKHR(physicalDevice, queueFamilyIndex, dpy, visualID); }
+#endif
+  void vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) const { return ::vkDestroyDevice(device, pAllocator); }
+  void vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) const { return ::vkGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue); }
+  VkResult vkQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const { return ::vkQueueSubmit(queue, submitCount, pSubmits, fence); }
+  VkResult vkQueueWaitIdle(VkQueue queue) const { return ::vkQueueWaitIdle(queue); }
+  VkResult vkDeviceWaitIdle(VkDevice device) const { return ::vkDeviceWaitIdle(device); }
+  VkResult vkCreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) const { return ::vkCreateSampler(device, pCreateInfo, pAllocator, pSampler); }
+  void vkDestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) const { return ::vkDestroySampler(device, sampler, pAllocator); }
+  VkResult vkCreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) const { return ::vkCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout); }
+  VkResult vkCreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) const { return ::vkCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout); }
+  VkResult vkCreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const { return ::vkCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule); }
+  VkResult vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const { return ::vkCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines); }
+  void vkDestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) const { return ::vkDestroyPipeline(device, pipeline, pAllocator); }
+  VkResult vkCreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) const { return ::vkCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool); }
+  VkResult vkAllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) const { return ::vkAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers); }
+  VkResult vkBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) const { return ::vkBeginCommandBuffer(commandBuffer, pBeginInfo); }
+  VkResult vkEndCommandBuffer(VkCommandBuffer commandBuffer) const { return ::vkEndCommandBuffer(commandBuffer); }
+  void vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) const { return ::vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline); }
+  void vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) const { return ::vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports); }
+  void vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) const { return ::vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors); }
+  void vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) const { return ::vkCmdSetLineWidth(commandBuffer, lineWidth); }
+  void vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) const { return ::vkCmdSetBlendConstants(commandBuffer, blendConstants); }
+  void vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) const { return ::vkCmdSetStencilReference(commandBuffer, faceMask, reference); }
+  void vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) const { return ::vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets); }
+  void vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) const { return ::vkCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType); }
+  void vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) const { return ::vkCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets); }
+  void vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const { return ::vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance); }
+  void vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const { return ::vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance); }
+  void vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) const { return ::vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues); }
+  VkResult vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) const { return ::vkCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain); }
+  void vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator) const { return ::vkDestroySwapchainKHR(device, swapchain, pAllocator); }
+  VkResult vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) const { return ::vkGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages); }
+  VkResult vkQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) const { return ::vkQueuePresentKHR(queue, pPresentInfo); }
+};
+#endif
+
+// Holds command pointers fetched through the vkgen dispatch tables. Global
+// and instance level commands are resolved with vkGetInstanceProcAddr, while
+// device level commands (including everything recorded into a command buffer)
+// are resolved with vkGetDeviceProcAddr and therefore call into the driver
+// without passing through a loader trampoline. Pointers are public and named
+// after their commands so that the dispatcher can be passed wherever a
+// DispatchLoaderStatic is accepted. Only one device should be loaded into a
+// given dispatcher.
+class DispatchLoaderDynamic {
+public:
+  DispatchLoaderDynamic() = default;
+  explicit DispatchLoaderDynamic(GlobalFunctions const& globals) { init(globals); }
+  DispatchLoaderDynamic(InstanceFunctions const& instance, DeviceFunctions const& device) { init(instance); init(device); }
+
+  void init(GlobalFunctions const& globals) {
+    vkCreateInstance = reinterpret_cast<PFN_vkCreateInstance>(globals.vkGetInstanceProcAddr(nullptr, "vkCreateInstance"));
+    if (!vkCreateInstance) {
+      throw VulkanProcNotFound("vkCreateInstance");
+    }
+    vkEnumerateInstanceExtensionProperties = reinterpret_cast<PFN_vkEnumerateInstanceExtensionProperties>(globals.vkGetInstanceProcAddr(nullptr, "vkEnumerateInstanceExtensionProperties"));
+    if (!vkEnumerateInstanceExtensionProperties) {
+      throw VulkanProcNotFound("vkEnumerateInstanceExtensionProperties");
+    }
+    vkEnumerateInstanceLayerProperties = reinterpret_cast<PFN_vkEnumerateInstanceLayerProperties>(globals.vkGetInstanceProcAddr(nullptr, "vkEnumerateInstanceLayerProperties"));
+    if (!vkEnumerateInstanceLayerProperties) {
+      throw VulkanProcNotFound("vkEnumerateInstanceLayerProperties");
+    }
+  }
+
+  void init(InstanceFunctions const& instance) {
+    vkGetInstanceProcAddr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(instance.vkGetInstanceProcAddr("vkGetInstanceProcAddr"));
+    if (!vkGetInstanceProcAddr) {
+      throw VulkanProcNotFound("vkGetInstanceProcAddr");
+    }
+    vkDestroyInstance = reinterpret_cast<PFN_vkDestroyInstance>(instance.vkGetInstanceProcAddr("vkDestroyInstance"));
+    if (!vkDestroyInstance) {
+      throw VulkanProcNotFound("vkDestroyInstance");
+    }
+    vkEnumeratePhysicalDevices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(instance.vkGetInstanceProcAddr("vkEnumeratePhysicalDevices"));
+    if (!vkEnumeratePhysicalDevices) {
+      throw VulkanProcNotFound("vkEnumeratePhysicalDevices");
+    }
+    vkGetPhysicalDeviceFeatures = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures>(instance.vkGetInstanceProcAddr("vkGetPhysicalDeviceFeatures"));
+    if (!vkGetPhysicalDeviceFeatures) {
+      throw VulkanProcNotFound("vkGetPhysicalDeviceFeatures");
+    }
+    vkGetPhysicalDeviceQueueFamilyProperties = reinterpret_cast<PFN_vkGetPhysicalDeviceQueueFamilyProperties>(instance.vkGetInstanceProcAddr("vkGetPhysicalDeviceQueueFamilyProperties"));
+    if (!vkGetPhysicalDeviceQueueFamilyProperties) {
+      throw VulkanProcNotFound("vkGetPhysicalDeviceQueueFamilyProperties");
+    }
+    vkGetDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(instance.vkGetInstanceProcAddr("vkGetDeviceProcAddr"));
+    if (!vkGetDeviceProcAddr) {
+      throw VulkanProcNotFound("vkGetDeviceProcAddr");
+    }
+    vkCreateDevice = reinterpret_cast<PFN_vkCreateDevice>(instance.vkGetInstanceProcAddr("vkCreateDevice"));
+    if (!vkCreateDevice) {
+      throw VulkanProcNotFound("vkCreateDevice");
+    }
+    vkEnumerateDeviceExtensionProperties = reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(instance.vkGetInstanceProcAddr("vkEnumerateDeviceExtensionProperties"));
+    if (!vkEnumerateDeviceExtensionProperties) {
+      throw VulkanProcNotFound("vkEnumerateDeviceExtensionProperties");
+    }
+    vkDestroySurfaceKHR = reinterpret_cast<PFN_vkDestroySurfaceKHR>(instance.vkGetInstanceProcAddr("vkDestroySurfaceKHR"));
+    vkGetPhysicalDeviceSurfaceCapabilitiesKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR>(instance.vkGetInstanceProcAddr("vkGetPhysicalDeviceSurfaceCapabilitiesKHR"));
+    vkGetPhysicalDeviceSurfaceFormatsKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceSurfaceFormatsKHR>(instance.vkGetInstanceProcAddr("vkGetPhysicalDeviceSurfaceFormatsKHR"));
+  #if defined(VK_USE_PLATFORM_XLIB_KHR)
+    vkCreateXlibSurfaceKHR = reinterpret_cast<PFN_vkCreateXlibSurfaceKHR>(instance.vkGetInstanceProcAddr("vkCreateXlibSurfaceKHR"));
+  #endif
+  #if defined(VK_USE_PLATFORM_XLIB_KHR)
+    vkGetPhysicalDeviceXlibPresentationSupportKHR = reinterpret_cast<PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR>(instance.vkGetInstanceProcAddr("vkGetPhysicalDeviceXlibPresentationSupportKHR"));
+  #endif
+  }
+
+  void init(DeviceFunctions const& device) {
+    vkDestroyDevice = reinterpret_cast<PFN_vkDestroyDevice>(device.vkGetDeviceProcAddr("vkDestroyDevice"));
+    if (!vkDestroyDevice) {
+      throw VulkanProcNotFound("vkDestroyDevice");
+    }
+    vkGetDeviceQueue = reinterpret_cast<PFN_vkGetDeviceQueue>(device.vkGetDeviceProcAddr("vkGetDeviceQueue"));
+    if (!vkGetDeviceQueue) {
+      throw VulkanProcNotFound("vkGetDeviceQueue");
+    }
+    vkQueueSubmit = reinterpret_cast<PFN_vkQueueSubmit>(device.vkGetDeviceProcAddr("vkQueueSubmit"));
+    if (!vkQueueSubmit) {
+      throw VulkanProcNotFound("vkQueueSubmit");
+    }
+    vkQueueWaitIdle = reinterpret_cast<PFN_vkQueueWaitIdle>(device.vkGetDeviceProcAddr("vkQueueWaitIdle"));
+    if (!vkQueueWaitIdle) {
+      throw VulkanProcNotFound("vkQueueWaitIdle");
+    }
+    vkDeviceWaitIdle = reinterpret_cast<PFN_vkDeviceWaitIdle>(device.vkGetDeviceProcAddr("vkDeviceWaitIdle"));
+    if (!vkDeviceWaitIdle) {
+      throw VulkanProcNotFound("vkDeviceWaitIdle");
+    }
+    vkCreateSampler = reinterpret_cast<PFN_vkCreateSampler>(device.vkGetDeviceProcAddr("vkCreateSampler"));
+    if (!vkCreateSampler) {
+      throw VulkanProcNotFound("vkCreateSampler");
+    }
+    vkDestroySampler = reinterpret_cast<PFN_vkDestroySampler>(device.vkGetDeviceProcAddr("vkDestroySampler"));
+    if (!vkDestroySampler) {
+      throw VulkanProcNotFound("vkDestroySampler");
+    }
+    vkCreateDescriptorSetLayout = reinterpret_cast<PFN_vkCreateDescriptorSetLayout>(device.vkGetDeviceProcAddr("vkCreateDescriptorSetLayout"));
+    if (!vkCreateDescriptorSetLayout) {
+      throw VulkanProcNotFound("vkCreateDescriptorSetLayout");
+    }
+    vkCreatePipelineLayout = reinterpret_cast<PFN_vkCreatePipelineLayout>(device.vkGetDeviceProcAddr("vkCreatePipelineLayout"));
+    if (!vkCreatePipelineLayout) {
+      throw VulkanProcNotFound("vkCreatePipelineLayout");
+    }
+    vkCreateShaderModule = reinterpret_cast<PFN_vkCreateShaderModule>(device.vkGetDeviceProcAddr("vkCreateShaderModule"));
+    if (!vkCreateShaderModule) {
+      throw VulkanProcNotFound("vkCreateShaderModule");
+    }
+    vkCreateGraphicsPipelines = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(device.vkGetDeviceProcAddr("vkCreateGraphicsPipelines"));
+    if (!vkCreateGraphicsPipelines) {
+      throw VulkanProcNotFound("vkCreateGraphicsPipelines");
+    }
+    vkDestroyPipeline = reinterpret_cast<PFN_vkDestroyPipeline>(device.vkGetDeviceProcAddr("vkDestroyPipeline"));
+    if (!vkDestroyPipeline) {
+      throw VulkanProcNotFound("vkDestroyPipeline");
+    }
+    vkCreateCommandPool = reinterpret_cast<PFN_vkCreateCommandPool>(device.vkGetDeviceProcAddr("vkCreateCommandPool"));
+    if (!vkCreateCommandPool) {
+      throw VulkanProcNotFound("vkCreateCommandPool");
+    }
+    vkAllocateCommandBuffers = reinterpret_cast<PFN_vkAllocateCommandBuffers>(device.vkGetDeviceProcAddr("vkAllocateCommandBuffers"));
+    if (!vkAllocateCommandBuffers) {
+      throw VulkanProcNotFound("vkAllocateCommandBuffers");
+    }
+    vkBeginCommandBuffer = reinterpret_cast<PFN_vkBeginCommandBuffer>(device.vkGetDeviceProcAddr("vkBeginCommandBuffer"));
+    if (!vkBeginCommandBuffer) {
+      throw VulkanProcNotFound("vkBeginCommandBuffer");
+    }
+    vkEndCommandBuffer = reinterpret_cast<PFN_vkEndCommandBuffer>(device.vkGetDeviceProcAddr("vkEndCommandBuffer"));
+    if (!vkEndCommandBuffer) {
+      throw VulkanProcNotFound("vkEndCommandBuffer");
+    }
+    vkCmdBindPipeline = reinterpret_cast<PFN_vkCmdBindPipeline>(device.vkGetDeviceProcAddr("vkCmdBindPipeline"));
+    if (!vkCmdBindPipeline) {
+      throw VulkanProcNotFound("vkCmdBindPipeline");
+    }
+    vkCmdSetViewport = reinterpret_cast<PFN_vkCmdSetViewport>(device.vkGetDeviceProcAddr("vkCmdSetViewport"));
+    if (!vkCmdSetViewport) {
+      throw VulkanProcNotFound("vkCmdSetViewport");
+    }
+    vkCmdSetScissor = reinterpret_cast<PFN_vkCmdSetScissor>(device.vkGetDeviceProcAddr("vkCmdSetScissor"));
+    if (!vkCmdSetScissor) {
+      throw VulkanProcNotFound("vkCmdSetScissor");
+    }
+    vkCmdSetLineWidth = reinterpret_cast<PFN_vkCmdSetLineWidth>(device.vkGetDeviceProcAddr("vkCmdSetLineWidth"));
+    if (!vkCmdSetLineWidth) {
+      throw VulkanProcNotFound("vkCmdSetLineWidth");
+    }
+    vkCmdSetBlendConstants = reinterpret_cast<PFN_vkCmdSetBlendConstants>(device.vkGetDeviceProcAddr("vkCmdSetBlendConstants"));
+    if (!vkCmdSetBlendConstants) {
+      throw VulkanProcNotFound("vkCmdSetBlendConstants");
+    }
+    vkCmdSetStencilReference = reinterpret_cast<PFN_vkCmdSetStencilReference>(device.vkGetDeviceProcAddr("vkCmdSetStencilReference"));
+    if (!vkCmdSetStencilReference) {
+      throw VulkanProcNotFound("vkCmdSetStencilReference");
+    }
+    vkCmdBindDescriptorSets = reinterpret_cast<PFN_vkCmdBindDescriptorSets>(device.vkGetDeviceProcAddr("vkCmdBindDescriptorSets"));
+    if (!vkCmdBindDescriptorSets) {
+      throw VulkanProcNotFound("vkCmdBindDescriptorSets");
+    }
+    vkCmdBindIndexBuffer = reinterpret_cast<PFN_vkCmdBindIndexBuffer>(device.vkGetDeviceProcAddr("vkCmdBindIndexBuffer"));
+    if (!vkCmdBindIndexBuffer) {
+      throw VulkanProcNotFound("vkCmdBindIndexBuffer");
+    }
+    vkCmdBindVertexBuffers = reinterpret_cast<PFN_vkCmdBindVertexBuffers>(device.vkGetDeviceProcAddr("vkCmdBindVertexBuffers"));
+    if (!vkCmdBindVertexBuffers) {
+      throw VulkanProcNotFound("vkCmdBindVertexBuffers");
+    }
+    vkCmdDraw = reinterpret_cast<PFN_vkCmdDraw>(device.vkGetDeviceProcAddr("vkCmdDraw"));
+    if (!vkCmdDraw) {
+      throw VulkanProcNotFound("vkCmdDraw");
+    }
+    vkCmdDrawIndexed = reinterpret_cast<PFN_vkCmdDrawIndexed>(device.vkGetDeviceProcAddr("vkCmdDrawIndexed"));
+    if (!vkCmdDrawIndexed) {
+      throw VulkanProcNotFound("vkCmdDrawIndexed");
+    }
+    vkCmdPushConstants = reinterpret_cast<PFN_vkCmdPushConstants>(device.vkGetDeviceProcAddr("vkCmdPushConstants"));
+    if (!vkCmdPushConstants) {
+      throw VulkanProcNotFound("vkCmdPushConstants");
+    }
+    vkCreateSwapchainKHR = reinterpret_cast<PFN_vkCreateSwapchainKHR>(device.vkGetDeviceProcAddr("vkCreateSwapchainKHR"));
+    vkDestroySwapchainKHR = reinterpret_cast<PFN_vkDestroySwapchainKHR>(device.vkGetDeviceProcAddr("vkDestroySwapchainKHR"));
+    vkGetSwapchainImagesKHR = reinterpret_cast<PFN_vkGetSwapchainImagesKHR>(device.vkGetDeviceProcAddr("vkGetSwapchainImagesKHR"));
+    vkQueuePresentKHR = reinterpret_cast<PFN_vkQueuePresentKHR>(device.vkGetDeviceProcAddr("vkQueuePresentKHR"));
+  }
+
+  PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = nullptr;
+  PFN_vkCreateInstance vkCreateInstance = nullptr;
+  PFN_vkEnumerateInstanceExtensionProperties vkEnumerateInstanceExtensionProperties = nullptr;
+  PFN_vkEnumerateInstanceLayerProperties vkEnumerateInstanceLayerProperties = nullptr;
+  PFN_vkDestroyInstance vkDestroyInstance = nullptr;
+  PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices = nullptr;
+  PFN_vkGetPhysicalDeviceFeatures vkGetPhysicalDeviceFeatures = nullptr;
+  PFN_vkGetPhysicalDeviceQueueFamilyProperties vkGetPhysicalDeviceQueueFamilyProperties = nullptr;
+  PFN_vkGetDeviceProcAddr vkGetDeviceProcAddr = nullptr;
+  PFN_vkCreateDevice vkCreateDevice = nullptr;
+  PFN_vkEnumerateDeviceExtensionProperties vkEnumerateDeviceExtensionProperties = nullptr;
+  PFN_vkDestroySurfaceKHR vkDestroySurfaceKHR = nullptr;
+  PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR vkGetPhysicalDeviceSurfaceCapabilitiesKHR = nullptr;
+  PFN_vkGetPhysicalDeviceSurfaceFormatsKHR vkGetPhysicalDeviceSurfaceFormatsKHR = nullptr;
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  PFN_vkCreateXlibSurfaceKHR vkCreateXlibSurfaceKHR = nullptr;
+#endif
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR vkGetPhysicalDeviceXlibPresentationSupportKHR = nullptr;
+#endif
+  PFN_vkDestroyDevice vkDestroyDevice = nullptr;
+  PFN_vkGetDeviceQueue vkGetDeviceQueue = nullptr;
+  PFN_vkQueueSubmit vkQueueSubmit = nullptr;
+  PFN_vkQueueWaitIdle vkQueueWaitIdle = nullptr;
+  PFN_vkDeviceWaitIdle vkDeviceWaitIdle = nullptr;
+  PFN_vkCreateSampler vkCreateSampler = nullptr;
+  PFN_vkDestroySampler vkDestroySampler = nullptr;
+  PFN_vkCreateDescriptorSetLayout vkCreateDescriptorSetLayout = nullptr;
+  PFN_vkCreatePipelineLayout vkCreatePipelineLayout = nullptr;
+  PFN_vkCreateShaderModule vkCreateShaderModule = nullptr;
+  PFN_vkCreateGraphicsPipelines vkCreateGraphicsPipelines = nullptr;
+  PFN_vkDestroyPipeline vkDestroyPipeline = nullptr;
+  PFN_vkCreateCommandPool vkCreateCommandPool = nullptr;
+  PFN_vkAllocateCommandBuffers vkAllocateCommandBuffers = nullptr;
+  PFN_vkBeginCommandBuffer vkBeginCommandBuffer = nullptr;
+  PFN_vkEndCommandBuffer vkEndCommandBuffer = nullptr;
+  PFN_vkCmdBindPipeline vkCmdBindPipeline = nullptr;
+  PFN_vkCmdSetViewport vkCmdSetViewport = nullptr;
+  PFN_vkCmdSetScissor vkCmdSetScissor = nullptr;
+  PFN_vkCmdSetLineWidth vkCmdSetLineWidth = nullptr;
+  PFN_vkCmdSetBlendConstants vkCmdSetBlendConstants = nullptr;
+  PFN_vkCmdSetStencilReference vkCmdSetStencilReference = nullptr;
+  PFN_vkCmdBindDescriptorSets vkCmdBindDescriptorSets = nullptr;
+  PFN_vkCmdBindIndexBuffer vkCmdBindIndexBuffer = nullptr;
+  PFN_vkCmdBindVertexBuffers vkCmdBindVertexBuffers = nullptr;
+  PFN_vkCmdDraw vkCmdDraw = nullptr;
+  PFN_vkCmdDrawIndexed vkCmdDrawIndexed = nullptr;
+  PFN_vkCmdPushConstants vkCmdPushConstants = nullptr;
+  PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR = nullptr;
+  PFN_vkDestroySwapchainKHR vkDestroySwapchainKHR = nullptr;
+  PFN_vkGetSwapchainImagesKHR vkGetSwapchainImagesKHR = nullptr;
+  PFN_vkQueuePresentKHR vkQueuePresentKHR = nullptr;
+};
+
+} // vkgen
+
+#endif // VK_DISPATCHER_INCLUDE
@@ -0,0 +1,355 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// State filters for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_STATE_FILTER_INCLUDE
+#define VK_STATE_FILTER_INCLUDE
+
+#include "vk_dispatch_tables.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace vkgen {
+
+// vkgen::StateFilter passes the commands recorded through it on to a command
+// buffer, except for calls of state-setting commands that would change
+// nothing. A call is dropped when its arguments, including the contents of
+// the arrays and structs they point to, are the same as those of the last
+// call of the same command that was passed on. Tracking starts over when the
+// command buffer is begun or reset and after secondary command buffers are
+// executed, and calls that may change state tracked for other commands, such
+// as pipeline binds overriding dynamic state, make the filter forget it.
+//
+// Like its command buffer, a filter is used by one thread at a time. Commands
+// recorded on the command buffer without going through the filter leave it
+// out of date, so invalidate() must be called after recording them. counters()
+// tells how many calls were passed on and how many were dropped per command.
+
+namespace detail {
+
+// The arguments of the last call of a command. Those of a new call are
+// compared with them as they are added and replace them from the first
+// difference on. Storage is kept, so that recording does not allocate once
+// the largest arguments of the command have been seen.
+class state_key {
+public:
+  void begin_call() {
+    _size = 0;
+    _changed = !_valid;
+  }
+
+  // Whether the arguments of the call differ from those of the last one
+  bool end_call() {
+    bool changed = _changed || _size != _last_size;
+    _last_size = _size;
+    _valid = true;
+    return changed;
+  }
+
+  void invalidate() { _valid = false; }
+
+  template <typename T>
+  void add(T const& value) {
+    add_bytes(&value, sizeof(T));
+  }
+
+  template <typename T>
+  void add_range(T const* values, size_t count) {
+    add(values != nullptr);
+    if (values) {
+      add_bytes(values, count * sizeof(T));
+    }
+  }
+
+  void add_range(void const* data, size_t size) {
+    add(data != nullptr);
+    if (data) {
+      add_bytes(data, size);
+    }
+  }
+
+  void add_string(char const* s) {
+    add(s != nullptr);
+    if (s) {
+      add_bytes(s, std::strlen(s) + 1);
+    }
+  }
+
+private:
+  void add_bytes(void const* data, size_t size) {
+    if (size == 0) {
+      return;
+    }
+    if (!_changed) {
+      if (_size + size <= _last_size && std::memcmp(_bytes.data() + _size, data, size) == 0) {
+        _size += size;
+        return;
+      }
+      _changed = true;
+    }
+    if (_size + size > _bytes.size()) {
+      _bytes.resize(std::max(_size + size, 2 * _bytes.size()));
+    }
+    std::memcpy(_bytes.data() + _size, data, size);
+    _size += size;
+  }
+
+private:
+  std::vector<unsigned char> _bytes;
+  size_t _size = 0; // Of the arguments added so far
+  size_t _last_size = 0;
+  bool _changed = false;
+  bool _valid = false;
+};
+
+} // detail
+
+struct StateFilterCounters {
+  uint64_t forwarded = 0; // Calls of all commands passed on to the command buffer
+
+  // Dropped calls per command
+  uint64_t vkCmdBindPipeline = 0;
+  uint64_t vkCmdSetViewport = 0;
+  uint64_t vkCmdSetScissor = 0;
+  uint64_t vkCmdSetLineWidth = 0;
+  uint64_t vkCmdSetBlendConstants = 0;
+  uint64_t vkCmdSetStencilReference = 0;
+  uint64_t vkCmdBindDescriptorSets = 0;
+  uint64_t vkCmdBindIndexBuffer = 0;
+  uint64_t vkCmdBindVertexBuffers = 0;
+
+  uint64_t eliminated() const {
+    uint64_t sum = 0;
+    sum += vkCmdBindPipeline;
+    sum += vkCmdSetViewport;
+    sum += vkCmdSetScissor;
+    sum += vkCmdSetLineWidth;
+    sum += vkCmdSetBlendConstants;
+    sum += vkCmdSetStencilReference;
+    sum += vkCmdBindDescriptorSets;
+    sum += vkCmdBindIndexBuffer;
+    sum += vkCmdBindVertexBuffers;
+    return sum;
+  }
+};
+
+class StateFilter {
+public:
+  explicit StateFilter(CommandBufferFunctions const& command_buffer) : _command_buffer(command_buffer) {}
+  StateFilter(StateFilter const&) = delete;
+  StateFilter& operator=(StateFilter const&) = delete;
+
+  CommandBufferFunctions const& command_buffer() const { return _command_buffer; }
+  VkResult vkBeginCommandBuffer(const VkCommandBufferBeginInfo* pBeginInfo);
+  VkResult vkEndCommandBuffer();
+  void vkCmdBindPipeline(VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline);
+  void vkCmdSetViewport(uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports);
+  void vkCmdSetScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors);
+  void vkCmdSetLineWidth(float lineWidth);
+  void vkCmdSetBlendConstants(const float blendConstants[4]);
+  void vkCmdSetStencilReference(VkStencilFaceFlags faceMask, uint32_t reference);
+  void vkCmdBindDescriptorSets(VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets);
+  void vkCmdBindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType);
+  void vkCmdBindVertexBuffers(uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets);
+  void vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
+  void vkCmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance);
+  void vkCmdPushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues);
+
+  void invalidate();
+  StateFilterCounters const& counters() const { return _counters; }
+  void reset_counters() { _counters = StateFilterCounters(); }
+
+private:
+  CommandBufferFunctions const& _command_buffer;
+  StateFilterCounters _counters;
+
+  // Arguments of the last call passed on, per filtered command
+  detail::state_key _vkCmdBindPipeline;
+  detail::state_key _vkCmdSetViewport;
+  detail::state_key _vkCmdSetScissor;
+  detail::state_key _vkCmdSetLineWidth;
+  detail::state_key _vkCmdSetBlendConstants;
+  detail::state_key _vkCmdSetStencilReference;
+  detail::state_key _vkCmdBindDescriptorSets;
+  detail::state_key _vkCmdBindIndexBuffer;
+  detail::state_key _vkCmdBindVertexBuffers;
+};
+
+inline void StateFilter::invalidate() {
+  _vkCmdBindPipeline.invalidate();
+  _vkCmdSetViewport.invalidate();
+  _vkCmdSetScissor.invalidate();
+  _vkCmdSetLineWidth.invalidate();
+  _vkCmdSetBlendConstants.invalidate();
+  _vkCmdSetStencilReference.invalidate();
+  _vkCmdBindDescriptorSets.invalidate();
+  _vkCmdBindIndexBuffer.invalidate();
+  _vkCmdBindVertexBuffers.invalidate();
+}
+
+inline VkResult StateFilter::vkBeginCommandBuffer(const VkCommandBufferBeginInfo* pBeginInfo) {
+  invalidate();
+  ++_counters.forwarded;
+  return _command_buffer.vkBeginCommandBuffer(pBeginInfo);
+}
+
+inline VkResult StateFilter::vkEndCommandBuffer() {
+  invalidate();
+  ++_counters.forwarded;
+  return _command_buffer.vkEndCommandBuffer();
+}
+
+inline void StateFilter::vkCmdBindPipeline(VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+  _vkCmdBindPipeline.begin_call();
+  _vkCmdBindPipeline.add(pipelineBindPoint);
+  _vkCmdBindPipeline.add(pipeline);
+  if (!_vkCmdBindPipeline.end_call()) {
+    ++_counters.vkCmdBindPipeline;
+    return;
+  }
+  _vkCmdSetViewport.invalidate();
+  _vkCmdSetScissor.invalidate();
+  _vkCmdSetLineWidth.invalidate();
+  _vkCmdSetBlendConstants.invalidate();
+  _vkCmdSetStencilReference.invalidate();
+  ++_counters.forwarded;
+  _command_buffer.vkCmdBindPipeline(pipelineBindPoint, pipeline);
+}
+
+inline void StateFilter::vkCmdSetViewport(uint32_t firstViewport, uint32_t viewportCount, const VkViewport* pViewports) {
+  _vkCmdSetViewport.begin_call();
+  _vkCmdSetViewport.add(firstViewport);
+  _vkCmdSetViewport.add(viewportCount);
+  _vkCmdSetViewport.add_range(pViewports, viewportCount);
+  if (!_vkCmdSetViewport.end_call()) {
+    ++_counters.vkCmdSetViewport;
+    return;
+  }
+  ++_counters.forwarded;
+  _command_buffer.vkCmdSetViewport(firstViewport, viewportCount, pViewports);
+}
+
+inline void StateFilter::vkCmdSetScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D* pScissors) {
+  _vkCmdSetScissor.begin_call();
+  _vkCmdSetScissor.add(firstScissor);
+  _vkCmdSetScissor.add(scissorCount);
+  _vkCmdSetScissor.add_range(pScissors, scissorCount);
+  if (!_vkCmdSetScissor.end_call()) {
+    ++_counters.vkCmdSetScissor;
+    return;
+  }
+  ++_counters.forwarded;
+  _command_buffer.vkCmdSetScissor(firstScissor, scissorCount, pScissors);
+}
+
+inline void StateFilter::vkCmdSetLineWidth(float lineWidth) {
+  _vkCmdSetLineWidth.begin_call();
+  _vkCmdSetLineWidth.add(lineWidth);
+  if (!_vkCmdSetLineWidth.end_call()) {
+    ++_counters.vkCmdSetLineWidth;
+    return;
+  }
+  ++_counters.forwarded;
+  _command_buffer.vkCmdSetLineWidth(lineWidth);
+}
+
+inline void StateFilter::vkCmdSetBlendConstants(const float blendConstants[4]) {
+  _vkCmdSetBlendConstants.begin_call();
+  _vkCmdSetBlendConstants.add_range(blendConstants, 4);
+  if (!_vkCmdSetBlendConstants.end_call()) {
+    ++_counters.vkCmdSetBlendConstants;
+    return;
+  }
+  ++_counters.forwarded;
+  _command_buffer.vkCmdSetBlendConstants(blendConstants);
+}
+
+inline void StateFilter::vkCmdSetStencilReference(VkStencilFaceFlags faceMask, uint32_t reference) {
+  _vkCmdSetStencilReference.begin_call();
+  _vkCmdSetStencilReference.add(faceMask);
+  _vkCmdSetStencilReference.add(reference);
+  if (!_vkCmdSetStencilReference.end_call()) {
+    ++_counters.vkCmdSetStencilReference;
+    return;
+  }
+  ++_counters.forwarded;
+  _command_buffer.vkCmdSetStencilReference(faceMask, reference);
+}
+
+inline void StateFilter::vkCmdBindDescriptorSets(VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t* pDynamicOffsets) {
+  _vkCmdBindDescriptorSets.begin_call();
+  _vkCmdBindDescriptorSets.add(pipelineBindPoint);
+  _vkCmdBindDescriptorSets.add(layout);
+  _vkCmdBindDescriptorSets.add(firstSet);
+  _vkCmdBindDescriptorSets.add(descriptorSetCount);
+  _vkCmdBindDescriptorSets.add_range(pDescriptorSets, descriptorSetCount);
+  _vkCmdBindDescriptorSets.add(dynamicOffsetCount);
+  _vkCmdBindDescriptorSets.add_range(pDynamicOffsets, dynamicOffsetCount);
+  if (!_vkCmdBindDescriptorSets.end_call()) {
+    ++_counters.vkCmdBindDescriptorSets;
+    return;
+  }
+  ++_counters.forwarded;
+  _command_buffer.vkCmdBindDescriptorSets(pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+
+inline void StateFilter::vkCmdBindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
+  _vkCmdBindIndexBuffer.begin_call();
+  _vkCmdBindIndexBuffer.add(buffer);
+  _vkCmdBindIndexBuffer.add(offset);
+  _vkCmdBindIndexBuffer.add(indexType);
+  if (!_vkCmdBindIndexBuffer.end_call()) {
+    ++_counters.vkCmdBindIndexBuffer;
+    return;
+  }
+  ++_counters.forwarded;
+  _command_buffer.vkCmdBindIndexBuffer(buffer, offset, indexType);
+}
+
+inline void StateFilter::vkCmdBindVertexBuffers(uint32_t firstBinding, uint32_t bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) {
+  _vkCmdBindVertexBuffers.begin_call();
+  _vkCmdBindVertexBuffers.add(firstBinding);
+  _vkCmdBindVertexBuffers.add(bindingCount);
+  _vkCmdBindVertexBuffers.add_range(pBuffers, bindingCount);
+  _vkCmdBindVertexBuffers.add_range(pOffsets, bindingCount);
+  if (!_vkCmdBindVertexBuffers.end_call()) {
+    ++_counters.vkCmdBindVertexBuffers;
+    return;
+  }
+  ++_counters.forwarded;
+  _command_buffer.vkCmdBindVertexBuffers(firstBinding, bindingCount, pBuffers, pOffsets);
+}
+
+inline void StateFilter::vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+  ++_counters.forwarded;
+  _command_buffer.vkCmdDraw(vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+inline void StateFilter::vkCmdDrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+  ++_counters.forwarded;
+  _command_buffer.vkCmdDrawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+
+inline void StateFilter::vkCmdPushConstants(VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void* pValues) {
+  ++_counters.forwarded;
+  _command_buffer.vkCmdPushConstants(layout, stageFlags, offset, size, pValues);
+}
+
+} // vkgen
+
+#endif // VK_STATE_FILTER_INCLUDE
@@ -0,0 +1,551 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#![allow(non_camel_case_types)]
+#![allow(non_snake_case)]
+
+#[macro_use]
+#[allow(unused_macros)] // Some are only used by extensions, which may all be disabled
+mod macros {
+    pub use ::std::ops::{BitOr, BitAnd};
+    pub use ::std::{fmt, mem};
+
+    /*
+    For regular enums, a repr(C) enum is used, which seems to be the way to go.
+    Things become a bit more difficult for flags because Rust requires enum values
+    to be valid variants, which is not the case when oring them together. Instead,
+    the flag types use the newtype pattern to build a struct that wraps an
+    integer. Being repr(transparent), the struct is guaranteed to have the same
+    ABI as the wrapped VkFlags, so it can be passed to C as is. The flags are
+    associated constants and the bit operations are const fns, so combinations
+    of flags can be computed at compile time. The BitOr and BitAnd operators are
+    provided for convenience outside of constant expressions.
+    */
+    macro_rules! flag_definitions {
+        ($bit_definitions:ident, { $($flag:ident = $flag_val:expr,)* }) => (
+            #[repr(C)]
+            pub enum $bit_definitions {
+                $(
+                    $flag = $flag_val,
+                )*
+            }
+        )
+    }
+
+    macro_rules! bitmask {
+        ($bitmask:ident) => (
+            #[repr(transparent)]
+            #[derive(Debug, Copy, Clone, PartialEq, Eq, Hash, Default)]
+            pub struct $bitmask {
+                flags: VkFlags,
+            }
+
+            #[allow(dead_code)]
+            impl $bitmask {
+                pub const NONE: $bitmask = $bitmask { flags: 0 };
+
+                #[inline]
+                pub const fn from_raw(flags: VkFlags) -> $bitmask {
+                    $bitmask { flags: flags }
+                }
+
+                #[inline]
+                pub const fn as_raw(self) -> VkFlags {
+                    self.flags
+                }
+
+                #[inline]
+                pub const fn is_empty(self) -> bool {
+                    self.flags == 0
+                }
+
+                #[inline]
+                pub const fn contains(self, other: $bitmask) -> bool {
+                    self.flags & other.flags == other.flags
+                }
+
+                #[inline]
+                pub const fn intersects(self, other: $bitmask) -> bool {
+                    self.flags & other.flags != 0
+                }
+
+                #[inline]
+                pub const fn union(self, other: $bitmask) -> $bitmask {
+                    $bitmask { flags: self.flags | other.flags }
+                }
+
+                #[inline]
+                pub const fn intersection(self, other: $bitmask) -> $bitmask {
+                    $bitmask { flags: self.flags & other.flags }
+                }
+
+                #[inline]
+                pub const fn difference(self, other: $bitmask) -> $bitmask {
+                    $bitmask { flags: self.flags & !other.flags }
+                }
+            }
+
+            impl BitOr for $bitmask {
+                type Output = Self;
+
+                #[inline]
+                fn bitor(self, rhs: Self) -> Self {
+                    self.union(rhs)
+                }
+            }
+
+            impl BitAnd for $bitmask {
+                type Output = Self;
+
+                #[inline]
+                fn bitand(self, rhs: Self) -> Self {
+                    self.intersection(rhs)
+                }
+            }
+        )
+    }
+
+    macro_rules! flag_traits {
+        ($bitmask:ident) => (
+            impl fmt::Display for $bitmask {
+                fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+                    write!(f, concat!(stringify!($bitmask), " {{\n}}"))
+                }
+            }
+        );
+        ($bitmask:ident, $bit_definitions:ident, { $($flag:ident = $flag_val:expr,)* }) => (
+            impl $bitmask {
+                $(
+                    pub const $flag: $bitmask = $bitmask { flags: $flag_val };
+                )*
+            }
+
+            impl From<$bit_definitions> for $bitmask {
+                #[inline]
+                fn from(bit: $bit_definitions) -> $bitmask {
+                    $bitmask { flags: bit as VkFlags }
+                }
+            }
+
+            impl BitOr<$bit_definitions> for $bitmask {
+                type Output = Self;
+
+                #[inline]
+                fn bitor(self, rhs: $bit_definitions) -> Self {
+                    $bitmask { flags: self.flags | (rhs as VkFlags) }
+                }
+            }
+
+            impl BitAnd<$bit_definitions> for $bitmask {
+                type Output = Self;
+
+                #[inline]
+                fn bitand(self, rhs: $bit_definitions) -> Self {
+                    $bitmask { flags: self.flags & (rhs as VkFlags) }
+                }
+            }
+
+            impl fmt::Display for $bitmask {
+                fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+                    write!(f, concat!(
+                        stringify!($bitmask), " {{\n",
+                            $(
+                                "    [{}] ", stringify!($flag), "\n",
+                            )* "}}"
+                        )
+                        $(, if self.contains($bitmask::$flag) { "x" } else { " " } )*
+                    )
+                }
+            }
+        )
+    }
+
+    macro_rules! vulkan_flags {
+        ($bitmask:ident) => (
+            bitmask!($bitmask);
+            flag_traits!($bitmask);
+        );
+        ($bitmask:ident, $bit_definitions:ident, { $($flag:ident = $flag_val:expr,)* }) => (
+            flag_definitions!($bit_definitions, {$($flag = $flag_val,)*});
+            bitmask!($bitmask);
+            flag_traits!($bitmask, $bit_definitions, {$($flag = $flag_val,)*});
+        );
+    }
+
+    // I don't think I can use "system" as that translates into "C" for
+    // 64 bit Windows, but Vulkan always uses "stdcall" on Windows.
+    #[cfg(windows)]
+    macro_rules! vk_fun {
+        (($($param_id:ident: $param_type:ty),*) -> $return_type:ty) => (
+            unsafe extern "stdcall" fn($($param_id: $param_type),*) -> $return_type
+        );
+    }
+
+    #[cfg(not(windows))]
+    macro_rules! vk_fun {
+        (($($param_id:ident: $param_type:ty),*) -> $return_type:ty) => (
+            unsafe extern "C" fn($($param_id: $param_type),*) -> $return_type
+        );
+    }
+
+    // Generates a global dispatch table consisting of the provided member
+    // functions. This table uses the entry function to load commands not
+    // depending on an instance. For each function pointer an inline method
+    // is generated to hide function pointer syntax.
+    macro_rules! global_dispatch_table {
+        { $($fun:ident => ($($param_id:ident: $param_type:ty),*) -> $return_type:ty,)* } => (
+            // Define member function pointers
+            pub struct GlobalDispatchTable {
+                $(
+                    $fun: vk_fun!(($($param_id: $param_type),*) -> $return_type),
+                )*
+            }
+
+            impl GlobalDispatchTable {
+                pub fn new(vulkan_entry: &VulkanEntry) -> Result<GlobalDispatchTable, String> {
+                    unsafe {
+                        Ok(GlobalDispatchTable {
+                            // Attempt to load provided function pointers into
+                            // their corresponding variables. Early exits in case
+                            // of failure assures that success means that all
+                            // pointers are valid to call.
+                            $(
+                                $fun: match vulkan_entry.vkGetInstanceProcAddr(0, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+                                    Some(f) => mem::transmute(f),
+                                    None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
+                                },
+                            )*
+                        })
+                    }
+                }
+
+                // Generate unsafe methods that simply wraps an internal function
+                // pointer. Note that creation of this struct ensures pointers
+                // are valid, but unsafe is used here to indicate to the caller
+                // that the method is a raw C-function behind the scenes.
+                $(
+                    #[inline]
+                    pub unsafe fn $fun(&self $(, $param_id: $param_type)*) -> $return_type {
+                        (self.$fun)($($param_id),*)
+                    }
+                )*
+            }
+        )
+    }
+
+    // Similar to the global_dispatch_table! macro, but creating the table additionally
+    // requires a VkInstance to pass as parameter to vkGetInstanceProcAddr.
+    macro_rules! instance_dispatch_table {
+        { $($fun:ident => ($($param_id:ident: $param_type:ty),*) -> $return_type:ty,)* } => (
+            pub struct InstanceDispatchTable {
+                $(
+                    $fun: vk_fun!(($($param_id: $param_type),*) -> $return_type),
+                )*
+            }
+
+            impl InstanceDispatchTable {
+                pub fn new(vulkan_entry: &VulkanEntry, instance: VkInstance) -> Result<InstanceDispatchTable, String> {
+                    unsafe {
+                        Ok(InstanceDispatchTable {
+                            $(
+                                $fun: match vulkan_entry.vkGetInstanceProcAddr(instance, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+                                    Some(f) => mem::transmute(f),
+                                    None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
+                                },
+                            )*
+                        })
+                    }
+                }
+
+                $(
+                    #[inline]
+                    pub unsafe fn $fun(&self $(, $param_id: $param_type)*) -> $return_type {
+                        (self.$fun)($($param_id),*)
+                    }
+                )*
+            }
+        )
+    }
+
+    // Similar to the other dispatch table macros, but this time we need the
+    // instance dispatch table for vkGetDeviceProcAddr and a Device object to
+    // generate the table for.
+    macro_rules! device_dispatch_table {
+        { $($fun:ident => ($($param_id:ident: $param_type:ty),*) -> $return_type:ty,)* } => (
+            pub struct DeviceDispatchTable {
+                $(
+                    $fun: vk_fun!(($($param_id: $param_type),*) -> $return_type),
+                )*
+            }
+
+            impl DeviceDispatchTable {
+                pub fn new(instance_table: &InstanceDispatchTable, device: VkDevice) -> Result<DeviceDispatchTable, String> {
+                    unsafe {
+                        Ok(DeviceDispatchTable {
+                            $(
+                                $fun: match instance_table.vkGetDeviceProcAddr(device, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+                                    Some(f) => mem::transmute(f),
+                                    None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
+                                },
+                            )*
+                        })
+                    }
+                }
+
+                $(
+                    #[inline]
+                    pub unsafe fn $fun(&self $(, $param_id: $param_type)*) -> $return_type {
+                        (self.$fun)($($param_id),*)
+                    }
+                )*
+            }
+
+            lazy_device_dispatch_table!{
+                $($fun => ($($param_id: $param_type),*) -> $return_type,)*
+            }
+        )
+    }
+
+    // Generates LazyDeviceDispatchTable, an alternative to DeviceDispatchTable
+    // that resolves each command the first time it is called rather than all of
+    // them up front. Every slot is an atomic pointer that starts out null and is
+    // set once the command has been resolved, so calling through the table only
+    // costs a load and a null test. Calling a command the driver does not have
+    // panics. The table holds no references and only atomics, so it is Sync and
+    // can be shared between threads, for example in a static OnceLock.
+    macro_rules! lazy_device_dispatch_table {
+        { $($fun:ident => ($($param_id:ident: $param_type:ty),*) -> $return_type:ty,)* } => (
+            pub struct LazyDeviceDispatchTable {
+                device: VkDevice,
+                get_device_proc_addr: vk_fun!((device: VkDevice, pName: *const c_char) -> Option<PFN_vkVoidFunction>),
+                $(
+                    $fun: ::std::sync::atomic::AtomicPtr<c_void>,
+                )*
+            }
+
+            impl LazyDeviceDispatchTable {
+                pub fn new(instance_table: &InstanceDispatchTable, device: VkDevice) -> LazyDeviceDispatchTable {
+                    LazyDeviceDispatchTable {
+                        device: device,
+                        get_device_proc_addr: instance_table.vkGetDeviceProcAddr,
+                        $(
+                            $fun: ::std::sync::atomic::AtomicPtr::new(::std::ptr::null_mut()),
+                        )*
+                    }
+                }
+
+                // Kept out of line so that the calling methods stay small. Racing
+                // threads may both resolve a command, but they store the same
+                // pointer.
+                #[cold]
+                #[inline(never)]
+                unsafe fn resolve(&self, slot: &::std::sync::atomic::AtomicPtr<c_void>, name: &'static str) -> *mut c_void {
+                    match (self.get_device_proc_addr)(self.device, name.as_ptr() as *const c_char) {
+                        Some(f) => {
+                            let p = f as *mut c_void;
+                            slot.store(p, ::std::sync::atomic::Ordering::Release);
+                            p
+                        },
+                        None => panic!("Could not load {}", &name[..name.len() - 1]),
+                    }
+                }
+
+                $(
+                    #[inline]
+                    pub unsafe fn $fun(&self $(, $param_id: $param_type)*) -> $return_type {
+                        let mut p = self.$fun.load(::std::sync::atomic::Ordering::Acquire);
+                        if p.is_null() {
+                            p = self.resolve(&self.$fun, concat!(stringify!($fun), "\0"));
+                        }
+                        let f: vk_fun!(($($param_id: $param_type),*) -> $return_type) = mem::transmute(p);
+                        f($($param_id),*)
+                    }
+                )*
+            }
+        )
+    }
+
+    macro_rules! load_function {
+        (instance, $fun:ident, $vulkan_entry:ident, $instance:ident) => (
+            match $vulkan_entry.vkGetInstanceProcAddr($instance, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+                Some(f) => mem::transmute(f),
+                None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
+            }
+        );
+        (instance, $fun:ident, $vulkan_entry:ident, $instance:ident, $instance_table:ident, $device:ident) => (
+            match $vulkan_entry.vkGetInstanceProcAddr($instance, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+                Some(f) => mem::transmute(f),
+                None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
+            }
+        );
+        (device, $fun:ident, $vulkan_entry:ident, $instance:ident, $instance_table:ident, $device:ident) => (
+            match $instance_table.vkGetDeviceProcAddr($device, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+                Some(f) => mem::transmute(f),
+                None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
+            }
+        );
+    }
+
+    macro_rules! table_ctor {
+        (instance, $table_name:ident $(, $fun_type:ident, $fun:ident)*) => (
+            #[allow(unused_variables)] // Yes, vulkan_entry and instance are used
+            pub fn new(vulkan_entry: &VulkanEntry, instance: VkInstance) -> Result<$table_name, String> {
+                #[allow(unused_unsafe)]            
+                unsafe {
+                    Ok($table_name {
+                        $(
+                            $fun: load_function!($fun_type, $fun, vulkan_entry, instance),
+                        )*
+                    })
+                }
+            }
+        );
+        (device, $table_name:ident $(, $fun_type:ident, $fun:ident)*) => (
+            #[allow(unused_variables)] // For device extensions, instance and device functions use different parameters
+            pub fn new(vulkan_entry: &VulkanEntry, instance: VkInstance, instance_table: &InstanceDispatchTable, device: VkDevice) -> Result<$table_name, String> {
+                #[allow(unused_unsafe)] // Yes, it is necessary. Don't know why it says it isn't
+                unsafe {
+                    Ok($table_name {
+                        $(
+                            $fun: load_function!($fun_type, $fun, vulkan_entry, instance, instance_table, device),
+                        )*
+                    })
+                }
+            }
+        );
+    }
+
+    // Generates a dispatch table in a similar fashion as before. Slightly more
+    // complex because we invoke it for multiple tables, and commands can be
+    // either instance or device commands, which are loaded differently.
+    macro_rules! extension_dispatch_table {
+        { $table_name:ident | $ext_type:ident, { $([$fun_type:ident] $fun:ident => ($($param_id:ident: $param_type:ty),*) -> $return_type:ty,)* } } => (
+            pub struct $table_name {
+                $(
+                    $fun: vk_fun!(($($param_id: $param_type),*) -> $return_type),
+                )*
+            }
+
+            impl $table_name {
+                table_ctor!($ext_type, $table_name $(,$fun_type, $fun)*);
+
+                $(
+                    #[inline]
+                    pub unsafe fn $fun(&self $(, $param_id: $param_type)*) -> $return_type {
+                        (self.$fun)($($param_id),*)
+                    }
+                )*
+            }
+        )
+    }
+
+    // Like load_function!, but yields None instead of failing when the loader
+    // does not know about the function.
+    macro_rules! load_optional_function {
+        (instance, $fun:ident, $vulkan_entry:ident, $instance:ident, $instance_table:ident, $device:ident) => (
+            match $vulkan_entry.vkGetInstanceProcAddr($instance, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+                Some(f) => Some(mem::transmute(f)),
+                None => None,
+            }
+        );
+        (device, $fun:ident, $vulkan_entry:ident, $instance:ident, $instance_table:ident, $device:ident) => (
+            match $instance_table.vkGetDeviceProcAddr($device, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+                Some(f) => Some(mem::transmute(f)),
+                None => None,
+            }
+        );
+    }
+
+    // Generates DeviceDispatch, an alternative to creating one table per device
+    // extension. It wraps the core device table and has an optional slot for
+    // every device extension command, filled in a single pass for the
+    // extensions in the enabled set and left as None for the others. Slots are
+    // public so that presence can be checked with is_some(), which is just a
+    // null test since Option of a function pointer has the same representation
+    // as the pointer itself. Core commands are reached through Deref.
+    macro_rules! device_dispatch {
+        { $(#[$cfg:meta] $ext:ident => { $([$fun_type:ident] $fun:ident => ($($param_id:ident: $param_type:ty),*) -> $return_type:ty,)* },)* } => (
+            pub struct DeviceDispatch {
+                core: DeviceDispatchTable,
+                $($(
+                    #[$cfg]
+                    pub $fun: Option<vk_fun!(($($param_id: $param_type),*) -> $return_type)>,
+                )*)*
+            }
+
+            impl DeviceDispatch {
+                #[allow(unused_variables)]
+                pub fn new(vulkan_entry: &VulkanEntry, instance: VkInstance, instance_table: &InstanceDispatchTable, device: VkDevice, enabled_extensions: &[&str]) -> Result<DeviceDispatch, String> {
+                    let enabled = |name: &str| enabled_extensions.iter().any(|e| *e == name);
+
+                    #[allow(unused_mut)]
+                    let mut table = DeviceDispatch {
+                        core: DeviceDispatchTable::new(instance_table, device)?,
+                        $($(
+                            #[$cfg]
+                            $fun: None,
+                        )*)*
+                    };
+
+                    #[allow(unused_unsafe)] // When no extension is compiled in
+                    unsafe {
+                        $(
+                            #[$cfg]
+                            if enabled(stringify!($ext)) {
+                                $(
+                                    table.$fun = load_optional_function!($fun_type, $fun, vulkan_entry, instance, instance_table, device);
+                                )*
+                            }
+                        )*
+                    }
+
+                    Ok(table)
+                }
+
+                // Calling a command whose extension was not enabled is a
+                // programming error and panics.
+                $($(
+                    #[$cfg]
+                    #[inline]
+                    pub unsafe fn $fun(&self $(, $param_id: $param_type)*) -> $return_type {
+                        (self.$fun.expect(concat!(stringify!($fun), " is not loaded")))($($param_id),*)
+                    }
+                )*)*
+            }
+
+            impl ::std::ops::Deref for DeviceDispatch {
+                type Target = DeviceDispatchTable;
+
+                fn deref(&self) -> &DeviceDispatchTable {
+                    &self.core
+                }
+            }
+        )
+    }
+} // mod macros
+
+#[path = "vulkan_core.rs"]
+pub mod core;
+
+#[path = "vulkan_extensions.rs"]
+pub mod extensions;
+
+// Compile time checks that struct layouts match C, printed by the program
+// generated in vulkan_layout.c when built for the target platform.
+#[cfg(feature = "layout_assertions")]
+#[path = "vulkan_layout.rs"]
+mod layout;
@@ -0,0 +1,3900 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+use super::macros::*;
+extern crate libloading;
+pub use ::std::os::raw::{c_void, c_char, c_int, c_ulong};
+
+pub fn VK_MAKE_VERSION(major: u32, minor: u32, patch: u32) -> u32 {
+    (major << 22) | (minor << 12) | patch
+}
+
+// Common beginning of structs that can be part of a pNext chain, used by
+// builders to link them together.
+#[repr(C)]
+pub struct ChainLink {
+    pub sType: VkStructureType,
+    pub pNext: *mut ChainLink,
+}
+
+pub type VkFlags = u32;
+pub type VkBool32 = u32;
+pub type VkSampleMask = u32;
+pub type VkDeviceSize = u64;
+
+pub type VkInstance = usize;
+pub type VkPhysicalDevice = usize;
+pub type VkDevice = usize;
+pub type VkQueue = usize;
+pub type VkSemaphore = u64;
+pub type VkCommandBuffer = usize;
+pub type VkFence = u64;
+pub type VkSampler = u64;
+pub type VkDescriptorSetLayout = u64;
+pub type VkPipelineLayout = u64;
+pub type VkShaderModule = u64;
+pub type VkPipelineCache = u64;
+pub type VkRenderPass = u64;
+pub type VkPipeline = u64;
+pub type VkCommandPool = u64;
+pub type VkFramebuffer = u64;
+pub type VkDescriptorSet = u64;
+pub type VkBuffer = u64;
+pub type VkImage = u64;
+
+pub const VK_LOD_CLAMP_NONE: f32 = 1000.0;
+pub const VK_REMAINING_MIP_LEVELS: u32 = !0;
+pub const VK_WHOLE_SIZE: u64 = !0;
+pub const VK_TRUE: u32 = 1;
+pub const VK_FALSE: u32 = 0;
+pub const VK_QUEUE_FAMILY_IGNORED: u32 = !0;
+pub const VK_MAX_PHYSICAL_DEVICE_NAME_SIZE: u32 = 256;
+pub const VK_MAX_EXTENSION_NAME_SIZE: u32 = 256;
+pub const VK_MAX_DESCRIPTION_SIZE: u32 = 256;
+
+#[repr(C)]
+pub enum VkPipelineCacheHeaderVersion {
+    VK_PIPELINE_CACHE_HEADER_VERSION_ONE = 1,
+}
+
+#[repr(C)]
+pub enum VkResult {
+    VK_SUCCESS = 0,
+    VK_NOT_READY = 1,
+    VK_TIMEOUT = 2,
+    VK_INCOMPLETE = 5,
+    VK_ERROR_OUT_OF_HOST_MEMORY = -1,
+    VK_ERROR_OUT_OF_DEVICE_MEMORY = -2,
+    VK_ERROR_INITIALIZATION_FAILED = -3,
+    VK_ERROR_DEVICE_LOST = -4,
+    VK_ERROR_LAYER_NOT_PRESENT = -6,
+    VK_ERROR_EXTENSION_NOT_PRESENT = -7,
+    VK_ERROR_SURFACE_LOST_KHR = -1000000000,
+    VK_ERROR_INVALID_SHADER_NV = -1000012000,
+}
+
+#[repr(C)]
+pub enum VkStructureType {
+    VK_STRUCTURE_TYPE_APPLICATION_INFO = 0,
+    VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO = 1,
+    VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO = 2,
+    VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO = 3,
+    VK_STRUCTURE_TYPE_SUBMIT_INFO = 4,
+    VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO = 16,
+    VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO = 18,
+    VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO = 19,
+    VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO = 20,
+    VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO = 21,
+    VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO = 22,
+    VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO = 23,
+    VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO = 24,
+    VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO = 25,
+    VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO = 26,
+    VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO = 27,
+    VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO = 28,
+    VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO = 30,
+    VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO = 31,
+    VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO = 32,
+    VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO = 39,
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO = 40,
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO = 41,
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO = 42,
+    VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR = 1000001000,
+    VK_STRUCTURE_TYPE_PRESENT_INFO_KHR = 1000001001,
+    VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR = 1000004000,
+    VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT = 1000061000,
+}
+
+#[repr(C)]
+pub enum VkFilter {
+    VK_FILTER_NEAREST = 0,
+    VK_FILTER_LINEAR = 1,
+}
+
+#[repr(C)]
+pub enum VkSamplerMipmapMode {
+    VK_SAMPLER_MIPMAP_MODE_NEAREST = 0,
+    VK_SAMPLER_MIPMAP_MODE_LINEAR = 1,
+}
+
+#[repr(C)]
+pub enum VkSamplerAddressMode {
+    VK_SAMPLER_ADDRESS_MODE_REPEAT = 0,
+    VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT = 1,
+    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE = 2,
+    VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER = 3,
+}
+
+#[repr(C)]
+pub enum VkCompareOp {
+    VK_COMPARE_OP_NEVER = 0,
+    VK_COMPARE_OP_LESS = 1,
+    VK_COMPARE_OP_EQUAL = 2,
+    VK_COMPARE_OP_LESS_OR_EQUAL = 3,
+    VK_COMPARE_OP_GREATER = 4,
+    VK_COMPARE_OP_NOT_EQUAL = 5,
+    VK_COMPARE_OP_GREATER_OR_EQUAL = 6,
+    VK_COMPARE_OP_ALWAYS = 7,
+}
+
+#[repr(C)]
+pub enum VkBorderColor {
+    VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK = 0,
+    VK_BORDER_COLOR_INT_TRANSPARENT_BLACK = 1,
+    VK_BORDER_COLOR_FLOAT_OPAQUE_BLACK = 2,
+    VK_BORDER_COLOR_INT_OPAQUE_BLACK = 3,
+    VK_BORDER_COLOR_FLOAT_OPAQUE_WHITE = 4,
+    VK_BORDER_COLOR_INT_OPAQUE_WHITE = 5,
+}
+
+#[repr(C)]
+pub enum VkDescriptorType {
+    VK_DESCRIPTOR_TYPE_SAMPLER = 0,
+    VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER = 1,
+    VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE = 2,
+    VK_DESCRIPTOR_TYPE_STORAGE_IMAGE = 3,
+    VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER = 4,
+    VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER = 5,
+    VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER = 6,
+    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER = 7,
+    VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC = 8,
+    VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC = 9,
+    VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT = 10,
+}
+
+#[repr(C)]
+pub enum VkVertexInputRate {
+    VK_VERTEX_INPUT_RATE_VERTEX = 0,
+    VK_VERTEX_INPUT_RATE_INSTANCE = 1,
+}
+
+#[repr(C)]
+pub enum VkFormat {
+    VK_FORMAT_UNDEFINED = 0,
+    VK_FORMAT_R4G4_UNORM_PACK8 = 1,
+    VK_FORMAT_R8G8B8A8_UNORM = 37,
+    VK_FORMAT_B8G8R8A8_UNORM = 44,
+    VK_FORMAT_R32G32B32_SFLOAT = 106,
+}
+
+#[repr(C)]
+pub enum VkPrimitiveTopology {
+    VK_PRIMITIVE_TOPOLOGY_POINT_LIST = 0,
+    VK_PRIMITIVE_TOPOLOGY_LINE_LIST = 1,
+    VK_PRIMITIVE_TOPOLOGY_LINE_STRIP = 2,
+    VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST = 3,
+    VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP = 4,
+    VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN = 5,
+}
+
+#[repr(C)]
+pub enum VkPolygonMode {
+    VK_POLYGON_MODE_FILL = 0,
+    VK_POLYGON_MODE_LINE = 1,
+    VK_POLYGON_MODE_POINT = 2,
+}
+
+#[repr(C)]
+pub enum VkFrontFace {
+    VK_FRONT_FACE_COUNTER_CLOCKWISE = 0,
+    VK_FRONT_FACE_CLOCKWISE = 1,
+}
+
+#[repr(C)]
+pub enum VkStencilOp {
+    VK_STENCIL_OP_KEEP = 0,
+    VK_STENCIL_OP_ZERO = 1,
+    VK_STENCIL_OP_REPLACE = 2,
+    VK_STENCIL_OP_INCREMENT_AND_CLAMP = 3,
+    VK_STENCIL_OP_DECREMENT_AND_CLAMP = 4,
+    VK_STENCIL_OP_INVERT = 5,
+    VK_STENCIL_OP_INCREMENT_AND_WRAP = 6,
+    VK_STENCIL_OP_DECREMENT_AND_WRAP = 7,
+}
+
+#[repr(C)]
+pub enum VkLogicOp {
+    VK_LOGIC_OP_CLEAR = 0,
+    VK_LOGIC_OP_AND = 1,
+    VK_LOGIC_OP_AND_REVERSE = 2,
+    VK_LOGIC_OP_COPY = 3,
+}
+
+#[repr(C)]
+pub enum VkBlendFactor {
+    VK_BLEND_FACTOR_ZERO = 0,
+    VK_BLEND_FACTOR_ONE = 1,
+    VK_BLEND_FACTOR_SRC_COLOR = 2,
+    VK_BLEND_FACTOR_ONE_MINUS_SRC_COLOR = 3,
+    VK_BLEND_FACTOR_DST_COLOR = 4,
+    VK_BLEND_FACTOR_ONE_MINUS_DST_COLOR = 5,
+    VK_BLEND_FACTOR_SRC_ALPHA = 6,
+    VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA = 7,
+}
+
+#[repr(C)]
+pub enum VkBlendOp {
+    VK_BLEND_OP_ADD = 0,
+    VK_BLEND_OP_SUBTRACT = 1,
+    VK_BLEND_OP_REVERSE_SUBTRACT = 2,
+    VK_BLEND_OP_MIN = 3,
+    VK_BLEND_OP_MAX = 4,
+}
+
+#[repr(C)]
+pub enum VkDynamicState {
+    VK_DYNAMIC_STATE_VIEWPORT = 0,
+    VK_DYNAMIC_STATE_SCISSOR = 1,
+    VK_DYNAMIC_STATE_LINE_WIDTH = 2,
+    VK_DYNAMIC_STATE_DEPTH_BIAS = 3,
+    VK_DYNAMIC_STATE_BLEND_CONSTANTS = 4,
+    VK_DYNAMIC_STATE_DEPTH_BOUNDS = 5,
+    VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK = 6,
+    VK_DYNAMIC_STATE_STENCIL_WRITE_MASK = 7,
+    VK_DYNAMIC_STATE_STENCIL_REFERENCE = 8,
+}
+
+#[repr(C)]
+pub enum VkCommandBufferLevel {
+    VK_COMMAND_BUFFER_LEVEL_PRIMARY = 0,
+    VK_COMMAND_BUFFER_LEVEL_SECONDARY = 1,
+}
+
+#[repr(C)]
+pub enum VkPipelineBindPoint {
+    VK_PIPELINE_BIND_POINT_GRAPHICS = 0,
+    VK_PIPELINE_BIND_POINT_COMPUTE = 1,
+}
+
+#[repr(C)]
+pub enum VkIndexType {
+    VK_INDEX_TYPE_UINT16 = 0,
+    VK_INDEX_TYPE_UINT32 = 1,
+}
+
+#[repr(C)]
+pub enum VkSharingMode {
+    VK_SHARING_MODE_EXCLUSIVE = 0,
+    VK_SHARING_MODE_CONCURRENT = 1,
+}
+
+#[repr(C)]
+pub enum VkImageLayout {
+    VK_IMAGE_LAYOUT_UNDEFINED = 0,
+    VK_IMAGE_LAYOUT_GENERAL = 1,
+    VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL = 2,
+    VK_IMAGE_LAYOUT_PRESENT_SRC_KHR = 1000001002,
+}
+
+vulkan_flags!(VkInstanceCreateFlags);
+vulkan_flags!(VkQueueFlags, VkQueueFlagBits, {
+    VK_QUEUE_GRAPHICS_BIT = 0x00000001,
+    VK_QUEUE_COMPUTE_BIT = 0x00000002,
+    VK_QUEUE_TRANSFER_BIT = 0x00000004,
+    VK_QUEUE_SPARSE_BINDING_BIT = 0x00000008,
+});
+vulkan_flags!(VkDeviceCreateFlags);
+vulkan_flags!(VkDeviceQueueCreateFlags);
+vulkan_flags!(VkPipelineStageFlags, VkPipelineStageFlagBits, {
+    VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT = 0x00000001,
+    VK_PIPELINE_STAGE_VERTEX_INPUT_BIT = 0x00000004,
+    VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT = 0x00000400,
+    VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT = 0x00002000,
+});
+vulkan_flags!(VkSamplerCreateFlags);
+vulkan_flags!(VkDescriptorSetLayoutCreateFlags);
+vulkan_flags!(VkShaderStageFlags, VkShaderStageFlagBits, {
+    VK_SHADER_STAGE_VERTEX_BIT = 0x00000001,
+    VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT = 0x00000002,
+    VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT = 0x00000004,
+    VK_SHADER_STAGE_GEOMETRY_BIT = 0x00000008,
+    VK_SHADER_STAGE_FRAGMENT_BIT = 0x00000010,
+    VK_SHADER_STAGE_COMPUTE_BIT = 0x00000020,
+});
+vulkan_flags!(VkPipelineLayoutCreateFlags);
+vulkan_flags!(VkShaderModuleCreateFlags);
+vulkan_flags!(VkPipelineCreateFlags, VkPipelineCreateFlagBits, {
+    VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT = 0x00000001,
+    VK_PIPELINE_CREATE_ALLOW_DERIVATIVES_BIT = 0x00000002,
+    VK_PIPELINE_CREATE_DERIVATIVE_BIT = 0x00000004,
+});
+vulkan_flags!(VkPipelineShaderStageCreateFlags);
+vulkan_flags!(VkPipelineVertexInputStateCreateFlags);
+vulkan_flags!(VkPipelineInputAssemblyStateCreateFlags);
+vulkan_flags!(VkPipelineTessellationStateCreateFlags);
+vulkan_flags!(VkPipelineViewportStateCreateFlags);
+vulkan_flags!(VkPipelineRasterizationStateCreateFlags);
+vulkan_flags!(VkCullModeFlags, VkCullModeFlagBits, {
+    VK_CULL_MODE_FRONT_BIT = 0x00000001,
+    VK_CULL_MODE_BACK_BIT = 0x00000002,
+});
+vulkan_flags!(VkPipelineMultisampleStateCreateFlags);
+vulkan_flags!(VkPipelineDepthStencilStateCreateFlags);
+vulkan_flags!(VkPipelineColorBlendStateCreateFlags);
+vulkan_flags!(VkColorComponentFlags, VkColorComponentFlagBits, {
+    VK_COLOR_COMPONENT_R_BIT = 0x00000001,
+    VK_COLOR_COMPONENT_G_BIT = 0x00000002,
+    VK_COLOR_COMPONENT_B_BIT = 0x00000004,
+    VK_COLOR_COMPONENT_A_BIT = 0x00000008,
+});
+vulkan_flags!(VkPipelineDynamicStateCreateFlags);
+vulkan_flags!(VkCommandPoolCreateFlags, VkCommandPoolCreateFlagBits, {
+    VK_COMMAND_POOL_CREATE_TRANSIENT_BIT = 0x00000001,
+    VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT = 0x00000002,
+});
+vulkan_flags!(VkCommandBufferUsageFlags, VkCommandBufferUsageFlagBits, {
+    VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT = 0x00000001,
+    VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT = 0x00000002,
+    VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT = 0x00000004,
+});
+vulkan_flags!(VkQueryControlFlags, VkQueryControlFlagBits, {
+    VK_QUERY_CONTROL_PRECISE_BIT = 0x00000001,
+});
+vulkan_flags!(VkQueryPipelineStatisticFlags, VkQueryPipelineStatisticFlagBits, {
+    VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT = 0x00000001,
+});
+vulkan_flags!(VkStencilFaceFlags, VkStencilFaceFlagBits, {
+    VK_STENCIL_FACE_FRONT_BIT = 0x00000001,
+    VK_STENCIL_FACE_BACK_BIT = 0x00000002,
+});
+vulkan_flags!(VkSampleCountFlags, VkSampleCountFlagBits, {
+    VK_SAMPLE_COUNT_1_BIT = 0x00000001,
+    VK_SAMPLE_COUNT_2_BIT = 0x00000002,
+    VK_SAMPLE_COUNT_4_BIT = 0x00000004,
+});
+vulkan_flags!(VkImageUsageFlags, VkImageUsageFlagBits, {
+    VK_IMAGE_USAGE_TRANSFER_SRC_BIT = 0x00000001,
+    VK_IMAGE_USAGE_TRANSFER_DST_BIT = 0x00000002,
+    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT = 0x00000010,
+});
+
+pub type PFN_vkAllocationFunction = vk_fun!((pUserData: *mut c_void) -> *mut c_void);
+pub type PFN_vkFreeFunction = vk_fun!((pUserData: *mut c_void) -> ());
+pub type PFN_vkVoidFunction = vk_fun!(() -> ());
+
+#[repr(C)]
+pub struct VkApplicationInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub pApplicationName: *const c_char,
+    pub applicationVersion: u32,
+    pub pEngineName: *const c_char,
+    pub engineVersion: u32,
+    pub apiVersion: u32,
+}
+impl Default for VkApplicationInfo {
+    fn default() -> VkApplicationInfo {
+        VkApplicationInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_APPLICATION_INFO,
+            pNext: ::std::ptr::null(),
+            pApplicationName: ::std::ptr::null(),
+            applicationVersion: Default::default(),
+            pEngineName: ::std::ptr::null(),
+            engineVersion: Default::default(),
+            apiVersion: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkApplicationInfoBuilder<'a> {
+    inner: VkApplicationInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkApplicationInfo {
+    pub fn builder<'a>() -> VkApplicationInfoBuilder<'a> {
+        VkApplicationInfoBuilder { inner: VkApplicationInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkApplicationInfoBuilder<'a> {
+    pub fn pApplicationName(mut self, v: Option<&'a ::std::ffi::CStr>) -> Self {
+        self.inner.pApplicationName = v.map_or(::std::ptr::null(), |s| s.as_ptr());
+        self
+    }
+    pub fn applicationVersion(mut self, v: u32) -> Self {
+        self.inner.applicationVersion = v;
+        self
+    }
+    pub fn pEngineName(mut self, v: Option<&'a ::std::ffi::CStr>) -> Self {
+        self.inner.pEngineName = v.map_or(::std::ptr::null(), |s| s.as_ptr());
+        self
+    }
+    pub fn engineVersion(mut self, v: u32) -> Self {
+        self.inner.engineVersion = v;
+        self
+    }
+    pub fn apiVersion(mut self, v: u32) -> Self {
+        self.inner.apiVersion = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkApplicationInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkApplicationInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkApplicationInfoBuilder<'a> {
+    type Target = VkApplicationInfo;
+    fn deref(&self) -> &VkApplicationInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkApplicationInfo {}
+
+#[repr(C)]
+pub struct VkInstanceCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkInstanceCreateFlags,
+    pub pApplicationInfo: *const VkApplicationInfo,
+    pub enabledLayerCount: u32,
+    pub ppEnabledLayerNames: *const *const c_char,
+    pub enabledExtensionCount: u32,
+    pub ppEnabledExtensionNames: *const *const c_char,
+}
+impl Default for VkInstanceCreateInfo {
+    fn default() -> VkInstanceCreateInfo {
+        VkInstanceCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            pApplicationInfo: ::std::ptr::null(),
+            enabledLayerCount: Default::default(),
+            ppEnabledLayerNames: ::std::ptr::null(),
+            enabledExtensionCount: Default::default(),
+            ppEnabledExtensionNames: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkInstanceCreateInfoBuilder<'a> {
+    inner: VkInstanceCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkInstanceCreateInfo {
+    pub fn builder<'a>() -> VkInstanceCreateInfoBuilder<'a> {
+        VkInstanceCreateInfoBuilder { inner: VkInstanceCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkInstanceCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkInstanceCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pApplicationInfo(mut self, v: Option<&'a VkApplicationInfo>) -> Self {
+        self.inner.pApplicationInfo = v.map_or(::std::ptr::null(), |r| r as *const VkApplicationInfo);
+        self
+    }
+    pub fn ppEnabledLayerNames(mut self, v: &'a [*const c_char]) -> Self {
+        self.inner.enabledLayerCount = v.len() as u32;
+        self.inner.ppEnabledLayerNames = v.as_ptr();
+        self
+    }
+    pub fn ppEnabledExtensionNames(mut self, v: &'a [*const c_char]) -> Self {
+        self.inner.enabledExtensionCount = v.len() as u32;
+        self.inner.ppEnabledExtensionNames = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkInstanceCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkInstanceCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkInstanceCreateInfoBuilder<'a> {
+    type Target = VkInstanceCreateInfo;
+    fn deref(&self) -> &VkInstanceCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkInstanceCreateInfo {}
+
+#[repr(C)]
+pub struct VkAllocationCallbacks {
+    pub pUserData: *mut c_void,
+    pub pfnAllocation: Option<PFN_vkAllocationFunction>,
+    pub pfnFree: Option<PFN_vkFreeFunction>,
+}
+impl Default for VkAllocationCallbacks {
+    fn default() -> VkAllocationCallbacks {
+        VkAllocationCallbacks {
+            pUserData: ::std::ptr::null_mut(),
+            pfnAllocation: None,
+            pfnFree: None,
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkAllocationCallbacksBuilder<'a> {
+    inner: VkAllocationCallbacks,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkAllocationCallbacks {
+    pub fn builder<'a>() -> VkAllocationCallbacksBuilder<'a> {
+        VkAllocationCallbacksBuilder { inner: VkAllocationCallbacks::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkAllocationCallbacksBuilder<'a> {
+    pub fn pUserData(mut self, v: *mut c_void) -> Self {
+        self.inner.pUserData = v;
+        self
+    }
+    pub fn pfnAllocation(mut self, v: Option<PFN_vkAllocationFunction>) -> Self {
+        self.inner.pfnAllocation = v;
+        self
+    }
+    pub fn pfnFree(mut self, v: Option<PFN_vkFreeFunction>) -> Self {
+        self.inner.pfnFree = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkAllocationCallbacks {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkAllocationCallbacksBuilder<'a> {
+    type Target = VkAllocationCallbacks;
+    fn deref(&self) -> &VkAllocationCallbacks {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkPhysicalDeviceFeatures {
+    pub robustBufferAccess: VkBool32,
+    pub fullDrawIndexUint32: VkBool32,
+    pub imageCubeArray: VkBool32,
+    pub independentBlend: VkBool32,
+    pub geometryShader: VkBool32,
+    pub tessellationShader: VkBool32,
+    pub sampleRateShading: VkBool32,
+    pub dualSrcBlend: VkBool32,
+    pub logicOp: VkBool32,
+    pub multiDrawIndirect: VkBool32,
+    pub drawIndirectFirstInstance: VkBool32,
+    pub depthClamp: VkBool32,
+    pub depthBiasClamp: VkBool32,
+    pub fillModeNonSolid: VkBool32,
+    pub depthBounds: VkBool32,
+    pub wideLines: VkBool32,
+    pub largePoints: VkBool32,
+    pub alphaToOne: VkBool32,
+    pub multiViewport: VkBool32,
+    pub samplerAnisotropy: VkBool32,
+    pub textureCompressionETC2: VkBool32,
+    pub textureCompressionASTC_LDR: VkBool32,
+    pub textureCompressionBC: VkBool32,
+    pub occlusionQueryPrecise: VkBool32,
+    pub pipelineStatisticsQuery: VkBool32,
+    pub vertexPipelineStoresAndAtomics: VkBool32,
+    pub fragmentStoresAndAtomics: VkBool32,
+    pub shaderTessellationAndGeometryPointSize: VkBool32,
+    pub shaderImageGatherExtended: VkBool32,
+    pub shaderStorageImageExtendedFormats: VkBool32,
+    pub shaderStorageImageMultisample: VkBool32,
+    pub shaderStorageImageReadWithoutFormat: VkBool32,
+    pub shaderStorageImageWriteWithoutFormat: VkBool32,
+    pub shaderUniformBufferArrayDynamicIndexing: VkBool32,
+    pub shaderSampledImageArrayDynamicIndexing: VkBool32,
+    pub shaderStorageBufferArrayDynamicIndexing: VkBool32,
+    pub shaderStorageImageArrayDynamicIndexing: VkBool32,
+    pub shaderClipDistance: VkBool32,
+    pub shaderCullDistance: VkBool32,
+    pub shaderFloat64: VkBool32,
+    pub shaderInt64: VkBool32,
+    pub shaderInt16: VkBool32,
+    pub shaderResourceResidency: VkBool32,
+    pub shaderResourceMinLod: VkBool32,
+    pub sparseBinding: VkBool32,
+    pub sparseResidencyBuffer: VkBool32,
+    pub sparseResidencyImage2D: VkBool32,
+    pub sparseResidencyImage3D: VkBool32,
+    pub sparseResidency2Samples: VkBool32,
+    pub sparseResidency4Samples: VkBool32,
+    pub sparseResidency8Samples: VkBool32,
+    pub sparseResidency16Samples: VkBool32,
+    pub sparseResidencyAliased: VkBool32,
+    pub variableMultisampleRate: VkBool32,
+    pub inheritedQueries: VkBool32,
+}
+impl Default for VkPhysicalDeviceFeatures {
+    fn default() -> VkPhysicalDeviceFeatures {
+        VkPhysicalDeviceFeatures {
+            robustBufferAccess: Default::default(),
+            fullDrawIndexUint32: Default::default(),
+            imageCubeArray: Default::default(),
+            independentBlend: Default::default(),
+            geometryShader: Default::default(),
+            tessellationShader: Default::default(),
+            sampleRateShading: Default::default(),
+            dualSrcBlend: Default::default(),
+            logicOp: Default::default(),
+            multiDrawIndirect: Default::default(),
+            drawIndirectFirstInstance: Default::default(),
+            depthClamp: Default::default(),
+            depthBiasClamp: Default::default(),
+            fillModeNonSolid: Default::default(),
+            depthBounds: Default::default(),
+            wideLines: Default::default(),
+            largePoints: Default::default(),
+            alphaToOne: Default::default(),
+            multiViewport: Default::default(),
+            samplerAnisotropy: Default::default(),
+            textureCompressionETC2: Default::default(),
+            textureCompressionASTC_LDR: Default::default(),
+            textureCompressionBC: Default::default(),
+            occlusionQueryPrecise: Default::default(),
+            pipelineStatisticsQuery: Default::default(),
+            vertexPipelineStoresAndAtomics: Default::default(),
+            fragmentStoresAndAtomics: Default::default(),
+            shaderTessellationAndGeometryPointSize: Default::default(),
+            shaderImageGatherExtended: Default::default(),
+            shaderStorageImageExtendedFormats: Default::default(),
+            shaderStorageImageMultisample: Default::default(),
+            shaderStorageImageReadWithoutFormat: Default::default(),
+            shaderStorageImageWriteWithoutFormat: Default::default(),
+            shaderUniformBufferArrayDynamicIndexing: Default::default(),
+            shaderSampledImageArrayDynamicIndexing: Default::default(),
+            shaderStorageBufferArrayDynamicIndexing: Default::default(),
+            shaderStorageImageArrayDynamicIndexing: Default::default(),
+            shaderClipDistance: Default::default(),
+            shaderCullDistance: Default::default(),
+            shaderFloat64: Default::default(),
+            shaderInt64: Default::default(),
+            shaderInt16: Default::default(),
+            shaderResourceResidency: Default::default(),
+            shaderResourceMinLod: Default::default(),
+            sparseBinding: Default::default(),
+            sparseResidencyBuffer: Default::default(),
+            sparseResidencyImage2D: Default::default(),
+            sparseResidencyImage3D: Default::default(),
+            sparseResidency2Samples: Default::default(),
+            sparseResidency4Samples: Default::default(),
+            sparseResidency8Samples: Default::default(),
+            sparseResidency16Samples: Default::default(),
+            sparseResidencyAliased: Default::default(),
+            variableMultisampleRate: Default::default(),
+            inheritedQueries: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPhysicalDeviceFeaturesBuilder<'a> {
+    inner: VkPhysicalDeviceFeatures,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPhysicalDeviceFeatures {
+    pub fn builder<'a>() -> VkPhysicalDeviceFeaturesBuilder<'a> {
+        VkPhysicalDeviceFeaturesBuilder { inner: VkPhysicalDeviceFeatures::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPhysicalDeviceFeaturesBuilder<'a> {
+    pub fn robustBufferAccess(mut self, v: VkBool32) -> Self {
+        self.inner.robustBufferAccess = v;
+        self
+    }
+    pub fn fullDrawIndexUint32(mut self, v: VkBool32) -> Self {
+        self.inner.fullDrawIndexUint32 = v;
+        self
+    }
+    pub fn imageCubeArray(mut self, v: VkBool32) -> Self {
+        self.inner.imageCubeArray = v;
+        self
+    }
+    pub fn independentBlend(mut self, v: VkBool32) -> Self {
+        self.inner.independentBlend = v;
+        self
+    }
+    pub fn geometryShader(mut self, v: VkBool32) -> Self {
+        self.inner.geometryShader = v;
+        self
+    }
+    pub fn tessellationShader(mut self, v: VkBool32) -> Self {
+        self.inner.tessellationShader = v;
+        self
+    }
+    pub fn sampleRateShading(mut self, v: VkBool32) -> Self {
+        self.inner.sampleRateShading = v;
+        self
+    }
+    pub fn dualSrcBlend(mut self, v: VkBool32) -> Self {
+        self.inner.dualSrcBlend = v;
+        self
+    }
+    pub fn logicOp(mut self, v: VkBool32) -> Self {
+        self.inner.logicOp = v;
+        self
+    }
+    pub fn multiDrawIndirect(mut self, v: VkBool32) -> Self {
+        self.inner.multiDrawIndirect = v;
+        self
+    }
+    pub fn drawIndirectFirstInstance(mut self, v: VkBool32) -> Self {
+        self.inner.drawIndirectFirstInstance = v;
+        self
+    }
+    pub fn depthClamp(mut self, v: VkBool32) -> Self {
+        self.inner.depthClamp = v;
+        self
+    }
+    pub fn depthBiasClamp(mut self, v: VkBool32) -> Self {
+        self.inner.depthBiasClamp = v;
+        self
+    }
+    pub fn fillModeNonSolid(mut self, v: VkBool32) -> Self {
+        self.inner.fillModeNonSolid = v;
+        self
+    }
+    pub fn depthBounds(mut self, v: VkBool32) -> Self {
+        self.inner.depthBounds = v;
+        self
+    }
+    pub fn wideLines(mut self, v: VkBool32) -> Self {
+        self.inner.wideLines = v;
+        self
+    }
+    pub fn largePoints(mut self, v: VkBool32) -> Self {
+        self.inner.largePoints = v;
+        self
+    }
+    pub fn alphaToOne(mut self, v: VkBool32) -> Self {
+        self.inner.alphaToOne = v;
+        self
+    }
+    pub fn multiViewport(mut self, v: VkBool32) -> Self {
+        self.inner.multiViewport = v;
+        self
+    }
+    pub fn samplerAnisotropy(mut self, v: VkBool32) -> Self {
+        self.inner.samplerAnisotropy = v;
+        self
+    }
+    pub fn textureCompressionETC2(mut self, v: VkBool32) -> Self {
+        self.inner.textureCompressionETC2 = v;
+        self
+    }
+    pub fn textureCompressionASTC_LDR(mut self, v: VkBool32) -> Self {
+        self.inner.textureCompressionASTC_LDR = v;
+        self
+    }
+    pub fn textureCompressionBC(mut self, v: VkBool32) -> Self {
+        self.inner.textureCompressionBC = v;
+        self
+    }
+    pub fn occlusionQueryPrecise(mut self, v: VkBool32) -> Self {
+        self.inner.occlusionQueryPrecise = v;
+        self
+    }
+    pub fn pipelineStatisticsQuery(mut self, v: VkBool32) -> Self {
+        self.inner.pipelineStatisticsQuery = v;
+        self
+    }
+    pub fn vertexPipelineStoresAndAtomics(mut self, v: VkBool32) -> Self {
+        self.inner.vertexPipelineStoresAndAtomics = v;
+        self
+    }
+    pub fn fragmentStoresAndAtomics(mut self, v: VkBool32) -> Self {
+        self.inner.fragmentStoresAndAtomics = v;
+        self
+    }
+    pub fn shaderTessellationAndGeometryPointSize(mut self, v: VkBool32) -> Self {
+        self.inner.shaderTessellationAndGeometryPointSize = v;
+        self
+    }
+    pub fn shaderImageGatherExtended(mut self, v: VkBool32) -> Self {
+        self.inner.shaderImageGatherExtended = v;
+        self
+    }
+    pub fn shaderStorageImageExtendedFormats(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageExtendedFormats = v;
+        self
+    }
+    pub fn shaderStorageImageMultisample(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageMultisample = v;
+        self
+    }
+    pub fn shaderStorageImageReadWithoutFormat(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageReadWithoutFormat = v;
+        self
+    }
+    pub fn shaderStorageImageWriteWithoutFormat(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageWriteWithoutFormat = v;
+        self
+    }
+    pub fn shaderUniformBufferArrayDynamicIndexing(mut self, v: VkBool32) -> Self {
+        self.inner.shaderUniformBufferArrayDynamicIndexing = v;
+        self
+    }
+    pub fn shaderSampledImageArrayDynamicIndexing(mut self, v: VkBool32) -> Self {
+        self.inner.shaderSampledImageArrayDynamicIndexing = v;
+        self
+    }
+    pub fn shaderStorageBufferArrayDynamicIndexing(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageBufferArrayDynamicIndexing = v;
+        self
+    }
+    pub fn shaderStorageImageArrayDynamicIndexing(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageArrayDynamicIndexing = v;
+        self
+    }
+    pub fn shaderClipDistance(mut self, v: VkBool32) -> Self {
+        self.inner.shaderClipDistance = v;
+        self
+    }
+    pub fn shaderCullDistance(mut self, v: VkBool32) -> Self {
+        self.inner.shaderCullDistance = v;
+        self
+    }
+    pub fn shaderFloat64(mut self, v: VkBool32) -> Self {
+        self.inner.shaderFloat64 = v;
+        self
+    }
+    pub fn shaderInt64(mut self, v: VkBool32) -> Self {
+        self.inner.shaderInt64 = v;
+        self
+    }
+    pub fn shaderInt16(mut self, v: VkBool32) -> Self {
+        self.inner.shaderInt16 = v;
+        self
+    }
+    pub fn shaderResourceResidency(mut self, v: VkBool32) -> Self {
+        self.inner.shaderResourceResidency = v;
+        self
+    }
+    pub fn shaderResourceMinLod(mut self, v: VkBool32) -> Self {
+        self.inner.shaderResourceMinLod = v;
+        self
+    }
+    pub fn sparseBinding(mut self, v: VkBool32) -> Self {
+        self.inner.sparseBinding = v;
+        self
+    }
+    pub fn sparseResidencyBuffer(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidencyBuffer = v;
+        self
+    }
+    pub fn sparseResidencyImage2D(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidencyImage2D = v;
+        self
+    }
+    pub fn sparseResidencyImage3D(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidencyImage3D = v;
+        self
+    }
+    pub fn sparseResidency2Samples(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidency2Samples = v;
+        self
+    }
+    pub fn sparseResidency4Samples(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidency4Samples = v;
+        self
+    }
+    pub fn sparseResidency8Samples(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidency8Samples = v;
+        self
+    }
+    pub fn sparseResidency16Samples(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidency16Samples = v;
+        self
+    }
+    pub fn sparseResidencyAliased(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidencyAliased = v;
+        self
+    }
+    pub fn variableMultisampleRate(mut self, v: VkBool32) -> Self {
+        self.inner.variableMultisampleRate = v;
+        self
+    }
+    pub fn inheritedQueries(mut self, v: VkBool32) -> Self {
+        self.inner.inheritedQueries = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPhysicalDeviceFeatures {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPhysicalDeviceFeaturesBuilder<'a> {
+    type Target = VkPhysicalDeviceFeatures;
+    fn deref(&self) -> &VkPhysicalDeviceFeatures {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkExtent3D {
+    pub width: u32,
+    pub height: u32,
+    pub depth: u32,
+}
+impl Default for VkExtent3D {
+    fn default() -> VkExtent3D {
+        VkExtent3D {
+            width: Default::default(),
+            height: Default::default(),
+            depth: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkExtent3DBuilder<'a> {
+    inner: VkExtent3D,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkExtent3D {
+    pub fn builder<'a>() -> VkExtent3DBuilder<'a> {
+        VkExtent3DBuilder { inner: VkExtent3D::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkExtent3DBuilder<'a> {
+    pub fn width(mut self, v: u32) -> Self {
+        self.inner.width = v;
+        self
+    }
+    pub fn height(mut self, v: u32) -> Self {
+        self.inner.height = v;
+        self
+    }
+    pub fn depth(mut self, v: u32) -> Self {
+        self.inner.depth = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkExtent3D {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkExtent3DBuilder<'a> {
+    type Target = VkExtent3D;
+    fn deref(&self) -> &VkExtent3D {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkQueueFamilyProperties {
+    pub queueFlags: VkQueueFlags,
+    pub queueCount: u32,
+    pub timestampValidBits: u32,
+    pub minImageTransferGranularity: VkExtent3D,
+}
+impl Default for VkQueueFamilyProperties {
+    fn default() -> VkQueueFamilyProperties {
+        VkQueueFamilyProperties {
+            queueFlags: Default::default(),
+            queueCount: Default::default(),
+            timestampValidBits: Default::default(),
+            minImageTransferGranularity: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkQueueFamilyPropertiesBuilder<'a> {
+    inner: VkQueueFamilyProperties,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkQueueFamilyProperties {
+    pub fn builder<'a>() -> VkQueueFamilyPropertiesBuilder<'a> {
+        VkQueueFamilyPropertiesBuilder { inner: VkQueueFamilyProperties::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkQueueFamilyPropertiesBuilder<'a> {
+    pub fn queueFlags(mut self, v: VkQueueFlags) -> Self {
+        self.inner.queueFlags = v;
+        self
+    }
+    pub fn queueCount(mut self, v: u32) -> Self {
+        self.inner.queueCount = v;
+        self
+    }
+    pub fn timestampValidBits(mut self, v: u32) -> Self {
+        self.inner.timestampValidBits = v;
+        self
+    }
+    pub fn minImageTransferGranularity(mut self, v: VkExtent3D) -> Self {
+        self.inner.minImageTransferGranularity = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkQueueFamilyProperties {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkQueueFamilyPropertiesBuilder<'a> {
+    type Target = VkQueueFamilyProperties;
+    fn deref(&self) -> &VkQueueFamilyProperties {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkDeviceQueueCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkDeviceQueueCreateFlags,
+    pub queueFamilyIndex: u32,
+    pub queueCount: u32,
+    pub pQueuePriorities: *const f32,
+}
+impl Default for VkDeviceQueueCreateInfo {
+    fn default() -> VkDeviceQueueCreateInfo {
+        VkDeviceQueueCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            queueFamilyIndex: Default::default(),
+            queueCount: Default::default(),
+            pQueuePriorities: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkDeviceQueueCreateInfoBuilder<'a> {
+    inner: VkDeviceQueueCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkDeviceQueueCreateInfo {
+    pub fn builder<'a>() -> VkDeviceQueueCreateInfoBuilder<'a> {
+        VkDeviceQueueCreateInfoBuilder { inner: VkDeviceQueueCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkDeviceQueueCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkDeviceQueueCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn queueFamilyIndex(mut self, v: u32) -> Self {
+        self.inner.queueFamilyIndex = v;
+        self
+    }
+    pub fn pQueuePriorities(mut self, v: &'a [f32]) -> Self {
+        self.inner.queueCount = v.len() as u32;
+        self.inner.pQueuePriorities = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkDeviceQueueCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkDeviceQueueCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkDeviceQueueCreateInfoBuilder<'a> {
+    type Target = VkDeviceQueueCreateInfo;
+    fn deref(&self) -> &VkDeviceQueueCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkDeviceQueueCreateInfo {}
+
+#[repr(C)]
+pub struct VkDeviceCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkDeviceCreateFlags,
+    pub queueCreateInfoCount: u32,
+    pub pQueueCreateInfos: *const VkDeviceQueueCreateInfo,
+    pub enabledLayerCount: u32,
+    pub ppEnabledLayerNames: *const *const c_char,
+    pub enabledExtensionCount: u32,
+    pub ppEnabledExtensionNames: *const *const c_char,
+    pub pEnabledFeatures: *const VkPhysicalDeviceFeatures,
+}
+impl Default for VkDeviceCreateInfo {
+    fn default() -> VkDeviceCreateInfo {
+        VkDeviceCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            queueCreateInfoCount: Default::default(),
+            pQueueCreateInfos: ::std::ptr::null(),
+            enabledLayerCount: Default::default(),
+            ppEnabledLayerNames: ::std::ptr::null(),
+            enabledExtensionCount: Default::default(),
+            ppEnabledExtensionNames: ::std::ptr::null(),
+            pEnabledFeatures: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkDeviceCreateInfoBuilder<'a> {
+    inner: VkDeviceCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkDeviceCreateInfo {
+    pub fn builder<'a>() -> VkDeviceCreateInfoBuilder<'a> {
+        VkDeviceCreateInfoBuilder { inner: VkDeviceCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkDeviceCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkDeviceCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pQueueCreateInfos(mut self, v: &'a [VkDeviceQueueCreateInfo]) -> Self {
+        self.inner.queueCreateInfoCount = v.len() as u32;
+        self.inner.pQueueCreateInfos = v.as_ptr();
+        self
+    }
+    pub fn ppEnabledLayerNames(mut self, v: &'a [*const c_char]) -> Self {
+        self.inner.enabledLayerCount = v.len() as u32;
+        self.inner.ppEnabledLayerNames = v.as_ptr();
+        self
+    }
+    pub fn ppEnabledExtensionNames(mut self, v: &'a [*const c_char]) -> Self {
+        self.inner.enabledExtensionCount = v.len() as u32;
+        self.inner.ppEnabledExtensionNames = v.as_ptr();
+        self
+    }
+    pub fn pEnabledFeatures(mut self, v: Option<&'a VkPhysicalDeviceFeatures>) -> Self {
+        self.inner.pEnabledFeatures = v.map_or(::std::ptr::null(), |r| r as *const VkPhysicalDeviceFeatures);
+        self
+    }
+    pub fn push_next<T: ExtendsVkDeviceCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkDeviceCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkDeviceCreateInfoBuilder<'a> {
+    type Target = VkDeviceCreateInfo;
+    fn deref(&self) -> &VkDeviceCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkDeviceCreateInfo {}
+
+#[repr(C)]
+pub struct VkExtensionProperties {
+    pub extensionName: [c_char; VK_MAX_EXTENSION_NAME_SIZE as usize],
+    pub specVersion: u32,
+}
+impl Default for VkExtensionProperties {
+    fn default() -> VkExtensionProperties {
+        VkExtensionProperties {
+            extensionName: unsafe { mem::zeroed() },
+            specVersion: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkExtensionPropertiesBuilder<'a> {
+    inner: VkExtensionProperties,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkExtensionProperties {
+    pub fn builder<'a>() -> VkExtensionPropertiesBuilder<'a> {
+        VkExtensionPropertiesBuilder { inner: VkExtensionProperties::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkExtensionPropertiesBuilder<'a> {
+    pub fn extensionName(mut self, v: [c_char; VK_MAX_EXTENSION_NAME_SIZE as usize]) -> Self {
+        self.inner.extensionName = v;
+        self
+    }
+    pub fn specVersion(mut self, v: u32) -> Self {
+        self.inner.specVersion = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkExtensionProperties {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkExtensionPropertiesBuilder<'a> {
+    type Target = VkExtensionProperties;
+    fn deref(&self) -> &VkExtensionProperties {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkLayerProperties {
+    pub layerName: [c_char; VK_MAX_EXTENSION_NAME_SIZE as usize],
+    pub specVersion: u32,
+    pub implementationVersion: u32,
+    pub description: [c_char; VK_MAX_DESCRIPTION_SIZE as usize],
+}
+impl Default for VkLayerProperties {
+    fn default() -> VkLayerProperties {
+        VkLayerProperties {
+            layerName: unsafe { mem::zeroed() },
+            specVersion: Default::default(),
+            implementationVersion: Default::default(),
+            description: unsafe { mem::zeroed() },
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkLayerPropertiesBuilder<'a> {
+    inner: VkLayerProperties,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkLayerProperties {
+    pub fn builder<'a>() -> VkLayerPropertiesBuilder<'a> {
+        VkLayerPropertiesBuilder { inner: VkLayerProperties::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkLayerPropertiesBuilder<'a> {
+    pub fn layerName(mut self, v: [c_char; VK_MAX_EXTENSION_NAME_SIZE as usize]) -> Self {
+        self.inner.layerName = v;
+        self
+    }
+    pub fn specVersion(mut self, v: u32) -> Self {
+        self.inner.specVersion = v;
+        self
+    }
+    pub fn implementationVersion(mut self, v: u32) -> Self {
+        self.inner.implementationVersion = v;
+        self
+    }
+    pub fn description(mut self, v: [c_char; VK_MAX_DESCRIPTION_SIZE as usize]) -> Self {
+        self.inner.description = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkLayerProperties {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkLayerPropertiesBuilder<'a> {
+    type Target = VkLayerProperties;
+    fn deref(&self) -> &VkLayerProperties {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkSubmitInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub waitSemaphoreCount: u32,
+    pub pWaitSemaphores: *const VkSemaphore,
+    pub pWaitDstStageMask: *const VkPipelineStageFlags,
+    pub commandBufferCount: u32,
+    pub pCommandBuffers: *const VkCommandBuffer,
+    pub signalSemaphoreCount: u32,
+    pub pSignalSemaphores: *const VkSemaphore,
+}
+impl Default for VkSubmitInfo {
+    fn default() -> VkSubmitInfo {
+        VkSubmitInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_SUBMIT_INFO,
+            pNext: ::std::ptr::null(),
+            waitSemaphoreCount: Default::default(),
+            pWaitSemaphores: ::std::ptr::null(),
+            pWaitDstStageMask: ::std::ptr::null(),
+            commandBufferCount: Default::default(),
+            pCommandBuffers: ::std::ptr::null(),
+            signalSemaphoreCount: Default::default(),
+            pSignalSemaphores: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkSubmitInfoBuilder<'a> {
+    inner: VkSubmitInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkSubmitInfo {
+    pub fn builder<'a>() -> VkSubmitInfoBuilder<'a> {
+        VkSubmitInfoBuilder { inner: VkSubmitInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkSubmitInfoBuilder<'a> {
+    pub fn pWaitSemaphores(mut self, v: &'a [VkSemaphore]) -> Self {
+        self.inner.waitSemaphoreCount = v.len() as u32;
+        self.inner.pWaitSemaphores = v.as_ptr();
+        self
+    }
+    pub fn pWaitDstStageMask(mut self, v: &'a [VkPipelineStageFlags]) -> Self {
+        self.inner.waitSemaphoreCount = v.len() as u32;
+        self.inner.pWaitDstStageMask = v.as_ptr();
+        self
+    }
+    pub fn pCommandBuffers(mut self, v: &'a [VkCommandBuffer]) -> Self {
+        self.inner.commandBufferCount = v.len() as u32;
+        self.inner.pCommandBuffers = v.as_ptr();
+        self
+    }
+    pub fn pSignalSemaphores(mut self, v: &'a [VkSemaphore]) -> Self {
+        self.inner.signalSemaphoreCount = v.len() as u32;
+        self.inner.pSignalSemaphores = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkSubmitInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkSubmitInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkSubmitInfoBuilder<'a> {
+    type Target = VkSubmitInfo;
+    fn deref(&self) -> &VkSubmitInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkSubmitInfo {}
+
+#[repr(C)]
+pub struct VkSamplerCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkSamplerCreateFlags,
+    pub magFilter: VkFilter,
+    pub minFilter: VkFilter,
+    pub mipmapMode: VkSamplerMipmapMode,
+    pub addressModeU: VkSamplerAddressMode,
+    pub addressModeV: VkSamplerAddressMode,
+    pub addressModeW: VkSamplerAddressMode,
+    pub mipLodBias: f32,
+    pub anisotropyEnable: VkBool32,
+    pub maxAnisotropy: f32,
+    pub compareEnable: VkBool32,
+    pub compareOp: VkCompareOp,
+    pub minLod: f32,
+    pub maxLod: f32,
+    pub borderColor: VkBorderColor,
+    pub unnormalizedCoordinates: VkBool32,
+}
+impl Default for VkSamplerCreateInfo {
+    fn default() -> VkSamplerCreateInfo {
+        VkSamplerCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            magFilter: VkFilter::VK_FILTER_NEAREST,
+            minFilter: VkFilter::VK_FILTER_NEAREST,
+            mipmapMode: VkSamplerMipmapMode::VK_SAMPLER_MIPMAP_MODE_NEAREST,
+            addressModeU: VkSamplerAddressMode::VK_SAMPLER_ADDRESS_MODE_REPEAT,
+            addressModeV: VkSamplerAddressMode::VK_SAMPLER_ADDRESS_MODE_REPEAT,
+            addressModeW: VkSamplerAddressMode::VK_SAMPLER_ADDRESS_MODE_REPEAT,
+            mipLodBias: Default::default(),
+            anisotropyEnable: Default::default(),
+            maxAnisotropy: Default::default(),
+            compareEnable: Default::default(),
+            compareOp: VkCompareOp::VK_COMPARE_OP_NEVER,
+            minLod: Default::default(),
+            maxLod: Default::default(),
+            borderColor: VkBorderColor::VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK,
+            unnormalizedCoordinates: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkSamplerCreateInfoBuilder<'a> {
+    inner: VkSamplerCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkSamplerCreateInfo {
+    pub fn builder<'a>() -> VkSamplerCreateInfoBuilder<'a> {
+        VkSamplerCreateInfoBuilder { inner: VkSamplerCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkSamplerCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkSamplerCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn magFilter(mut self, v: VkFilter) -> Self {
+        self.inner.magFilter = v;
+        self
+    }
+    pub fn minFilter(mut self, v: VkFilter) -> Self {
+        self.inner.minFilter = v;
+        self
+    }
+    pub fn mipmapMode(mut self, v: VkSamplerMipmapMode) -> Self {
+        self.inner.mipmapMode = v;
+        self
+    }
+    pub fn addressModeU(mut self, v: VkSamplerAddressMode) -> Self {
+        self.inner.addressModeU = v;
+        self
+    }
+    pub fn addressModeV(mut self, v: VkSamplerAddressMode) -> Self {
+        self.inner.addressModeV = v;
+        self
+    }
+    pub fn addressModeW(mut self, v: VkSamplerAddressMode) -> Self {
+        self.inner.addressModeW = v;
+        self
+    }
+    pub fn mipLodBias(mut self, v: f32) -> Self {
+        self.inner.mipLodBias = v;
+        self
+    }
+    pub fn anisotropyEnable(mut self, v: VkBool32) -> Self {
+        self.inner.anisotropyEnable = v;
+        self
+    }
+    pub fn maxAnisotropy(mut self, v: f32) -> Self {
+        self.inner.maxAnisotropy = v;
+        self
+    }
+    pub fn compareEnable(mut self, v: VkBool32) -> Self {
+        self.inner.compareEnable = v;
+        self
+    }
+    pub fn compareOp(mut self, v: VkCompareOp) -> Self {
+        self.inner.compareOp = v;
+        self
+    }
+    pub fn minLod(mut self, v: f32) -> Self {
+        self.inner.minLod = v;
+        self
+    }
+    pub fn maxLod(mut self, v: f32) -> Self {
+        self.inner.maxLod = v;
+        self
+    }
+    pub fn borderColor(mut self, v: VkBorderColor) -> Self {
+        self.inner.borderColor = v;
+        self
+    }
+    pub fn unnormalizedCoordinates(mut self, v: VkBool32) -> Self {
+        self.inner.unnormalizedCoordinates = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkSamplerCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkSamplerCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkSamplerCreateInfoBuilder<'a> {
+    type Target = VkSamplerCreateInfo;
+    fn deref(&self) -> &VkSamplerCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkSamplerCreateInfo {}
+
+#[repr(C)]
+pub struct VkDescriptorSetLayoutBinding {
+    pub binding: u32,
+    pub descriptorType: VkDescriptorType,
+    pub descriptorCount: u32,
+    pub stageFlags: VkShaderStageFlags,
+    pub pImmutableSamplers: *const VkSampler,
+}
+impl Default for VkDescriptorSetLayoutBinding {
+    fn default() -> VkDescriptorSetLayoutBinding {
+        VkDescriptorSetLayoutBinding {
+            binding: Default::default(),
+            descriptorType: VkDescriptorType::VK_DESCRIPTOR_TYPE_SAMPLER,
+            descriptorCount: Default::default(),
+            stageFlags: Default::default(),
+            pImmutableSamplers: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkDescriptorSetLayoutBindingBuilder<'a> {
+    inner: VkDescriptorSetLayoutBinding,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkDescriptorSetLayoutBinding {
+    pub fn builder<'a>() -> VkDescriptorSetLayoutBindingBuilder<'a> {
+        VkDescriptorSetLayoutBindingBuilder { inner: VkDescriptorSetLayoutBinding::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkDescriptorSetLayoutBindingBuilder<'a> {
+    pub fn binding(mut self, v: u32) -> Self {
+        self.inner.binding = v;
+        self
+    }
+    pub fn descriptorType(mut self, v: VkDescriptorType) -> Self {
+        self.inner.descriptorType = v;
+        self
+    }
+    pub fn stageFlags(mut self, v: VkShaderStageFlags) -> Self {
+        self.inner.stageFlags = v;
+        self
+    }
+    pub fn pImmutableSamplers(mut self, v: &'a [VkSampler]) -> Self {
+        self.inner.descriptorCount = v.len() as u32;
+        self.inner.pImmutableSamplers = v.as_ptr();
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkDescriptorSetLayoutBinding {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkDescriptorSetLayoutBindingBuilder<'a> {
+    type Target = VkDescriptorSetLayoutBinding;
+    fn deref(&self) -> &VkDescriptorSetLayoutBinding {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkDescriptorSetLayoutCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkDescriptorSetLayoutCreateFlags,
+    pub bindingCount: u32,
+    pub pBindings: *const VkDescriptorSetLayoutBinding,
+}
+impl Default for VkDescriptorSetLayoutCreateInfo {
+    fn default() -> VkDescriptorSetLayoutCreateInfo {
+        VkDescriptorSetLayoutCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            bindingCount: Default::default(),
+            pBindings: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkDescriptorSetLayoutCreateInfoBuilder<'a> {
+    inner: VkDescriptorSetLayoutCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkDescriptorSetLayoutCreateInfo {
+    pub fn builder<'a>() -> VkDescriptorSetLayoutCreateInfoBuilder<'a> {
+        VkDescriptorSetLayoutCreateInfoBuilder { inner: VkDescriptorSetLayoutCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkDescriptorSetLayoutCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkDescriptorSetLayoutCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pBindings(mut self, v: &'a [VkDescriptorSetLayoutBinding]) -> Self {
+        self.inner.bindingCount = v.len() as u32;
+        self.inner.pBindings = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkDescriptorSetLayoutCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkDescriptorSetLayoutCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkDescriptorSetLayoutCreateInfoBuilder<'a> {
+    type Target = VkDescriptorSetLayoutCreateInfo;
+    fn deref(&self) -> &VkDescriptorSetLayoutCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkDescriptorSetLayoutCreateInfo {}
+
+#[repr(C)]
+pub struct VkPushConstantRange {
+    pub stageFlags: VkShaderStageFlags,
+    pub offset: u32,
+    pub size: u32,
+}
+impl Default for VkPushConstantRange {
+    fn default() -> VkPushConstantRange {
+        VkPushConstantRange {
+            stageFlags: Default::default(),
+            offset: Default::default(),
+            size: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPushConstantRangeBuilder<'a> {
+    inner: VkPushConstantRange,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPushConstantRange {
+    pub fn builder<'a>() -> VkPushConstantRangeBuilder<'a> {
+        VkPushConstantRangeBuilder { inner: VkPushConstantRange::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPushConstantRangeBuilder<'a> {
+    pub fn stageFlags(mut self, v: VkShaderStageFlags) -> Self {
+        self.inner.stageFlags = v;
+        self
+    }
+    pub fn offset(mut self, v: u32) -> Self {
+        self.inner.offset = v;
+        self
+    }
+    pub fn size(mut self, v: u32) -> Self {
+        self.inner.size = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPushConstantRange {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPushConstantRangeBuilder<'a> {
+    type Target = VkPushConstantRange;
+    fn deref(&self) -> &VkPushConstantRange {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkPipelineLayoutCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineLayoutCreateFlags,
+    pub setLayoutCount: u32,
+    pub pSetLayouts: *const VkDescriptorSetLayout,
+    pub pushConstantRangeCount: u32,
+    pub pPushConstantRanges: *const VkPushConstantRange,
+}
+impl Default for VkPipelineLayoutCreateInfo {
+    fn default() -> VkPipelineLayoutCreateInfo {
+        VkPipelineLayoutCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            setLayoutCount: Default::default(),
+            pSetLayouts: ::std::ptr::null(),
+            pushConstantRangeCount: Default::default(),
+            pPushConstantRanges: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineLayoutCreateInfoBuilder<'a> {
+    inner: VkPipelineLayoutCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineLayoutCreateInfo {
+    pub fn builder<'a>() -> VkPipelineLayoutCreateInfoBuilder<'a> {
+        VkPipelineLayoutCreateInfoBuilder { inner: VkPipelineLayoutCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineLayoutCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineLayoutCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pSetLayouts(mut self, v: &'a [VkDescriptorSetLayout]) -> Self {
+        self.inner.setLayoutCount = v.len() as u32;
+        self.inner.pSetLayouts = v.as_ptr();
+        self
+    }
+    pub fn pPushConstantRanges(mut self, v: &'a [VkPushConstantRange]) -> Self {
+        self.inner.pushConstantRangeCount = v.len() as u32;
+        self.inner.pPushConstantRanges = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineLayoutCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineLayoutCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineLayoutCreateInfoBuilder<'a> {
+    type Target = VkPipelineLayoutCreateInfo;
+    fn deref(&self) -> &VkPipelineLayoutCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineLayoutCreateInfo {}
+
+#[repr(C)]
+pub struct VkShaderModuleCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkShaderModuleCreateFlags,
+    pub codeSize: usize,
+    pub pCode: *const u32,
+}
+impl Default for VkShaderModuleCreateInfo {
+    fn default() -> VkShaderModuleCreateInfo {
+        VkShaderModuleCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            codeSize: Default::default(),
+            pCode: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkShaderModuleCreateInfoBuilder<'a> {
+    inner: VkShaderModuleCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkShaderModuleCreateInfo {
+    pub fn builder<'a>() -> VkShaderModuleCreateInfoBuilder<'a> {
+        VkShaderModuleCreateInfoBuilder { inner: VkShaderModuleCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkShaderModuleCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkShaderModuleCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn codeSize(mut self, v: usize) -> Self {
+        self.inner.codeSize = v;
+        self
+    }
+    pub fn pCode(mut self, v: *const u32) -> Self {
+        self.inner.pCode = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkShaderModuleCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkShaderModuleCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkShaderModuleCreateInfoBuilder<'a> {
+    type Target = VkShaderModuleCreateInfo;
+    fn deref(&self) -> &VkShaderModuleCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkShaderModuleCreateInfo {}
+
+#[repr(C)]
+pub struct VkSpecializationMapEntry {
+    pub constantID: u32,
+    pub offset: u32,
+    pub size: usize,
+}
+impl Default for VkSpecializationMapEntry {
+    fn default() -> VkSpecializationMapEntry {
+        VkSpecializationMapEntry {
+            constantID: Default::default(),
+            offset: Default::default(),
+            size: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkSpecializationMapEntryBuilder<'a> {
+    inner: VkSpecializationMapEntry,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkSpecializationMapEntry {
+    pub fn builder<'a>() -> VkSpecializationMapEntryBuilder<'a> {
+        VkSpecializationMapEntryBuilder { inner: VkSpecializationMapEntry::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkSpecializationMapEntryBuilder<'a> {
+    pub fn constantID(mut self, v: u32) -> Self {
+        self.inner.constantID = v;
+        self
+    }
+    pub fn offset(mut self, v: u32) -> Self {
+        self.inner.offset = v;
+        self
+    }
+    pub fn size(mut self, v: usize) -> Self {
+        self.inner.size = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkSpecializationMapEntry {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkSpecializationMapEntryBuilder<'a> {
+    type Target = VkSpecializationMapEntry;
+    fn deref(&self) -> &VkSpecializationMapEntry {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkSpecializationInfo {
+    pub mapEntryCount: u32,
+    pub pMapEntries: *const VkSpecializationMapEntry,
+    pub dataSize: usize,
+    pub pData: *const c_void,
+}
+impl Default for VkSpecializationInfo {
+    fn default() -> VkSpecializationInfo {
+        VkSpecializationInfo {
+            mapEntryCount: Default::default(),
+            pMapEntries: ::std::ptr::null(),
+            dataSize: Default::default(),
+            pData: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkSpecializationInfoBuilder<'a> {
+    inner: VkSpecializationInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkSpecializationInfo {
+    pub fn builder<'a>() -> VkSpecializationInfoBuilder<'a> {
+        VkSpecializationInfoBuilder { inner: VkSpecializationInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkSpecializationInfoBuilder<'a> {
+    pub fn pMapEntries(mut self, v: &'a [VkSpecializationMapEntry]) -> Self {
+        self.inner.mapEntryCount = v.len() as u32;
+        self.inner.pMapEntries = v.as_ptr();
+        self
+    }
+    pub fn pData(mut self, v: &'a [u8]) -> Self {
+        self.inner.dataSize = v.len() as usize;
+        self.inner.pData = v.as_ptr() as *const c_void;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkSpecializationInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkSpecializationInfoBuilder<'a> {
+    type Target = VkSpecializationInfo;
+    fn deref(&self) -> &VkSpecializationInfo {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkPipelineShaderStageCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineShaderStageCreateFlags,
+    pub stage: VkShaderStageFlagBits,
+    pub module: VkShaderModule,
+    pub pName: *const c_char,
+    pub pSpecializationInfo: *const VkSpecializationInfo,
+}
+impl Default for VkPipelineShaderStageCreateInfo {
+    fn default() -> VkPipelineShaderStageCreateInfo {
+        VkPipelineShaderStageCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            stage: VkShaderStageFlagBits::VK_SHADER_STAGE_VERTEX_BIT,
+            module: Default::default(),
+            pName: ::std::ptr::null(),
+            pSpecializationInfo: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineShaderStageCreateInfoBuilder<'a> {
+    inner: VkPipelineShaderStageCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineShaderStageCreateInfo {
+    pub fn builder<'a>() -> VkPipelineShaderStageCreateInfoBuilder<'a> {
+        VkPipelineShaderStageCreateInfoBuilder { inner: VkPipelineShaderStageCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineShaderStageCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineShaderStageCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn stage(mut self, v: VkShaderStageFlagBits) -> Self {
+        self.inner.stage = v;
+        self
+    }
+    pub fn module(mut self, v: VkShaderModule) -> Self {
+        self.inner.module = v;
+        self
+    }
+    pub fn pName(mut self, v: &'a ::std::ffi::CStr) -> Self {
+        self.inner.pName = v.as_ptr();
+        self
+    }
+    pub fn pSpecializationInfo(mut self, v: Option<&'a VkSpecializationInfo>) -> Self {
+        self.inner.pSpecializationInfo = v.map_or(::std::ptr::null(), |r| r as *const VkSpecializationInfo);
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineShaderStageCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineShaderStageCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineShaderStageCreateInfoBuilder<'a> {
+    type Target = VkPipelineShaderStageCreateInfo;
+    fn deref(&self) -> &VkPipelineShaderStageCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineShaderStageCreateInfo {}
+
+#[repr(C)]
+pub struct VkVertexInputBindingDescription {
+    pub binding: u32,
+    pub stride: u32,
+    pub inputRate: VkVertexInputRate,
+}
+impl Default for VkVertexInputBindingDescription {
+    fn default() -> VkVertexInputBindingDescription {
+        VkVertexInputBindingDescription {
+            binding: Default::default(),
+            stride: Default::default(),
+            inputRate: VkVertexInputRate::VK_VERTEX_INPUT_RATE_VERTEX,
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkVertexInputBindingDescriptionBuilder<'a> {
+    inner: VkVertexInputBindingDescription,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkVertexInputBindingDescription {
+    pub fn builder<'a>() -> VkVertexInputBindingDescriptionBuilder<'a> {
+        VkVertexInputBindingDescriptionBuilder { inner: VkVertexInputBindingDescription::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkVertexInputBindingDescriptionBuilder<'a> {
+    pub fn binding(mut self, v: u32) -> Self {
+        self.inner.binding = v;
+        self
+    }
+    pub fn stride(mut self, v: u32) -> Self {
+        self.inner.stride = v;
+        self
+    }
+    pub fn inputRate(mut self, v: VkVertexInputRate) -> Self {
+        self.inner.inputRate = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkVertexInputBindingDescription {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkVertexInputBindingDescriptionBuilder<'a> {
+    type Target = VkVertexInputBindingDescription;
+    fn deref(&self) -> &VkVertexInputBindingDescription {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkVertexInputAttributeDescription {
+    pub location: u32,
+    pub binding: u32,
+    pub format: VkFormat,
+    pub offset: u32,
+}
+impl Default for VkVertexInputAttributeDescription {
+    fn default() -> VkVertexInputAttributeDescription {
+        VkVertexInputAttributeDescription {
+            location: Default::default(),
+            binding: Default::default(),
+            format: VkFormat::VK_FORMAT_UNDEFINED,
+            offset: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkVertexInputAttributeDescriptionBuilder<'a> {
+    inner: VkVertexInputAttributeDescription,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkVertexInputAttributeDescription {
+    pub fn builder<'a>() -> VkVertexInputAttributeDescriptionBuilder<'a> {
+        VkVertexInputAttributeDescriptionBuilder { inner: VkVertexInputAttributeDescription::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkVertexInputAttributeDescriptionBuilder<'a> {
+    pub fn location(mut self, v: u32) -> Self {
+        self.inner.location = v;
+        self
+    }
+    pub fn binding(mut self, v: u32) -> Self {
+        self.inner.binding = v;
+        self
+    }
+    pub fn format(mut self, v: VkFormat) -> Self {
+        self.inner.format = v;
+        self
+    }
+    pub fn offset(mut self, v: u32) -> Self {
+        self.inner.offset = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkVertexInputAttributeDescription {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkVertexInputAttributeDescriptionBuilder<'a> {
+    type Target = VkVertexInputAttributeDescription;
+    fn deref(&self) -> &VkVertexInputAttributeDescription {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkPipelineVertexInputStateCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineVertexInputStateCreateFlags,
+    pub vertexBindingDescriptionCount: u32,
+    pub pVertexBindingDescriptions: *const VkVertexInputBindingDescription,
+    pub vertexAttributeDescriptionCount: u32,
+    pub pVertexAttributeDescriptions: *const VkVertexInputAttributeDescription,
+}
+impl Default for VkPipelineVertexInputStateCreateInfo {
+    fn default() -> VkPipelineVertexInputStateCreateInfo {
+        VkPipelineVertexInputStateCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            vertexBindingDescriptionCount: Default::default(),
+            pVertexBindingDescriptions: ::std::ptr::null(),
+            vertexAttributeDescriptionCount: Default::default(),
+            pVertexAttributeDescriptions: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineVertexInputStateCreateInfoBuilder<'a> {
+    inner: VkPipelineVertexInputStateCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineVertexInputStateCreateInfo {
+    pub fn builder<'a>() -> VkPipelineVertexInputStateCreateInfoBuilder<'a> {
+        VkPipelineVertexInputStateCreateInfoBuilder { inner: VkPipelineVertexInputStateCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineVertexInputStateCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineVertexInputStateCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pVertexBindingDescriptions(mut self, v: &'a [VkVertexInputBindingDescription]) -> Self {
+        self.inner.vertexBindingDescriptionCount = v.len() as u32;
+        self.inner.pVertexBindingDescriptions = v.as_ptr();
+        self
+    }
+    pub fn pVertexAttributeDescriptions(mut self, v: &'a [VkVertexInputAttributeDescription]) -> Self {
+        self.inner.vertexAttributeDescriptionCount = v.len() as u32;
+        self.inner.pVertexAttributeDescriptions = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineVertexInputStateCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineVertexInputStateCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineVertexInputStateCreateInfoBuilder<'a> {
+    type Target = VkPipelineVertexInputStateCreateInfo;
+    fn deref(&self) -> &VkPipelineVertexInputStateCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineVertexInputStateCreateInfo {}
+
+#[repr(C)]
+pub struct VkPipelineInputAssemblyStateCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineInputAssemblyStateCreateFlags,
+    pub topology: VkPrimitiveTopology,
+    pub primitiveRestartEnable: VkBool32,
+}
+impl Default for VkPipelineInputAssemblyStateCreateInfo {
+    fn default() -> VkPipelineInputAssemblyStateCreateInfo {
+        VkPipelineInputAssemblyStateCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            topology: VkPrimitiveTopology::VK_PRIMITIVE_TOPOLOGY_POINT_LIST,
+            primitiveRestartEnable: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineInputAssemblyStateCreateInfoBuilder<'a> {
+    inner: VkPipelineInputAssemblyStateCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineInputAssemblyStateCreateInfo {
+    pub fn builder<'a>() -> VkPipelineInputAssemblyStateCreateInfoBuilder<'a> {
+        VkPipelineInputAssemblyStateCreateInfoBuilder { inner: VkPipelineInputAssemblyStateCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineInputAssemblyStateCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineInputAssemblyStateCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn topology(mut self, v: VkPrimitiveTopology) -> Self {
+        self.inner.topology = v;
+        self
+    }
+    pub fn primitiveRestartEnable(mut self, v: VkBool32) -> Self {
+        self.inner.primitiveRestartEnable = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineInputAssemblyStateCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineInputAssemblyStateCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineInputAssemblyStateCreateInfoBuilder<'a> {
+    type Target = VkPipelineInputAssemblyStateCreateInfo;
+    fn deref(&self) -> &VkPipelineInputAssemblyStateCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineInputAssemblyStateCreateInfo {}
+
+#[repr(C)]
+pub struct VkPipelineTessellationStateCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineTessellationStateCreateFlags,
+    pub patchControlPoints: u32,
+}
+impl Default for VkPipelineTessellationStateCreateInfo {
+    fn default() -> VkPipelineTessellationStateCreateInfo {
+        VkPipelineTessellationStateCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            patchControlPoints: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineTessellationStateCreateInfoBuilder<'a> {
+    inner: VkPipelineTessellationStateCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineTessellationStateCreateInfo {
+    pub fn builder<'a>() -> VkPipelineTessellationStateCreateInfoBuilder<'a> {
+        VkPipelineTessellationStateCreateInfoBuilder { inner: VkPipelineTessellationStateCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineTessellationStateCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineTessellationStateCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn patchControlPoints(mut self, v: u32) -> Self {
+        self.inner.patchControlPoints = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineTessellationStateCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineTessellationStateCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineTessellationStateCreateInfoBuilder<'a> {
+    type Target = VkPipelineTessellationStateCreateInfo;
+    fn deref(&self) -> &VkPipelineTessellationStateCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineTessellationStateCreateInfo {}
+
+#[repr(C)]
+pub struct VkViewport {
+    pub x: f32,
+    pub y: f32,
+    pub width: f32,
+    pub height: f32,
+    pub minDepth: f32,
+    pub maxDepth: f32,
+}
+impl Default for VkViewport {
+    fn default() -> VkViewport {
+        VkViewport {
+            x: Default::default(),
+            y: Default::default(),
+            width: Default::default(),
+            height: Default::default(),
+            minDepth: Default::default(),
+            maxDepth: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkViewportBuilder<'a> {
+    inner: VkViewport,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkViewport {
+    pub fn builder<'a>() -> VkViewportBuilder<'a> {
+        VkViewportBuilder { inner: VkViewport::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkViewportBuilder<'a> {
+    pub fn x(mut self, v: f32) -> Self {
+        self.inner.x = v;
+        self
+    }
+    pub fn y(mut self, v: f32) -> Self {
+        self.inner.y = v;
+        self
+    }
+    pub fn width(mut self, v: f32) -> Self {
+        self.inner.width = v;
+        self
+    }
+    pub fn height(mut self, v: f32) -> Self {
+        self.inner.height = v;
+        self
+    }
+    pub fn minDepth(mut self, v: f32) -> Self {
+        self.inner.minDepth = v;
+        self
+    }
+    pub fn maxDepth(mut self, v: f32) -> Self {
+        self.inner.maxDepth = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkViewport {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkViewportBuilder<'a> {
+    type Target = VkViewport;
+    fn deref(&self) -> &VkViewport {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkOffset2D {
+    pub x: i32,
+    pub y: i32,
+}
+impl Default for VkOffset2D {
+    fn default() -> VkOffset2D {
+        VkOffset2D {
+            x: Default::default(),
+            y: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkOffset2DBuilder<'a> {
+    inner: VkOffset2D,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkOffset2D {
+    pub fn builder<'a>() -> VkOffset2DBuilder<'a> {
+        VkOffset2DBuilder { inner: VkOffset2D::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkOffset2DBuilder<'a> {
+    pub fn x(mut self, v: i32) -> Self {
+        self.inner.x = v;
+        self
+    }
+    pub fn y(mut self, v: i32) -> Self {
+        self.inner.y = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkOffset2D {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkOffset2DBuilder<'a> {
+    type Target = VkOffset2D;
+    fn deref(&self) -> &VkOffset2D {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkExtent2D {
+    pub width: u32,
+    pub height: u32,
+}
+impl Default for VkExtent2D {
+    fn default() -> VkExtent2D {
+        VkExtent2D {
+            width: Default::default(),
+            height: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkExtent2DBuilder<'a> {
+    inner: VkExtent2D,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkExtent2D {
+    pub fn builder<'a>() -> VkExtent2DBuilder<'a> {
+        VkExtent2DBuilder { inner: VkExtent2D::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkExtent2DBuilder<'a> {
+    pub fn width(mut self, v: u32) -> Self {
+        self.inner.width = v;
+        self
+    }
+    pub fn height(mut self, v: u32) -> Self {
+        self.inner.height = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkExtent2D {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkExtent2DBuilder<'a> {
+    type Target = VkExtent2D;
+    fn deref(&self) -> &VkExtent2D {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkRect2D {
+    pub offset: VkOffset2D,
+    pub extent: VkExtent2D,
+}
+impl Default for VkRect2D {
+    fn default() -> VkRect2D {
+        VkRect2D {
+            offset: Default::default(),
+            extent: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkRect2DBuilder<'a> {
+    inner: VkRect2D,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkRect2D {
+    pub fn builder<'a>() -> VkRect2DBuilder<'a> {
+        VkRect2DBuilder { inner: VkRect2D::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkRect2DBuilder<'a> {
+    pub fn offset(mut self, v: VkOffset2D) -> Self {
+        self.inner.offset = v;
+        self
+    }
+    pub fn extent(mut self, v: VkExtent2D) -> Self {
+        self.inner.extent = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkRect2D {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkRect2DBuilder<'a> {
+    type Target = VkRect2D;
+    fn deref(&self) -> &VkRect2D {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkPipelineViewportStateCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineViewportStateCreateFlags,
+    pub viewportCount: u32,
+    pub pViewports: *const VkViewport,
+    pub scissorCount: u32,
+    pub pScissors: *const VkRect2D,
+}
+impl Default for VkPipelineViewportStateCreateInfo {
+    fn default() -> VkPipelineViewportStateCreateInfo {
+        VkPipelineViewportStateCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            viewportCount: Default::default(),
+            pViewports: ::std::ptr::null(),
+            scissorCount: Default::default(),
+            pScissors: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineViewportStateCreateInfoBuilder<'a> {
+    inner: VkPipelineViewportStateCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineViewportStateCreateInfo {
+    pub fn builder<'a>() -> VkPipelineViewportStateCreateInfoBuilder<'a> {
+        VkPipelineViewportStateCreateInfoBuilder { inner: VkPipelineViewportStateCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineViewportStateCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineViewportStateCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pViewports(mut self, v: &'a [VkViewport]) -> Self {
+        self.inner.viewportCount = v.len() as u32;
+        self.inner.pViewports = v.as_ptr();
+        self
+    }
+    pub fn pScissors(mut self, v: &'a [VkRect2D]) -> Self {
+        self.inner.scissorCount = v.len() as u32;
+        self.inner.pScissors = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineViewportStateCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineViewportStateCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineViewportStateCreateInfoBuilder<'a> {
+    type Target = VkPipelineViewportStateCreateInfo;
+    fn deref(&self) -> &VkPipelineViewportStateCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineViewportStateCreateInfo {}
+
+#[repr(C)]
+pub struct VkPipelineRasterizationStateCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineRasterizationStateCreateFlags,
+    pub depthClampEnable: VkBool32,
+    pub rasterizerDiscardEnable: VkBool32,
+    pub polygonMode: VkPolygonMode,
+    pub cullMode: VkCullModeFlags,
+    pub frontFace: VkFrontFace,
+    pub depthBiasEnable: VkBool32,
+    pub depthBiasConstantFactor: f32,
+    pub depthBiasClamp: f32,
+    pub depthBiasSlopeFactor: f32,
+    pub lineWidth: f32,
+}
+impl Default for VkPipelineRasterizationStateCreateInfo {
+    fn default() -> VkPipelineRasterizationStateCreateInfo {
+        VkPipelineRasterizationStateCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            depthClampEnable: Default::default(),
+            rasterizerDiscardEnable: Default::default(),
+            polygonMode: VkPolygonMode::VK_POLYGON_MODE_FILL,
+            cullMode: Default::default(),
+            frontFace: VkFrontFace::VK_FRONT_FACE_COUNTER_CLOCKWISE,
+            depthBiasEnable: Default::default(),
+            depthBiasConstantFactor: Default::default(),
+            depthBiasClamp: Default::default(),
+            depthBiasSlopeFactor: Default::default(),
+            lineWidth: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineRasterizationStateCreateInfoBuilder<'a> {
+    inner: VkPipelineRasterizationStateCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineRasterizationStateCreateInfo {
+    pub fn builder<'a>() -> VkPipelineRasterizationStateCreateInfoBuilder<'a> {
+        VkPipelineRasterizationStateCreateInfoBuilder { inner: VkPipelineRasterizationStateCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineRasterizationStateCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineRasterizationStateCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn depthClampEnable(mut self, v: VkBool32) -> Self {
+        self.inner.depthClampEnable = v;
+        self
+    }
+    pub fn rasterizerDiscardEnable(mut self, v: VkBool32) -> Self {
+        self.inner.rasterizerDiscardEnable = v;
+        self
+    }
+    pub fn polygonMode(mut self, v: VkPolygonMode) -> Self {
+        self.inner.polygonMode = v;
+        self
+    }
+    pub fn cullMode(mut self, v: VkCullModeFlags) -> Self {
+        self.inner.cullMode = v;
+        self
+    }
+    pub fn frontFace(mut self, v: VkFrontFace) -> Self {
+        self.inner.frontFace = v;
+        self
+    }
+    pub fn depthBiasEnable(mut self, v: VkBool32) -> Self {
+        self.inner.depthBiasEnable = v;
+        self
+    }
+    pub fn depthBiasConstantFactor(mut self, v: f32) -> Self {
+        self.inner.depthBiasConstantFactor = v;
+        self
+    }
+    pub fn depthBiasClamp(mut self, v: f32) -> Self {
+        self.inner.depthBiasClamp = v;
+        self
+    }
+    pub fn depthBiasSlopeFactor(mut self, v: f32) -> Self {
+        self.inner.depthBiasSlopeFactor = v;
+        self
+    }
+    pub fn lineWidth(mut self, v: f32) -> Self {
+        self.inner.lineWidth = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineRasterizationStateCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineRasterizationStateCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineRasterizationStateCreateInfoBuilder<'a> {
+    type Target = VkPipelineRasterizationStateCreateInfo;
+    fn deref(&self) -> &VkPipelineRasterizationStateCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineRasterizationStateCreateInfo {}
+
+#[repr(C)]
+pub struct VkPipelineMultisampleStateCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineMultisampleStateCreateFlags,
+    pub rasterizationSamples: VkSampleCountFlagBits,
+    pub sampleShadingEnable: VkBool32,
+    pub minSampleShading: f32,
+    pub pSampleMask: *const VkSampleMask,
+    pub alphaToCoverageEnable: VkBool32,
+    pub alphaToOneEnable: VkBool32,
+}
+impl Default for VkPipelineMultisampleStateCreateInfo {
+    fn default() -> VkPipelineMultisampleStateCreateInfo {
+        VkPipelineMultisampleStateCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            rasterizationSamples: VkSampleCountFlagBits::VK_SAMPLE_COUNT_1_BIT,
+            sampleShadingEnable: Default::default(),
+            minSampleShading: Default::default(),
+            pSampleMask: ::std::ptr::null(),
+            alphaToCoverageEnable: Default::default(),
+            alphaToOneEnable: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineMultisampleStateCreateInfoBuilder<'a> {
+    inner: VkPipelineMultisampleStateCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineMultisampleStateCreateInfo {
+    pub fn builder<'a>() -> VkPipelineMultisampleStateCreateInfoBuilder<'a> {
+        VkPipelineMultisampleStateCreateInfoBuilder { inner: VkPipelineMultisampleStateCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineMultisampleStateCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineMultisampleStateCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn rasterizationSamples(mut self, v: VkSampleCountFlagBits) -> Self {
+        self.inner.rasterizationSamples = v;
+        self
+    }
+    pub fn sampleShadingEnable(mut self, v: VkBool32) -> Self {
+        self.inner.sampleShadingEnable = v;
+        self
+    }
+    pub fn minSampleShading(mut self, v: f32) -> Self {
+        self.inner.minSampleShading = v;
+        self
+    }
+    pub fn pSampleMask(mut self, v: *const VkSampleMask) -> Self {
+        self.inner.pSampleMask = v;
+        self
+    }
+    pub fn alphaToCoverageEnable(mut self, v: VkBool32) -> Self {
+        self.inner.alphaToCoverageEnable = v;
+        self
+    }
+    pub fn alphaToOneEnable(mut self, v: VkBool32) -> Self {
+        self.inner.alphaToOneEnable = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineMultisampleStateCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineMultisampleStateCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineMultisampleStateCreateInfoBuilder<'a> {
+    type Target = VkPipelineMultisampleStateCreateInfo;
+    fn deref(&self) -> &VkPipelineMultisampleStateCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineMultisampleStateCreateInfo {}
+
+#[repr(C)]
+pub struct VkStencilOpState {
+    pub failOp: VkStencilOp,
+    pub passOp: VkStencilOp,
+    pub depthFailOp: VkStencilOp,
+    pub compareOp: VkCompareOp,
+    pub compareMask: u32,
+    pub writeMask: u32,
+    pub reference: u32,
+}
+impl Default for VkStencilOpState {
+    fn default() -> VkStencilOpState {
+        VkStencilOpState {
+            failOp: VkStencilOp::VK_STENCIL_OP_KEEP,
+            passOp: VkStencilOp::VK_STENCIL_OP_KEEP,
+            depthFailOp: VkStencilOp::VK_STENCIL_OP_KEEP,
+            compareOp: VkCompareOp::VK_COMPARE_OP_NEVER,
+            compareMask: Default::default(),
+            writeMask: Default::default(),
+            reference: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkStencilOpStateBuilder<'a> {
+    inner: VkStencilOpState,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkStencilOpState {
+    pub fn builder<'a>() -> VkStencilOpStateBuilder<'a> {
+        VkStencilOpStateBuilder { inner: VkStencilOpState::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkStencilOpStateBuilder<'a> {
+    pub fn failOp(mut self, v: VkStencilOp) -> Self {
+        self.inner.failOp = v;
+        self
+    }
+    pub fn passOp(mut self, v: VkStencilOp) -> Self {
+        self.inner.passOp = v;
+        self
+    }
+    pub fn depthFailOp(mut self, v: VkStencilOp) -> Self {
+        self.inner.depthFailOp = v;
+        self
+    }
+    pub fn compareOp(mut self, v: VkCompareOp) -> Self {
+        self.inner.compareOp = v;
+        self
+    }
+    pub fn compareMask(mut self, v: u32) -> Self {
+        self.inner.compareMask = v;
+        self
+    }
+    pub fn writeMask(mut self, v: u32) -> Self {
+        self.inner.writeMask = v;
+        self
+    }
+    pub fn reference(mut self, v: u32) -> Self {
+        self.inner.reference = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkStencilOpState {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkStencilOpStateBuilder<'a> {
+    type Target = VkStencilOpState;
+    fn deref(&self) -> &VkStencilOpState {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkPipelineDepthStencilStateCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineDepthStencilStateCreateFlags,
+    pub depthTestEnable: VkBool32,
+    pub depthWriteEnable: VkBool32,
+    pub depthCompareOp: VkCompareOp,
+    pub depthBoundsTestEnable: VkBool32,
+    pub stencilTestEnable: VkBool32,
+    pub front: VkStencilOpState,
+    pub back: VkStencilOpState,
+    pub minDepthBounds: f32,
+    pub maxDepthBounds: f32,
+}
+impl Default for VkPipelineDepthStencilStateCreateInfo {
+    fn default() -> VkPipelineDepthStencilStateCreateInfo {
+        VkPipelineDepthStencilStateCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            depthTestEnable: Default::default(),
+            depthWriteEnable: Default::default(),
+            depthCompareOp: VkCompareOp::VK_COMPARE_OP_NEVER,
+            depthBoundsTestEnable: Default::default(),
+            stencilTestEnable: Default::default(),
+            front: Default::default(),
+            back: Default::default(),
+            minDepthBounds: Default::default(),
+            maxDepthBounds: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineDepthStencilStateCreateInfoBuilder<'a> {
+    inner: VkPipelineDepthStencilStateCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineDepthStencilStateCreateInfo {
+    pub fn builder<'a>() -> VkPipelineDepthStencilStateCreateInfoBuilder<'a> {
+        VkPipelineDepthStencilStateCreateInfoBuilder { inner: VkPipelineDepthStencilStateCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineDepthStencilStateCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineDepthStencilStateCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn depthTestEnable(mut self, v: VkBool32) -> Self {
+        self.inner.depthTestEnable = v;
+        self
+    }
+    pub fn depthWriteEnable(mut self, v: VkBool32) -> Self {
+        self.inner.depthWriteEnable = v;
+        self
+    }
+    pub fn depthCompareOp(mut self, v: VkCompareOp) -> Self {
+        self.inner.depthCompareOp = v;
+        self
+    }
+    pub fn depthBoundsTestEnable(mut self, v: VkBool32) -> Self {
+        self.inner.depthBoundsTestEnable = v;
+        self
+    }
+    pub fn stencilTestEnable(mut self, v: VkBool32) -> Self {
+        self.inner.stencilTestEnable = v;
+        self
+    }
+    pub fn front(mut self, v: VkStencilOpState) -> Self {
+        self.inner.front = v;
+        self
+    }
+    pub fn back(mut self, v: VkStencilOpState) -> Self {
+        self.inner.back = v;
+        self
+    }
+    pub fn minDepthBounds(mut self, v: f32) -> Self {
+        self.inner.minDepthBounds = v;
+        self
+    }
+    pub fn maxDepthBounds(mut self, v: f32) -> Self {
+        self.inner.maxDepthBounds = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineDepthStencilStateCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineDepthStencilStateCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineDepthStencilStateCreateInfoBuilder<'a> {
+    type Target = VkPipelineDepthStencilStateCreateInfo;
+    fn deref(&self) -> &VkPipelineDepthStencilStateCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineDepthStencilStateCreateInfo {}
+
+#[repr(C)]
+pub struct VkPipelineColorBlendAttachmentState {
+    pub blendEnable: VkBool32,
+    pub srcColorBlendFactor: VkBlendFactor,
+    pub dstColorBlendFactor: VkBlendFactor,
+    pub colorBlendOp: VkBlendOp,
+    pub srcAlphaBlendFactor: VkBlendFactor,
+    pub dstAlphaBlendFactor: VkBlendFactor,
+    pub alphaBlendOp: VkBlendOp,
+    pub colorWriteMask: VkColorComponentFlags,
+}
+impl Default for VkPipelineColorBlendAttachmentState {
+    fn default() -> VkPipelineColorBlendAttachmentState {
+        VkPipelineColorBlendAttachmentState {
+            blendEnable: Default::default(),
+            srcColorBlendFactor: VkBlendFactor::VK_BLEND_FACTOR_ZERO,
+            dstColorBlendFactor: VkBlendFactor::VK_BLEND_FACTOR_ZERO,
+            colorBlendOp: VkBlendOp::VK_BLEND_OP_ADD,
+            srcAlphaBlendFactor: VkBlendFactor::VK_BLEND_FACTOR_ZERO,
+            dstAlphaBlendFactor: VkBlendFactor::VK_BLEND_FACTOR_ZERO,
+            alphaBlendOp: VkBlendOp::VK_BLEND_OP_ADD,
+            colorWriteMask: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineColorBlendAttachmentStateBuilder<'a> {
+    inner: VkPipelineColorBlendAttachmentState,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineColorBlendAttachmentState {
+    pub fn builder<'a>() -> VkPipelineColorBlendAttachmentStateBuilder<'a> {
+        VkPipelineColorBlendAttachmentStateBuilder { inner: VkPipelineColorBlendAttachmentState::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineColorBlendAttachmentStateBuilder<'a> {
+    pub fn blendEnable(mut self, v: VkBool32) -> Self {
+        self.inner.blendEnable = v;
+        self
+    }
+    pub fn srcColorBlendFactor(mut self, v: VkBlendFactor) -> Self {
+        self.inner.srcColorBlendFactor = v;
+        self
+    }
+    pub fn dstColorBlendFactor(mut self, v: VkBlendFactor) -> Self {
+        self.inner.dstColorBlendFactor = v;
+        self
+    }
+    pub fn colorBlendOp(mut self, v: VkBlendOp) -> Self {
+        self.inner.colorBlendOp = v;
+        self
+    }
+    pub fn srcAlphaBlendFactor(mut self, v: VkBlendFactor) -> Self {
+        self.inner.srcAlphaBlendFactor = v;
+        self
+    }
+    pub fn dstAlphaBlendFactor(mut self, v: VkBlendFactor) -> Self {
+        self.inner.dstAlphaBlendFactor = v;
+        self
+    }
+    pub fn alphaBlendOp(mut self, v: VkBlendOp) -> Self {
+        self.inner.alphaBlendOp = v;
+        self
+    }
+    pub fn colorWriteMask(mut self, v: VkColorComponentFlags) -> Self {
+        self.inner.colorWriteMask = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineColorBlendAttachmentState {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineColorBlendAttachmentStateBuilder<'a> {
+    type Target = VkPipelineColorBlendAttachmentState;
+    fn deref(&self) -> &VkPipelineColorBlendAttachmentState {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkPipelineColorBlendStateCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineColorBlendStateCreateFlags,
+    pub logicOpEnable: VkBool32,
+    pub logicOp: VkLogicOp,
+    pub attachmentCount: u32,
+    pub pAttachments: *const VkPipelineColorBlendAttachmentState,
+    pub blendConstants: [f32; 4 as usize],
+}
+impl Default for VkPipelineColorBlendStateCreateInfo {
+    fn default() -> VkPipelineColorBlendStateCreateInfo {
+        VkPipelineColorBlendStateCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            logicOpEnable: Default::default(),
+            logicOp: VkLogicOp::VK_LOGIC_OP_CLEAR,
+            attachmentCount: Default::default(),
+            pAttachments: ::std::ptr::null(),
+            blendConstants: unsafe { mem::zeroed() },
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineColorBlendStateCreateInfoBuilder<'a> {
+    inner: VkPipelineColorBlendStateCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineColorBlendStateCreateInfo {
+    pub fn builder<'a>() -> VkPipelineColorBlendStateCreateInfoBuilder<'a> {
+        VkPipelineColorBlendStateCreateInfoBuilder { inner: VkPipelineColorBlendStateCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineColorBlendStateCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineColorBlendStateCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn logicOpEnable(mut self, v: VkBool32) -> Self {
+        self.inner.logicOpEnable = v;
+        self
+    }
+    pub fn logicOp(mut self, v: VkLogicOp) -> Self {
+        self.inner.logicOp = v;
+        self
+    }
+    pub fn pAttachments(mut self, v: &'a [VkPipelineColorBlendAttachmentState]) -> Self {
+        self.inner.attachmentCount = v.len() as u32;
+        self.inner.pAttachments = v.as_ptr();
+        self
+    }
+    pub fn blendConstants(mut self, v: [f32; 4 as usize]) -> Self {
+        self.inner.blendConstants = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineColorBlendStateCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineColorBlendStateCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineColorBlendStateCreateInfoBuilder<'a> {
+    type Target = VkPipelineColorBlendStateCreateInfo;
+    fn deref(&self) -> &VkPipelineColorBlendStateCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineColorBlendStateCreateInfo {}
+
+#[repr(C)]
+pub struct VkPipelineDynamicStateCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineDynamicStateCreateFlags,
+    pub dynamicStateCount: u32,
+    pub pDynamicStates: *const VkDynamicState,
+}
+impl Default for VkPipelineDynamicStateCreateInfo {
+    fn default() -> VkPipelineDynamicStateCreateInfo {
+        VkPipelineDynamicStateCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            dynamicStateCount: Default::default(),
+            pDynamicStates: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPipelineDynamicStateCreateInfoBuilder<'a> {
+    inner: VkPipelineDynamicStateCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPipelineDynamicStateCreateInfo {
+    pub fn builder<'a>() -> VkPipelineDynamicStateCreateInfoBuilder<'a> {
+        VkPipelineDynamicStateCreateInfoBuilder { inner: VkPipelineDynamicStateCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPipelineDynamicStateCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineDynamicStateCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pDynamicStates(mut self, v: &'a [VkDynamicState]) -> Self {
+        self.inner.dynamicStateCount = v.len() as u32;
+        self.inner.pDynamicStates = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkPipelineDynamicStateCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPipelineDynamicStateCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPipelineDynamicStateCreateInfoBuilder<'a> {
+    type Target = VkPipelineDynamicStateCreateInfo;
+    fn deref(&self) -> &VkPipelineDynamicStateCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPipelineDynamicStateCreateInfo {}
+
+#[repr(C)]
+pub struct VkGraphicsPipelineCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkPipelineCreateFlags,
+    pub stageCount: u32,
+    pub pStages: *const VkPipelineShaderStageCreateInfo,
+    pub pVertexInputState: *const VkPipelineVertexInputStateCreateInfo,
+    pub pInputAssemblyState: *const VkPipelineInputAssemblyStateCreateInfo,
+    pub pTessellationState: *const VkPipelineTessellationStateCreateInfo,
+    pub pViewportState: *const VkPipelineViewportStateCreateInfo,
+    pub pRasterizationState: *const VkPipelineRasterizationStateCreateInfo,
+    pub pMultisampleState: *const VkPipelineMultisampleStateCreateInfo,
+    pub pDepthStencilState: *const VkPipelineDepthStencilStateCreateInfo,
+    pub pColorBlendState: *const VkPipelineColorBlendStateCreateInfo,
+    pub pDynamicState: *const VkPipelineDynamicStateCreateInfo,
+    pub layout: VkPipelineLayout,
+    pub renderPass: VkRenderPass,
+    pub subpass: u32,
+    pub basePipelineHandle: VkPipeline,
+    pub basePipelineIndex: i32,
+}
+impl Default for VkGraphicsPipelineCreateInfo {
+    fn default() -> VkGraphicsPipelineCreateInfo {
+        VkGraphicsPipelineCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            stageCount: Default::default(),
+            pStages: ::std::ptr::null(),
+            pVertexInputState: ::std::ptr::null(),
+            pInputAssemblyState: ::std::ptr::null(),
+            pTessellationState: ::std::ptr::null(),
+            pViewportState: ::std::ptr::null(),
+            pRasterizationState: ::std::ptr::null(),
+            pMultisampleState: ::std::ptr::null(),
+            pDepthStencilState: ::std::ptr::null(),
+            pColorBlendState: ::std::ptr::null(),
+            pDynamicState: ::std::ptr::null(),
+            layout: Default::default(),
+            renderPass: Default::default(),
+            subpass: Default::default(),
+            basePipelineHandle: Default::default(),
+            basePipelineIndex: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkGraphicsPipelineCreateInfoBuilder<'a> {
+    inner: VkGraphicsPipelineCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkGraphicsPipelineCreateInfo {
+    pub fn builder<'a>() -> VkGraphicsPipelineCreateInfoBuilder<'a> {
+        VkGraphicsPipelineCreateInfoBuilder { inner: VkGraphicsPipelineCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkGraphicsPipelineCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkPipelineCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pStages(mut self, v: &'a [VkPipelineShaderStageCreateInfo]) -> Self {
+        self.inner.stageCount = v.len() as u32;
+        self.inner.pStages = v.as_ptr();
+        self
+    }
+    pub fn pVertexInputState(mut self, v: &'a VkPipelineVertexInputStateCreateInfo) -> Self {
+        self.inner.pVertexInputState = v as *const VkPipelineVertexInputStateCreateInfo;
+        self
+    }
+    pub fn pInputAssemblyState(mut self, v: &'a VkPipelineInputAssemblyStateCreateInfo) -> Self {
+        self.inner.pInputAssemblyState = v as *const VkPipelineInputAssemblyStateCreateInfo;
+        self
+    }
+    pub fn pTessellationState(mut self, v: Option<&'a VkPipelineTessellationStateCreateInfo>) -> Self {
+        self.inner.pTessellationState = v.map_or(::std::ptr::null(), |r| r as *const VkPipelineTessellationStateCreateInfo);
+        self
+    }
+    pub fn pViewportState(mut self, v: Option<&'a VkPipelineViewportStateCreateInfo>) -> Self {
+        self.inner.pViewportState = v.map_or(::std::ptr::null(), |r| r as *const VkPipelineViewportStateCreateInfo);
+        self
+    }
+    pub fn pRasterizationState(mut self, v: &'a VkPipelineRasterizationStateCreateInfo) -> Self {
+        self.inner.pRasterizationState = v as *const VkPipelineRasterizationStateCreateInfo;
+        self
+    }
+    pub fn pMultisampleState(mut self, v: Option<&'a VkPipelineMultisampleStateCreateInfo>) -> Self {
+        self.inner.pMultisampleState = v.map_or(::std::ptr::null(), |r| r as *const VkPipelineMultisampleStateCreateInfo);
+        self
+    }
+    pub fn pDepthStencilState(mut self, v: Option<&'a VkPipelineDepthStencilStateCreateInfo>) -> Self {
+        self.inner.pDepthStencilState = v.map_or(::std::ptr::null(), |r| r as *const VkPipelineDepthStencilStateCreateInfo);
+        self
+    }
+    pub fn pColorBlendState(mut self, v: Option<&'a VkPipelineColorBlendStateCreateInfo>) -> Self {
+        self.inner.pColorBlendState = v.map_or(::std::ptr::null(), |r| r as *const VkPipelineColorBlendStateCreateInfo);
+        self
+    }
+    pub fn pDynamicState(mut self, v: Option<&'a VkPipelineDynamicStateCreateInfo>) -> Self {
+        self.inner.pDynamicState = v.map_or(::std::ptr::null(), |r| r as *const VkPipelineDynamicStateCreateInfo);
+        self
+    }
+    pub fn layout(mut self, v: VkPipelineLayout) -> Self {
+        self.inner.layout = v;
+        self
+    }
+    pub fn renderPass(mut self, v: VkRenderPass) -> Self {
+        self.inner.renderPass = v;
+        self
+    }
+    pub fn subpass(mut self, v: u32) -> Self {
+        self.inner.subpass = v;
+        self
+    }
+    pub fn basePipelineHandle(mut self, v: VkPipeline) -> Self {
+        self.inner.basePipelineHandle = v;
+        self
+    }
+    pub fn basePipelineIndex(mut self, v: i32) -> Self {
+        self.inner.basePipelineIndex = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkGraphicsPipelineCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkGraphicsPipelineCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkGraphicsPipelineCreateInfoBuilder<'a> {
+    type Target = VkGraphicsPipelineCreateInfo;
+    fn deref(&self) -> &VkGraphicsPipelineCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkGraphicsPipelineCreateInfo {}
+
+#[repr(C)]
+pub struct VkCommandPoolCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkCommandPoolCreateFlags,
+    pub queueFamilyIndex: u32,
+}
+impl Default for VkCommandPoolCreateInfo {
+    fn default() -> VkCommandPoolCreateInfo {
+        VkCommandPoolCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            queueFamilyIndex: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkCommandPoolCreateInfoBuilder<'a> {
+    inner: VkCommandPoolCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkCommandPoolCreateInfo {
+    pub fn builder<'a>() -> VkCommandPoolCreateInfoBuilder<'a> {
+        VkCommandPoolCreateInfoBuilder { inner: VkCommandPoolCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkCommandPoolCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkCommandPoolCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn queueFamilyIndex(mut self, v: u32) -> Self {
+        self.inner.queueFamilyIndex = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkCommandPoolCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkCommandPoolCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkCommandPoolCreateInfoBuilder<'a> {
+    type Target = VkCommandPoolCreateInfo;
+    fn deref(&self) -> &VkCommandPoolCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkCommandPoolCreateInfo {}
+
+#[repr(C)]
+pub struct VkCommandBufferAllocateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub commandPool: VkCommandPool,
+    pub level: VkCommandBufferLevel,
+    pub commandBufferCount: u32,
+}
+impl Default for VkCommandBufferAllocateInfo {
+    fn default() -> VkCommandBufferAllocateInfo {
+        VkCommandBufferAllocateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+            pNext: ::std::ptr::null(),
+            commandPool: Default::default(),
+            level: VkCommandBufferLevel::VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+            commandBufferCount: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkCommandBufferAllocateInfoBuilder<'a> {
+    inner: VkCommandBufferAllocateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkCommandBufferAllocateInfo {
+    pub fn builder<'a>() -> VkCommandBufferAllocateInfoBuilder<'a> {
+        VkCommandBufferAllocateInfoBuilder { inner: VkCommandBufferAllocateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkCommandBufferAllocateInfoBuilder<'a> {
+    pub fn commandPool(mut self, v: VkCommandPool) -> Self {
+        self.inner.commandPool = v;
+        self
+    }
+    pub fn level(mut self, v: VkCommandBufferLevel) -> Self {
+        self.inner.level = v;
+        self
+    }
+    pub fn commandBufferCount(mut self, v: u32) -> Self {
+        self.inner.commandBufferCount = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkCommandBufferAllocateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkCommandBufferAllocateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkCommandBufferAllocateInfoBuilder<'a> {
+    type Target = VkCommandBufferAllocateInfo;
+    fn deref(&self) -> &VkCommandBufferAllocateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkCommandBufferAllocateInfo {}
+
+#[repr(C)]
+pub struct VkCommandBufferInheritanceInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub renderPass: VkRenderPass,
+    pub subpass: u32,
+    pub framebuffer: VkFramebuffer,
+    pub occlusionQueryEnable: VkBool32,
+    pub queryFlags: VkQueryControlFlags,
+    pub pipelineStatistics: VkQueryPipelineStatisticFlags,
+}
+impl Default for VkCommandBufferInheritanceInfo {
+    fn default() -> VkCommandBufferInheritanceInfo {
+        VkCommandBufferInheritanceInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+            pNext: ::std::ptr::null(),
+            renderPass: Default::default(),
+            subpass: Default::default(),
+            framebuffer: Default::default(),
+            occlusionQueryEnable: Default::default(),
+            queryFlags: Default::default(),
+            pipelineStatistics: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkCommandBufferInheritanceInfoBuilder<'a> {
+    inner: VkCommandBufferInheritanceInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkCommandBufferInheritanceInfo {
+    pub fn builder<'a>() -> VkCommandBufferInheritanceInfoBuilder<'a> {
+        VkCommandBufferInheritanceInfoBuilder { inner: VkCommandBufferInheritanceInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkCommandBufferInheritanceInfoBuilder<'a> {
+    pub fn renderPass(mut self, v: VkRenderPass) -> Self {
+        self.inner.renderPass = v;
+        self
+    }
+    pub fn subpass(mut self, v: u32) -> Self {
+        self.inner.subpass = v;
+        self
+    }
+    pub fn framebuffer(mut self, v: VkFramebuffer) -> Self {
+        self.inner.framebuffer = v;
+        self
+    }
+    pub fn occlusionQueryEnable(mut self, v: VkBool32) -> Self {
+        self.inner.occlusionQueryEnable = v;
+        self
+    }
+    pub fn queryFlags(mut self, v: VkQueryControlFlags) -> Self {
+        self.inner.queryFlags = v;
+        self
+    }
+    pub fn pipelineStatistics(mut self, v: VkQueryPipelineStatisticFlags) -> Self {
+        self.inner.pipelineStatistics = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkCommandBufferInheritanceInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkCommandBufferInheritanceInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkCommandBufferInheritanceInfoBuilder<'a> {
+    type Target = VkCommandBufferInheritanceInfo;
+    fn deref(&self) -> &VkCommandBufferInheritanceInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkCommandBufferInheritanceInfo {}
+
+#[repr(C)]
+pub struct VkCommandBufferBeginInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkCommandBufferUsageFlags,
+    pub pInheritanceInfo: *const VkCommandBufferInheritanceInfo,
+}
+impl Default for VkCommandBufferBeginInfo {
+    fn default() -> VkCommandBufferBeginInfo {
+        VkCommandBufferBeginInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            pInheritanceInfo: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkCommandBufferBeginInfoBuilder<'a> {
+    inner: VkCommandBufferBeginInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkCommandBufferBeginInfo {
+    pub fn builder<'a>() -> VkCommandBufferBeginInfoBuilder<'a> {
+        VkCommandBufferBeginInfoBuilder { inner: VkCommandBufferBeginInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkCommandBufferBeginInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkCommandBufferUsageFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pInheritanceInfo(mut self, v: Option<&'a VkCommandBufferInheritanceInfo>) -> Self {
+        self.inner.pInheritanceInfo = v.map_or(::std::ptr::null(), |r| r as *const VkCommandBufferInheritanceInfo);
+        self
+    }
+    pub fn push_next<T: ExtendsVkCommandBufferBeginInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkCommandBufferBeginInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkCommandBufferBeginInfoBuilder<'a> {
+    type Target = VkCommandBufferBeginInfo;
+    fn deref(&self) -> &VkCommandBufferBeginInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkCommandBufferBeginInfo {}
+
+#[repr(C)]
+pub struct VkClearColorValue {
+    data: [u32; 4],
+}
+impl VkClearColorValue {
+    #[inline]
+    pub unsafe fn float32(&self) -> &[f32; 4 as usize] {
+        ::std::mem::transmute(&self.data)
+    }
+    #[inline]
+    pub unsafe fn float32_mut(&mut self) -> &mut [f32; 4 as usize] {
+        ::std::mem::transmute(&mut self.data)
+    }
+    #[inline]
+    pub unsafe fn int32(&self) -> &[i32; 4 as usize] {
+        ::std::mem::transmute(&self.data)
+    }
+    #[inline]
+    pub unsafe fn int32_mut(&mut self) -> &mut [i32; 4 as usize] {
+        ::std::mem::transmute(&mut self.data)
+    }
+    #[inline]
+    pub unsafe fn uint32(&self) -> &[u32; 4 as usize] {
+        ::std::mem::transmute(&self.data)
+    }
+    #[inline]
+    pub unsafe fn uint32_mut(&mut self) -> &mut [u32; 4 as usize] {
+        ::std::mem::transmute(&mut self.data)
+    }
+}
+impl Default for VkClearColorValue {
+    fn default() -> VkClearColorValue {
+        unsafe { mem::zeroed() }
+    }
+}
+
+/*
+ * ------------------------------------------------------------------------
+ * Entry dispatch table. Represents the Vulkan entry point that can be used
+ * to get other Vulkan functions. Holds the library handle so that it does
+ * not get unloaded. This is very similar to the macros used for generating
+ * global-, instance-, and dispatch tables, except explicit since the entry
+ * is just a single function.
+ * ------------------------------------------------------------------------
+*/
+type PFN_vkGetInstanceProcAddr = vk_fun!((instance: VkInstance, pName: *const c_char) -> Option<PFN_vkVoidFunction>);
+pub struct VulkanEntry {
+    #[allow(dead_code)]
+    vulkan_lib: libloading::Library,
+    vkGetInstanceProcAddr: PFN_vkGetInstanceProcAddr,
+}
+
+impl VulkanEntry {
+    pub fn new(loader_path: &str) -> Result<VulkanEntry, String> {
+        let lib = match libloading::Library::new(loader_path) {
+            Ok(lib) => lib,
+            Err(_) => return Err(String::from("Failed to open Vulkan loader")),
+        };
+
+        let vkGetInstanceProcAddr: PFN_vkGetInstanceProcAddr = unsafe {
+            match lib.get::<PFN_vkGetInstanceProcAddr>(b"vkGetInstanceProcAddr\0") {
+                Ok(symbol) => *symbol, // Deref Symbol, not function pointer
+                Err(_) => return Err(String::from("Could not load vkGetInstanceProcAddr")),
+            }
+        };
+
+        // Since I can't keep the library and the loaded function in the
+        // same struct (Rust would then not be able to drop it because of
+        // the symbol references into itself via the library) I have opted
+        // to just storing the raw loaded function. This should be fine as
+        // long as the library is also saved to prevent unloading it. Since
+        // I return a Result, Rust makes sure that the struct can only be
+        // used if properly initialized.
+        Ok(VulkanEntry {
+            vulkan_lib: lib, // Save this so that the library is not freed
+            vkGetInstanceProcAddr: vkGetInstanceProcAddr,
+        })
+    }
+
+    #[inline]
+    pub unsafe fn vkGetInstanceProcAddr(&self, instance: VkInstance, pName: *const c_char) -> Option<PFN_vkVoidFunction> {
+        (self.vkGetInstanceProcAddr)(instance, pName)
+    }
+}
+
+global_dispatch_table!{
+    vkCreateInstance => (pCreateInfo: *const VkInstanceCreateInfo, pAllocator: *const VkAllocationCallbacks, pInstance: *mut VkInstance) -> VkResult,
+    vkEnumerateInstanceExtensionProperties => (pLayerName: *const c_char, pPropertyCount: *mut u32, pProperties: *mut VkExtensionProperties) -> VkResult,
+    vkEnumerateInstanceLayerProperties => (pPropertyCount: *mut u32, pProperties: *mut VkLayerProperties) -> VkResult,
+}
+
+impl GlobalDispatchTable {
+    pub unsafe fn vkEnumerateInstanceExtensionProperties_into(&self, pLayerName: *const c_char, out: &mut Vec<VkExtensionProperties>) -> VkResult {
+        out.clear();
+        loop {
+            let mut count = out.capacity() as u32;
+            if count > 0 {
+                match self.vkEnumerateInstanceExtensionProperties(pLayerName, &mut count, out.as_mut_ptr()) {
+                    VkResult::VK_SUCCESS => {
+                        out.set_len(count as usize);
+                        return VkResult::VK_SUCCESS;
+                    },
+                    VkResult::VK_INCOMPLETE => {},
+                    other => return other,
+                }
+            }
+            match self.vkEnumerateInstanceExtensionProperties(pLayerName, &mut count, ::std::ptr::null_mut()) {
+                VkResult::VK_SUCCESS => {},
+                other => return other,
+            }
+            if count == 0 {
+                return VkResult::VK_SUCCESS;
+            }
+            out.reserve(count as usize);
+        }
+    }
+    pub unsafe fn vkEnumerateInstanceLayerProperties_into(&self, out: &mut Vec<VkLayerProperties>) -> VkResult {
+        out.clear();
+        loop {
+            let mut count = out.capacity() as u32;
+            if count > 0 {
+                match self.vkEnumerateInstanceLayerProperties(&mut count, out.as_mut_ptr()) {
+                    VkResult::VK_SUCCESS => {
+                        out.set_len(count as usize);
+                        return VkResult::VK_SUCCESS;
+                    },
+                    VkResult::VK_INCOMPLETE => {},
+                    other => return other,
+                }
+            }
+            match self.vkEnumerateInstanceLayerProperties(&mut count, ::std::ptr::null_mut()) {
+                VkResult::VK_SUCCESS => {},
+                other => return other,
+            }
+            if count == 0 {
+                return VkResult::VK_SUCCESS;
+            }
+            out.reserve(count as usize);
+        }
+    }
+}
+
+instance_dispatch_table!{
+    vkDestroyInstance => (instance: VkInstance, pAllocator: *const VkAllocationCallbacks) -> (),
+    vkEnumeratePhysicalDevices => (instance: VkInstance, pPhysicalDeviceCount: *mut u32, pPhysicalDevices: *mut VkPhysicalDevice) -> VkResult,
+    vkGetPhysicalDeviceFeatures => (physicalDevice: VkPhysicalDevice, pFeatures: *mut VkPhysicalDeviceFeatures) -> (),
+    vkGetPhysicalDeviceQueueFamilyProperties => (physicalDevice: VkPhysicalDevice, pQueueFamilyPropertyCount: *mut u32, pQueueFamilyProperties: *mut VkQueueFamilyProperties) -> (),
+    vkGetDeviceProcAddr => (device: VkDevice, pName: *const c_char) -> Option<PFN_vkVoidFunction>,
+    vkCreateDevice => (physicalDevice: VkPhysicalDevice, pCreateInfo: *const VkDeviceCreateInfo, pAllocator: *const VkAllocationCallbacks, pDevice: *mut VkDevice) -> VkResult,
+    vkEnumerateDeviceExtensionProperties => (physicalDevice: VkPhysicalDevice, pLayerName: *const c_char, pPropertyCount: *mut u32, pProperties: *mut VkExtensionProperties) -> VkResult,
+}
+
+impl InstanceDispatchTable {
+    pub unsafe fn vkEnumeratePhysicalDevices_into(&self, instance: VkInstance, out: &mut Vec<VkPhysicalDevice>) -> VkResult {
+        out.clear();
+        loop {
+            let mut count = out.capacity() as u32;
+            if count > 0 {
+                match self.vkEnumeratePhysicalDevices(instance, &mut count, out.as_mut_ptr()) {
+                    VkResult::VK_SUCCESS => {
+                        out.set_len(count as usize);
+                        return VkResult::VK_SUCCESS;
+                    },
+                    VkResult::VK_INCOMPLETE => {},
+                    other => return other,
+                }
+            }
+            match self.vkEnumeratePhysicalDevices(instance, &mut count, ::std::ptr::null_mut()) {
+                VkResult::VK_SUCCESS => {},
+                other => return other,
+            }
+            if count == 0 {
+                return VkResult::VK_SUCCESS;
+            }
+            out.reserve(count as usize);
+        }
+    }
+    pub unsafe fn vkGetPhysicalDeviceQueueFamilyProperties_into(&self, physicalDevice: VkPhysicalDevice, out: &mut Vec<VkQueueFamilyProperties>) {
+        out.clear();
+        let mut count: u32 = 0;
+        self.vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &mut count, ::std::ptr::null_mut());
+        out.reserve(count as usize);
+        self.vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &mut count, out.as_mut_ptr());
+        out.set_len(count as usize);
+    }
+    pub unsafe fn vkEnumerateDeviceExtensionProperties_into(&self, physicalDevice: VkPhysicalDevice, pLayerName: *const c_char, out: &mut Vec<VkExtensionProperties>) -> VkResult {
+        out.clear();
+        loop {
+            let mut count = out.capacity() as u32;
+            if count > 0 {
+                match self.vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, &mut count, out.as_mut_ptr()) {
+                    VkResult::VK_SUCCESS => {
+                        out.set_len(count as usize);
+                        return VkResult::VK_SUCCESS;
+                    },
+                    VkResult::VK_INCOMPLETE => {},
+                    other => return other,
+                }
+            }
+            match self.vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, &mut count, ::std::ptr::null_mut()) {
+                VkResult::VK_SUCCESS => {},
+                other => return other,
+            }
+            if count == 0 {
+                return VkResult::VK_SUCCESS;
+            }
+            out.reserve(count as usize);
+        }
+    }
+}
+
+device_dispatch_table!{
+    vkDestroyDevice => (device: VkDevice, pAllocator: *const VkAllocationCallbacks) -> (),
+    vkGetDeviceQueue => (device: VkDevice, queueFamilyIndex: u32, queueIndex: u32, pQueue: *mut VkQueue) -> (),
+    vkQueueSubmit => (queue: VkQueue, submitCount: u32, pSubmits: *const VkSubmitInfo, fence: VkFence) -> VkResult,
+    vkQueueWaitIdle => (queue: VkQueue) -> VkResult,
+    vkDeviceWaitIdle => (device: VkDevice) -> VkResult,
+    vkCreateSampler => (device: VkDevice, pCreateInfo: *const VkSamplerCreateInfo, pAllocator: *const VkAllocationCallbacks, pSampler: *mut VkSampler) -> VkResult,
+    vkDestroySampler => (device: VkDevice, sampler: VkSampler, pAllocator: *const VkAllocationCallbacks) -> (),
+    vkCreateDescriptorSetLayout => (device: VkDevice, pCreateInfo: *const VkDescriptorSetLayoutCreateInfo, pAllocator: *const VkAllocationCallbacks, pSetLayout: *mut VkDescriptorSetLayout) -> VkResult,
+    vkCreatePipelineLayout => (device: VkDevice, pCreateInfo: *const VkPipelineLayoutCreateInfo, pAllocator: *const VkAllocationCallbacks, pPipelineLayout: *mut VkPipelineLayout) -> VkResult,
+    vkCreateShaderModule => (device: VkDevice, pCreateInfo: *const VkShaderModuleCreateInfo, pAllocator: *const VkAllocationCallbacks, pShaderModule: *mut VkShaderModule) -> VkResult,
+    vkCreateGraphicsPipelines => (device: VkDevice, pipelineCache: VkPipelineCache, createInfoCount: u32, pCreateInfos: *const VkGraphicsPipelineCreateInfo, pAllocator: *const VkAllocationCallbacks, pPipelines: *mut VkPipeline) -> VkResult,
+    vkDestroyPipeline => (device: VkDevice, pipeline: VkPipeline, pAllocator: *const VkAllocationCallbacks) -> (),
+    vkCreateCommandPool => (device: VkDevice, pCreateInfo: *const VkCommandPoolCreateInfo, pAllocator: *const VkAllocationCallbacks, pCommandPool: *mut VkCommandPool) -> VkResult,
+    vkAllocateCommandBuffers => (device: VkDevice, pAllocateInfo: *const VkCommandBufferAllocateInfo, pCommandBuffers: *mut VkCommandBuffer) -> VkResult,
+    vkBeginCommandBuffer => (commandBuffer: VkCommandBuffer, pBeginInfo: *const VkCommandBufferBeginInfo) -> VkResult,
+    vkEndCommandBuffer => (commandBuffer: VkCommandBuffer) -> VkResult,
+    vkCmdBindPipeline => (commandBuffer: VkCommandBuffer, pipelineBindPoint: VkPipelineBindPoint, pipeline: VkPipeline) -> (),
+    vkCmdSetViewport => (commandBuffer: VkCommandBuffer, firstViewport: u32, viewportCount: u32, pViewports: *const VkViewport) -> (),
+    vkCmdSetScissor => (commandBuffer: VkCommandBuffer, firstScissor: u32, scissorCount: u32, pScissors: *const VkRect2D) -> (),
+    vkCmdSetLineWidth => (commandBuffer: VkCommandBuffer, lineWidth: f32) -> (),
+    vkCmdSetBlendConstants => (commandBuffer: VkCommandBuffer, blendConstants: &[f32; 4]) -> (),
+    vkCmdSetStencilReference => (commandBuffer: VkCommandBuffer, faceMask: VkStencilFaceFlags, reference: u32) -> (),
+    vkCmdBindDescriptorSets => (commandBuffer: VkCommandBuffer, pipelineBindPoint: VkPipelineBindPoint, layout: VkPipelineLayout, firstSet: u32, descriptorSetCount: u32, pDescriptorSets: *const VkDescriptorSet, dynamicOffsetCount: u32, pDynamicOffsets: *const u32) -> (),
+    vkCmdBindIndexBuffer => (commandBuffer: VkCommandBuffer, buffer: VkBuffer, offset: VkDeviceSize, indexType: VkIndexType) -> (),
+    vkCmdBindVertexBuffers => (commandBuffer: VkCommandBuffer, firstBinding: u32, bindingCount: u32, pBuffers: *const VkBuffer, pOffsets: *const VkDeviceSize) -> (),
+    vkCmdDraw => (commandBuffer: VkCommandBuffer, vertexCount: u32, instanceCount: u32, firstVertex: u32, firstInstance: u32) -> (),
+    vkCmdDrawIndexed => (commandBuffer: VkCommandBuffer, indexCount: u32, instanceCount: u32, firstIndex: u32, vertexOffset: i32, firstInstance: u32) -> (),
+    vkCmdPushConstants => (commandBuffer: VkCommandBuffer, layout: VkPipelineLayout, stageFlags: VkShaderStageFlags, offset: u32, size: u32, pValues: *const c_void) -> (),
+}
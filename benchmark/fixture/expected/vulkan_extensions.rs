@@ -0,0 +1,63 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#![allow(unused_imports)]
+
+use super::macros::*;
+use super::core::*;
+
+#[cfg(feature = "VK_KHR_surface")]
+#[path = "vulkan_vk_khr_surface.rs"]
+mod vk_khr_surface;
+#[cfg(feature = "VK_KHR_surface")]
+pub use self::vk_khr_surface::*;
+
+#[cfg(feature = "VK_KHR_swapchain")]
+#[path = "vulkan_vk_khr_swapchain.rs"]
+mod vk_khr_swapchain;
+#[cfg(feature = "VK_KHR_swapchain")]
+pub use self::vk_khr_swapchain::*;
+
+#[cfg(all(feature = "VK_KHR_xlib_surface", all(unix, not(target_os = "android"), not(target_os = "macos"), not(target_os = "ios"))))]
+#[path = "vulkan_vk_khr_xlib_surface.rs"]
+mod vk_khr_xlib_surface;
+#[cfg(all(feature = "VK_KHR_xlib_surface", all(unix, not(target_os = "android"), not(target_os = "macos"), not(target_os = "ios"))))]
+pub use self::vk_khr_xlib_surface::*;
+
+#[cfg(feature = "VK_NV_glsl_shader")]
+#[path = "vulkan_vk_nv_glsl_shader.rs"]
+mod vk_nv_glsl_shader;
+#[cfg(feature = "VK_NV_glsl_shader")]
+pub use self::vk_nv_glsl_shader::*;
+
+#[cfg(feature = "VK_EXT_validation_flags")]
+#[path = "vulkan_vk_ext_validation_flags.rs"]
+mod vk_ext_validation_flags;
+#[cfg(feature = "VK_EXT_validation_flags")]
+pub use self::vk_ext_validation_flags::*;
+
+#[cfg(feature = "VK_EXT_validation_flags")]
+unsafe impl ExtendsVkInstanceCreateInfo for VkValidationFlagsEXT {}
+
+device_dispatch!{
+    #[cfg(feature = "VK_KHR_swapchain")] VK_KHR_swapchain => {
+        [device] vkCreateSwapchainKHR => (device: VkDevice, pCreateInfo: *const VkSwapchainCreateInfoKHR, pAllocator: *const VkAllocationCallbacks, pSwapchain: *mut VkSwapchainKHR) -> VkResult,
+        [device] vkDestroySwapchainKHR => (device: VkDevice, swapchain: VkSwapchainKHR, pAllocator: *const VkAllocationCallbacks) -> (),
+        [device] vkGetSwapchainImagesKHR => (device: VkDevice, swapchain: VkSwapchainKHR, pSwapchainImageCount: *mut u32, pSwapchainImages: *mut VkImage) -> VkResult,
+        [device] vkQueuePresentKHR => (queue: VkQueue, pPresentInfo: *const VkPresentInfoKHR) -> VkResult,
+    },
+}
@@ -0,0 +1,603 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Layout checks for the Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#include <stddef.h>
+#include <stdio.h>
+#include "vulkan_include.inl"
+
+#define ALIGNOF(T) offsetof(struct { char c; T t; }, t)
+#define CHECK_TYPE(T) fprintf(out, "%sconst _: () = assert!(size_of::<" #T ">() == %lu && align_of::<" #T ">() == %lu);\n", cfg, (unsigned long)sizeof(T), (unsigned long)ALIGNOF(T))
+#define CHECK_MEMBER(T, M, RUST_M) fprintf(out, "%sconst _: () = assert!(offset_of!(" #T ", " RUST_M ") == %lu);\n", cfg, (unsigned long)offsetof(T, M))
+
+int main(int argc, char** argv) {
+  FILE* out = (argc > 1) ? fopen(argv[1], "w") : stdout;
+  char const* cfg = ""; /* Attribute making the check conditional like the struct */
+  if (!out) {
+    fprintf(stderr, "Failed to open %s for output\n", argv[1]);
+    return 1;
+  }
+
+  fprintf(out, "// Layout assertions for the Rust bindings for Vulkan 1.0.57, printed by vulkan_layout.c.\n");
+  fprintf(out, "\n");
+  fprintf(out, "#![allow(unused_imports)]\n");
+  fprintf(out, "\n");
+  fprintf(out, "use super::core::*;\n");
+  fprintf(out, "use super::extensions::*;\n");
+  fprintf(out, "use std::mem::{align_of, offset_of, size_of};\n");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkApplicationInfo);
+  CHECK_MEMBER(VkApplicationInfo, sType, "sType");
+  CHECK_MEMBER(VkApplicationInfo, pNext, "pNext");
+  CHECK_MEMBER(VkApplicationInfo, pApplicationName, "pApplicationName");
+  CHECK_MEMBER(VkApplicationInfo, applicationVersion, "applicationVersion");
+  CHECK_MEMBER(VkApplicationInfo, pEngineName, "pEngineName");
+  CHECK_MEMBER(VkApplicationInfo, engineVersion, "engineVersion");
+  CHECK_MEMBER(VkApplicationInfo, apiVersion, "apiVersion");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkInstanceCreateInfo);
+  CHECK_MEMBER(VkInstanceCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkInstanceCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkInstanceCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkInstanceCreateInfo, pApplicationInfo, "pApplicationInfo");
+  CHECK_MEMBER(VkInstanceCreateInfo, enabledLayerCount, "enabledLayerCount");
+  CHECK_MEMBER(VkInstanceCreateInfo, ppEnabledLayerNames, "ppEnabledLayerNames");
+  CHECK_MEMBER(VkInstanceCreateInfo, enabledExtensionCount, "enabledExtensionCount");
+  CHECK_MEMBER(VkInstanceCreateInfo, ppEnabledExtensionNames, "ppEnabledExtensionNames");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkAllocationCallbacks);
+  CHECK_MEMBER(VkAllocationCallbacks, pUserData, "pUserData");
+  CHECK_MEMBER(VkAllocationCallbacks, pfnAllocation, "pfnAllocation");
+  CHECK_MEMBER(VkAllocationCallbacks, pfnFree, "pfnFree");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPhysicalDeviceFeatures);
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, robustBufferAccess, "robustBufferAccess");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, fullDrawIndexUint32, "fullDrawIndexUint32");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, imageCubeArray, "imageCubeArray");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, independentBlend, "independentBlend");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, geometryShader, "geometryShader");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, tessellationShader, "tessellationShader");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sampleRateShading, "sampleRateShading");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, dualSrcBlend, "dualSrcBlend");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, logicOp, "logicOp");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, multiDrawIndirect, "multiDrawIndirect");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, drawIndirectFirstInstance, "drawIndirectFirstInstance");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, depthClamp, "depthClamp");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, depthBiasClamp, "depthBiasClamp");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, fillModeNonSolid, "fillModeNonSolid");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, depthBounds, "depthBounds");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, wideLines, "wideLines");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, largePoints, "largePoints");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, alphaToOne, "alphaToOne");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, multiViewport, "multiViewport");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, samplerAnisotropy, "samplerAnisotropy");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, textureCompressionETC2, "textureCompressionETC2");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, textureCompressionASTC_LDR, "textureCompressionASTC_LDR");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, textureCompressionBC, "textureCompressionBC");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, occlusionQueryPrecise, "occlusionQueryPrecise");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, pipelineStatisticsQuery, "pipelineStatisticsQuery");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, vertexPipelineStoresAndAtomics, "vertexPipelineStoresAndAtomics");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, fragmentStoresAndAtomics, "fragmentStoresAndAtomics");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderTessellationAndGeometryPointSize, "shaderTessellationAndGeometryPointSize");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderImageGatherExtended, "shaderImageGatherExtended");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageExtendedFormats, "shaderStorageImageExtendedFormats");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageMultisample, "shaderStorageImageMultisample");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageReadWithoutFormat, "shaderStorageImageReadWithoutFormat");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageWriteWithoutFormat, "shaderStorageImageWriteWithoutFormat");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderUniformBufferArrayDynamicIndexing, "shaderUniformBufferArrayDynamicIndexing");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderSampledImageArrayDynamicIndexing, "shaderSampledImageArrayDynamicIndexing");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageBufferArrayDynamicIndexing, "shaderStorageBufferArrayDynamicIndexing");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageArrayDynamicIndexing, "shaderStorageImageArrayDynamicIndexing");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderClipDistance, "shaderClipDistance");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderCullDistance, "shaderCullDistance");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderFloat64, "shaderFloat64");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderInt64, "shaderInt64");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderInt16, "shaderInt16");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderResourceResidency, "shaderResourceResidency");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderResourceMinLod, "shaderResourceMinLod");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseBinding, "sparseBinding");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidencyBuffer, "sparseResidencyBuffer");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidencyImage2D, "sparseResidencyImage2D");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidencyImage3D, "sparseResidencyImage3D");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidency2Samples, "sparseResidency2Samples");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidency4Samples, "sparseResidency4Samples");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidency8Samples, "sparseResidency8Samples");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidency16Samples, "sparseResidency16Samples");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidencyAliased, "sparseResidencyAliased");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, variableMultisampleRate, "variableMultisampleRate");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, inheritedQueries, "inheritedQueries");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkExtent3D);
+  CHECK_MEMBER(VkExtent3D, width, "width");
+  CHECK_MEMBER(VkExtent3D, height, "height");
+  CHECK_MEMBER(VkExtent3D, depth, "depth");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkQueueFamilyProperties);
+  CHECK_MEMBER(VkQueueFamilyProperties, queueFlags, "queueFlags");
+  CHECK_MEMBER(VkQueueFamilyProperties, queueCount, "queueCount");
+  CHECK_MEMBER(VkQueueFamilyProperties, timestampValidBits, "timestampValidBits");
+  CHECK_MEMBER(VkQueueFamilyProperties, minImageTransferGranularity, "minImageTransferGranularity");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkDeviceQueueCreateInfo);
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, queueFamilyIndex, "queueFamilyIndex");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, queueCount, "queueCount");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, pQueuePriorities, "pQueuePriorities");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkDeviceCreateInfo);
+  CHECK_MEMBER(VkDeviceCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkDeviceCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkDeviceCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkDeviceCreateInfo, queueCreateInfoCount, "queueCreateInfoCount");
+  CHECK_MEMBER(VkDeviceCreateInfo, pQueueCreateInfos, "pQueueCreateInfos");
+  CHECK_MEMBER(VkDeviceCreateInfo, enabledLayerCount, "enabledLayerCount");
+  CHECK_MEMBER(VkDeviceCreateInfo, ppEnabledLayerNames, "ppEnabledLayerNames");
+  CHECK_MEMBER(VkDeviceCreateInfo, enabledExtensionCount, "enabledExtensionCount");
+  CHECK_MEMBER(VkDeviceCreateInfo, ppEnabledExtensionNames, "ppEnabledExtensionNames");
+  CHECK_MEMBER(VkDeviceCreateInfo, pEnabledFeatures, "pEnabledFeatures");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkExtensionProperties);
+  CHECK_MEMBER(VkExtensionProperties, extensionName, "extensionName");
+  CHECK_MEMBER(VkExtensionProperties, specVersion, "specVersion");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkLayerProperties);
+  CHECK_MEMBER(VkLayerProperties, layerName, "layerName");
+  CHECK_MEMBER(VkLayerProperties, specVersion, "specVersion");
+  CHECK_MEMBER(VkLayerProperties, implementationVersion, "implementationVersion");
+  CHECK_MEMBER(VkLayerProperties, description, "description");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkSubmitInfo);
+  CHECK_MEMBER(VkSubmitInfo, sType, "sType");
+  CHECK_MEMBER(VkSubmitInfo, pNext, "pNext");
+  CHECK_MEMBER(VkSubmitInfo, waitSemaphoreCount, "waitSemaphoreCount");
+  CHECK_MEMBER(VkSubmitInfo, pWaitSemaphores, "pWaitSemaphores");
+  CHECK_MEMBER(VkSubmitInfo, pWaitDstStageMask, "pWaitDstStageMask");
+  CHECK_MEMBER(VkSubmitInfo, commandBufferCount, "commandBufferCount");
+  CHECK_MEMBER(VkSubmitInfo, pCommandBuffers, "pCommandBuffers");
+  CHECK_MEMBER(VkSubmitInfo, signalSemaphoreCount, "signalSemaphoreCount");
+  CHECK_MEMBER(VkSubmitInfo, pSignalSemaphores, "pSignalSemaphores");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkSamplerCreateInfo);
+  CHECK_MEMBER(VkSamplerCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkSamplerCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkSamplerCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkSamplerCreateInfo, magFilter, "magFilter");
+  CHECK_MEMBER(VkSamplerCreateInfo, minFilter, "minFilter");
+  CHECK_MEMBER(VkSamplerCreateInfo, mipmapMode, "mipmapMode");
+  CHECK_MEMBER(VkSamplerCreateInfo, addressModeU, "addressModeU");
+  CHECK_MEMBER(VkSamplerCreateInfo, addressModeV, "addressModeV");
+  CHECK_MEMBER(VkSamplerCreateInfo, addressModeW, "addressModeW");
+  CHECK_MEMBER(VkSamplerCreateInfo, mipLodBias, "mipLodBias");
+  CHECK_MEMBER(VkSamplerCreateInfo, anisotropyEnable, "anisotropyEnable");
+  CHECK_MEMBER(VkSamplerCreateInfo, maxAnisotropy, "maxAnisotropy");
+  CHECK_MEMBER(VkSamplerCreateInfo, compareEnable, "compareEnable");
+  CHECK_MEMBER(VkSamplerCreateInfo, compareOp, "compareOp");
+  CHECK_MEMBER(VkSamplerCreateInfo, minLod, "minLod");
+  CHECK_MEMBER(VkSamplerCreateInfo, maxLod, "maxLod");
+  CHECK_MEMBER(VkSamplerCreateInfo, borderColor, "borderColor");
+  CHECK_MEMBER(VkSamplerCreateInfo, unnormalizedCoordinates, "unnormalizedCoordinates");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkDescriptorSetLayoutBinding);
+  CHECK_MEMBER(VkDescriptorSetLayoutBinding, binding, "binding");
+  CHECK_MEMBER(VkDescriptorSetLayoutBinding, descriptorType, "descriptorType");
+  CHECK_MEMBER(VkDescriptorSetLayoutBinding, descriptorCount, "descriptorCount");
+  CHECK_MEMBER(VkDescriptorSetLayoutBinding, stageFlags, "stageFlags");
+  CHECK_MEMBER(VkDescriptorSetLayoutBinding, pImmutableSamplers, "pImmutableSamplers");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkDescriptorSetLayoutCreateInfo);
+  CHECK_MEMBER(VkDescriptorSetLayoutCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkDescriptorSetLayoutCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkDescriptorSetLayoutCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkDescriptorSetLayoutCreateInfo, bindingCount, "bindingCount");
+  CHECK_MEMBER(VkDescriptorSetLayoutCreateInfo, pBindings, "pBindings");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPushConstantRange);
+  CHECK_MEMBER(VkPushConstantRange, stageFlags, "stageFlags");
+  CHECK_MEMBER(VkPushConstantRange, offset, "offset");
+  CHECK_MEMBER(VkPushConstantRange, size, "size");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineLayoutCreateInfo);
+  CHECK_MEMBER(VkPipelineLayoutCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineLayoutCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineLayoutCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineLayoutCreateInfo, setLayoutCount, "setLayoutCount");
+  CHECK_MEMBER(VkPipelineLayoutCreateInfo, pSetLayouts, "pSetLayouts");
+  CHECK_MEMBER(VkPipelineLayoutCreateInfo, pushConstantRangeCount, "pushConstantRangeCount");
+  CHECK_MEMBER(VkPipelineLayoutCreateInfo, pPushConstantRanges, "pPushConstantRanges");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkShaderModuleCreateInfo);
+  CHECK_MEMBER(VkShaderModuleCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkShaderModuleCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkShaderModuleCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkShaderModuleCreateInfo, codeSize, "codeSize");
+  CHECK_MEMBER(VkShaderModuleCreateInfo, pCode, "pCode");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkSpecializationMapEntry);
+  CHECK_MEMBER(VkSpecializationMapEntry, constantID, "constantID");
+  CHECK_MEMBER(VkSpecializationMapEntry, offset, "offset");
+  CHECK_MEMBER(VkSpecializationMapEntry, size, "size");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkSpecializationInfo);
+  CHECK_MEMBER(VkSpecializationInfo, mapEntryCount, "mapEntryCount");
+  CHECK_MEMBER(VkSpecializationInfo, pMapEntries, "pMapEntries");
+  CHECK_MEMBER(VkSpecializationInfo, dataSize, "dataSize");
+  CHECK_MEMBER(VkSpecializationInfo, pData, "pData");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineShaderStageCreateInfo);
+  CHECK_MEMBER(VkPipelineShaderStageCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineShaderStageCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineShaderStageCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineShaderStageCreateInfo, stage, "stage");
+  CHECK_MEMBER(VkPipelineShaderStageCreateInfo, module, "module");
+  CHECK_MEMBER(VkPipelineShaderStageCreateInfo, pName, "pName");
+  CHECK_MEMBER(VkPipelineShaderStageCreateInfo, pSpecializationInfo, "pSpecializationInfo");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkVertexInputBindingDescription);
+  CHECK_MEMBER(VkVertexInputBindingDescription, binding, "binding");
+  CHECK_MEMBER(VkVertexInputBindingDescription, stride, "stride");
+  CHECK_MEMBER(VkVertexInputBindingDescription, inputRate, "inputRate");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkVertexInputAttributeDescription);
+  CHECK_MEMBER(VkVertexInputAttributeDescription, location, "location");
+  CHECK_MEMBER(VkVertexInputAttributeDescription, binding, "binding");
+  CHECK_MEMBER(VkVertexInputAttributeDescription, format, "format");
+  CHECK_MEMBER(VkVertexInputAttributeDescription, offset, "offset");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineVertexInputStateCreateInfo);
+  CHECK_MEMBER(VkPipelineVertexInputStateCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineVertexInputStateCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineVertexInputStateCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineVertexInputStateCreateInfo, vertexBindingDescriptionCount, "vertexBindingDescriptionCount");
+  CHECK_MEMBER(VkPipelineVertexInputStateCreateInfo, pVertexBindingDescriptions, "pVertexBindingDescriptions");
+  CHECK_MEMBER(VkPipelineVertexInputStateCreateInfo, vertexAttributeDescriptionCount, "vertexAttributeDescriptionCount");
+  CHECK_MEMBER(VkPipelineVertexInputStateCreateInfo, pVertexAttributeDescriptions, "pVertexAttributeDescriptions");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineInputAssemblyStateCreateInfo);
+  CHECK_MEMBER(VkPipelineInputAssemblyStateCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineInputAssemblyStateCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineInputAssemblyStateCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineInputAssemblyStateCreateInfo, topology, "topology");
+  CHECK_MEMBER(VkPipelineInputAssemblyStateCreateInfo, primitiveRestartEnable, "primitiveRestartEnable");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineTessellationStateCreateInfo);
+  CHECK_MEMBER(VkPipelineTessellationStateCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineTessellationStateCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineTessellationStateCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineTessellationStateCreateInfo, patchControlPoints, "patchControlPoints");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkViewport);
+  CHECK_MEMBER(VkViewport, x, "x");
+  CHECK_MEMBER(VkViewport, y, "y");
+  CHECK_MEMBER(VkViewport, width, "width");
+  CHECK_MEMBER(VkViewport, height, "height");
+  CHECK_MEMBER(VkViewport, minDepth, "minDepth");
+  CHECK_MEMBER(VkViewport, maxDepth, "maxDepth");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkOffset2D);
+  CHECK_MEMBER(VkOffset2D, x, "x");
+  CHECK_MEMBER(VkOffset2D, y, "y");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkExtent2D);
+  CHECK_MEMBER(VkExtent2D, width, "width");
+  CHECK_MEMBER(VkExtent2D, height, "height");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkRect2D);
+  CHECK_MEMBER(VkRect2D, offset, "offset");
+  CHECK_MEMBER(VkRect2D, extent, "extent");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineViewportStateCreateInfo);
+  CHECK_MEMBER(VkPipelineViewportStateCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineViewportStateCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineViewportStateCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineViewportStateCreateInfo, viewportCount, "viewportCount");
+  CHECK_MEMBER(VkPipelineViewportStateCreateInfo, pViewports, "pViewports");
+  CHECK_MEMBER(VkPipelineViewportStateCreateInfo, scissorCount, "scissorCount");
+  CHECK_MEMBER(VkPipelineViewportStateCreateInfo, pScissors, "pScissors");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineRasterizationStateCreateInfo);
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, depthClampEnable, "depthClampEnable");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, rasterizerDiscardEnable, "rasterizerDiscardEnable");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, polygonMode, "polygonMode");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, cullMode, "cullMode");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, frontFace, "frontFace");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, depthBiasEnable, "depthBiasEnable");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, depthBiasConstantFactor, "depthBiasConstantFactor");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, depthBiasClamp, "depthBiasClamp");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, depthBiasSlopeFactor, "depthBiasSlopeFactor");
+  CHECK_MEMBER(VkPipelineRasterizationStateCreateInfo, lineWidth, "lineWidth");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineMultisampleStateCreateInfo);
+  CHECK_MEMBER(VkPipelineMultisampleStateCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineMultisampleStateCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineMultisampleStateCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineMultisampleStateCreateInfo, rasterizationSamples, "rasterizationSamples");
+  CHECK_MEMBER(VkPipelineMultisampleStateCreateInfo, sampleShadingEnable, "sampleShadingEnable");
+  CHECK_MEMBER(VkPipelineMultisampleStateCreateInfo, minSampleShading, "minSampleShading");
+  CHECK_MEMBER(VkPipelineMultisampleStateCreateInfo, pSampleMask, "pSampleMask");
+  CHECK_MEMBER(VkPipelineMultisampleStateCreateInfo, alphaToCoverageEnable, "alphaToCoverageEnable");
+  CHECK_MEMBER(VkPipelineMultisampleStateCreateInfo, alphaToOneEnable, "alphaToOneEnable");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkStencilOpState);
+  CHECK_MEMBER(VkStencilOpState, failOp, "failOp");
+  CHECK_MEMBER(VkStencilOpState, passOp, "passOp");
+  CHECK_MEMBER(VkStencilOpState, depthFailOp, "depthFailOp");
+  CHECK_MEMBER(VkStencilOpState, compareOp, "compareOp");
+  CHECK_MEMBER(VkStencilOpState, compareMask, "compareMask");
+  CHECK_MEMBER(VkStencilOpState, writeMask, "writeMask");
+  CHECK_MEMBER(VkStencilOpState, reference, "reference");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineDepthStencilStateCreateInfo);
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, depthTestEnable, "depthTestEnable");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, depthWriteEnable, "depthWriteEnable");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, depthCompareOp, "depthCompareOp");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, depthBoundsTestEnable, "depthBoundsTestEnable");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, stencilTestEnable, "stencilTestEnable");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, front, "front");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, back, "back");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, minDepthBounds, "minDepthBounds");
+  CHECK_MEMBER(VkPipelineDepthStencilStateCreateInfo, maxDepthBounds, "maxDepthBounds");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineColorBlendAttachmentState);
+  CHECK_MEMBER(VkPipelineColorBlendAttachmentState, blendEnable, "blendEnable");
+  CHECK_MEMBER(VkPipelineColorBlendAttachmentState, srcColorBlendFactor, "srcColorBlendFactor");
+  CHECK_MEMBER(VkPipelineColorBlendAttachmentState, dstColorBlendFactor, "dstColorBlendFactor");
+  CHECK_MEMBER(VkPipelineColorBlendAttachmentState, colorBlendOp, "colorBlendOp");
+  CHECK_MEMBER(VkPipelineColorBlendAttachmentState, srcAlphaBlendFactor, "srcAlphaBlendFactor");
+  CHECK_MEMBER(VkPipelineColorBlendAttachmentState, dstAlphaBlendFactor, "dstAlphaBlendFactor");
+  CHECK_MEMBER(VkPipelineColorBlendAttachmentState, alphaBlendOp, "alphaBlendOp");
+  CHECK_MEMBER(VkPipelineColorBlendAttachmentState, colorWriteMask, "colorWriteMask");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineColorBlendStateCreateInfo);
+  CHECK_MEMBER(VkPipelineColorBlendStateCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineColorBlendStateCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineColorBlendStateCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineColorBlendStateCreateInfo, logicOpEnable, "logicOpEnable");
+  CHECK_MEMBER(VkPipelineColorBlendStateCreateInfo, logicOp, "logicOp");
+  CHECK_MEMBER(VkPipelineColorBlendStateCreateInfo, attachmentCount, "attachmentCount");
+  CHECK_MEMBER(VkPipelineColorBlendStateCreateInfo, pAttachments, "pAttachments");
+  CHECK_MEMBER(VkPipelineColorBlendStateCreateInfo, blendConstants, "blendConstants");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPipelineDynamicStateCreateInfo);
+  CHECK_MEMBER(VkPipelineDynamicStateCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkPipelineDynamicStateCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkPipelineDynamicStateCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkPipelineDynamicStateCreateInfo, dynamicStateCount, "dynamicStateCount");
+  CHECK_MEMBER(VkPipelineDynamicStateCreateInfo, pDynamicStates, "pDynamicStates");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkGraphicsPipelineCreateInfo);
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, stageCount, "stageCount");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pStages, "pStages");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pVertexInputState, "pVertexInputState");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pInputAssemblyState, "pInputAssemblyState");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pTessellationState, "pTessellationState");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pViewportState, "pViewportState");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pRasterizationState, "pRasterizationState");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pMultisampleState, "pMultisampleState");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pDepthStencilState, "pDepthStencilState");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pColorBlendState, "pColorBlendState");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, pDynamicState, "pDynamicState");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, layout, "layout");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, renderPass, "renderPass");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, subpass, "subpass");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, basePipelineHandle, "basePipelineHandle");
+  CHECK_MEMBER(VkGraphicsPipelineCreateInfo, basePipelineIndex, "basePipelineIndex");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkCommandPoolCreateInfo);
+  CHECK_MEMBER(VkCommandPoolCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkCommandPoolCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkCommandPoolCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkCommandPoolCreateInfo, queueFamilyIndex, "queueFamilyIndex");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkCommandBufferAllocateInfo);
+  CHECK_MEMBER(VkCommandBufferAllocateInfo, sType, "sType");
+  CHECK_MEMBER(VkCommandBufferAllocateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkCommandBufferAllocateInfo, commandPool, "commandPool");
+  CHECK_MEMBER(VkCommandBufferAllocateInfo, level, "level");
+  CHECK_MEMBER(VkCommandBufferAllocateInfo, commandBufferCount, "commandBufferCount");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkCommandBufferInheritanceInfo);
+  CHECK_MEMBER(VkCommandBufferInheritanceInfo, sType, "sType");
+  CHECK_MEMBER(VkCommandBufferInheritanceInfo, pNext, "pNext");
+  CHECK_MEMBER(VkCommandBufferInheritanceInfo, renderPass, "renderPass");
+  CHECK_MEMBER(VkCommandBufferInheritanceInfo, subpass, "subpass");
+  CHECK_MEMBER(VkCommandBufferInheritanceInfo, framebuffer, "framebuffer");
+  CHECK_MEMBER(VkCommandBufferInheritanceInfo, occlusionQueryEnable, "occlusionQueryEnable");
+  CHECK_MEMBER(VkCommandBufferInheritanceInfo, queryFlags, "queryFlags");
+  CHECK_MEMBER(VkCommandBufferInheritanceInfo, pipelineStatistics, "pipelineStatistics");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkCommandBufferBeginInfo);
+  CHECK_MEMBER(VkCommandBufferBeginInfo, sType, "sType");
+  CHECK_MEMBER(VkCommandBufferBeginInfo, pNext, "pNext");
+  CHECK_MEMBER(VkCommandBufferBeginInfo, flags, "flags");
+  CHECK_MEMBER(VkCommandBufferBeginInfo, pInheritanceInfo, "pInheritanceInfo");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkClearColorValue);
+
+  fprintf(out, "\n");
+  cfg = "#[cfg(feature = \"VK_KHR_surface\")] ";
+  CHECK_TYPE(VkSurfaceCapabilitiesKHR);
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, minImageCount, "minImageCount");
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, maxImageCount, "maxImageCount");
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, currentExtent, "currentExtent");
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, minImageExtent, "minImageExtent");
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, maxImageExtent, "maxImageExtent");
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, maxImageArrayLayers, "maxImageArrayLayers");
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, supportedTransforms, "supportedTransforms");
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, currentTransform, "currentTransform");
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, supportedCompositeAlpha, "supportedCompositeAlpha");
+  CHECK_MEMBER(VkSurfaceCapabilitiesKHR, supportedUsageFlags, "supportedUsageFlags");
+
+  fprintf(out, "\n");
+  cfg = "#[cfg(feature = \"VK_KHR_surface\")] ";
+  CHECK_TYPE(VkSurfaceFormatKHR);
+  CHECK_MEMBER(VkSurfaceFormatKHR, format, "format");
+  CHECK_MEMBER(VkSurfaceFormatKHR, colorSpace, "colorSpace");
+
+  fprintf(out, "\n");
+  cfg = "#[cfg(feature = \"VK_KHR_swapchain\")] ";
+  CHECK_TYPE(VkSwapchainCreateInfoKHR);
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, sType, "sType");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, pNext, "pNext");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, flags, "flags");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, surface, "surface");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, minImageCount, "minImageCount");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageFormat, "imageFormat");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageColorSpace, "imageColorSpace");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageExtent, "imageExtent");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageArrayLayers, "imageArrayLayers");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageUsage, "imageUsage");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageSharingMode, "imageSharingMode");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, queueFamilyIndexCount, "queueFamilyIndexCount");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, pQueueFamilyIndices, "pQueueFamilyIndices");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, preTransform, "preTransform");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, compositeAlpha, "compositeAlpha");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, presentMode, "presentMode");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, clipped, "clipped");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, oldSwapchain, "oldSwapchain");
+
+  fprintf(out, "\n");
+  cfg = "#[cfg(feature = \"VK_KHR_swapchain\")] ";
+  CHECK_TYPE(VkPresentInfoKHR);
+  CHECK_MEMBER(VkPresentInfoKHR, sType, "sType");
+  CHECK_MEMBER(VkPresentInfoKHR, pNext, "pNext");
+  CHECK_MEMBER(VkPresentInfoKHR, waitSemaphoreCount, "waitSemaphoreCount");
+  CHECK_MEMBER(VkPresentInfoKHR, pWaitSemaphores, "pWaitSemaphores");
+  CHECK_MEMBER(VkPresentInfoKHR, swapchainCount, "swapchainCount");
+  CHECK_MEMBER(VkPresentInfoKHR, pSwapchains, "pSwapchains");
+  CHECK_MEMBER(VkPresentInfoKHR, pImageIndices, "pImageIndices");
+  CHECK_MEMBER(VkPresentInfoKHR, pResults, "pResults");
+
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+  fprintf(out, "\n");
+  cfg = "#[cfg(all(feature = \"VK_KHR_xlib_surface\", all(unix, not(target_os = \"android\"), not(target_os = \"macos\"), not(target_os = \"ios\"))))] ";
+  CHECK_TYPE(VkXlibSurfaceCreateInfoKHR);
+  CHECK_MEMBER(VkXlibSurfaceCreateInfoKHR, sType, "sType");
+  CHECK_MEMBER(VkXlibSurfaceCreateInfoKHR, pNext, "pNext");
+  CHECK_MEMBER(VkXlibSurfaceCreateInfoKHR, flags, "flags");
+  CHECK_MEMBER(VkXlibSurfaceCreateInfoKHR, dpy, "dpy");
+  CHECK_MEMBER(VkXlibSurfaceCreateInfoKHR, window, "window");
+#endif
+
+  fprintf(out, "\n");
+  cfg = "#[cfg(feature = \"VK_EXT_validation_flags\")] ";
+  CHECK_TYPE(VkValidationFlagsEXT);
+  CHECK_MEMBER(VkValidationFlagsEXT, sType, "sType");
+  CHECK_MEMBER(VkValidationFlagsEXT, pNext, "pNext");
+  CHECK_MEMBER(VkValidationFlagsEXT, disabledValidationCheckCount, "disabledValidationCheckCount");
+  CHECK_MEMBER(VkValidationFlagsEXT, pDisabledValidationChecks, "pDisabledValidationChecks");
+
+  if (out != stdout) {
+    fclose(out);
+  }
+  return 0;
+}
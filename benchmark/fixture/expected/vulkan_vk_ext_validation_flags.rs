@@ -0,0 +1,94 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#![allow(unused_imports)]
+
+use super::super::macros::*;
+use super::super::core::*;
+use super::*;
+
+/*
+ * ------------------------------------------------------
+ * VK_EXT_validation_flags
+ * ------------------------------------------------------
+*/
+
+#[repr(C)]
+pub enum VkValidationCheckEXT {
+    VK_VALIDATION_CHECK_ALL_EXT = 0,
+}
+
+#[repr(C)]
+pub struct VkValidationFlagsEXT {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub disabledValidationCheckCount: u32,
+    pub pDisabledValidationChecks: *mut VkValidationCheckEXT,
+}
+impl Default for VkValidationFlagsEXT {
+    fn default() -> VkValidationFlagsEXT {
+        VkValidationFlagsEXT {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT,
+            pNext: ::std::ptr::null(),
+            disabledValidationCheckCount: Default::default(),
+            pDisabledValidationChecks: ::std::ptr::null_mut(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkValidationFlagsEXTBuilder<'a> {
+    inner: VkValidationFlagsEXT,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkValidationFlagsEXT {
+    pub fn builder<'a>() -> VkValidationFlagsEXTBuilder<'a> {
+        VkValidationFlagsEXTBuilder { inner: VkValidationFlagsEXT::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkValidationFlagsEXTBuilder<'a> {
+    pub fn pDisabledValidationChecks(mut self, v: &'a mut [VkValidationCheckEXT]) -> Self {
+        self.inner.disabledValidationCheckCount = v.len() as u32;
+        self.inner.pDisabledValidationChecks = v.as_mut_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkValidationFlagsEXT>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkValidationFlagsEXT {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkValidationFlagsEXTBuilder<'a> {
+    type Target = VkValidationFlagsEXT;
+    fn deref(&self) -> &VkValidationFlagsEXT {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkValidationFlagsEXT {}
+
+extension_dispatch_table!{VK_EXT_validation_flags | instance, {
+}}
@@ -0,0 +1,212 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#![allow(unused_imports)]
+
+use super::super::macros::*;
+use super::super::core::*;
+use super::*;
+
+/*
+ * ------------------------------------------------------
+ * VK_KHR_surface
+ * ------------------------------------------------------
+*/
+
+pub type VkSurfaceKHR = u64;
+
+#[repr(C)]
+pub enum VkColorSpaceKHR {
+    VK_COLOR_SPACE_SRGB_NONLINEAR_KHR = 0,
+}
+
+vulkan_flags!(VkSurfaceTransformFlagsKHR, VkSurfaceTransformFlagBitsKHR, {
+    VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR = 0x00000001,
+});
+vulkan_flags!(VkCompositeAlphaFlagsKHR, VkCompositeAlphaFlagBitsKHR, {
+    VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR = 0x00000001,
+    VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR = 0x00000002,
+});
+
+#[repr(C)]
+pub struct VkSurfaceCapabilitiesKHR {
+    pub minImageCount: u32,
+    pub maxImageCount: u32,
+    pub currentExtent: VkExtent2D,
+    pub minImageExtent: VkExtent2D,
+    pub maxImageExtent: VkExtent2D,
+    pub maxImageArrayLayers: u32,
+    pub supportedTransforms: VkSurfaceTransformFlagsKHR,
+    pub currentTransform: VkSurfaceTransformFlagBitsKHR,
+    pub supportedCompositeAlpha: VkCompositeAlphaFlagsKHR,
+    pub supportedUsageFlags: VkImageUsageFlags,
+}
+impl Default for VkSurfaceCapabilitiesKHR {
+    fn default() -> VkSurfaceCapabilitiesKHR {
+        VkSurfaceCapabilitiesKHR {
+            minImageCount: Default::default(),
+            maxImageCount: Default::default(),
+            currentExtent: Default::default(),
+            minImageExtent: Default::default(),
+            maxImageExtent: Default::default(),
+            maxImageArrayLayers: Default::default(),
+            supportedTransforms: Default::default(),
+            currentTransform: VkSurfaceTransformFlagBitsKHR::VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR,
+            supportedCompositeAlpha: Default::default(),
+            supportedUsageFlags: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkSurfaceCapabilitiesKHRBuilder<'a> {
+    inner: VkSurfaceCapabilitiesKHR,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkSurfaceCapabilitiesKHR {
+    pub fn builder<'a>() -> VkSurfaceCapabilitiesKHRBuilder<'a> {
+        VkSurfaceCapabilitiesKHRBuilder { inner: VkSurfaceCapabilitiesKHR::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkSurfaceCapabilitiesKHRBuilder<'a> {
+    pub fn minImageCount(mut self, v: u32) -> Self {
+        self.inner.minImageCount = v;
+        self
+    }
+    pub fn maxImageCount(mut self, v: u32) -> Self {
+        self.inner.maxImageCount = v;
+        self
+    }
+    pub fn currentExtent(mut self, v: VkExtent2D) -> Self {
+        self.inner.currentExtent = v;
+        self
+    }
+    pub fn minImageExtent(mut self, v: VkExtent2D) -> Self {
+        self.inner.minImageExtent = v;
+        self
+    }
+    pub fn maxImageExtent(mut self, v: VkExtent2D) -> Self {
+        self.inner.maxImageExtent = v;
+        self
+    }
+    pub fn maxImageArrayLayers(mut self, v: u32) -> Self {
+        self.inner.maxImageArrayLayers = v;
+        self
+    }
+    pub fn supportedTransforms(mut self, v: VkSurfaceTransformFlagsKHR) -> Self {
+        self.inner.supportedTransforms = v;
+        self
+    }
+    pub fn currentTransform(mut self, v: VkSurfaceTransformFlagBitsKHR) -> Self {
+        self.inner.currentTransform = v;
+        self
+    }
+    pub fn supportedCompositeAlpha(mut self, v: VkCompositeAlphaFlagsKHR) -> Self {
+        self.inner.supportedCompositeAlpha = v;
+        self
+    }
+    pub fn supportedUsageFlags(mut self, v: VkImageUsageFlags) -> Self {
+        self.inner.supportedUsageFlags = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkSurfaceCapabilitiesKHR {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkSurfaceCapabilitiesKHRBuilder<'a> {
+    type Target = VkSurfaceCapabilitiesKHR;
+    fn deref(&self) -> &VkSurfaceCapabilitiesKHR {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkSurfaceFormatKHR {
+    pub format: VkFormat,
+    pub colorSpace: VkColorSpaceKHR,
+}
+impl Default for VkSurfaceFormatKHR {
+    fn default() -> VkSurfaceFormatKHR {
+        VkSurfaceFormatKHR {
+            format: VkFormat::VK_FORMAT_UNDEFINED,
+            colorSpace: VkColorSpaceKHR::VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkSurfaceFormatKHRBuilder<'a> {
+    inner: VkSurfaceFormatKHR,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkSurfaceFormatKHR {
+    pub fn builder<'a>() -> VkSurfaceFormatKHRBuilder<'a> {
+        VkSurfaceFormatKHRBuilder { inner: VkSurfaceFormatKHR::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkSurfaceFormatKHRBuilder<'a> {
+    pub fn format(mut self, v: VkFormat) -> Self {
+        self.inner.format = v;
+        self
+    }
+    pub fn colorSpace(mut self, v: VkColorSpaceKHR) -> Self {
+        self.inner.colorSpace = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkSurfaceFormatKHR {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkSurfaceFormatKHRBuilder<'a> {
+    type Target = VkSurfaceFormatKHR;
+    fn deref(&self) -> &VkSurfaceFormatKHR {
+        &self.inner
+    }
+}
+
+extension_dispatch_table!{VK_KHR_surface | instance, {
+    [instance] vkDestroySurfaceKHR => (instance: VkInstance, surface: VkSurfaceKHR, pAllocator: *const VkAllocationCallbacks) -> (),
+    [instance] vkGetPhysicalDeviceSurfaceCapabilitiesKHR => (physicalDevice: VkPhysicalDevice, surface: VkSurfaceKHR, pSurfaceCapabilities: *mut VkSurfaceCapabilitiesKHR) -> VkResult,
+    [instance] vkGetPhysicalDeviceSurfaceFormatsKHR => (physicalDevice: VkPhysicalDevice, surface: VkSurfaceKHR, pSurfaceFormatCount: *mut u32, pSurfaceFormats: *mut VkSurfaceFormatKHR) -> VkResult,
+}}
+
+impl VK_KHR_surface {
+    pub unsafe fn vkGetPhysicalDeviceSurfaceFormatsKHR_into(&self, physicalDevice: VkPhysicalDevice, surface: VkSurfaceKHR, out: &mut Vec<VkSurfaceFormatKHR>) -> VkResult {
+        out.clear();
+        loop {
+            let mut count = out.capacity() as u32;
+            if count > 0 {
+                match self.vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, &mut count, out.as_mut_ptr()) {
+                    VkResult::VK_SUCCESS => {
+                        out.set_len(count as usize);
+                        return VkResult::VK_SUCCESS;
+                    },
+                    VkResult::VK_INCOMPLETE => {},
+                    other => return other,
+                }
+            }
+            match self.vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, &mut count, ::std::ptr::null_mut()) {
+                VkResult::VK_SUCCESS => {},
+                other => return other,
+            }
+            if count == 0 {
+                return VkResult::VK_SUCCESS;
+            }
+            out.reserve(count as usize);
+        }
+    }
+}
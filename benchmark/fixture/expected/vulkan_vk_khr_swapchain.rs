@@ -0,0 +1,323 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#![allow(unused_imports)]
+
+use super::super::macros::*;
+use super::super::core::*;
+use super::*;
+
+/*
+ * ------------------------------------------------------
+ * VK_KHR_swapchain
+ * ------------------------------------------------------
+*/
+
+pub type VkSwapchainKHR = u64;
+
+#[repr(C)]
+pub enum VkPresentModeKHR {
+    VK_PRESENT_MODE_IMMEDIATE_KHR = 0,
+    VK_PRESENT_MODE_MAILBOX_KHR = 1,
+    VK_PRESENT_MODE_FIFO_KHR = 2,
+}
+
+vulkan_flags!(VkSwapchainCreateFlagsKHR);
+
+#[repr(C)]
+pub struct VkSwapchainCreateInfoKHR {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkSwapchainCreateFlagsKHR,
+    pub surface: VkSurfaceKHR,
+    pub minImageCount: u32,
+    pub imageFormat: VkFormat,
+    pub imageColorSpace: VkColorSpaceKHR,
+    pub imageExtent: VkExtent2D,
+    pub imageArrayLayers: u32,
+    pub imageUsage: VkImageUsageFlags,
+    pub imageSharingMode: VkSharingMode,
+    pub queueFamilyIndexCount: u32,
+    pub pQueueFamilyIndices: *const u32,
+    pub preTransform: VkSurfaceTransformFlagBitsKHR,
+    pub compositeAlpha: VkCompositeAlphaFlagBitsKHR,
+    pub presentMode: VkPresentModeKHR,
+    pub clipped: VkBool32,
+    pub oldSwapchain: VkSwapchainKHR,
+}
+impl Default for VkSwapchainCreateInfoKHR {
+    fn default() -> VkSwapchainCreateInfoKHR {
+        VkSwapchainCreateInfoKHR {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            surface: Default::default(),
+            minImageCount: Default::default(),
+            imageFormat: VkFormat::VK_FORMAT_UNDEFINED,
+            imageColorSpace: VkColorSpaceKHR::VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+            imageExtent: Default::default(),
+            imageArrayLayers: Default::default(),
+            imageUsage: Default::default(),
+            imageSharingMode: VkSharingMode::VK_SHARING_MODE_EXCLUSIVE,
+            queueFamilyIndexCount: Default::default(),
+            pQueueFamilyIndices: ::std::ptr::null(),
+            preTransform: VkSurfaceTransformFlagBitsKHR::VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR,
+            compositeAlpha: VkCompositeAlphaFlagBitsKHR::VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+            presentMode: VkPresentModeKHR::VK_PRESENT_MODE_IMMEDIATE_KHR,
+            clipped: Default::default(),
+            oldSwapchain: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkSwapchainCreateInfoKHRBuilder<'a> {
+    inner: VkSwapchainCreateInfoKHR,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkSwapchainCreateInfoKHR {
+    pub fn builder<'a>() -> VkSwapchainCreateInfoKHRBuilder<'a> {
+        VkSwapchainCreateInfoKHRBuilder { inner: VkSwapchainCreateInfoKHR::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkSwapchainCreateInfoKHRBuilder<'a> {
+    pub fn flags(mut self, v: VkSwapchainCreateFlagsKHR) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn surface(mut self, v: VkSurfaceKHR) -> Self {
+        self.inner.surface = v;
+        self
+    }
+    pub fn minImageCount(mut self, v: u32) -> Self {
+        self.inner.minImageCount = v;
+        self
+    }
+    pub fn imageFormat(mut self, v: VkFormat) -> Self {
+        self.inner.imageFormat = v;
+        self
+    }
+    pub fn imageColorSpace(mut self, v: VkColorSpaceKHR) -> Self {
+        self.inner.imageColorSpace = v;
+        self
+    }
+    pub fn imageExtent(mut self, v: VkExtent2D) -> Self {
+        self.inner.imageExtent = v;
+        self
+    }
+    pub fn imageArrayLayers(mut self, v: u32) -> Self {
+        self.inner.imageArrayLayers = v;
+        self
+    }
+    pub fn imageUsage(mut self, v: VkImageUsageFlags) -> Self {
+        self.inner.imageUsage = v;
+        self
+    }
+    pub fn imageSharingMode(mut self, v: VkSharingMode) -> Self {
+        self.inner.imageSharingMode = v;
+        self
+    }
+    pub fn pQueueFamilyIndices(mut self, v: &'a [u32]) -> Self {
+        self.inner.queueFamilyIndexCount = v.len() as u32;
+        self.inner.pQueueFamilyIndices = v.as_ptr();
+        self
+    }
+    pub fn preTransform(mut self, v: VkSurfaceTransformFlagBitsKHR) -> Self {
+        self.inner.preTransform = v;
+        self
+    }
+    pub fn compositeAlpha(mut self, v: VkCompositeAlphaFlagBitsKHR) -> Self {
+        self.inner.compositeAlpha = v;
+        self
+    }
+    pub fn presentMode(mut self, v: VkPresentModeKHR) -> Self {
+        self.inner.presentMode = v;
+        self
+    }
+    pub fn clipped(mut self, v: VkBool32) -> Self {
+        self.inner.clipped = v;
+        self
+    }
+    pub fn oldSwapchain(mut self, v: VkSwapchainKHR) -> Self {
+        self.inner.oldSwapchain = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkSwapchainCreateInfoKHR>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkSwapchainCreateInfoKHR {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkSwapchainCreateInfoKHRBuilder<'a> {
+    type Target = VkSwapchainCreateInfoKHR;
+    fn deref(&self) -> &VkSwapchainCreateInfoKHR {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkSwapchainCreateInfoKHR {}
+
+#[repr(C)]
+pub struct VkPresentInfoKHR {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub waitSemaphoreCount: u32,
+    pub pWaitSemaphores: *const VkSemaphore,
+    pub swapchainCount: u32,
+    pub pSwapchains: *const VkSwapchainKHR,
+    pub pImageIndices: *const u32,
+    pub pResults: *mut VkResult,
+}
+impl Default for VkPresentInfoKHR {
+    fn default() -> VkPresentInfoKHR {
+        VkPresentInfoKHR {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+            pNext: ::std::ptr::null(),
+            waitSemaphoreCount: Default::default(),
+            pWaitSemaphores: ::std::ptr::null(),
+            swapchainCount: Default::default(),
+            pSwapchains: ::std::ptr::null(),
+            pImageIndices: ::std::ptr::null(),
+            pResults: ::std::ptr::null_mut(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPresentInfoKHRBuilder<'a> {
+    inner: VkPresentInfoKHR,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPresentInfoKHR {
+    pub fn builder<'a>() -> VkPresentInfoKHRBuilder<'a> {
+        VkPresentInfoKHRBuilder { inner: VkPresentInfoKHR::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPresentInfoKHRBuilder<'a> {
+    pub fn pWaitSemaphores(mut self, v: &'a [VkSemaphore]) -> Self {
+        self.inner.waitSemaphoreCount = v.len() as u32;
+        self.inner.pWaitSemaphores = v.as_ptr();
+        self
+    }
+    pub fn pSwapchains(mut self, v: &'a [VkSwapchainKHR]) -> Self {
+        self.inner.swapchainCount = v.len() as u32;
+        self.inner.pSwapchains = v.as_ptr();
+        self
+    }
+    pub fn pImageIndices(mut self, v: &'a [u32]) -> Self {
+        self.inner.swapchainCount = v.len() as u32;
+        self.inner.pImageIndices = v.as_ptr();
+        self
+    }
+    pub fn pResults(mut self, v: &'a mut [VkResult]) -> Self {
+        self.inner.swapchainCount = v.len() as u32;
+        self.inner.pResults = v.as_mut_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkPresentInfoKHR>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPresentInfoKHR {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPresentInfoKHRBuilder<'a> {
+    type Target = VkPresentInfoKHR;
+    fn deref(&self) -> &VkPresentInfoKHR {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkPresentInfoKHR {}
+
+extension_dispatch_table!{VK_KHR_swapchain | device, {
+    [device] vkCreateSwapchainKHR => (device: VkDevice, pCreateInfo: *const VkSwapchainCreateInfoKHR, pAllocator: *const VkAllocationCallbacks, pSwapchain: *mut VkSwapchainKHR) -> VkResult,
+    [device] vkDestroySwapchainKHR => (device: VkDevice, swapchain: VkSwapchainKHR, pAllocator: *const VkAllocationCallbacks) -> (),
+    [device] vkGetSwapchainImagesKHR => (device: VkDevice, swapchain: VkSwapchainKHR, pSwapchainImageCount: *mut u32, pSwapchainImages: *mut VkImage) -> VkResult,
+    [device] vkQueuePresentKHR => (queue: VkQueue, pPresentInfo: *const VkPresentInfoKHR) -> VkResult,
+}}
+
+impl VK_KHR_swapchain {
+    pub unsafe fn vkGetSwapchainImagesKHR_into(&self, device: VkDevice, swapchain: VkSwapchainKHR, out: &mut Vec<VkImage>) -> VkResult {
+        out.clear();
+        loop {
+            let mut count = out.capacity() as u32;
+            if count > 0 {
+                match self.vkGetSwapchainImagesKHR(device, swapchain, &mut count, out.as_mut_ptr()) {
+                    VkResult::VK_SUCCESS => {
+                        out.set_len(count as usize);
+                        return VkResult::VK_SUCCESS;
+                    },
+                    VkResult::VK_INCOMPLETE => {},
+                    other => return other,
+                }
+            }
+            match self.vkGetSwapchainImagesKHR(device, swapchain, &mut count, ::std::ptr::null_mut()) {
+                VkResult::VK_SUCCESS => {},
+                other => return other,
+            }
+            if count == 0 {
+                return VkResult::VK_SUCCESS;
+            }
+            out.reserve(count as usize);
+        }
+    }
+}
+
+impl DeviceDispatch {
+    pub unsafe fn vkGetSwapchainImagesKHR_into(&self, device: VkDevice, swapchain: VkSwapchainKHR, out: &mut Vec<VkImage>) -> VkResult {
+        out.clear();
+        loop {
+            let mut count = out.capacity() as u32;
+            if count > 0 {
+                match self.vkGetSwapchainImagesKHR(device, swapchain, &mut count, out.as_mut_ptr()) {
+                    VkResult::VK_SUCCESS => {
+                        out.set_len(count as usize);
+                        return VkResult::VK_SUCCESS;
+                    },
+                    VkResult::VK_INCOMPLETE => {},
+                    other => return other,
+                }
+            }
+            match self.vkGetSwapchainImagesKHR(device, swapchain, &mut count, ::std::ptr::null_mut()) {
+                VkResult::VK_SUCCESS => {},
+                other => return other,
+            }
+            if count == 0 {
+                return VkResult::VK_SUCCESS;
+            }
+            out.reserve(count as usize);
+        }
+    }
+}
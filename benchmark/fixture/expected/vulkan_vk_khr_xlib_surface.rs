@@ -0,0 +1,102 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#![allow(unused_imports)]
+
+use super::super::macros::*;
+use super::super::core::*;
+use super::*;
+
+/*
+ * ------------------------------------------------------
+ * VK_KHR_xlib_surface
+ * ------------------------------------------------------
+*/
+
+vulkan_flags!(VkXlibSurfaceCreateFlagsKHR);
+
+#[repr(C)]
+pub struct VkXlibSurfaceCreateInfoKHR {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkXlibSurfaceCreateFlagsKHR,
+    pub dpy: *mut c_void,
+    pub window: c_ulong,
+}
+impl Default for VkXlibSurfaceCreateInfoKHR {
+    fn default() -> VkXlibSurfaceCreateInfoKHR {
+        VkXlibSurfaceCreateInfoKHR {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            dpy: ::std::ptr::null_mut(),
+            window: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkXlibSurfaceCreateInfoKHRBuilder<'a> {
+    inner: VkXlibSurfaceCreateInfoKHR,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkXlibSurfaceCreateInfoKHR {
+    pub fn builder<'a>() -> VkXlibSurfaceCreateInfoKHRBuilder<'a> {
+        VkXlibSurfaceCreateInfoKHRBuilder { inner: VkXlibSurfaceCreateInfoKHR::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkXlibSurfaceCreateInfoKHRBuilder<'a> {
+    pub fn flags(mut self, v: VkXlibSurfaceCreateFlagsKHR) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn dpy(mut self, v: *mut c_void) -> Self {
+        self.inner.dpy = v;
+        self
+    }
+    pub fn window(mut self, v: c_ulong) -> Self {
+        self.inner.window = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkXlibSurfaceCreateInfoKHR>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkXlibSurfaceCreateInfoKHR {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkXlibSurfaceCreateInfoKHRBuilder<'a> {
+    type Target = VkXlibSurfaceCreateInfoKHR;
+    fn deref(&self) -> &VkXlibSurfaceCreateInfoKHR {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkXlibSurfaceCreateInfoKHR {}
+
+extension_dispatch_table!{VK_KHR_xlib_surface | instance, {
+    [instance] vkCreateXlibSurfaceKHR => (instance: VkInstance, pCreateInfo: *const VkXlibSurfaceCreateInfoKHR, pAllocator: *const VkAllocationCallbacks, pSurface: *mut VkSurfaceKHR) -> VkResult,
+    [instance] vkGetPhysicalDeviceXlibPresentationSupportKHR => (physicalDevice: VkPhysicalDevice, queueFamilyIndex: u32, dpy: *mut c_void, visualID: c_ulong) -> VkBool32,
+}}
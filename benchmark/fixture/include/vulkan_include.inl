@@ -0,0 +1 @@
+#include "vulkan.h"
@@ -0,0 +1,44 @@
+#include "vk_command_stream.h"
+
+namespace vkgen {
+
+CommandStream::~CommandStream() {
+  for (auto& chunk : _chunks) {
+    std::free(chunk.data);
+  }
+}
+
+void CommandStream::reset() {
+  for (auto& chunk : _chunks) {
+    chunk.used = 0;
+  }
+  _current = 0;
+}
+
+void CommandStream::_new_chunk(size_t capacity) {
+  void* data = std::malloc(capacity);
+  if (!data) {
+    throw std::bad_alloc();
+  }
+  Chunk chunk = { static_cast<unsigned char*>(data), capacity, 0 };
+  _chunks.push_back(chunk);
+}
+
+void CommandStream::replay(CommandBufferFunctions const& command_buffer) const {
+  for (size_t i = 0; i < _chunks.size() && i <= _current; ++i) {
+    unsigned char const* data = _chunks[i].data;
+    for (size_t offset = 0; offset < _chunks[i].used;) {
+      detail::command_header const* header = reinterpret_cast<detail::command_header const*>(data + offset);
+      switch (header->op) {
+      case CommandOp::vkCmdDraw: {
+        detail::vkCmdDraw_record const* record = reinterpret_cast<detail::vkCmdDraw_record const*>(header);
+        command_buffer.vkCmdDraw(record->vertexCount, record->instanceCount, record->firstVertex, record->firstInstance);
+        break;
+      }
+      }
+      offset += header->size;
+    }
+  }
+}
+
+} // vkgen
@@ -0,0 +1,134 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Command streams for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_COMMAND_STREAM_INCLUDE
+#define VK_COMMAND_STREAM_INCLUDE
+
+#include "vk_deep_copy.h"
+#include "vk_dispatch_tables.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace vkgen {
+
+// vkgen::CommandStream records commands for a command buffer without calling
+// into the driver, so that commands can be prepared on any thread and handed
+// to the threads that own the command buffers. Recording a command bumps a
+// pointer and stores the arguments; arrays, strings and structs the command
+// reads are copied into the stream the way vkgen::deep_copy copies them, so
+// the caller's data may go away right after recording. Other pointers, such
+// as pointers to data of unknown size, are stored as they are and must stay
+// valid until the stream has been replayed.
+//
+// replay calls the recorded commands, in order, on the command buffer of a
+// dispatch table. It may be called any number of times, from any thread and
+// concurrently, as long as nothing is being recorded at the same time. reset
+// empties the stream but keeps its memory for recording again.
+//
+// Opcodes depend on the platform defines of the build, so streams are only
+// meant to be replayed by the program that recorded them.
+
+enum class CommandOp : uint32_t {
+  vkCmdDraw,
+};
+
+namespace detail {
+
+// Records are packed at the alignment of the largest Vulkan scalars. Untyped
+// data such as push constants is copied byte by byte and needs no more.
+static size_t const record_alignment = 8;
+
+// Begins every record. |size| includes the data copied behind the record and
+// the padding up to the next record.
+struct command_header {
+  CommandOp op;
+  uint32_t size;
+};
+
+struct vkCmdDraw_record {
+  command_header header;
+  uint32_t vertexCount;
+  uint32_t instanceCount;
+  uint32_t firstVertex;
+  uint32_t firstInstance;
+};
+
+} // detail
+
+class CommandStream {
+public:
+  explicit CommandStream(size_t chunk_size = 64 * 1024) : _chunk_size(chunk_size) {}
+  ~CommandStream();
+  CommandStream(CommandStream const&) = delete;
+  CommandStream& operator=(CommandStream const&) = delete;
+
+  void vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
+
+  void replay(CommandBufferFunctions const& command_buffer) const;
+  void reset();
+  bool empty() const { return _chunks.empty() || (_current == 0 && _chunks[0].used == 0); }
+
+private:
+  // Records are laid out back to back in each chunk, and chunks are replayed
+  // in order up to the current one. Chunks never move, so pointers into them
+  // stay valid while more commands are recorded.
+  struct Chunk {
+    unsigned char* data;
+    size_t capacity;
+    size_t used;
+  };
+
+  // Returns a block of |size| bytes beginning with the header of a record
+  void* _record(CommandOp op, size_t size) {
+    size = detail::align(size, detail::record_alignment);
+    while (_current < _chunks.size() && _chunks[_current].used + size > _chunks[_current].capacity) {
+      ++_current;
+    }
+    if (_current == _chunks.size()) {
+      _new_chunk(std::max(size, _chunk_size));
+    }
+
+    Chunk& chunk = _chunks[_current];
+    detail::command_header* header = reinterpret_cast<detail::command_header*>(chunk.data + chunk.used);
+    header->op = op;
+    header->size = static_cast<uint32_t>(size);
+    chunk.used += size;
+    return header;
+  }
+
+  void _new_chunk(size_t capacity);
+
+private:
+  std::vector<Chunk> _chunks;
+  size_t _current = 0;
+  size_t _chunk_size;
+};
+
+inline void CommandStream::vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+  size_t record_size = sizeof(detail::vkCmdDraw_record);
+  detail::cursor block(_record(CommandOp::vkCmdDraw, record_size));
+  detail::vkCmdDraw_record* record = block.take<detail::vkCmdDraw_record>(1);
+  record->vertexCount = vertexCount;
+  record->instanceCount = instanceCount;
+  record->firstVertex = firstVertex;
+  record->firstInstance = firstInstance;
+}
+
+} // vkgen
+
+#endif // VK_COMMAND_STREAM_INCLUDE
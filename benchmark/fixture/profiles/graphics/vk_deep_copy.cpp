@@ -0,0 +1,33 @@
+#include "vk_deep_copy.h"
+
+namespace vkgen {
+
+template VkApplicationInfo* deep_copy<VkApplicationInfo>(VkApplicationInfo const&, Arena&);
+template VkInstanceCreateInfo* deep_copy<VkInstanceCreateInfo>(VkInstanceCreateInfo const&, Arena&);
+template VkAllocationCallbacks* deep_copy<VkAllocationCallbacks>(VkAllocationCallbacks const&, Arena&);
+template VkPhysicalDeviceFeatures* deep_copy<VkPhysicalDeviceFeatures>(VkPhysicalDeviceFeatures const&, Arena&);
+template VkDeviceQueueCreateInfo* deep_copy<VkDeviceQueueCreateInfo>(VkDeviceQueueCreateInfo const&, Arena&);
+template VkDeviceCreateInfo* deep_copy<VkDeviceCreateInfo>(VkDeviceCreateInfo const&, Arena&);
+template VkSpecializationMapEntry* deep_copy<VkSpecializationMapEntry>(VkSpecializationMapEntry const&, Arena&);
+template VkSpecializationInfo* deep_copy<VkSpecializationInfo>(VkSpecializationInfo const&, Arena&);
+template VkPipelineShaderStageCreateInfo* deep_copy<VkPipelineShaderStageCreateInfo>(VkPipelineShaderStageCreateInfo const&, Arena&);
+template VkVertexInputBindingDescription* deep_copy<VkVertexInputBindingDescription>(VkVertexInputBindingDescription const&, Arena&);
+template VkVertexInputAttributeDescription* deep_copy<VkVertexInputAttributeDescription>(VkVertexInputAttributeDescription const&, Arena&);
+template VkPipelineVertexInputStateCreateInfo* deep_copy<VkPipelineVertexInputStateCreateInfo>(VkPipelineVertexInputStateCreateInfo const&, Arena&);
+template VkPipelineInputAssemblyStateCreateInfo* deep_copy<VkPipelineInputAssemblyStateCreateInfo>(VkPipelineInputAssemblyStateCreateInfo const&, Arena&);
+template VkPipelineTessellationStateCreateInfo* deep_copy<VkPipelineTessellationStateCreateInfo>(VkPipelineTessellationStateCreateInfo const&, Arena&);
+template VkViewport* deep_copy<VkViewport>(VkViewport const&, Arena&);
+template VkOffset2D* deep_copy<VkOffset2D>(VkOffset2D const&, Arena&);
+template VkExtent2D* deep_copy<VkExtent2D>(VkExtent2D const&, Arena&);
+template VkRect2D* deep_copy<VkRect2D>(VkRect2D const&, Arena&);
+template VkPipelineViewportStateCreateInfo* deep_copy<VkPipelineViewportStateCreateInfo>(VkPipelineViewportStateCreateInfo const&, Arena&);
+template VkPipelineRasterizationStateCreateInfo* deep_copy<VkPipelineRasterizationStateCreateInfo>(VkPipelineRasterizationStateCreateInfo const&, Arena&);
+template VkPipelineMultisampleStateCreateInfo* deep_copy<VkPipelineMultisampleStateCreateInfo>(VkPipelineMultisampleStateCreateInfo const&, Arena&);
+template VkStencilOpState* deep_copy<VkStencilOpState>(VkStencilOpState const&, Arena&);
+template VkPipelineDepthStencilStateCreateInfo* deep_copy<VkPipelineDepthStencilStateCreateInfo>(VkPipelineDepthStencilStateCreateInfo const&, Arena&);
+template VkPipelineColorBlendAttachmentState* deep_copy<VkPipelineColorBlendAttachmentState>(VkPipelineColorBlendAttachmentState const&, Arena&);
+template VkPipelineColorBlendStateCreateInfo* deep_copy<VkPipelineColorBlendStateCreateInfo>(VkPipelineColorBlendStateCreateInfo const&, Arena&);
+template VkPipelineDynamicStateCreateInfo* deep_copy<VkPipelineDynamicStateCreateInfo>(VkPipelineDynamicStateCreateInfo const&, Arena&);
+template VkGraphicsPipelineCreateInfo* deep_copy<VkGraphicsPipelineCreateInfo>(VkGraphicsPipelineCreateInfo const&, Arena&);
+
+} // vkgen
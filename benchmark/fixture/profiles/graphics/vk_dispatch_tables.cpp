@@ -0,0 +1,173 @@
+#include "vk_dispatch_tables.h"
+
+#include <stdexcept>
+#if defined(_WIN32)
+#include <Windows.h>
+#elif defined(__linux__)
+#include <dlfcn.h>
+#endif
+
+namespace vkgen {
+
+/*
+ * ------------------------------------------------------
+ * GlobalFunctions
+ * ------------------------------------------------------
+*/
+
+GlobalFunctions::GlobalFunctions(std::string const& vulkan_library) {
+#if defined(_WIN32)
+  library_ = LoadLibraryA(vulkan_library.c_str());
+#elif defined(__linux__)
+  library_ = dlopen(vulkan_library.c_str(), RTLD_NOW);
+#else
+#error "Unsupported OS"
+#endif
+
+  if (!library_) {
+    throw std::runtime_error("Could not load Vulkan loader.");
+  }
+
+#if defined(_WIN32)
+  vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
+      GetProcAddress(static_cast<HMODULE>(library_), "vkGetInstanceProcAddr"));
+#elif defined(__linux__)
+  vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
+      dlsym(library_, "vkGetInstanceProcAddr"));
+#else
+#error "Unsupported OS"
+#endif
+
+  if (!vkGetInstanceProcAddr_) {
+    throw VulkanProcNotFound("vkGetInstanceProcAddr");
+  }
+
+  vkCreateInstance_ = reinterpret_cast<PFN_vkCreateInstance>(this->vkGetInstanceProcAddr(nullptr, "vkCreateInstance"));
+  if (!vkCreateInstance_) {
+    throw VulkanProcNotFound("vkCreateInstance");
+  }
+}
+
+GlobalFunctions::~GlobalFunctions() {
+#if defined(_WIN32)
+  FreeLibrary(static_cast<HMODULE>(library_));
+#elif defined(__linux__)
+  dlclose(library_);
+#else
+#error "Unsupported OS"
+#endif
+}
+
+PFN_vkVoidFunction GlobalFunctions::vkGetInstanceProcAddr(VkInstance instance, const char* pName) const {
+  return this->vkGetInstanceProcAddr_(instance, pName);
+}
+
+VkResult GlobalFunctions::vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) const {
+  return this->vkCreateInstance_(pCreateInfo, pAllocator, pInstance);
+}
+
+/*
+ * ------------------------------------------------------
+ * InstanceFunctions
+ * ------------------------------------------------------
+*/
+
+PFN_vkVoidFunction InstanceFunctions::vkGetInstanceProcAddr(const char* pName) const {
+  return this->vkGetInstanceProcAddr_(instance_, pName);
+}
+
+void InstanceFunctions::vkDestroyInstance(const VkAllocationCallbacks* pAllocator) const {
+  return this->vkDestroyInstance_(instance_, pAllocator);
+}
+
+VkResult InstanceFunctions::vkEnumeratePhysicalDevices(uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) const {
+  return this->vkEnumeratePhysicalDevices_(instance_, pPhysicalDeviceCount, pPhysicalDevices);
+}
+
+InstanceFunctions::InstanceFunctions(VkInstance instance, GlobalFunctions* globals) {
+  instance_ = instance;
+  vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(globals->vkGetInstanceProcAddr(instance, "vkGetInstanceProcAddr"));
+  if (!vkGetInstanceProcAddr_) {
+    throw VulkanProcNotFound("vkGetInstanceProcAddr");
+  }
+  vkDestroyInstance_ = reinterpret_cast<PFN_vkDestroyInstance>(this->vkGetInstanceProcAddr("vkDestroyInstance"));
+  if (!vkDestroyInstance_) {
+    throw VulkanProcNotFound("vkDestroyInstance");
+  }
+  vkEnumeratePhysicalDevices_ = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(this->vkGetInstanceProcAddr("vkEnumeratePhysicalDevices"));
+  if (!vkEnumeratePhysicalDevices_) {
+    throw VulkanProcNotFound("vkEnumeratePhysicalDevices");
+  }
+}
+
+/*
+ * ------------------------------------------------------
+ * PhysicalDeviceFunctions
+ * ------------------------------------------------------
+*/
+
+VkResult PhysicalDeviceFunctions::vkCreateDevice(const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const {
+  return this->vkCreateDevice_(physical_device_, pCreateInfo, pAllocator, pDevice);
+}
+
+PhysicalDeviceFunctions::PhysicalDeviceFunctions(VkPhysicalDevice physical_device, InstanceFunctions* instance) {
+  physical_device_ = physical_device;
+  vkCreateDevice_ = reinterpret_cast<PFN_vkCreateDevice>(instance->vkGetInstanceProcAddr("vkCreateDevice"));
+  if (!vkCreateDevice_) {
+    throw VulkanProcNotFound("vkCreateDevice");
+  }
+}
+
+/*
+ * ------------------------------------------------------
+ * DeviceFunctions
+ * ------------------------------------------------------
+*/
+
+PFN_vkVoidFunction DeviceFunctions::vkGetDeviceProcAddr(const char* pName) const {
+  return this->vkGetDeviceProcAddr_(device_, pName);
+}
+
+void DeviceFunctions::vkDestroyDevice(const VkAllocationCallbacks* pAllocator) const {
+  return this->vkDestroyDevice_(device_, pAllocator);
+}
+
+VkResult DeviceFunctions::vkCreateGraphicsPipelines(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const {
+  return this->vkCreateGraphicsPipelines_(device_, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+DeviceFunctions::DeviceFunctions(VkDevice device, InstanceFunctions* instance) {
+  device_ = device;
+  vkGetDeviceProcAddr_ = reinterpret_cast<PFN_vkGetDeviceProcAddr>(instance->vkGetInstanceProcAddr("vkGetDeviceProcAddr"));
+  if (!vkGetDeviceProcAddr_) {
+    throw VulkanProcNotFound("vkGetDeviceProcAddr");
+  }
+  vkDestroyDevice_ = reinterpret_cast<PFN_vkDestroyDevice>(this->vkGetDeviceProcAddr("vkDestroyDevice"));
+  if (!vkDestroyDevice_) {
+    throw VulkanProcNotFound("vkDestroyDevice");
+  }
+  vkCreateGraphicsPipelines_ = reinterpret_cast<PFN_vkCreateGraphicsPipelines>(this->vkGetDeviceProcAddr("vkCreateGraphicsPipelines"));
+  if (!vkCreateGraphicsPipelines_) {
+    throw VulkanProcNotFound("vkCreateGraphicsPipelines");
+  }
+}
+
+/*
+ * ------------------------------------------------------
+ * CommandBufferFunctions
+ * ------------------------------------------------------
+*/
+
+void CommandBufferFunctions::vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const {
+  return this->vkCmdDraw_(command_buffer_, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+CommandBufferFunctions::CommandBufferFunctions(VkCommandBuffer command_buffer, DeviceFunctions* device) {
+  command_buffer_ = command_buffer;
+  vkCmdDraw_ = reinterpret_cast<PFN_vkCmdDraw>(device->vkGetDeviceProcAddr("vkCmdDraw"));
+  if (!vkCmdDraw_) {
+    throw VulkanProcNotFound("vkCmdDraw");
+  }
+}
+
+} // vkgen
@@ -0,0 +1,122 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Dispatch tables for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_DISPATCH_TABLES_INCLUDE
+#define VK_DISPATCH_TABLES_INCLUDE
+
+#include "vulkan_include.inl"
+#include <stdexcept>
+#include <string>
+
+namespace vkgen {
+
+class VulkanProcNotFound: public std::exception {
+public:
+  VulkanProcNotFound(std::string const& proc) : proc_(proc) {}
+  virtual const char* what() const throw() {
+    return "Write better error message here";
+  }
+
+private:
+  std::string proc_;
+};
+
+class GlobalFunctions {
+  // HMODULE on Windows. Kept opaque so that platform headers are only
+  // included by the implementation.
+  typedef void* library_handle;
+
+public:
+  GlobalFunctions(std::string const& vulkan_library);
+  ~GlobalFunctions();
+  PFN_vkVoidFunction vkGetInstanceProcAddr(VkInstance instance, const char* pName) const;
+  VkResult vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) const;
+
+private:
+  GlobalFunctions(GlobalFunctions& other) = delete;
+  void operator=(GlobalFunctions& rhs) = delete;
+
+private:
+  library_handle library_ = nullptr;
+  PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr_ = nullptr;
+  PFN_vkCreateInstance vkCreateInstance_ = nullptr;
+};
+
+class InstanceFunctions {
+public:
+  VkInstance instance() const { return instance_; }
+  PFN_vkVoidFunction vkGetInstanceProcAddr(const char* pName) const;
+  void vkDestroyInstance(const VkAllocationCallbacks* pAllocator) const;
+  VkResult vkEnumeratePhysicalDevices(uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) const;
+
+protected:
+  InstanceFunctions(VkInstance instance, GlobalFunctions* globals);
+
+private:
+  VkInstance instance_ = VK_NULL_HANDLE;
+  PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr_ = nullptr;
+  PFN_vkDestroyInstance vkDestroyInstance_ = nullptr;
+  PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices_ = nullptr;
+};
+
+class PhysicalDeviceFunctions {
+public:
+  VkPhysicalDevice physical_device() const { return physical_device_; }
+  VkResult vkCreateDevice(const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const;
+
+protected:
+  PhysicalDeviceFunctions(VkPhysicalDevice physical_device, InstanceFunctions* instance);
+
+private:
+  VkPhysicalDevice physical_device_ = VK_NULL_HANDLE;
+  PFN_vkCreateDevice vkCreateDevice_ = nullptr;
+};
+
+class DeviceFunctions {
+public:
+  VkDevice device() const { return device_; }
+  PFN_vkVoidFunction vkGetDeviceProcAddr(const char* pName) const;
+  void vkDestroyDevice(const VkAllocationCallbacks* pAllocator) const;
+  VkResult vkCreateGraphicsPipelines(VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const;
+
+protected:
+  DeviceFunctions(VkDevice device, InstanceFunctions* instance);
+
+private:
+  VkDevice device_ = VK_NULL_HANDLE;
+  PFN_vkGetDeviceProcAddr vkGetDeviceProcAddr_ = nullptr;
+  PFN_vkDestroyDevice vkDestroyDevice_ = nullptr;
+  PFN_vkCreateGraphicsPipelines vkCreateGraphicsPipelines_ = nullptr;
+};
+
+class CommandBufferFunctions {
+public:
+  VkCommandBuffer command_buffer() const { return command_buffer_; }
+  void vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const;
+
+protected:
+  CommandBufferFunctions(VkCommandBuffer command_buffer, DeviceFunctions* device);
+
+private:
+  VkCommandBuffer command_buffer_ = VK_NULL_HANDLE;
+  PFN_vkCmdDraw vkCmdDraw_ = nullptr;
+};
+
+} // vkgen
+
+#endif // VK_DISPATCH_TABLES_INCLUDE
+
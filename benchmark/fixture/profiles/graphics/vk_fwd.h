@@ -0,0 +1,91 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Forward declarations for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_FWD_INCLUDE
+#define VK_FWD_INCLUDE
+
+#include <cstdint>
+
+typedef struct VkInstance_T* VkInstance;
+typedef struct VkPhysicalDevice_T* VkPhysicalDevice;
+typedef struct VkDevice_T* VkDevice;
+typedef struct VkCommandBuffer_T* VkCommandBuffer;
+
+#if defined(__LP64__) || defined(_WIN64) || (defined(__x86_64__) && !defined(__ILP32__) ) || defined(_M_X64) || defined(__ia64) || defined (_M_IA64) || defined(__aarch64__) || defined(__powerpc64__)
+typedef struct VkPipelineLayout_T* VkPipelineLayout;
+typedef struct VkShaderModule_T* VkShaderModule;
+typedef struct VkPipelineCache_T* VkPipelineCache;
+typedef struct VkRenderPass_T* VkRenderPass;
+typedef struct VkPipeline_T* VkPipeline;
+#else
+typedef uint64_t VkPipelineLayout;
+typedef uint64_t VkShaderModule;
+typedef uint64_t VkPipelineCache;
+typedef uint64_t VkRenderPass;
+typedef uint64_t VkPipeline;
+#endif
+
+typedef struct VkApplicationInfo VkApplicationInfo;
+typedef struct VkInstanceCreateInfo VkInstanceCreateInfo;
+typedef struct VkAllocationCallbacks VkAllocationCallbacks;
+typedef struct VkPhysicalDeviceFeatures VkPhysicalDeviceFeatures;
+typedef struct VkDeviceQueueCreateInfo VkDeviceQueueCreateInfo;
+typedef struct VkDeviceCreateInfo VkDeviceCreateInfo;
+typedef struct VkSpecializationMapEntry VkSpecializationMapEntry;
+typedef struct VkSpecializationInfo VkSpecializationInfo;
+typedef struct VkPipelineShaderStageCreateInfo VkPipelineShaderStageCreateInfo;
+typedef struct VkVertexInputBindingDescription VkVertexInputBindingDescription;
+typedef struct VkVertexInputAttributeDescription VkVertexInputAttributeDescription;
+typedef struct VkPipelineVertexInputStateCreateInfo VkPipelineVertexInputStateCreateInfo;
+typedef struct VkPipelineInputAssemblyStateCreateInfo VkPipelineInputAssemblyStateCreateInfo;
+typedef struct VkPipelineTessellationStateCreateInfo VkPipelineTessellationStateCreateInfo;
+typedef struct VkViewport VkViewport;
+typedef struct VkOffset2D VkOffset2D;
+typedef struct VkExtent2D VkExtent2D;
+typedef struct VkRect2D VkRect2D;
+typedef struct VkPipelineViewportStateCreateInfo VkPipelineViewportStateCreateInfo;
+typedef struct VkPipelineRasterizationStateCreateInfo VkPipelineRasterizationStateCreateInfo;
+typedef struct VkPipelineMultisampleStateCreateInfo VkPipelineMultisampleStateCreateInfo;
+typedef struct VkStencilOpState VkStencilOpState;
+typedef struct VkPipelineDepthStencilStateCreateInfo VkPipelineDepthStencilStateCreateInfo;
+typedef struct VkPipelineColorBlendAttachmentState VkPipelineColorBlendAttachmentState;
+typedef struct VkPipelineColorBlendStateCreateInfo VkPipelineColorBlendStateCreateInfo;
+typedef struct VkPipelineDynamicStateCreateInfo VkPipelineDynamicStateCreateInfo;
+typedef struct VkGraphicsPipelineCreateInfo VkGraphicsPipelineCreateInfo;
+
+namespace vkgen {
+
+class InstanceFunctions;
+class PhysicalDeviceFunctions;
+class DeviceFunctions;
+class CommandBufferFunctions;
+class GlobalFunctions;
+class DispatchLoaderStatic;
+class DispatchLoaderDynamic;
+template <typename T> struct hash;
+template <typename T> struct equal_to;
+template <typename T> struct deep_hash;
+template <typename T> struct deep_equal_to;
+class Arena;
+template <typename T> struct deep_copier;
+class CommandStream;
+struct StateFilterCounters;
+class StateFilter;
+
+} // vkgen
+
+#endif // VK_FWD_INCLUDE
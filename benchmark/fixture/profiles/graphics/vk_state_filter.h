@@ -0,0 +1,163 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// State filters for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_STATE_FILTER_INCLUDE
+#define VK_STATE_FILTER_INCLUDE
+
+#include "vk_dispatch_tables.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace vkgen {
+
+// vkgen::StateFilter passes the commands recorded through it on to a command
+// buffer, except for calls of state-setting commands that would change
+// nothing. A call is dropped when its arguments, including the contents of
+// the arrays and structs they point to, are the same as those of the last
+// call of the same command that was passed on. Tracking starts over when the
+// command buffer is begun or reset and after secondary command buffers are
+// executed, and calls that may change state tracked for other commands, such
+// as pipeline binds overriding dynamic state, make the filter forget it.
+//
+// Like its command buffer, a filter is used by one thread at a time. Commands
+// recorded on the command buffer without going through the filter leave it
+// out of date, so invalidate() must be called after recording them. counters()
+// tells how many calls were passed on and how many were dropped per command.
+
+namespace detail {
+
+// The arguments of the last call of a command. Those of a new call are
+// compared with them as they are added and replace them from the first
+// difference on. Storage is kept, so that recording does not allocate once
+// the largest arguments of the command have been seen.
+class state_key {
+public:
+  void begin_call() {
+    _size = 0;
+    _changed = !_valid;
+  }
+
+  // Whether the arguments of the call differ from those of the last one
+  bool end_call() {
+    bool changed = _changed || _size != _last_size;
+    _last_size = _size;
+    _valid = true;
+    return changed;
+  }
+
+  void invalidate() { _valid = false; }
+
+  template <typename T>
+  void add(T const& value) {
+    add_bytes(&value, sizeof(T));
+  }
+
+  template <typename T>
+  void add_range(T const* values, size_t count) {
+    add(values != nullptr);
+    if (values) {
+      add_bytes(values, count * sizeof(T));
+    }
+  }
+
+  void add_range(void const* data, size_t size) {
+    add(data != nullptr);
+    if (data) {
+      add_bytes(data, size);
+    }
+  }
+
+  void add_string(char const* s) {
+    add(s != nullptr);
+    if (s) {
+      add_bytes(s, std::strlen(s) + 1);
+    }
+  }
+
+private:
+  void add_bytes(void const* data, size_t size) {
+    if (size == 0) {
+      return;
+    }
+    if (!_changed) {
+      if (_size + size <= _last_size && std::memcmp(_bytes.data() + _size, data, size) == 0) {
+        _size += size;
+        return;
+      }
+      _changed = true;
+    }
+    if (_size + size > _bytes.size()) {
+      _bytes.resize(std::max(_size + size, 2 * _bytes.size()));
+    }
+    std::memcpy(_bytes.data() + _size, data, size);
+    _size += size;
+  }
+
+private:
+  std::vector<unsigned char> _bytes;
+  size_t _size = 0; // Of the arguments added so far
+  size_t _last_size = 0;
+  bool _changed = false;
+  bool _valid = false;
+};
+
+} // detail
+
+struct StateFilterCounters {
+  uint64_t forwarded = 0; // Calls of all commands passed on to the command buffer
+
+  // Dropped calls per command
+
+  uint64_t eliminated() const {
+    uint64_t sum = 0;
+    return sum;
+  }
+};
+
+class StateFilter {
+public:
+  explicit StateFilter(CommandBufferFunctions const& command_buffer) : _command_buffer(command_buffer) {}
+  StateFilter(StateFilter const&) = delete;
+  StateFilter& operator=(StateFilter const&) = delete;
+
+  CommandBufferFunctions const& command_buffer() const { return _command_buffer; }
+  void vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance);
+
+  void invalidate();
+  StateFilterCounters const& counters() const { return _counters; }
+  void reset_counters() { _counters = StateFilterCounters(); }
+
+private:
+  CommandBufferFunctions const& _command_buffer;
+  StateFilterCounters _counters;
+
+  // Arguments of the last call passed on, per filtered command
+};
+
+inline void StateFilter::invalidate() {
+}
+
+inline void StateFilter::vkCmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+  ++_counters.forwarded;
+  _command_buffer.vkCmdDraw(vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+} // vkgen
+
+#endif // VK_STATE_FILTER_INCLUDE
@@ -0,0 +1,2310 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Struct hashing for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_STRUCT_HASH_INCLUDE
+#define VK_STRUCT_HASH_INCLUDE
+
+#include "vulkan_include.inl"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+namespace vkgen {
+
+// vkgen::hash<T> and vkgen::equal_to<T> are shallow: members are compared by
+// value, while pointer members (pNext included) are compared by address and
+// the data they point to is never read. Floats compare with operator==, which
+// means 0.0f and -0.0f are equal and hash the same. A struct without floats
+// and without padding (checked at compile time through sizeof) has bitwise set
+// and is compared with memcmp and hashed as one block of memory. Unions are
+// always treated as raw bytes, so zero-initialize them before writing a member
+// that does not cover the whole union.
+//
+// vkgen::deep_hash<T> and vkgen::deep_equal_to<T> compare content instead:
+// len annotated arrays, strings and single struct pointers are followed
+// whenever they are not null, so unused pointers must be null. pNext chains
+// are walked link by link. Links with an sType unknown to the generator
+// contribute only their sType to the hash and compare by address.
+template <typename T> struct hash;
+template <typename T> struct equal_to;
+template <typename T> struct deep_hash;
+template <typename T> struct deep_equal_to;
+
+namespace detail {
+
+inline uint64_t mix(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+// Consumes eight bytes at a time. A trailing partial word is zero-extended.
+inline uint64_t hash_bytes(uint64_t seed, void const* data, size_t size) {
+  unsigned char const* p = static_cast<unsigned char const*>(data);
+  uint64_t h = seed ^ (size * 0x9e3779b97f4a7c15ULL);
+  for (; size >= 8; p += 8, size -= 8) {
+    uint64_t k;
+    std::memcpy(&k, p, 8);
+    h = mix(h ^ k);
+  }
+  if (size > 0) {
+    uint64_t k = 0;
+    std::memcpy(&k, p, size);
+    h = mix(h ^ k);
+  }
+  return h;
+}
+
+template <typename T>
+inline uint64_t hash_value(uint64_t seed, T const& v) {
+  return hash_bytes(seed, &v, sizeof(v));
+}
+
+inline uint64_t hash_value(uint64_t seed, float v) {
+  if (v == 0.0f) {
+    v = 0.0f; // Fold -0.0f into 0.0f
+  }
+  return hash_bytes(seed, &v, sizeof(v));
+}
+
+template <size_t N>
+inline uint64_t hash_value(uint64_t seed, float const (&v)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    seed = hash_value(seed, v[i]);
+  }
+  return seed;
+}
+
+template <typename H, typename T, size_t N>
+inline uint64_t combine_each(uint64_t seed, T const (&v)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    seed = H::combine(seed, v[i]);
+  }
+  return seed;
+}
+
+template <typename T>
+inline bool equal_value(T const& a, T const& b) {
+  return a == b;
+}
+
+template <typename T, size_t N>
+inline bool equal_value(T const (&a)[N], T const (&b)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    if (!(a[i] == b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename E, typename T, size_t N>
+inline bool equal_each(T const (&a)[N], T const (&b)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    if (!E()(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Pointed-to scalars are hashed as one block of memory, except for floats.
+template <typename T>
+inline uint64_t hash_range(uint64_t seed, T const* p, size_t n) {
+  return hash_bytes(seed, p, p ? n * sizeof(T) : 0);
+}
+
+inline uint64_t hash_range(uint64_t seed, void const* p, size_t n) {
+  return hash_bytes(seed, p, p ? n : 0);
+}
+
+inline uint64_t hash_range(uint64_t seed, float const* p, size_t n) {
+  if (!p) {
+    n = 0;
+  }
+  seed = hash_value(seed, n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = hash_value(seed, p[i]);
+  }
+  return seed;
+}
+
+template <typename T>
+inline bool equal_range(T const* a, T const* b, size_t n) {
+  return n == 0 || a == b || (a && b && std::memcmp(a, b, n * sizeof(T)) == 0);
+}
+
+inline bool equal_range(void const* a, void const* b, size_t n) {
+  return n == 0 || a == b || (a && b && std::memcmp(a, b, n) == 0);
+}
+
+inline bool equal_range(float const* a, float const* b, size_t n) {
+  if (n == 0 || a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!(a[i] == b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename H, typename T>
+inline uint64_t combine_range(uint64_t seed, T const* p, size_t n) {
+  if (!p) {
+    n = 0;
+  }
+  seed = hash_value(seed, n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = H::combine(seed, p[i]);
+  }
+  return seed;
+}
+
+template <typename E, typename T>
+inline bool equal_each_range(T const* a, T const* b, size_t n) {
+  if (n == 0 || a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!E()(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename H, typename T>
+inline uint64_t combine_pointee(uint64_t seed, T const* p) {
+  return p ? H::combine(mix(seed), *p) : seed;
+}
+
+template <typename E, typename T>
+inline bool equal_pointee(T const* a, T const* b) {
+  return a == b || (a && b && E()(*a, *b));
+}
+
+inline uint64_t hash_string(uint64_t seed, char const* s) {
+  return s ? hash_bytes(mix(seed), s, std::strlen(s)) : seed;
+}
+
+inline bool equal_string(char const* a, char const* b) {
+  return a == b || (a && b && std::strcmp(a, b) == 0);
+}
+
+inline uint64_t hash_strings(uint64_t seed, char const* const* p, size_t n) {
+  if (!p) {
+    n = 0;
+  }
+  seed = hash_value(seed, n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = hash_string(seed, p[i]);
+  }
+  return seed;
+}
+
+inline bool equal_strings(char const* const* a, char const* const* b, size_t n) {
+  if (n == 0 || a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!equal_string(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Common beginning of all structs that can be part of a pNext chain. Shared
+// with the other vkgen headers.
+#ifndef VKGEN_CHAIN_LINK_DEFINED
+#define VKGEN_CHAIN_LINK_DEFINED
+struct chain_link {
+  VkStructureType sType;
+  void const* pNext;
+};
+#endif
+
+// Defined after all structs since any of them may be part of a chain
+inline uint64_t deep_hash_next(uint64_t seed, void const* next);
+inline bool deep_equal_next(void const* a, void const* b);
+
+} // detail
+
+template <> struct equal_to<VkApplicationInfo> {
+  static const bool bitwise = sizeof(VkApplicationInfo) == (sizeof(VkApplicationInfo::sType) + sizeof(VkApplicationInfo::pNext) + sizeof(VkApplicationInfo::pApplicationName) + sizeof(VkApplicationInfo::applicationVersion) + sizeof(VkApplicationInfo::pEngineName) + sizeof(VkApplicationInfo::engineVersion) + sizeof(VkApplicationInfo::apiVersion));
+  bool operator()(VkApplicationInfo const& a, VkApplicationInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.pApplicationName, b.pApplicationName) &&
+        detail::equal_value(a.applicationVersion, b.applicationVersion) &&
+        detail::equal_value(a.pEngineName, b.pEngineName) &&
+        detail::equal_value(a.engineVersion, b.engineVersion) &&
+        detail::equal_value(a.apiVersion, b.apiVersion);
+  }
+};
+
+template <> struct hash<VkApplicationInfo> {
+  static uint64_t combine(uint64_t seed, VkApplicationInfo const& v) {
+    if (equal_to<VkApplicationInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.pApplicationName);
+    seed = detail::hash_value(seed, v.applicationVersion);
+    seed = detail::hash_value(seed, v.pEngineName);
+    seed = detail::hash_value(seed, v.engineVersion);
+    seed = detail::hash_value(seed, v.apiVersion);
+    return seed;
+  }
+  size_t operator()(VkApplicationInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkApplicationInfo> {
+  static bool members(VkApplicationInfo const& a, VkApplicationInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.applicationVersion, b.applicationVersion) &&
+        detail::equal_value(a.engineVersion, b.engineVersion) &&
+        detail::equal_value(a.apiVersion, b.apiVersion) &&
+        detail::equal_string(a.pApplicationName, b.pApplicationName) &&
+        detail::equal_string(a.pEngineName, b.pEngineName);
+  }
+  bool operator()(VkApplicationInfo const& a, VkApplicationInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkApplicationInfo> {
+  static uint64_t members(uint64_t seed, VkApplicationInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_string(seed, v.pApplicationName);
+    seed = detail::hash_value(seed, v.applicationVersion);
+    seed = detail::hash_string(seed, v.pEngineName);
+    seed = detail::hash_value(seed, v.engineVersion);
+    seed = detail::hash_value(seed, v.apiVersion);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkApplicationInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkApplicationInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkInstanceCreateInfo> {
+  static const bool bitwise = sizeof(VkInstanceCreateInfo) == (sizeof(VkInstanceCreateInfo::sType) + sizeof(VkInstanceCreateInfo::pNext) + sizeof(VkInstanceCreateInfo::flags) + sizeof(VkInstanceCreateInfo::pApplicationInfo) + sizeof(VkInstanceCreateInfo::enabledLayerCount) + sizeof(VkInstanceCreateInfo::ppEnabledLayerNames) + sizeof(VkInstanceCreateInfo::enabledExtensionCount) + sizeof(VkInstanceCreateInfo::ppEnabledExtensionNames));
+  bool operator()(VkInstanceCreateInfo const& a, VkInstanceCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.pApplicationInfo, b.pApplicationInfo) &&
+        detail::equal_value(a.enabledLayerCount, b.enabledLayerCount) &&
+        detail::equal_value(a.ppEnabledLayerNames, b.ppEnabledLayerNames) &&
+        detail::equal_value(a.enabledExtensionCount, b.enabledExtensionCount) &&
+        detail::equal_value(a.ppEnabledExtensionNames, b.ppEnabledExtensionNames);
+  }
+};
+
+template <> struct hash<VkInstanceCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkInstanceCreateInfo const& v) {
+    if (equal_to<VkInstanceCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.pApplicationInfo);
+    seed = detail::hash_value(seed, v.enabledLayerCount);
+    seed = detail::hash_value(seed, v.ppEnabledLayerNames);
+    seed = detail::hash_value(seed, v.enabledExtensionCount);
+    seed = detail::hash_value(seed, v.ppEnabledExtensionNames);
+    return seed;
+  }
+  size_t operator()(VkInstanceCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkInstanceCreateInfo> {
+  static bool members(VkInstanceCreateInfo const& a, VkInstanceCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.enabledLayerCount, b.enabledLayerCount) &&
+        detail::equal_value(a.enabledExtensionCount, b.enabledExtensionCount) &&
+        detail::equal_pointee<deep_equal_to<VkApplicationInfo>>(a.pApplicationInfo, b.pApplicationInfo) &&
+        detail::equal_strings(a.ppEnabledLayerNames, b.ppEnabledLayerNames, a.enabledLayerCount) &&
+        detail::equal_strings(a.ppEnabledExtensionNames, b.ppEnabledExtensionNames, a.enabledExtensionCount);
+  }
+  bool operator()(VkInstanceCreateInfo const& a, VkInstanceCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkInstanceCreateInfo> {
+  static uint64_t members(uint64_t seed, VkInstanceCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::combine_pointee<deep_hash<VkApplicationInfo>>(seed, v.pApplicationInfo);
+    seed = detail::hash_value(seed, v.enabledLayerCount);
+    seed = detail::hash_strings(seed, v.ppEnabledLayerNames, v.enabledLayerCount);
+    seed = detail::hash_value(seed, v.enabledExtensionCount);
+    seed = detail::hash_strings(seed, v.ppEnabledExtensionNames, v.enabledExtensionCount);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkInstanceCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkInstanceCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkAllocationCallbacks> {
+  static const bool bitwise = sizeof(VkAllocationCallbacks) == (sizeof(VkAllocationCallbacks::pUserData) + sizeof(VkAllocationCallbacks::pfnAllocation) + sizeof(VkAllocationCallbacks::pfnFree));
+  bool operator()(VkAllocationCallbacks const& a, VkAllocationCallbacks const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.pUserData, b.pUserData) &&
+        detail::equal_value(a.pfnAllocation, b.pfnAllocation) &&
+        detail::equal_value(a.pfnFree, b.pfnFree);
+  }
+};
+
+template <> struct hash<VkAllocationCallbacks> {
+  static uint64_t combine(uint64_t seed, VkAllocationCallbacks const& v) {
+    if (equal_to<VkAllocationCallbacks>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.pUserData);
+    seed = detail::hash_value(seed, v.pfnAllocation);
+    seed = detail::hash_value(seed, v.pfnFree);
+    return seed;
+  }
+  size_t operator()(VkAllocationCallbacks const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkAllocationCallbacks> {
+  static bool members(VkAllocationCallbacks const& a, VkAllocationCallbacks const& b) {
+    return detail::equal_value(a.pUserData, b.pUserData) &&
+        detail::equal_value(a.pfnAllocation, b.pfnAllocation) &&
+        detail::equal_value(a.pfnFree, b.pfnFree);
+  }
+  bool operator()(VkAllocationCallbacks const& a, VkAllocationCallbacks const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkAllocationCallbacks> {
+  static uint64_t members(uint64_t seed, VkAllocationCallbacks const& v) {
+    seed = detail::hash_value(seed, v.pUserData);
+    seed = detail::hash_value(seed, v.pfnAllocation);
+    seed = detail::hash_value(seed, v.pfnFree);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkAllocationCallbacks const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkAllocationCallbacks const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPhysicalDeviceFeatures> {
+  static const bool bitwise = sizeof(VkPhysicalDeviceFeatures) == (sizeof(VkPhysicalDeviceFeatures::robustBufferAccess) + sizeof(VkPhysicalDeviceFeatures::fullDrawIndexUint32) + sizeof(VkPhysicalDeviceFeatures::imageCubeArray) + sizeof(VkPhysicalDeviceFeatures::independentBlend) + sizeof(VkPhysicalDeviceFeatures::geometryShader) + sizeof(VkPhysicalDeviceFeatures::tessellationShader) + sizeof(VkPhysicalDeviceFeatures::sampleRateShading) + sizeof(VkPhysicalDeviceFeatures::dualSrcBlend) + sizeof(VkPhysicalDeviceFeatures::logicOp) + sizeof(VkPhysicalDeviceFeatures::multiDrawIndirect) + sizeof(VkPhysicalDeviceFeatures::drawIndirectFirstInstance) + sizeof(VkPhysicalDeviceFeatures::depthClamp) + sizeof(VkPhysicalDeviceFeatures::depthBiasClamp) + sizeof(VkPhysicalDeviceFeatures::fillModeNonSolid) + sizeof(VkPhysicalDeviceFeatures::depthBounds) + sizeof(VkPhysicalDeviceFeatures::wideLines) + sizeof(VkPhysicalDeviceFeatures::largePoints) + sizeof(VkPhysicalDeviceFeatures::alphaToOne) + sizeof(VkPhysicalDeviceFeatures::multiViewport) + sizeof(VkPhysicalDeviceFeatures::samplerAnisotropy) + sizeof(VkPhysicalDeviceFeatures::textureCompressionETC2) + sizeof(VkPhysicalDeviceFeatures::textureCompressionASTC_LDR) + sizeof(VkPhysicalDeviceFeatures::textureCompressionBC) + sizeof(VkPhysicalDeviceFeatures::occlusionQueryPrecise) + sizeof(VkPhysicalDeviceFeatures::pipelineStatisticsQuery) + sizeof(VkPhysicalDeviceFeatures::vertexPipelineStoresAndAtomics) + sizeof(VkPhysicalDeviceFeatures::fragmentStoresAndAtomics) + sizeof(VkPhysicalDeviceFeatures::shaderTessellationAndGeometryPointSize) + sizeof(VkPhysicalDeviceFeatures::shaderImageGatherExtended) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageExtendedFormats) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageMultisample) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageReadWithoutFormat) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageWriteWithoutFormat) + sizeof(VkPhysicalDeviceFeatures::shaderUniformBufferArrayDynamicIndexing) + sizeof(VkPhysicalDeviceFeatures::shaderSampledImageArrayDynamicIndexing) + sizeof(VkPhysicalDeviceFeatures::shaderStorageBufferArrayDynamicIndexing) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageArrayDynamicIndexing) + sizeof(VkPhysicalDeviceFeatures::shaderClipDistance) + sizeof(VkPhysicalDeviceFeatures::shaderCullDistance) + sizeof(VkPhysicalDeviceFeatures::shaderFloat64) + sizeof(VkPhysicalDeviceFeatures::shaderInt64) + sizeof(VkPhysicalDeviceFeatures::shaderInt16) + sizeof(VkPhysicalDeviceFeatures::shaderResourceResidency) + sizeof(VkPhysicalDeviceFeatures::shaderResourceMinLod) + sizeof(VkPhysicalDeviceFeatures::sparseBinding) + sizeof(VkPhysicalDeviceFeatures::sparseResidencyBuffer) + sizeof(VkPhysicalDeviceFeatures::sparseResidencyImage2D) + sizeof(VkPhysicalDeviceFeatures::sparseResidencyImage3D) + sizeof(VkPhysicalDeviceFeatures::sparseResidency2Samples) + sizeof(VkPhysicalDeviceFeatures::sparseResidency4Samples) + sizeof(VkPhysicalDeviceFeatures::sparseResidency8Samples) + sizeof(VkPhysicalDeviceFeatures::sparseResidency16Samples) + sizeof(VkPhysicalDeviceFeatures::sparseResidencyAliased) + sizeof(VkPhysicalDeviceFeatures::variableMultisampleRate) + sizeof(VkPhysicalDeviceFeatures::inheritedQueries));
+  bool operator()(VkPhysicalDeviceFeatures const& a, VkPhysicalDeviceFeatures const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.robustBufferAccess, b.robustBufferAccess) &&
+        detail::equal_value(a.fullDrawIndexUint32, b.fullDrawIndexUint32) &&
+        detail::equal_value(a.imageCubeArray, b.imageCubeArray) &&
+        detail::equal_value(a.independentBlend, b.independentBlend) &&
+        detail::equal_value(a.geometryShader, b.geometryShader) &&
+        detail::equal_value(a.tessellationShader, b.tessellationShader) &&
+        detail::equal_value(a.sampleRateShading, b.sampleRateShading) &&
+        detail::equal_value(a.dualSrcBlend, b.dualSrcBlend) &&
+        detail::equal_value(a.logicOp, b.logicOp) &&
+        detail::equal_value(a.multiDrawIndirect, b.multiDrawIndirect) &&
+        detail::equal_value(a.drawIndirectFirstInstance, b.drawIndirectFirstInstance) &&
+        detail::equal_value(a.depthClamp, b.depthClamp) &&
+        detail::equal_value(a.depthBiasClamp, b.depthBiasClamp) &&
+        detail::equal_value(a.fillModeNonSolid, b.fillModeNonSolid) &&
+        detail::equal_value(a.depthBounds, b.depthBounds) &&
+        detail::equal_value(a.wideLines, b.wideLines) &&
+        detail::equal_value(a.largePoints, b.largePoints) &&
+        detail::equal_value(a.alphaToOne, b.alphaToOne) &&
+        detail::equal_value(a.multiViewport, b.multiViewport) &&
+        detail::equal_value(a.samplerAnisotropy, b.samplerAnisotropy) &&
+        detail::equal_value(a.textureCompressionETC2, b.textureCompressionETC2) &&
+        detail::equal_value(a.textureCompressionASTC_LDR, b.textureCompressionASTC_LDR) &&
+        detail::equal_value(a.textureCompressionBC, b.textureCompressionBC) &&
+        detail::equal_value(a.occlusionQueryPrecise, b.occlusionQueryPrecise) &&
+        detail::equal_value(a.pipelineStatisticsQuery, b.pipelineStatisticsQuery) &&
+        detail::equal_value(a.vertexPipelineStoresAndAtomics, b.vertexPipelineStoresAndAtomics) &&
+        detail::equal_value(a.fragmentStoresAndAtomics, b.fragmentStoresAndAtomics) &&
+        detail::equal_value(a.shaderTessellationAndGeometryPointSize, b.shaderTessellationAndGeometryPointSize) &&
+        detail::equal_value(a.shaderImageGatherExtended, b.shaderImageGatherExtended) &&
+        detail::equal_value(a.shaderStorageImageExtendedFormats, b.shaderStorageImageExtendedFormats) &&
+        detail::equal_value(a.shaderStorageImageMultisample, b.shaderStorageImageMultisample) &&
+        detail::equal_value(a.shaderStorageImageReadWithoutFormat, b.shaderStorageImageReadWithoutFormat) &&
+        detail::equal_value(a.shaderStorageImageWriteWithoutFormat, b.shaderStorageImageWriteWithoutFormat) &&
+        detail::equal_value(a.shaderUniformBufferArrayDynamicIndexing, b.shaderUniformBufferArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderSampledImageArrayDynamicIndexing, b.shaderSampledImageArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderStorageBufferArrayDynamicIndexing, b.shaderStorageBufferArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderStorageImageArrayDynamicIndexing, b.shaderStorageImageArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderClipDistance, b.shaderClipDistance) &&
+        detail::equal_value(a.shaderCullDistance, b.shaderCullDistance) &&
+        detail::equal_value(a.shaderFloat64, b.shaderFloat64) &&
+        detail::equal_value(a.shaderInt64, b.shaderInt64) &&
+        detail::equal_value(a.shaderInt16, b.shaderInt16) &&
+        detail::equal_value(a.shaderResourceResidency, b.shaderResourceResidency) &&
+        detail::equal_value(a.shaderResourceMinLod, b.shaderResourceMinLod) &&
+        detail::equal_value(a.sparseBinding, b.sparseBinding) &&
+        detail::equal_value(a.sparseResidencyBuffer, b.sparseResidencyBuffer) &&
+        detail::equal_value(a.sparseResidencyImage2D, b.sparseResidencyImage2D) &&
+        detail::equal_value(a.sparseResidencyImage3D, b.sparseResidencyImage3D) &&
+        detail::equal_value(a.sparseResidency2Samples, b.sparseResidency2Samples) &&
+        detail::equal_value(a.sparseResidency4Samples, b.sparseResidency4Samples) &&
+        detail::equal_value(a.sparseResidency8Samples, b.sparseResidency8Samples) &&
+        detail::equal_value(a.sparseResidency16Samples, b.sparseResidency16Samples) &&
+        detail::equal_value(a.sparseResidencyAliased, b.sparseResidencyAliased) &&
+        detail::equal_value(a.variableMultisampleRate, b.variableMultisampleRate) &&
+        detail::equal_value(a.inheritedQueries, b.inheritedQueries);
+  }
+};
+
+template <> struct hash<VkPhysicalDeviceFeatures> {
+  static uint64_t combine(uint64_t seed, VkPhysicalDeviceFeatures const& v) {
+    if (equal_to<VkPhysicalDeviceFeatures>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.robustBufferAccess);
+    seed = detail::hash_value(seed, v.fullDrawIndexUint32);
+    seed = detail::hash_value(seed, v.imageCubeArray);
+    seed = detail::hash_value(seed, v.independentBlend);
+    seed = detail::hash_value(seed, v.geometryShader);
+    seed = detail::hash_value(seed, v.tessellationShader);
+    seed = detail::hash_value(seed, v.sampleRateShading);
+    seed = detail::hash_value(seed, v.dualSrcBlend);
+    seed = detail::hash_value(seed, v.logicOp);
+    seed = detail::hash_value(seed, v.multiDrawIndirect);
+    seed = detail::hash_value(seed, v.drawIndirectFirstInstance);
+    seed = detail::hash_value(seed, v.depthClamp);
+    seed = detail::hash_value(seed, v.depthBiasClamp);
+    seed = detail::hash_value(seed, v.fillModeNonSolid);
+    seed = detail::hash_value(seed, v.depthBounds);
+    seed = detail::hash_value(seed, v.wideLines);
+    seed = detail::hash_value(seed, v.largePoints);
+    seed = detail::hash_value(seed, v.alphaToOne);
+    seed = detail::hash_value(seed, v.multiViewport);
+    seed = detail::hash_value(seed, v.samplerAnisotropy);
+    seed = detail::hash_value(seed, v.textureCompressionETC2);
+    seed = detail::hash_value(seed, v.textureCompressionASTC_LDR);
+    seed = detail::hash_value(seed, v.textureCompressionBC);
+    seed = detail::hash_value(seed, v.occlusionQueryPrecise);
+    seed = detail::hash_value(seed, v.pipelineStatisticsQuery);
+    seed = detail::hash_value(seed, v.vertexPipelineStoresAndAtomics);
+    seed = detail::hash_value(seed, v.fragmentStoresAndAtomics);
+    seed = detail::hash_value(seed, v.shaderTessellationAndGeometryPointSize);
+    seed = detail::hash_value(seed, v.shaderImageGatherExtended);
+    seed = detail::hash_value(seed, v.shaderStorageImageExtendedFormats);
+    seed = detail::hash_value(seed, v.shaderStorageImageMultisample);
+    seed = detail::hash_value(seed, v.shaderStorageImageReadWithoutFormat);
+    seed = detail::hash_value(seed, v.shaderStorageImageWriteWithoutFormat);
+    seed = detail::hash_value(seed, v.shaderUniformBufferArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderSampledImageArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderStorageBufferArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderStorageImageArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderClipDistance);
+    seed = detail::hash_value(seed, v.shaderCullDistance);
+    seed = detail::hash_value(seed, v.shaderFloat64);
+    seed = detail::hash_value(seed, v.shaderInt64);
+    seed = detail::hash_value(seed, v.shaderInt16);
+    seed = detail::hash_value(seed, v.shaderResourceResidency);
+    seed = detail::hash_value(seed, v.shaderResourceMinLod);
+    seed = detail::hash_value(seed, v.sparseBinding);
+    seed = detail::hash_value(seed, v.sparseResidencyBuffer);
+    seed = detail::hash_value(seed, v.sparseResidencyImage2D);
+    seed = detail::hash_value(seed, v.sparseResidencyImage3D);
+    seed = detail::hash_value(seed, v.sparseResidency2Samples);
+    seed = detail::hash_value(seed, v.sparseResidency4Samples);
+    seed = detail::hash_value(seed, v.sparseResidency8Samples);
+    seed = detail::hash_value(seed, v.sparseResidency16Samples);
+    seed = detail::hash_value(seed, v.sparseResidencyAliased);
+    seed = detail::hash_value(seed, v.variableMultisampleRate);
+    seed = detail::hash_value(seed, v.inheritedQueries);
+    return seed;
+  }
+  size_t operator()(VkPhysicalDeviceFeatures const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPhysicalDeviceFeatures> {
+  static bool members(VkPhysicalDeviceFeatures const& a, VkPhysicalDeviceFeatures const& b) {
+    return detail::equal_value(a.robustBufferAccess, b.robustBufferAccess) &&
+        detail::equal_value(a.fullDrawIndexUint32, b.fullDrawIndexUint32) &&
+        detail::equal_value(a.imageCubeArray, b.imageCubeArray) &&
+        detail::equal_value(a.independentBlend, b.independentBlend) &&
+        detail::equal_value(a.geometryShader, b.geometryShader) &&
+        detail::equal_value(a.tessellationShader, b.tessellationShader) &&
+        detail::equal_value(a.sampleRateShading, b.sampleRateShading) &&
+        detail::equal_value(a.dualSrcBlend, b.dualSrcBlend) &&
+        detail::equal_value(a.logicOp, b.logicOp) &&
+        detail::equal_value(a.multiDrawIndirect, b.multiDrawIndirect) &&
+        detail::equal_value(a.drawIndirectFirstInstance, b.drawIndirectFirstInstance) &&
+        detail::equal_value(a.depthClamp, b.depthClamp) &&
+        detail::equal_value(a.depthBiasClamp, b.depthBiasClamp) &&
+        detail::equal_value(a.fillModeNonSolid, b.fillModeNonSolid) &&
+        detail::equal_value(a.depthBounds, b.depthBounds) &&
+        detail::equal_value(a.wideLines, b.wideLines) &&
+        detail::equal_value(a.largePoints, b.largePoints) &&
+        detail::equal_value(a.alphaToOne, b.alphaToOne) &&
+        detail::equal_value(a.multiViewport, b.multiViewport) &&
+        detail::equal_value(a.samplerAnisotropy, b.samplerAnisotropy) &&
+        detail::equal_value(a.textureCompressionETC2, b.textureCompressionETC2) &&
+        detail::equal_value(a.textureCompressionASTC_LDR, b.textureCompressionASTC_LDR) &&
+        detail::equal_value(a.textureCompressionBC, b.textureCompressionBC) &&
+        detail::equal_value(a.occlusionQueryPrecise, b.occlusionQueryPrecise) &&
+        detail::equal_value(a.pipelineStatisticsQuery, b.pipelineStatisticsQuery) &&
+        detail::equal_value(a.vertexPipelineStoresAndAtomics, b.vertexPipelineStoresAndAtomics) &&
+        detail::equal_value(a.fragmentStoresAndAtomics, b.fragmentStoresAndAtomics) &&
+        detail::equal_value(a.shaderTessellationAndGeometryPointSize, b.shaderTessellationAndGeometryPointSize) &&
+        detail::equal_value(a.shaderImageGatherExtended, b.shaderImageGatherExtended) &&
+        detail::equal_value(a.shaderStorageImageExtendedFormats, b.shaderStorageImageExtendedFormats) &&
+        detail::equal_value(a.shaderStorageImageMultisample, b.shaderStorageImageMultisample) &&
+        detail::equal_value(a.shaderStorageImageReadWithoutFormat, b.shaderStorageImageReadWithoutFormat) &&
+        detail::equal_value(a.shaderStorageImageWriteWithoutFormat, b.shaderStorageImageWriteWithoutFormat) &&
+        detail::equal_value(a.shaderUniformBufferArrayDynamicIndexing, b.shaderUniformBufferArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderSampledImageArrayDynamicIndexing, b.shaderSampledImageArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderStorageBufferArrayDynamicIndexing, b.shaderStorageBufferArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderStorageImageArrayDynamicIndexing, b.shaderStorageImageArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderClipDistance, b.shaderClipDistance) &&
+        detail::equal_value(a.shaderCullDistance, b.shaderCullDistance) &&
+        detail::equal_value(a.shaderFloat64, b.shaderFloat64) &&
+        detail::equal_value(a.shaderInt64, b.shaderInt64) &&
+        detail::equal_value(a.shaderInt16, b.shaderInt16) &&
+        detail::equal_value(a.shaderResourceResidency, b.shaderResourceResidency) &&
+        detail::equal_value(a.shaderResourceMinLod, b.shaderResourceMinLod) &&
+        detail::equal_value(a.sparseBinding, b.sparseBinding) &&
+        detail::equal_value(a.sparseResidencyBuffer, b.sparseResidencyBuffer) &&
+        detail::equal_value(a.sparseResidencyImage2D, b.sparseResidencyImage2D) &&
+        detail::equal_value(a.sparseResidencyImage3D, b.sparseResidencyImage3D) &&
+        detail::equal_value(a.sparseResidency2Samples, b.sparseResidency2Samples) &&
+        detail::equal_value(a.sparseResidency4Samples, b.sparseResidency4Samples) &&
+        detail::equal_value(a.sparseResidency8Samples, b.sparseResidency8Samples) &&
+        detail::equal_value(a.sparseResidency16Samples, b.sparseResidency16Samples) &&
+        detail::equal_value(a.sparseResidencyAliased, b.sparseResidencyAliased) &&
+        detail::equal_value(a.variableMultisampleRate, b.variableMultisampleRate) &&
+        detail::equal_value(a.inheritedQueries, b.inheritedQueries);
+  }
+  bool operator()(VkPhysicalDeviceFeatures const& a, VkPhysicalDeviceFeatures const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkPhysicalDeviceFeatures> {
+  static uint64_t members(uint64_t seed, VkPhysicalDeviceFeatures const& v) {
+    seed = detail::hash_value(seed, v.robustBufferAccess);
+    seed = detail::hash_value(seed, v.fullDrawIndexUint32);
+    seed = detail::hash_value(seed, v.imageCubeArray);
+    seed = detail::hash_value(seed, v.independentBlend);
+    seed = detail::hash_value(seed, v.geometryShader);
+    seed = detail::hash_value(seed, v.tessellationShader);
+    seed = detail::hash_value(seed, v.sampleRateShading);
+    seed = detail::hash_value(seed, v.dualSrcBlend);
+    seed = detail::hash_value(seed, v.logicOp);
+    seed = detail::hash_value(seed, v.multiDrawIndirect);
+    seed = detail::hash_value(seed, v.drawIndirectFirstInstance);
+    seed = detail::hash_value(seed, v.depthClamp);
+    seed = detail::hash_value(seed, v.depthBiasClamp);
+    seed = detail::hash_value(seed, v.fillModeNonSolid);
+    seed = detail::hash_value(seed, v.depthBounds);
+    seed = detail::hash_value(seed, v.wideLines);
+    seed = detail::hash_value(seed, v.largePoints);
+    seed = detail::hash_value(seed, v.alphaToOne);
+    seed = detail::hash_value(seed, v.multiViewport);
+    seed = detail::hash_value(seed, v.samplerAnisotropy);
+    seed = detail::hash_value(seed, v.textureCompressionETC2);
+    seed = detail::hash_value(seed, v.textureCompressionASTC_LDR);
+    seed = detail::hash_value(seed, v.textureCompressionBC);
+    seed = detail::hash_value(seed, v.occlusionQueryPrecise);
+    seed = detail::hash_value(seed, v.pipelineStatisticsQuery);
+    seed = detail::hash_value(seed, v.vertexPipelineStoresAndAtomics);
+    seed = detail::hash_value(seed, v.fragmentStoresAndAtomics);
+    seed = detail::hash_value(seed, v.shaderTessellationAndGeometryPointSize);
+    seed = detail::hash_value(seed, v.shaderImageGatherExtended);
+    seed = detail::hash_value(seed, v.shaderStorageImageExtendedFormats);
+    seed = detail::hash_value(seed, v.shaderStorageImageMultisample);
+    seed = detail::hash_value(seed, v.shaderStorageImageReadWithoutFormat);
+    seed = detail::hash_value(seed, v.shaderStorageImageWriteWithoutFormat);
+    seed = detail::hash_value(seed, v.shaderUniformBufferArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderSampledImageArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderStorageBufferArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderStorageImageArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderClipDistance);
+    seed = detail::hash_value(seed, v.shaderCullDistance);
+    seed = detail::hash_value(seed, v.shaderFloat64);
+    seed = detail::hash_value(seed, v.shaderInt64);
+    seed = detail::hash_value(seed, v.shaderInt16);
+    seed = detail::hash_value(seed, v.shaderResourceResidency);
+    seed = detail::hash_value(seed, v.shaderResourceMinLod);
+    seed = detail::hash_value(seed, v.sparseBinding);
+    seed = detail::hash_value(seed, v.sparseResidencyBuffer);
+    seed = detail::hash_value(seed, v.sparseResidencyImage2D);
+    seed = detail::hash_value(seed, v.sparseResidencyImage3D);
+    seed = detail::hash_value(seed, v.sparseResidency2Samples);
+    seed = detail::hash_value(seed, v.sparseResidency4Samples);
+    seed = detail::hash_value(seed, v.sparseResidency8Samples);
+    seed = detail::hash_value(seed, v.sparseResidency16Samples);
+    seed = detail::hash_value(seed, v.sparseResidencyAliased);
+    seed = detail::hash_value(seed, v.variableMultisampleRate);
+    seed = detail::hash_value(seed, v.inheritedQueries);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPhysicalDeviceFeatures const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkPhysicalDeviceFeatures const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkDeviceQueueCreateInfo> {
+  static const bool bitwise = sizeof(VkDeviceQueueCreateInfo) == (sizeof(VkDeviceQueueCreateInfo::sType) + sizeof(VkDeviceQueueCreateInfo::pNext) + sizeof(VkDeviceQueueCreateInfo::flags) + sizeof(VkDeviceQueueCreateInfo::queueFamilyIndex) + sizeof(VkDeviceQueueCreateInfo::queueCount) + sizeof(VkDeviceQueueCreateInfo::pQueuePriorities));
+  bool operator()(VkDeviceQueueCreateInfo const& a, VkDeviceQueueCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.queueFamilyIndex, b.queueFamilyIndex) &&
+        detail::equal_value(a.queueCount, b.queueCount) &&
+        detail::equal_value(a.pQueuePriorities, b.pQueuePriorities);
+  }
+};
+
+template <> struct hash<VkDeviceQueueCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkDeviceQueueCreateInfo const& v) {
+    if (equal_to<VkDeviceQueueCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.queueFamilyIndex);
+    seed = detail::hash_value(seed, v.queueCount);
+    seed = detail::hash_value(seed, v.pQueuePriorities);
+    return seed;
+  }
+  size_t operator()(VkDeviceQueueCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkDeviceQueueCreateInfo> {
+  static bool members(VkDeviceQueueCreateInfo const& a, VkDeviceQueueCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.queueFamilyIndex, b.queueFamilyIndex) &&
+        detail::equal_value(a.queueCount, b.queueCount) &&
+        detail::equal_range(a.pQueuePriorities, b.pQueuePriorities, a.queueCount);
+  }
+  bool operator()(VkDeviceQueueCreateInfo const& a, VkDeviceQueueCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkDeviceQueueCreateInfo> {
+  static uint64_t members(uint64_t seed, VkDeviceQueueCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.queueFamilyIndex);
+    seed = detail::hash_value(seed, v.queueCount);
+    seed = detail::hash_range(seed, v.pQueuePriorities, v.queueCount);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkDeviceQueueCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkDeviceQueueCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkDeviceCreateInfo> {
+  static const bool bitwise = sizeof(VkDeviceCreateInfo) == (sizeof(VkDeviceCreateInfo::sType) + sizeof(VkDeviceCreateInfo::pNext) + sizeof(VkDeviceCreateInfo::flags) + sizeof(VkDeviceCreateInfo::queueCreateInfoCount) + sizeof(VkDeviceCreateInfo::pQueueCreateInfos) + sizeof(VkDeviceCreateInfo::enabledLayerCount) + sizeof(VkDeviceCreateInfo::ppEnabledLayerNames) + sizeof(VkDeviceCreateInfo::enabledExtensionCount) + sizeof(VkDeviceCreateInfo::ppEnabledExtensionNames) + sizeof(VkDeviceCreateInfo::pEnabledFeatures));
+  bool operator()(VkDeviceCreateInfo const& a, VkDeviceCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.queueCreateInfoCount, b.queueCreateInfoCount) &&
+        detail::equal_value(a.pQueueCreateInfos, b.pQueueCreateInfos) &&
+        detail::equal_value(a.enabledLayerCount, b.enabledLayerCount) &&
+        detail::equal_value(a.ppEnabledLayerNames, b.ppEnabledLayerNames) &&
+        detail::equal_value(a.enabledExtensionCount, b.enabledExtensionCount) &&
+        detail::equal_value(a.ppEnabledExtensionNames, b.ppEnabledExtensionNames) &&
+        detail::equal_value(a.pEnabledFeatures, b.pEnabledFeatures);
+  }
+};
+
+template <> struct hash<VkDeviceCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkDeviceCreateInfo const& v) {
+    if (equal_to<VkDeviceCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.queueCreateInfoCount);
+    seed = detail::hash_value(seed, v.pQueueCreateInfos);
+    seed = detail::hash_value(seed, v.enabledLayerCount);
+    seed = detail::hash_value(seed, v.ppEnabledLayerNames);
+    seed = detail::hash_value(seed, v.enabledExtensionCount);
+    seed = detail::hash_value(seed, v.ppEnabledExtensionNames);
+    seed = detail::hash_value(seed, v.pEnabledFeatures);
+    return seed;
+  }
+  size_t operator()(VkDeviceCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkDeviceCreateInfo> {
+  static bool members(VkDeviceCreateInfo const& a, VkDeviceCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.queueCreateInfoCount, b.queueCreateInfoCount) &&
+        detail::equal_value(a.enabledLayerCount, b.enabledLayerCount) &&
+        detail::equal_value(a.enabledExtensionCount, b.enabledExtensionCount) &&
+        detail::equal_each_range<deep_equal_to<VkDeviceQueueCreateInfo>>(a.pQueueCreateInfos, b.pQueueCreateInfos, a.queueCreateInfoCount) &&
+        detail::equal_strings(a.ppEnabledLayerNames, b.ppEnabledLayerNames, a.enabledLayerCount) &&
+        detail::equal_strings(a.ppEnabledExtensionNames, b.ppEnabledExtensionNames, a.enabledExtensionCount) &&
+        detail::equal_pointee<deep_equal_to<VkPhysicalDeviceFeatures>>(a.pEnabledFeatures, b.pEnabledFeatures);
+  }
+  bool operator()(VkDeviceCreateInfo const& a, VkDeviceCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkDeviceCreateInfo> {
+  static uint64_t members(uint64_t seed, VkDeviceCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.queueCreateInfoCount);
+    seed = detail::combine_range<deep_hash<VkDeviceQueueCreateInfo>>(seed, v.pQueueCreateInfos, v.queueCreateInfoCount);
+    seed = detail::hash_value(seed, v.enabledLayerCount);
+    seed = detail::hash_strings(seed, v.ppEnabledLayerNames, v.enabledLayerCount);
+    seed = detail::hash_value(seed, v.enabledExtensionCount);
+    seed = detail::hash_strings(seed, v.ppEnabledExtensionNames, v.enabledExtensionCount);
+    seed = detail::combine_pointee<deep_hash<VkPhysicalDeviceFeatures>>(seed, v.pEnabledFeatures);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkDeviceCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkDeviceCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkSpecializationMapEntry> {
+  static const bool bitwise = sizeof(VkSpecializationMapEntry) == (sizeof(VkSpecializationMapEntry::constantID) + sizeof(VkSpecializationMapEntry::offset) + sizeof(VkSpecializationMapEntry::size));
+  bool operator()(VkSpecializationMapEntry const& a, VkSpecializationMapEntry const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.constantID, b.constantID) &&
+        detail::equal_value(a.offset, b.offset) &&
+        detail::equal_value(a.size, b.size);
+  }
+};
+
+template <> struct hash<VkSpecializationMapEntry> {
+  static uint64_t combine(uint64_t seed, VkSpecializationMapEntry const& v) {
+    if (equal_to<VkSpecializationMapEntry>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.constantID);
+    seed = detail::hash_value(seed, v.offset);
+    seed = detail::hash_value(seed, v.size);
+    return seed;
+  }
+  size_t operator()(VkSpecializationMapEntry const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkSpecializationMapEntry> {
+  static bool members(VkSpecializationMapEntry const& a, VkSpecializationMapEntry const& b) {
+    return detail::equal_value(a.constantID, b.constantID) &&
+        detail::equal_value(a.offset, b.offset) &&
+        detail::equal_value(a.size, b.size);
+  }
+  bool operator()(VkSpecializationMapEntry const& a, VkSpecializationMapEntry const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkSpecializationMapEntry> {
+  static uint64_t members(uint64_t seed, VkSpecializationMapEntry const& v) {
+    seed = detail::hash_value(seed, v.constantID);
+    seed = detail::hash_value(seed, v.offset);
+    seed = detail::hash_value(seed, v.size);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkSpecializationMapEntry const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkSpecializationMapEntry const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkSpecializationInfo> {
+  static const bool bitwise = sizeof(VkSpecializationInfo) == (sizeof(VkSpecializationInfo::mapEntryCount) + sizeof(VkSpecializationInfo::pMapEntries) + sizeof(VkSpecializationInfo::dataSize) + sizeof(VkSpecializationInfo::pData));
+  bool operator()(VkSpecializationInfo const& a, VkSpecializationInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.mapEntryCount, b.mapEntryCount) &&
+        detail::equal_value(a.pMapEntries, b.pMapEntries) &&
+        detail::equal_value(a.dataSize, b.dataSize) &&
+        detail::equal_value(a.pData, b.pData);
+  }
+};
+
+template <> struct hash<VkSpecializationInfo> {
+  static uint64_t combine(uint64_t seed, VkSpecializationInfo const& v) {
+    if (equal_to<VkSpecializationInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.mapEntryCount);
+    seed = detail::hash_value(seed, v.pMapEntries);
+    seed = detail::hash_value(seed, v.dataSize);
+    seed = detail::hash_value(seed, v.pData);
+    return seed;
+  }
+  size_t operator()(VkSpecializationInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkSpecializationInfo> {
+  static bool members(VkSpecializationInfo const& a, VkSpecializationInfo const& b) {
+    return detail::equal_value(a.mapEntryCount, b.mapEntryCount) &&
+        detail::equal_value(a.dataSize, b.dataSize) &&
+        detail::equal_each_range<deep_equal_to<VkSpecializationMapEntry>>(a.pMapEntries, b.pMapEntries, a.mapEntryCount) &&
+        detail::equal_range(a.pData, b.pData, a.dataSize);
+  }
+  bool operator()(VkSpecializationInfo const& a, VkSpecializationInfo const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkSpecializationInfo> {
+  static uint64_t members(uint64_t seed, VkSpecializationInfo const& v) {
+    seed = detail::hash_value(seed, v.mapEntryCount);
+    seed = detail::combine_range<deep_hash<VkSpecializationMapEntry>>(seed, v.pMapEntries, v.mapEntryCount);
+    seed = detail::hash_value(seed, v.dataSize);
+    seed = detail::hash_range(seed, v.pData, v.dataSize);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkSpecializationInfo const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkSpecializationInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineShaderStageCreateInfo> {
+  static const bool bitwise = sizeof(VkPipelineShaderStageCreateInfo) == (sizeof(VkPipelineShaderStageCreateInfo::sType) + sizeof(VkPipelineShaderStageCreateInfo::pNext) + sizeof(VkPipelineShaderStageCreateInfo::flags) + sizeof(VkPipelineShaderStageCreateInfo::stage) + sizeof(VkPipelineShaderStageCreateInfo::module) + sizeof(VkPipelineShaderStageCreateInfo::pName) + sizeof(VkPipelineShaderStageCreateInfo::pSpecializationInfo));
+  bool operator()(VkPipelineShaderStageCreateInfo const& a, VkPipelineShaderStageCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.stage, b.stage) &&
+        detail::equal_value(a.module, b.module) &&
+        detail::equal_value(a.pName, b.pName) &&
+        detail::equal_value(a.pSpecializationInfo, b.pSpecializationInfo);
+  }
+};
+
+template <> struct hash<VkPipelineShaderStageCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineShaderStageCreateInfo const& v) {
+    if (equal_to<VkPipelineShaderStageCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.stage);
+    seed = detail::hash_value(seed, v.module);
+    seed = detail::hash_value(seed, v.pName);
+    seed = detail::hash_value(seed, v.pSpecializationInfo);
+    return seed;
+  }
+  size_t operator()(VkPipelineShaderStageCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineShaderStageCreateInfo> {
+  static bool members(VkPipelineShaderStageCreateInfo const& a, VkPipelineShaderStageCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.stage, b.stage) &&
+        detail::equal_value(a.module, b.module) &&
+        detail::equal_string(a.pName, b.pName) &&
+        detail::equal_pointee<deep_equal_to<VkSpecializationInfo>>(a.pSpecializationInfo, b.pSpecializationInfo);
+  }
+  bool operator()(VkPipelineShaderStageCreateInfo const& a, VkPipelineShaderStageCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineShaderStageCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineShaderStageCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.stage);
+    seed = detail::hash_value(seed, v.module);
+    seed = detail::hash_string(seed, v.pName);
+    seed = detail::combine_pointee<deep_hash<VkSpecializationInfo>>(seed, v.pSpecializationInfo);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineShaderStageCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineShaderStageCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkVertexInputBindingDescription> {
+  static const bool bitwise = sizeof(VkVertexInputBindingDescription) == (sizeof(VkVertexInputBindingDescription::binding) + sizeof(VkVertexInputBindingDescription::stride) + sizeof(VkVertexInputBindingDescription::inputRate));
+  bool operator()(VkVertexInputBindingDescription const& a, VkVertexInputBindingDescription const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.binding, b.binding) &&
+        detail::equal_value(a.stride, b.stride) &&
+        detail::equal_value(a.inputRate, b.inputRate);
+  }
+};
+
+template <> struct hash<VkVertexInputBindingDescription> {
+  static uint64_t combine(uint64_t seed, VkVertexInputBindingDescription const& v) {
+    if (equal_to<VkVertexInputBindingDescription>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.binding);
+    seed = detail::hash_value(seed, v.stride);
+    seed = detail::hash_value(seed, v.inputRate);
+    return seed;
+  }
+  size_t operator()(VkVertexInputBindingDescription const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkVertexInputBindingDescription> {
+  static bool members(VkVertexInputBindingDescription const& a, VkVertexInputBindingDescription const& b) {
+    return detail::equal_value(a.binding, b.binding) &&
+        detail::equal_value(a.stride, b.stride) &&
+        detail::equal_value(a.inputRate, b.inputRate);
+  }
+  bool operator()(VkVertexInputBindingDescription const& a, VkVertexInputBindingDescription const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkVertexInputBindingDescription> {
+  static uint64_t members(uint64_t seed, VkVertexInputBindingDescription const& v) {
+    seed = detail::hash_value(seed, v.binding);
+    seed = detail::hash_value(seed, v.stride);
+    seed = detail::hash_value(seed, v.inputRate);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkVertexInputBindingDescription const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkVertexInputBindingDescription const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkVertexInputAttributeDescription> {
+  static const bool bitwise = sizeof(VkVertexInputAttributeDescription) == (sizeof(VkVertexInputAttributeDescription::location) + sizeof(VkVertexInputAttributeDescription::binding) + sizeof(VkVertexInputAttributeDescription::format) + sizeof(VkVertexInputAttributeDescription::offset));
+  bool operator()(VkVertexInputAttributeDescription const& a, VkVertexInputAttributeDescription const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.location, b.location) &&
+        detail::equal_value(a.binding, b.binding) &&
+        detail::equal_value(a.format, b.format) &&
+        detail::equal_value(a.offset, b.offset);
+  }
+};
+
+template <> struct hash<VkVertexInputAttributeDescription> {
+  static uint64_t combine(uint64_t seed, VkVertexInputAttributeDescription const& v) {
+    if (equal_to<VkVertexInputAttributeDescription>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.location);
+    seed = detail::hash_value(seed, v.binding);
+    seed = detail::hash_value(seed, v.format);
+    seed = detail::hash_value(seed, v.offset);
+    return seed;
+  }
+  size_t operator()(VkVertexInputAttributeDescription const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkVertexInputAttributeDescription> {
+  static bool members(VkVertexInputAttributeDescription const& a, VkVertexInputAttributeDescription const& b) {
+    return detail::equal_value(a.location, b.location) &&
+        detail::equal_value(a.binding, b.binding) &&
+        detail::equal_value(a.format, b.format) &&
+        detail::equal_value(a.offset, b.offset);
+  }
+  bool operator()(VkVertexInputAttributeDescription const& a, VkVertexInputAttributeDescription const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkVertexInputAttributeDescription> {
+  static uint64_t members(uint64_t seed, VkVertexInputAttributeDescription const& v) {
+    seed = detail::hash_value(seed, v.location);
+    seed = detail::hash_value(seed, v.binding);
+    seed = detail::hash_value(seed, v.format);
+    seed = detail::hash_value(seed, v.offset);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkVertexInputAttributeDescription const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkVertexInputAttributeDescription const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineVertexInputStateCreateInfo> {
+  static const bool bitwise = sizeof(VkPipelineVertexInputStateCreateInfo) == (sizeof(VkPipelineVertexInputStateCreateInfo::sType) + sizeof(VkPipelineVertexInputStateCreateInfo::pNext) + sizeof(VkPipelineVertexInputStateCreateInfo::flags) + sizeof(VkPipelineVertexInputStateCreateInfo::vertexBindingDescriptionCount) + sizeof(VkPipelineVertexInputStateCreateInfo::pVertexBindingDescriptions) + sizeof(VkPipelineVertexInputStateCreateInfo::vertexAttributeDescriptionCount) + sizeof(VkPipelineVertexInputStateCreateInfo::pVertexAttributeDescriptions));
+  bool operator()(VkPipelineVertexInputStateCreateInfo const& a, VkPipelineVertexInputStateCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.vertexBindingDescriptionCount, b.vertexBindingDescriptionCount) &&
+        detail::equal_value(a.pVertexBindingDescriptions, b.pVertexBindingDescriptions) &&
+        detail::equal_value(a.vertexAttributeDescriptionCount, b.vertexAttributeDescriptionCount) &&
+        detail::equal_value(a.pVertexAttributeDescriptions, b.pVertexAttributeDescriptions);
+  }
+};
+
+template <> struct hash<VkPipelineVertexInputStateCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineVertexInputStateCreateInfo const& v) {
+    if (equal_to<VkPipelineVertexInputStateCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.vertexBindingDescriptionCount);
+    seed = detail::hash_value(seed, v.pVertexBindingDescriptions);
+    seed = detail::hash_value(seed, v.vertexAttributeDescriptionCount);
+    seed = detail::hash_value(seed, v.pVertexAttributeDescriptions);
+    return seed;
+  }
+  size_t operator()(VkPipelineVertexInputStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineVertexInputStateCreateInfo> {
+  static bool members(VkPipelineVertexInputStateCreateInfo const& a, VkPipelineVertexInputStateCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.vertexBindingDescriptionCount, b.vertexBindingDescriptionCount) &&
+        detail::equal_value(a.vertexAttributeDescriptionCount, b.vertexAttributeDescriptionCount) &&
+        detail::equal_each_range<deep_equal_to<VkVertexInputBindingDescription>>(a.pVertexBindingDescriptions, b.pVertexBindingDescriptions, a.vertexBindingDescriptionCount) &&
+        detail::equal_each_range<deep_equal_to<VkVertexInputAttributeDescription>>(a.pVertexAttributeDescriptions, b.pVertexAttributeDescriptions, a.vertexAttributeDescriptionCount);
+  }
+  bool operator()(VkPipelineVertexInputStateCreateInfo const& a, VkPipelineVertexInputStateCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineVertexInputStateCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineVertexInputStateCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.vertexBindingDescriptionCount);
+    seed = detail::combine_range<deep_hash<VkVertexInputBindingDescription>>(seed, v.pVertexBindingDescriptions, v.vertexBindingDescriptionCount);
+    seed = detail::hash_value(seed, v.vertexAttributeDescriptionCount);
+    seed = detail::combine_range<deep_hash<VkVertexInputAttributeDescription>>(seed, v.pVertexAttributeDescriptions, v.vertexAttributeDescriptionCount);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineVertexInputStateCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineVertexInputStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineInputAssemblyStateCreateInfo> {
+  static const bool bitwise = sizeof(VkPipelineInputAssemblyStateCreateInfo) == (sizeof(VkPipelineInputAssemblyStateCreateInfo::sType) + sizeof(VkPipelineInputAssemblyStateCreateInfo::pNext) + sizeof(VkPipelineInputAssemblyStateCreateInfo::flags) + sizeof(VkPipelineInputAssemblyStateCreateInfo::topology) + sizeof(VkPipelineInputAssemblyStateCreateInfo::primitiveRestartEnable));
+  bool operator()(VkPipelineInputAssemblyStateCreateInfo const& a, VkPipelineInputAssemblyStateCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.topology, b.topology) &&
+        detail::equal_value(a.primitiveRestartEnable, b.primitiveRestartEnable);
+  }
+};
+
+template <> struct hash<VkPipelineInputAssemblyStateCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineInputAssemblyStateCreateInfo const& v) {
+    if (equal_to<VkPipelineInputAssemblyStateCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.topology);
+    seed = detail::hash_value(seed, v.primitiveRestartEnable);
+    return seed;
+  }
+  size_t operator()(VkPipelineInputAssemblyStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineInputAssemblyStateCreateInfo> {
+  static bool members(VkPipelineInputAssemblyStateCreateInfo const& a, VkPipelineInputAssemblyStateCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.topology, b.topology) &&
+        detail::equal_value(a.primitiveRestartEnable, b.primitiveRestartEnable);
+  }
+  bool operator()(VkPipelineInputAssemblyStateCreateInfo const& a, VkPipelineInputAssemblyStateCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineInputAssemblyStateCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineInputAssemblyStateCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.topology);
+    seed = detail::hash_value(seed, v.primitiveRestartEnable);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineInputAssemblyStateCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineInputAssemblyStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineTessellationStateCreateInfo> {
+  static const bool bitwise = sizeof(VkPipelineTessellationStateCreateInfo) == (sizeof(VkPipelineTessellationStateCreateInfo::sType) + sizeof(VkPipelineTessellationStateCreateInfo::pNext) + sizeof(VkPipelineTessellationStateCreateInfo::flags) + sizeof(VkPipelineTessellationStateCreateInfo::patchControlPoints));
+  bool operator()(VkPipelineTessellationStateCreateInfo const& a, VkPipelineTessellationStateCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.patchControlPoints, b.patchControlPoints);
+  }
+};
+
+template <> struct hash<VkPipelineTessellationStateCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineTessellationStateCreateInfo const& v) {
+    if (equal_to<VkPipelineTessellationStateCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.patchControlPoints);
+    return seed;
+  }
+  size_t operator()(VkPipelineTessellationStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineTessellationStateCreateInfo> {
+  static bool members(VkPipelineTessellationStateCreateInfo const& a, VkPipelineTessellationStateCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.patchControlPoints, b.patchControlPoints);
+  }
+  bool operator()(VkPipelineTessellationStateCreateInfo const& a, VkPipelineTessellationStateCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineTessellationStateCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineTessellationStateCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.patchControlPoints);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineTessellationStateCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineTessellationStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkViewport> {
+  static const bool bitwise = false;
+  bool operator()(VkViewport const& a, VkViewport const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.x, b.x) &&
+        detail::equal_value(a.y, b.y) &&
+        detail::equal_value(a.width, b.width) &&
+        detail::equal_value(a.height, b.height) &&
+        detail::equal_value(a.minDepth, b.minDepth) &&
+        detail::equal_value(a.maxDepth, b.maxDepth);
+  }
+};
+
+template <> struct hash<VkViewport> {
+  static uint64_t combine(uint64_t seed, VkViewport const& v) {
+    if (equal_to<VkViewport>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.x);
+    seed = detail::hash_value(seed, v.y);
+    seed = detail::hash_value(seed, v.width);
+    seed = detail::hash_value(seed, v.height);
+    seed = detail::hash_value(seed, v.minDepth);
+    seed = detail::hash_value(seed, v.maxDepth);
+    return seed;
+  }
+  size_t operator()(VkViewport const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkViewport> {
+  static bool members(VkViewport const& a, VkViewport const& b) {
+    return detail::equal_value(a.x, b.x) &&
+        detail::equal_value(a.y, b.y) &&
+        detail::equal_value(a.width, b.width) &&
+        detail::equal_value(a.height, b.height) &&
+        detail::equal_value(a.minDepth, b.minDepth) &&
+        detail::equal_value(a.maxDepth, b.maxDepth);
+  }
+  bool operator()(VkViewport const& a, VkViewport const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkViewport> {
+  static uint64_t members(uint64_t seed, VkViewport const& v) {
+    seed = detail::hash_value(seed, v.x);
+    seed = detail::hash_value(seed, v.y);
+    seed = detail::hash_value(seed, v.width);
+    seed = detail::hash_value(seed, v.height);
+    seed = detail::hash_value(seed, v.minDepth);
+    seed = detail::hash_value(seed, v.maxDepth);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkViewport const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkViewport const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkOffset2D> {
+  static const bool bitwise = sizeof(VkOffset2D) == (sizeof(VkOffset2D::x) + sizeof(VkOffset2D::y));
+  bool operator()(VkOffset2D const& a, VkOffset2D const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.x, b.x) &&
+        detail::equal_value(a.y, b.y);
+  }
+};
+
+template <> struct hash<VkOffset2D> {
+  static uint64_t combine(uint64_t seed, VkOffset2D const& v) {
+    if (equal_to<VkOffset2D>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.x);
+    seed = detail::hash_value(seed, v.y);
+    return seed;
+  }
+  size_t operator()(VkOffset2D const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkOffset2D> {
+  static bool members(VkOffset2D const& a, VkOffset2D const& b) {
+    return detail::equal_value(a.x, b.x) &&
+        detail::equal_value(a.y, b.y);
+  }
+  bool operator()(VkOffset2D const& a, VkOffset2D const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkOffset2D> {
+  static uint64_t members(uint64_t seed, VkOffset2D const& v) {
+    seed = detail::hash_value(seed, v.x);
+    seed = detail::hash_value(seed, v.y);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkOffset2D const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkOffset2D const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkExtent2D> {
+  static const bool bitwise = sizeof(VkExtent2D) == (sizeof(VkExtent2D::width) + sizeof(VkExtent2D::height));
+  bool operator()(VkExtent2D const& a, VkExtent2D const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.width, b.width) &&
+        detail::equal_value(a.height, b.height);
+  }
+};
+
+template <> struct hash<VkExtent2D> {
+  static uint64_t combine(uint64_t seed, VkExtent2D const& v) {
+    if (equal_to<VkExtent2D>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.width);
+    seed = detail::hash_value(seed, v.height);
+    return seed;
+  }
+  size_t operator()(VkExtent2D const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkExtent2D> {
+  static bool members(VkExtent2D const& a, VkExtent2D const& b) {
+    return detail::equal_value(a.width, b.width) &&
+        detail::equal_value(a.height, b.height);
+  }
+  bool operator()(VkExtent2D const& a, VkExtent2D const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkExtent2D> {
+  static uint64_t members(uint64_t seed, VkExtent2D const& v) {
+    seed = detail::hash_value(seed, v.width);
+    seed = detail::hash_value(seed, v.height);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkExtent2D const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkExtent2D const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkRect2D> {
+  static const bool bitwise = sizeof(VkRect2D) == (sizeof(VkRect2D::offset) + sizeof(VkRect2D::extent)) && equal_to<VkOffset2D>::bitwise && equal_to<VkExtent2D>::bitwise;
+  bool operator()(VkRect2D const& a, VkRect2D const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return equal_to<VkOffset2D>()(a.offset, b.offset) &&
+        equal_to<VkExtent2D>()(a.extent, b.extent);
+  }
+};
+
+template <> struct hash<VkRect2D> {
+  static uint64_t combine(uint64_t seed, VkRect2D const& v) {
+    if (equal_to<VkRect2D>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = hash<VkOffset2D>::combine(seed, v.offset);
+    seed = hash<VkExtent2D>::combine(seed, v.extent);
+    return seed;
+  }
+  size_t operator()(VkRect2D const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkRect2D> {
+  static bool members(VkRect2D const& a, VkRect2D const& b) {
+    return deep_equal_to<VkOffset2D>()(a.offset, b.offset) &&
+        deep_equal_to<VkExtent2D>()(a.extent, b.extent);
+  }
+  bool operator()(VkRect2D const& a, VkRect2D const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkRect2D> {
+  static uint64_t members(uint64_t seed, VkRect2D const& v) {
+    seed = deep_hash<VkOffset2D>::combine(seed, v.offset);
+    seed = deep_hash<VkExtent2D>::combine(seed, v.extent);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkRect2D const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkRect2D const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineViewportStateCreateInfo> {
+  static const bool bitwise = sizeof(VkPipelineViewportStateCreateInfo) == (sizeof(VkPipelineViewportStateCreateInfo::sType) + sizeof(VkPipelineViewportStateCreateInfo::pNext) + sizeof(VkPipelineViewportStateCreateInfo::flags) + sizeof(VkPipelineViewportStateCreateInfo::viewportCount) + sizeof(VkPipelineViewportStateCreateInfo::pViewports) + sizeof(VkPipelineViewportStateCreateInfo::scissorCount) + sizeof(VkPipelineViewportStateCreateInfo::pScissors));
+  bool operator()(VkPipelineViewportStateCreateInfo const& a, VkPipelineViewportStateCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.viewportCount, b.viewportCount) &&
+        detail::equal_value(a.pViewports, b.pViewports) &&
+        detail::equal_value(a.scissorCount, b.scissorCount) &&
+        detail::equal_value(a.pScissors, b.pScissors);
+  }
+};
+
+template <> struct hash<VkPipelineViewportStateCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineViewportStateCreateInfo const& v) {
+    if (equal_to<VkPipelineViewportStateCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.viewportCount);
+    seed = detail::hash_value(seed, v.pViewports);
+    seed = detail::hash_value(seed, v.scissorCount);
+    seed = detail::hash_value(seed, v.pScissors);
+    return seed;
+  }
+  size_t operator()(VkPipelineViewportStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineViewportStateCreateInfo> {
+  static bool members(VkPipelineViewportStateCreateInfo const& a, VkPipelineViewportStateCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.viewportCount, b.viewportCount) &&
+        detail::equal_value(a.scissorCount, b.scissorCount) &&
+        detail::equal_each_range<deep_equal_to<VkViewport>>(a.pViewports, b.pViewports, a.viewportCount) &&
+        detail::equal_each_range<deep_equal_to<VkRect2D>>(a.pScissors, b.pScissors, a.scissorCount);
+  }
+  bool operator()(VkPipelineViewportStateCreateInfo const& a, VkPipelineViewportStateCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineViewportStateCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineViewportStateCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.viewportCount);
+    seed = detail::combine_range<deep_hash<VkViewport>>(seed, v.pViewports, v.viewportCount);
+    seed = detail::hash_value(seed, v.scissorCount);
+    seed = detail::combine_range<deep_hash<VkRect2D>>(seed, v.pScissors, v.scissorCount);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineViewportStateCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineViewportStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineRasterizationStateCreateInfo> {
+  static const bool bitwise = false;
+  bool operator()(VkPipelineRasterizationStateCreateInfo const& a, VkPipelineRasterizationStateCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.depthClampEnable, b.depthClampEnable) &&
+        detail::equal_value(a.rasterizerDiscardEnable, b.rasterizerDiscardEnable) &&
+        detail::equal_value(a.polygonMode, b.polygonMode) &&
+        detail::equal_value(a.cullMode, b.cullMode) &&
+        detail::equal_value(a.frontFace, b.frontFace) &&
+        detail::equal_value(a.depthBiasEnable, b.depthBiasEnable) &&
+        detail::equal_value(a.depthBiasConstantFactor, b.depthBiasConstantFactor) &&
+        detail::equal_value(a.depthBiasClamp, b.depthBiasClamp) &&
+        detail::equal_value(a.depthBiasSlopeFactor, b.depthBiasSlopeFactor) &&
+        detail::equal_value(a.lineWidth, b.lineWidth);
+  }
+};
+
+template <> struct hash<VkPipelineRasterizationStateCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineRasterizationStateCreateInfo const& v) {
+    if (equal_to<VkPipelineRasterizationStateCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.depthClampEnable);
+    seed = detail::hash_value(seed, v.rasterizerDiscardEnable);
+    seed = detail::hash_value(seed, v.polygonMode);
+    seed = detail::hash_value(seed, v.cullMode);
+    seed = detail::hash_value(seed, v.frontFace);
+    seed = detail::hash_value(seed, v.depthBiasEnable);
+    seed = detail::hash_value(seed, v.depthBiasConstantFactor);
+    seed = detail::hash_value(seed, v.depthBiasClamp);
+    seed = detail::hash_value(seed, v.depthBiasSlopeFactor);
+    seed = detail::hash_value(seed, v.lineWidth);
+    return seed;
+  }
+  size_t operator()(VkPipelineRasterizationStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineRasterizationStateCreateInfo> {
+  static bool members(VkPipelineRasterizationStateCreateInfo const& a, VkPipelineRasterizationStateCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.depthClampEnable, b.depthClampEnable) &&
+        detail::equal_value(a.rasterizerDiscardEnable, b.rasterizerDiscardEnable) &&
+        detail::equal_value(a.polygonMode, b.polygonMode) &&
+        detail::equal_value(a.cullMode, b.cullMode) &&
+        detail::equal_value(a.frontFace, b.frontFace) &&
+        detail::equal_value(a.depthBiasEnable, b.depthBiasEnable) &&
+        detail::equal_value(a.depthBiasConstantFactor, b.depthBiasConstantFactor) &&
+        detail::equal_value(a.depthBiasClamp, b.depthBiasClamp) &&
+        detail::equal_value(a.depthBiasSlopeFactor, b.depthBiasSlopeFactor) &&
+        detail::equal_value(a.lineWidth, b.lineWidth);
+  }
+  bool operator()(VkPipelineRasterizationStateCreateInfo const& a, VkPipelineRasterizationStateCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineRasterizationStateCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineRasterizationStateCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.depthClampEnable);
+    seed = detail::hash_value(seed, v.rasterizerDiscardEnable);
+    seed = detail::hash_value(seed, v.polygonMode);
+    seed = detail::hash_value(seed, v.cullMode);
+    seed = detail::hash_value(seed, v.frontFace);
+    seed = detail::hash_value(seed, v.depthBiasEnable);
+    seed = detail::hash_value(seed, v.depthBiasConstantFactor);
+    seed = detail::hash_value(seed, v.depthBiasClamp);
+    seed = detail::hash_value(seed, v.depthBiasSlopeFactor);
+    seed = detail::hash_value(seed, v.lineWidth);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineRasterizationStateCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineRasterizationStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineMultisampleStateCreateInfo> {
+  static const bool bitwise = false;
+  bool operator()(VkPipelineMultisampleStateCreateInfo const& a, VkPipelineMultisampleStateCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.rasterizationSamples, b.rasterizationSamples) &&
+        detail::equal_value(a.sampleShadingEnable, b.sampleShadingEnable) &&
+        detail::equal_value(a.minSampleShading, b.minSampleShading) &&
+        detail::equal_value(a.pSampleMask, b.pSampleMask) &&
+        detail::equal_value(a.alphaToCoverageEnable, b.alphaToCoverageEnable) &&
+        detail::equal_value(a.alphaToOneEnable, b.alphaToOneEnable);
+  }
+};
+
+template <> struct hash<VkPipelineMultisampleStateCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineMultisampleStateCreateInfo const& v) {
+    if (equal_to<VkPipelineMultisampleStateCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.rasterizationSamples);
+    seed = detail::hash_value(seed, v.sampleShadingEnable);
+    seed = detail::hash_value(seed, v.minSampleShading);
+    seed = detail::hash_value(seed, v.pSampleMask);
+    seed = detail::hash_value(seed, v.alphaToCoverageEnable);
+    seed = detail::hash_value(seed, v.alphaToOneEnable);
+    return seed;
+  }
+  size_t operator()(VkPipelineMultisampleStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineMultisampleStateCreateInfo> {
+  static bool members(VkPipelineMultisampleStateCreateInfo const& a, VkPipelineMultisampleStateCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.rasterizationSamples, b.rasterizationSamples) &&
+        detail::equal_value(a.sampleShadingEnable, b.sampleShadingEnable) &&
+        detail::equal_value(a.minSampleShading, b.minSampleShading) &&
+        detail::equal_value(a.alphaToCoverageEnable, b.alphaToCoverageEnable) &&
+        detail::equal_value(a.alphaToOneEnable, b.alphaToOneEnable) &&
+        detail::equal_range(a.pSampleMask, b.pSampleMask, (a.rasterizationSamples + 31) / 32);
+  }
+  bool operator()(VkPipelineMultisampleStateCreateInfo const& a, VkPipelineMultisampleStateCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineMultisampleStateCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineMultisampleStateCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.rasterizationSamples);
+    seed = detail::hash_value(seed, v.sampleShadingEnable);
+    seed = detail::hash_value(seed, v.minSampleShading);
+    seed = detail::hash_range(seed, v.pSampleMask, (v.rasterizationSamples + 31) / 32);
+    seed = detail::hash_value(seed, v.alphaToCoverageEnable);
+    seed = detail::hash_value(seed, v.alphaToOneEnable);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineMultisampleStateCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineMultisampleStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkStencilOpState> {
+  static const bool bitwise = sizeof(VkStencilOpState) == (sizeof(VkStencilOpState::failOp) + sizeof(VkStencilOpState::passOp) + sizeof(VkStencilOpState::depthFailOp) + sizeof(VkStencilOpState::compareOp) + sizeof(VkStencilOpState::compareMask) + sizeof(VkStencilOpState::writeMask) + sizeof(VkStencilOpState::reference));
+  bool operator()(VkStencilOpState const& a, VkStencilOpState const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.failOp, b.failOp) &&
+        detail::equal_value(a.passOp, b.passOp) &&
+        detail::equal_value(a.depthFailOp, b.depthFailOp) &&
+        detail::equal_value(a.compareOp, b.compareOp) &&
+        detail::equal_value(a.compareMask, b.compareMask) &&
+        detail::equal_value(a.writeMask, b.writeMask) &&
+        detail::equal_value(a.reference, b.reference);
+  }
+};
+
+template <> struct hash<VkStencilOpState> {
+  static uint64_t combine(uint64_t seed, VkStencilOpState const& v) {
+    if (equal_to<VkStencilOpState>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.failOp);
+    seed = detail::hash_value(seed, v.passOp);
+    seed = detail::hash_value(seed, v.depthFailOp);
+    seed = detail::hash_value(seed, v.compareOp);
+    seed = detail::hash_value(seed, v.compareMask);
+    seed = detail::hash_value(seed, v.writeMask);
+    seed = detail::hash_value(seed, v.reference);
+    return seed;
+  }
+  size_t operator()(VkStencilOpState const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkStencilOpState> {
+  static bool members(VkStencilOpState const& a, VkStencilOpState const& b) {
+    return detail::equal_value(a.failOp, b.failOp) &&
+        detail::equal_value(a.passOp, b.passOp) &&
+        detail::equal_value(a.depthFailOp, b.depthFailOp) &&
+        detail::equal_value(a.compareOp, b.compareOp) &&
+        detail::equal_value(a.compareMask, b.compareMask) &&
+        detail::equal_value(a.writeMask, b.writeMask) &&
+        detail::equal_value(a.reference, b.reference);
+  }
+  bool operator()(VkStencilOpState const& a, VkStencilOpState const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkStencilOpState> {
+  static uint64_t members(uint64_t seed, VkStencilOpState const& v) {
+    seed = detail::hash_value(seed, v.failOp);
+    seed = detail::hash_value(seed, v.passOp);
+    seed = detail::hash_value(seed, v.depthFailOp);
+    seed = detail::hash_value(seed, v.compareOp);
+    seed = detail::hash_value(seed, v.compareMask);
+    seed = detail::hash_value(seed, v.writeMask);
+    seed = detail::hash_value(seed, v.reference);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkStencilOpState const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkStencilOpState const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineDepthStencilStateCreateInfo> {
+  static const bool bitwise = false;
+  bool operator()(VkPipelineDepthStencilStateCreateInfo const& a, VkPipelineDepthStencilStateCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.depthTestEnable, b.depthTestEnable) &&
+        detail::equal_value(a.depthWriteEnable, b.depthWriteEnable) &&
+        detail::equal_value(a.depthCompareOp, b.depthCompareOp) &&
+        detail::equal_value(a.depthBoundsTestEnable, b.depthBoundsTestEnable) &&
+        detail::equal_value(a.stencilTestEnable, b.stencilTestEnable) &&
+        equal_to<VkStencilOpState>()(a.front, b.front) &&
+        equal_to<VkStencilOpState>()(a.back, b.back) &&
+        detail::equal_value(a.minDepthBounds, b.minDepthBounds) &&
+        detail::equal_value(a.maxDepthBounds, b.maxDepthBounds);
+  }
+};
+
+template <> struct hash<VkPipelineDepthStencilStateCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineDepthStencilStateCreateInfo const& v) {
+    if (equal_to<VkPipelineDepthStencilStateCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.depthTestEnable);
+    seed = detail::hash_value(seed, v.depthWriteEnable);
+    seed = detail::hash_value(seed, v.depthCompareOp);
+    seed = detail::hash_value(seed, v.depthBoundsTestEnable);
+    seed = detail::hash_value(seed, v.stencilTestEnable);
+    seed = hash<VkStencilOpState>::combine(seed, v.front);
+    seed = hash<VkStencilOpState>::combine(seed, v.back);
+    seed = detail::hash_value(seed, v.minDepthBounds);
+    seed = detail::hash_value(seed, v.maxDepthBounds);
+    return seed;
+  }
+  size_t operator()(VkPipelineDepthStencilStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineDepthStencilStateCreateInfo> {
+  static bool members(VkPipelineDepthStencilStateCreateInfo const& a, VkPipelineDepthStencilStateCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.depthTestEnable, b.depthTestEnable) &&
+        detail::equal_value(a.depthWriteEnable, b.depthWriteEnable) &&
+        detail::equal_value(a.depthCompareOp, b.depthCompareOp) &&
+        detail::equal_value(a.depthBoundsTestEnable, b.depthBoundsTestEnable) &&
+        detail::equal_value(a.stencilTestEnable, b.stencilTestEnable) &&
+        deep_equal_to<VkStencilOpState>()(a.front, b.front) &&
+        deep_equal_to<VkStencilOpState>()(a.back, b.back) &&
+        detail::equal_value(a.minDepthBounds, b.minDepthBounds) &&
+        detail::equal_value(a.maxDepthBounds, b.maxDepthBounds);
+  }
+  bool operator()(VkPipelineDepthStencilStateCreateInfo const& a, VkPipelineDepthStencilStateCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineDepthStencilStateCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineDepthStencilStateCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.depthTestEnable);
+    seed = detail::hash_value(seed, v.depthWriteEnable);
+    seed = detail::hash_value(seed, v.depthCompareOp);
+    seed = detail::hash_value(seed, v.depthBoundsTestEnable);
+    seed = detail::hash_value(seed, v.stencilTestEnable);
+    seed = deep_hash<VkStencilOpState>::combine(seed, v.front);
+    seed = deep_hash<VkStencilOpState>::combine(seed, v.back);
+    seed = detail::hash_value(seed, v.minDepthBounds);
+    seed = detail::hash_value(seed, v.maxDepthBounds);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineDepthStencilStateCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineDepthStencilStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineColorBlendAttachmentState> {
+  static const bool bitwise = sizeof(VkPipelineColorBlendAttachmentState) == (sizeof(VkPipelineColorBlendAttachmentState::blendEnable) + sizeof(VkPipelineColorBlendAttachmentState::srcColorBlendFactor) + sizeof(VkPipelineColorBlendAttachmentState::dstColorBlendFactor) + sizeof(VkPipelineColorBlendAttachmentState::colorBlendOp) + sizeof(VkPipelineColorBlendAttachmentState::srcAlphaBlendFactor) + sizeof(VkPipelineColorBlendAttachmentState::dstAlphaBlendFactor) + sizeof(VkPipelineColorBlendAttachmentState::alphaBlendOp) + sizeof(VkPipelineColorBlendAttachmentState::colorWriteMask));
+  bool operator()(VkPipelineColorBlendAttachmentState const& a, VkPipelineColorBlendAttachmentState const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.blendEnable, b.blendEnable) &&
+        detail::equal_value(a.srcColorBlendFactor, b.srcColorBlendFactor) &&
+        detail::equal_value(a.dstColorBlendFactor, b.dstColorBlendFactor) &&
+        detail::equal_value(a.colorBlendOp, b.colorBlendOp) &&
+        detail::equal_value(a.srcAlphaBlendFactor, b.srcAlphaBlendFactor) &&
+        detail::equal_value(a.dstAlphaBlendFactor, b.dstAlphaBlendFactor) &&
+        detail::equal_value(a.alphaBlendOp, b.alphaBlendOp) &&
+        detail::equal_value(a.colorWriteMask, b.colorWriteMask);
+  }
+};
+
+template <> struct hash<VkPipelineColorBlendAttachmentState> {
+  static uint64_t combine(uint64_t seed, VkPipelineColorBlendAttachmentState const& v) {
+    if (equal_to<VkPipelineColorBlendAttachmentState>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.blendEnable);
+    seed = detail::hash_value(seed, v.srcColorBlendFactor);
+    seed = detail::hash_value(seed, v.dstColorBlendFactor);
+    seed = detail::hash_value(seed, v.colorBlendOp);
+    seed = detail::hash_value(seed, v.srcAlphaBlendFactor);
+    seed = detail::hash_value(seed, v.dstAlphaBlendFactor);
+    seed = detail::hash_value(seed, v.alphaBlendOp);
+    seed = detail::hash_value(seed, v.colorWriteMask);
+    return seed;
+  }
+  size_t operator()(VkPipelineColorBlendAttachmentState const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineColorBlendAttachmentState> {
+  static bool members(VkPipelineColorBlendAttachmentState const& a, VkPipelineColorBlendAttachmentState const& b) {
+    return detail::equal_value(a.blendEnable, b.blendEnable) &&
+        detail::equal_value(a.srcColorBlendFactor, b.srcColorBlendFactor) &&
+        detail::equal_value(a.dstColorBlendFactor, b.dstColorBlendFactor) &&
+        detail::equal_value(a.colorBlendOp, b.colorBlendOp) &&
+        detail::equal_value(a.srcAlphaBlendFactor, b.srcAlphaBlendFactor) &&
+        detail::equal_value(a.dstAlphaBlendFactor, b.dstAlphaBlendFactor) &&
+        detail::equal_value(a.alphaBlendOp, b.alphaBlendOp) &&
+        detail::equal_value(a.colorWriteMask, b.colorWriteMask);
+  }
+  bool operator()(VkPipelineColorBlendAttachmentState const& a, VkPipelineColorBlendAttachmentState const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkPipelineColorBlendAttachmentState> {
+  static uint64_t members(uint64_t seed, VkPipelineColorBlendAttachmentState const& v) {
+    seed = detail::hash_value(seed, v.blendEnable);
+    seed = detail::hash_value(seed, v.srcColorBlendFactor);
+    seed = detail::hash_value(seed, v.dstColorBlendFactor);
+    seed = detail::hash_value(seed, v.colorBlendOp);
+    seed = detail::hash_value(seed, v.srcAlphaBlendFactor);
+    seed = detail::hash_value(seed, v.dstAlphaBlendFactor);
+    seed = detail::hash_value(seed, v.alphaBlendOp);
+    seed = detail::hash_value(seed, v.colorWriteMask);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineColorBlendAttachmentState const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkPipelineColorBlendAttachmentState const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineColorBlendStateCreateInfo> {
+  static const bool bitwise = false;
+  bool operator()(VkPipelineColorBlendStateCreateInfo const& a, VkPipelineColorBlendStateCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.logicOpEnable, b.logicOpEnable) &&
+        detail::equal_value(a.logicOp, b.logicOp) &&
+        detail::equal_value(a.attachmentCount, b.attachmentCount) &&
+        detail::equal_value(a.pAttachments, b.pAttachments) &&
+        detail::equal_value(a.blendConstants, b.blendConstants);
+  }
+};
+
+template <> struct hash<VkPipelineColorBlendStateCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineColorBlendStateCreateInfo const& v) {
+    if (equal_to<VkPipelineColorBlendStateCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.logicOpEnable);
+    seed = detail::hash_value(seed, v.logicOp);
+    seed = detail::hash_value(seed, v.attachmentCount);
+    seed = detail::hash_value(seed, v.pAttachments);
+    seed = detail::hash_value(seed, v.blendConstants);
+    return seed;
+  }
+  size_t operator()(VkPipelineColorBlendStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineColorBlendStateCreateInfo> {
+  static bool members(VkPipelineColorBlendStateCreateInfo const& a, VkPipelineColorBlendStateCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.logicOpEnable, b.logicOpEnable) &&
+        detail::equal_value(a.logicOp, b.logicOp) &&
+        detail::equal_value(a.attachmentCount, b.attachmentCount) &&
+        detail::equal_value(a.blendConstants, b.blendConstants) &&
+        detail::equal_each_range<deep_equal_to<VkPipelineColorBlendAttachmentState>>(a.pAttachments, b.pAttachments, a.attachmentCount);
+  }
+  bool operator()(VkPipelineColorBlendStateCreateInfo const& a, VkPipelineColorBlendStateCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineColorBlendStateCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineColorBlendStateCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.logicOpEnable);
+    seed = detail::hash_value(seed, v.logicOp);
+    seed = detail::hash_value(seed, v.attachmentCount);
+    seed = detail::combine_range<deep_hash<VkPipelineColorBlendAttachmentState>>(seed, v.pAttachments, v.attachmentCount);
+    seed = detail::hash_value(seed, v.blendConstants);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineColorBlendStateCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineColorBlendStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPipelineDynamicStateCreateInfo> {
+  static const bool bitwise = sizeof(VkPipelineDynamicStateCreateInfo) == (sizeof(VkPipelineDynamicStateCreateInfo::sType) + sizeof(VkPipelineDynamicStateCreateInfo::pNext) + sizeof(VkPipelineDynamicStateCreateInfo::flags) + sizeof(VkPipelineDynamicStateCreateInfo::dynamicStateCount) + sizeof(VkPipelineDynamicStateCreateInfo::pDynamicStates));
+  bool operator()(VkPipelineDynamicStateCreateInfo const& a, VkPipelineDynamicStateCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.dynamicStateCount, b.dynamicStateCount) &&
+        detail::equal_value(a.pDynamicStates, b.pDynamicStates);
+  }
+};
+
+template <> struct hash<VkPipelineDynamicStateCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkPipelineDynamicStateCreateInfo const& v) {
+    if (equal_to<VkPipelineDynamicStateCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.dynamicStateCount);
+    seed = detail::hash_value(seed, v.pDynamicStates);
+    return seed;
+  }
+  size_t operator()(VkPipelineDynamicStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPipelineDynamicStateCreateInfo> {
+  static bool members(VkPipelineDynamicStateCreateInfo const& a, VkPipelineDynamicStateCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.dynamicStateCount, b.dynamicStateCount) &&
+        detail::equal_range(a.pDynamicStates, b.pDynamicStates, a.dynamicStateCount);
+  }
+  bool operator()(VkPipelineDynamicStateCreateInfo const& a, VkPipelineDynamicStateCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkPipelineDynamicStateCreateInfo> {
+  static uint64_t members(uint64_t seed, VkPipelineDynamicStateCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.dynamicStateCount);
+    seed = detail::hash_range(seed, v.pDynamicStates, v.dynamicStateCount);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPipelineDynamicStateCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkPipelineDynamicStateCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkGraphicsPipelineCreateInfo> {
+  static const bool bitwise = sizeof(VkGraphicsPipelineCreateInfo) == (sizeof(VkGraphicsPipelineCreateInfo::sType) + sizeof(VkGraphicsPipelineCreateInfo::pNext) + sizeof(VkGraphicsPipelineCreateInfo::flags) + sizeof(VkGraphicsPipelineCreateInfo::stageCount) + sizeof(VkGraphicsPipelineCreateInfo::pStages) + sizeof(VkGraphicsPipelineCreateInfo::pVertexInputState) + sizeof(VkGraphicsPipelineCreateInfo::pInputAssemblyState) + sizeof(VkGraphicsPipelineCreateInfo::pTessellationState) + sizeof(VkGraphicsPipelineCreateInfo::pViewportState) + sizeof(VkGraphicsPipelineCreateInfo::pRasterizationState) + sizeof(VkGraphicsPipelineCreateInfo::pMultisampleState) + sizeof(VkGraphicsPipelineCreateInfo::pDepthStencilState) + sizeof(VkGraphicsPipelineCreateInfo::pColorBlendState) + sizeof(VkGraphicsPipelineCreateInfo::pDynamicState) + sizeof(VkGraphicsPipelineCreateInfo::layout) + sizeof(VkGraphicsPipelineCreateInfo::renderPass) + sizeof(VkGraphicsPipelineCreateInfo::subpass) + sizeof(VkGraphicsPipelineCreateInfo::basePipelineHandle) + sizeof(VkGraphicsPipelineCreateInfo::basePipelineIndex));
+  bool operator()(VkGraphicsPipelineCreateInfo const& a, VkGraphicsPipelineCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.stageCount, b.stageCount) &&
+        detail::equal_value(a.pStages, b.pStages) &&
+        detail::equal_value(a.pVertexInputState, b.pVertexInputState) &&
+        detail::equal_value(a.pInputAssemblyState, b.pInputAssemblyState) &&
+        detail::equal_value(a.pTessellationState, b.pTessellationState) &&
+        detail::equal_value(a.pViewportState, b.pViewportState) &&
+        detail::equal_value(a.pRasterizationState, b.pRasterizationState) &&
+        detail::equal_value(a.pMultisampleState, b.pMultisampleState) &&
+        detail::equal_value(a.pDepthStencilState, b.pDepthStencilState) &&
+        detail::equal_value(a.pColorBlendState, b.pColorBlendState) &&
+        detail::equal_value(a.pDynamicState, b.pDynamicState) &&
+        detail::equal_value(a.layout, b.layout) &&
+        detail::equal_value(a.renderPass, b.renderPass) &&
+        detail::equal_value(a.subpass, b.subpass) &&
+        detail::equal_value(a.basePipelineHandle, b.basePipelineHandle) &&
+        detail::equal_value(a.basePipelineIndex, b.basePipelineIndex);
+  }
+};
+
+template <> struct hash<VkGraphicsPipelineCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkGraphicsPipelineCreateInfo const& v) {
+    if (equal_to<VkGraphicsPipelineCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.stageCount);
+    seed = detail::hash_value(seed, v.pStages);
+    seed = detail::hash_value(seed, v.pVertexInputState);
+    seed = detail::hash_value(seed, v.pInputAssemblyState);
+    seed = detail::hash_value(seed, v.pTessellationState);
+    seed = detail::hash_value(seed, v.pViewportState);
+    seed = detail::hash_value(seed, v.pRasterizationState);
+    seed = detail::hash_value(seed, v.pMultisampleState);
+    seed = detail::hash_value(seed, v.pDepthStencilState);
+    seed = detail::hash_value(seed, v.pColorBlendState);
+    seed = detail::hash_value(seed, v.pDynamicState);
+    seed = detail::hash_value(seed, v.layout);
+    seed = detail::hash_value(seed, v.renderPass);
+    seed = detail::hash_value(seed, v.subpass);
+    seed = detail::hash_value(seed, v.basePipelineHandle);
+    seed = detail::hash_value(seed, v.basePipelineIndex);
+    return seed;
+  }
+  size_t operator()(VkGraphicsPipelineCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkGraphicsPipelineCreateInfo> {
+  static bool members(VkGraphicsPipelineCreateInfo const& a, VkGraphicsPipelineCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.stageCount, b.stageCount) &&
+        detail::equal_value(a.layout, b.layout) &&
+        detail::equal_value(a.renderPass, b.renderPass) &&
+        detail::equal_value(a.subpass, b.subpass) &&
+        detail::equal_value(a.basePipelineHandle, b.basePipelineHandle) &&
+        detail::equal_value(a.basePipelineIndex, b.basePipelineIndex) &&
+        detail::equal_each_range<deep_equal_to<VkPipelineShaderStageCreateInfo>>(a.pStages, b.pStages, a.stageCount) &&
+        detail::equal_pointee<deep_equal_to<VkPipelineVertexInputStateCreateInfo>>(a.pVertexInputState, b.pVertexInputState) &&
+        detail::equal_pointee<deep_equal_to<VkPipelineInputAssemblyStateCreateInfo>>(a.pInputAssemblyState, b.pInputAssemblyState) &&
+        detail::equal_pointee<deep_equal_to<VkPipelineTessellationStateCreateInfo>>(a.pTessellationState, b.pTessellationState) &&
+        detail::equal_pointee<deep_equal_to<VkPipelineViewportStateCreateInfo>>(a.pViewportState, b.pViewportState) &&
+        detail::equal_pointee<deep_equal_to<VkPipelineRasterizationStateCreateInfo>>(a.pRasterizationState, b.pRasterizationState) &&
+        detail::equal_pointee<deep_equal_to<VkPipelineMultisampleStateCreateInfo>>(a.pMultisampleState, b.pMultisampleState) &&
+        detail::equal_pointee<deep_equal_to<VkPipelineDepthStencilStateCreateInfo>>(a.pDepthStencilState, b.pDepthStencilState) &&
+        detail::equal_pointee<deep_equal_to<VkPipelineColorBlendStateCreateInfo>>(a.pColorBlendState, b.pColorBlendState) &&
+        detail::equal_pointee<deep_equal_to<VkPipelineDynamicStateCreateInfo>>(a.pDynamicState, b.pDynamicState);
+  }
+  bool operator()(VkGraphicsPipelineCreateInfo const& a, VkGraphicsPipelineCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkGraphicsPipelineCreateInfo> {
+  static uint64_t members(uint64_t seed, VkGraphicsPipelineCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.stageCount);
+    seed = detail::combine_range<deep_hash<VkPipelineShaderStageCreateInfo>>(seed, v.pStages, v.stageCount);
+    seed = detail::combine_pointee<deep_hash<VkPipelineVertexInputStateCreateInfo>>(seed, v.pVertexInputState);
+    seed = detail::combine_pointee<deep_hash<VkPipelineInputAssemblyStateCreateInfo>>(seed, v.pInputAssemblyState);
+    seed = detail::combine_pointee<deep_hash<VkPipelineTessellationStateCreateInfo>>(seed, v.pTessellationState);
+    seed = detail::combine_pointee<deep_hash<VkPipelineViewportStateCreateInfo>>(seed, v.pViewportState);
+    seed = detail::combine_pointee<deep_hash<VkPipelineRasterizationStateCreateInfo>>(seed, v.pRasterizationState);
+    seed = detail::combine_pointee<deep_hash<VkPipelineMultisampleStateCreateInfo>>(seed, v.pMultisampleState);
+    seed = detail::combine_pointee<deep_hash<VkPipelineDepthStencilStateCreateInfo>>(seed, v.pDepthStencilState);
+    seed = detail::combine_pointee<deep_hash<VkPipelineColorBlendStateCreateInfo>>(seed, v.pColorBlendState);
+    seed = detail::combine_pointee<deep_hash<VkPipelineDynamicStateCreateInfo>>(seed, v.pDynamicState);
+    seed = detail::hash_value(seed, v.layout);
+    seed = detail::hash_value(seed, v.renderPass);
+    seed = detail::hash_value(seed, v.subpass);
+    seed = detail::hash_value(seed, v.basePipelineHandle);
+    seed = detail::hash_value(seed, v.basePipelineIndex);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkGraphicsPipelineCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkGraphicsPipelineCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+namespace detail {
+
+inline uint64_t deep_hash_next(uint64_t seed, void const* next) {
+  for (; next; next = static_cast<chain_link const*>(next)->pNext) {
+    VkStructureType s_type = static_cast<chain_link const*>(next)->sType;
+    seed = hash_value(seed, s_type);
+    switch (s_type) {
+    default:
+      break; // Unknown structs contribute only their sType
+    }
+  }
+  return seed;
+}
+
+inline bool deep_equal_next(void const* a, void const* b) {
+  for (; a && b; a = static_cast<chain_link const*>(a)->pNext, b = static_cast<chain_link const*>(b)->pNext) {
+    if (a == b) {
+      return true; // Shared tail
+    }
+    VkStructureType s_type = static_cast<chain_link const*>(a)->sType;
+    if (s_type != static_cast<chain_link const*>(b)->sType) {
+      return false;
+    }
+    switch (s_type) {
+    default:
+      return false; // Unknown structs compare by address
+    }
+  }
+  return a == b;
+}
+
+} // detail
+
+} // vkgen
+
+namespace std {
+
+template <> struct hash<VkApplicationInfo> : public vkgen::hash<VkApplicationInfo> {};
+template <> struct hash<VkInstanceCreateInfo> : public vkgen::hash<VkInstanceCreateInfo> {};
+template <> struct hash<VkAllocationCallbacks> : public vkgen::hash<VkAllocationCallbacks> {};
+template <> struct hash<VkPhysicalDeviceFeatures> : public vkgen::hash<VkPhysicalDeviceFeatures> {};
+template <> struct hash<VkDeviceQueueCreateInfo> : public vkgen::hash<VkDeviceQueueCreateInfo> {};
+template <> struct hash<VkDeviceCreateInfo> : public vkgen::hash<VkDeviceCreateInfo> {};
+template <> struct hash<VkSpecializationMapEntry> : public vkgen::hash<VkSpecializationMapEntry> {};
+template <> struct hash<VkSpecializationInfo> : public vkgen::hash<VkSpecializationInfo> {};
+template <> struct hash<VkPipelineShaderStageCreateInfo> : public vkgen::hash<VkPipelineShaderStageCreateInfo> {};
+template <> struct hash<VkVertexInputBindingDescription> : public vkgen::hash<VkVertexInputBindingDescription> {};
+template <> struct hash<VkVertexInputAttributeDescription> : public vkgen::hash<VkVertexInputAttributeDescription> {};
+template <> struct hash<VkPipelineVertexInputStateCreateInfo> : public vkgen::hash<VkPipelineVertexInputStateCreateInfo> {};
+template <> struct hash<VkPipelineInputAssemblyStateCreateInfo> : public vkgen::hash<VkPipelineInputAssemblyStateCreateInfo> {};
+template <> struct hash<VkPipelineTessellationStateCreateInfo> : public vkgen::hash<VkPipelineTessellationStateCreateInfo> {};
+template <> struct hash<VkViewport> : public vkgen::hash<VkViewport> {};
+template <> struct hash<VkOffset2D> : public vkgen::hash<VkOffset2D> {};
+template <> struct hash<VkExtent2D> : public vkgen::hash<VkExtent2D> {};
+template <> struct hash<VkRect2D> : public vkgen::hash<VkRect2D> {};
+template <> struct hash<VkPipelineViewportStateCreateInfo> : public vkgen::hash<VkPipelineViewportStateCreateInfo> {};
+template <> struct hash<VkPipelineRasterizationStateCreateInfo> : public vkgen::hash<VkPipelineRasterizationStateCreateInfo> {};
+template <> struct hash<VkPipelineMultisampleStateCreateInfo> : public vkgen::hash<VkPipelineMultisampleStateCreateInfo> {};
+template <> struct hash<VkStencilOpState> : public vkgen::hash<VkStencilOpState> {};
+template <> struct hash<VkPipelineDepthStencilStateCreateInfo> : public vkgen::hash<VkPipelineDepthStencilStateCreateInfo> {};
+template <> struct hash<VkPipelineColorBlendAttachmentState> : public vkgen::hash<VkPipelineColorBlendAttachmentState> {};
+template <> struct hash<VkPipelineColorBlendStateCreateInfo> : public vkgen::hash<VkPipelineColorBlendStateCreateInfo> {};
+template <> struct hash<VkPipelineDynamicStateCreateInfo> : public vkgen::hash<VkPipelineDynamicStateCreateInfo> {};
+template <> struct hash<VkGraphicsPipelineCreateInfo> : public vkgen::hash<VkGraphicsPipelineCreateInfo> {};
+
+} // std
+
+#endif // VK_STRUCT_HASH_INCLUDE
@@ -0,0 +1,5 @@
+#include "vk_command_stream.h"
+
+namespace vkgen {
+
+} // vkgen
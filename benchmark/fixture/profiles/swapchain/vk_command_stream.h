@@ -0,0 +1,31 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Command streams for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_COMMAND_STREAM_INCLUDE
+#define VK_COMMAND_STREAM_INCLUDE
+
+#include "vk_deep_copy.h"
+#include "vk_dispatch_tables.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace vkgen {
+
+} // vkgen
+
+#endif // VK_COMMAND_STREAM_INCLUDE
@@ -0,0 +1,14 @@
+#include "vk_deep_copy.h"
+
+namespace vkgen {
+
+template VkApplicationInfo* deep_copy<VkApplicationInfo>(VkApplicationInfo const&, Arena&);
+template VkInstanceCreateInfo* deep_copy<VkInstanceCreateInfo>(VkInstanceCreateInfo const&, Arena&);
+template VkAllocationCallbacks* deep_copy<VkAllocationCallbacks>(VkAllocationCallbacks const&, Arena&);
+template VkPhysicalDeviceFeatures* deep_copy<VkPhysicalDeviceFeatures>(VkPhysicalDeviceFeatures const&, Arena&);
+template VkDeviceQueueCreateInfo* deep_copy<VkDeviceQueueCreateInfo>(VkDeviceQueueCreateInfo const&, Arena&);
+template VkDeviceCreateInfo* deep_copy<VkDeviceCreateInfo>(VkDeviceCreateInfo const&, Arena&);
+template VkExtent2D* deep_copy<VkExtent2D>(VkExtent2D const&, Arena&);
+template VkSwapchainCreateInfoKHR* deep_copy<VkSwapchainCreateInfoKHR>(VkSwapchainCreateInfoKHR const&, Arena&);
+
+} // vkgen
@@ -0,0 +1,381 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Deep copies for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_DEEP_COPY_INCLUDE
+#define VK_DEEP_COPY_INCLUDE
+
+#include "vulkan_include.inl"
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+namespace vkgen {
+
+// vkgen::deep_copy(v, arena) copies v and the data reachable from it into one
+// contiguous block of the arena and returns the copy, whose pointers all refer
+// into the block. len annotated arrays, strings and single struct pointers are
+// followed whenever they are not null, so unused pointers must be null. Other
+// pointers, such as pUserData and function pointers, are copied as they are.
+// pNext chains are copied up to the first struct unknown to the generator,
+// which is referenced rather than copied.
+//
+// Defining VKGEN_EXTERN_TEMPLATES declares deep_copy for every struct as an
+// extern template. The copies are then compiled once, in vk_deep_copy.cpp,
+// instead of in every translation unit making them.
+
+namespace detail {
+
+inline size_t align(size_t offset, size_t alignment) {
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+} // detail
+
+// Owns the memory of deep copies. Blocks are carved out of larger chunks; a
+// block larger than a chunk gets a chunk of its own. Memory is released by
+// reset or when the arena is destroyed. An arena is not thread safe, but the
+// copies it holds can be handed to other threads.
+class Arena {
+public:
+  explicit Arena(size_t chunk_size = 64 * 1024) : _chunk_size(chunk_size) {}
+  ~Arena() { reset(); }
+  Arena(Arena const&) = delete;
+  Arena& operator=(Arena const&) = delete;
+
+  // The returned block is suitably aligned for any Vulkan struct
+  void* allocate(size_t size) {
+    size = detail::align(size, alignof(std::max_align_t));
+    if (size > _chunk_size) {
+      return _new_chunk(size); // The current chunk keeps being filled afterwards
+    }
+    if (!_current || _used + size > _chunk_size) {
+      _current = _new_chunk(_chunk_size);
+      _used = 0;
+    }
+    void* block = _current + _used;
+    _used += size;
+    return block;
+  }
+
+  void reset() {
+    for (auto c : _chunks) {
+      std::free(c);
+    }
+    _chunks.clear();
+    _current = nullptr;
+    _used = 0;
+  }
+
+private:
+  unsigned char* _new_chunk(size_t size) {
+    void* chunk = std::malloc(size);
+    if (!chunk) {
+      throw std::bad_alloc();
+    }
+    _chunks.push_back(static_cast<unsigned char*>(chunk));
+    return _chunks.back();
+  }
+
+private:
+  std::vector<unsigned char*> _chunks;
+  unsigned char* _current = nullptr;
+  size_t _chunk_size;
+  size_t _used = 0;
+};
+
+namespace detail {
+
+// Hands out consecutive pieces of a block, matching the offsets computed when
+// sizing the block
+class cursor {
+public:
+  explicit cursor(void* block) : _block(static_cast<unsigned char*>(block)) {}
+
+  template <typename T>
+  T* take(size_t n) {
+    _offset = align(_offset, alignof(T));
+    T* p = reinterpret_cast<T*>(_block + _offset);
+    _offset += n * sizeof(T);
+    return p;
+  }
+
+private:
+  unsigned char* _block;
+  size_t _offset = 0;
+};
+
+template <typename T>
+inline size_t reserve(size_t offset, size_t n) {
+  return align(offset, alignof(T)) + n * sizeof(T);
+}
+
+// Untyped data, such as specialization constants, gets the strictest alignment
+struct max_aligned {
+  alignas(std::max_align_t) unsigned char bytes[1];
+};
+
+template <typename T>
+inline size_t size_range(size_t offset, T const* src, size_t n) {
+  return src ? reserve<T>(offset, n) : offset;
+}
+
+inline size_t size_range(size_t offset, void const* src, size_t n) {
+  return src ? align(offset, alignof(max_aligned)) + n : offset;
+}
+
+template <typename T>
+inline T* copy_range(cursor& c, T const* src, size_t n) {
+  if (!src) {
+    return nullptr;
+  }
+  T* dst = c.take<T>(n);
+  std::memcpy(dst, src, n * sizeof(T));
+  return dst;
+}
+
+inline void* copy_range(cursor& c, void const* src, size_t n) {
+  if (!src) {
+    return nullptr;
+  }
+  void* dst = c.take<max_aligned>(0);
+  c.take<unsigned char>(n);
+  std::memcpy(dst, src, n);
+  return dst;
+}
+
+template <typename C, typename T>
+inline size_t size_each(size_t offset, T const* src, size_t n) {
+  if (!src) {
+    return offset;
+  }
+  offset = reserve<T>(offset, n);
+  for (size_t i = 0; i < n; ++i) {
+    offset = C::size(offset, src[i]);
+  }
+  return offset;
+}
+
+template <typename C, typename T>
+inline T* copy_each(cursor& c, T const* src, size_t n) {
+  T* dst = copy_range(c, src, n);
+  for (size_t i = 0; dst && i < n; ++i) {
+    C::fill(dst[i], src[i], c);
+  }
+  return dst;
+}
+
+template <typename C, typename T, size_t N>
+inline size_t size_each(size_t offset, T const (&src)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    offset = C::size(offset, src[i]);
+  }
+  return offset;
+}
+
+template <typename C, typename T, size_t N>
+inline void fill_each(T (&dst)[N], T const (&src)[N], cursor& c) {
+  for (size_t i = 0; i < N; ++i) {
+    C::fill(dst[i], src[i], c);
+  }
+}
+
+template <typename C, typename T>
+inline size_t size_pointee(size_t offset, T const* src) {
+  return src ? C::size(reserve<T>(offset, 1), *src) : offset;
+}
+
+template <typename C, typename T>
+inline T* copy_pointee(cursor& c, T const* src) {
+  return copy_each<C>(c, src, 1);
+}
+
+inline size_t size_string(size_t offset, char const* src) {
+  return src ? offset + std::strlen(src) + 1 : offset;
+}
+
+inline char* copy_string(cursor& c, char const* src) {
+  return src ? copy_range(c, src, std::strlen(src) + 1) : nullptr;
+}
+
+inline size_t size_strings(size_t offset, char const* const* src, size_t n) {
+  if (!src) {
+    return offset;
+  }
+  offset = reserve<char const*>(offset, n);
+  for (size_t i = 0; i < n; ++i) {
+    offset = size_string(offset, src[i]);
+  }
+  return offset;
+}
+
+inline char const** copy_strings(cursor& c, char const* const* src, size_t n) {
+  if (!src) {
+    return nullptr;
+  }
+  char const** dst = c.take<char const*>(n);
+  for (size_t i = 0; i < n; ++i) {
+    dst[i] = copy_string(c, src[i]);
+  }
+  return dst;
+}
+
+// Common beginning of all structs that can be part of a pNext chain. Shared
+// with the other vkgen headers.
+#ifndef VKGEN_CHAIN_LINK_DEFINED
+#define VKGEN_CHAIN_LINK_DEFINED
+struct chain_link {
+  VkStructureType sType;
+  void const* pNext;
+};
+#endif
+
+// Defined after all structs since any of them may be part of a chain
+inline size_t size_next(size_t offset, void const* src);
+inline void* copy_next(cursor& c, void const* src);
+
+} // detail
+
+// Computes the size of the data reachable from a struct and copies it.
+// Structs without pointers to follow use this primary template, which has
+// nothing to do beyond the plain copy made by the caller.
+template <typename T>
+struct deep_copier {
+  static size_t size(size_t offset, T const&) { return offset; }
+  static void fill(T&, T const&, detail::cursor&) {}
+};
+
+template <> struct deep_copier<VkApplicationInfo> {
+  static size_t size(size_t offset, VkApplicationInfo const& v) {
+    offset = detail::size_next(offset, v.pNext);
+    offset = detail::size_string(offset, v.pApplicationName);
+    offset = detail::size_string(offset, v.pEngineName);
+    return offset;
+  }
+  static void fill(VkApplicationInfo& dst, VkApplicationInfo const& src, detail::cursor& c) {
+    dst.pNext = detail::copy_next(c, src.pNext);
+    dst.pApplicationName = detail::copy_string(c, src.pApplicationName);
+    dst.pEngineName = detail::copy_string(c, src.pEngineName);
+  }
+};
+
+template <> struct deep_copier<VkInstanceCreateInfo> {
+  static size_t size(size_t offset, VkInstanceCreateInfo const& v) {
+    offset = detail::size_next(offset, v.pNext);
+    offset = detail::size_pointee<deep_copier<VkApplicationInfo>>(offset, v.pApplicationInfo);
+    offset = detail::size_strings(offset, v.ppEnabledLayerNames, v.enabledLayerCount);
+    offset = detail::size_strings(offset, v.ppEnabledExtensionNames, v.enabledExtensionCount);
+    return offset;
+  }
+  static void fill(VkInstanceCreateInfo& dst, VkInstanceCreateInfo const& src, detail::cursor& c) {
+    dst.pNext = detail::copy_next(c, src.pNext);
+    dst.pApplicationInfo = detail::copy_pointee<deep_copier<VkApplicationInfo>>(c, src.pApplicationInfo);
+    dst.ppEnabledLayerNames = detail::copy_strings(c, src.ppEnabledLayerNames, src.enabledLayerCount);
+    dst.ppEnabledExtensionNames = detail::copy_strings(c, src.ppEnabledExtensionNames, src.enabledExtensionCount);
+  }
+};
+
+template <> struct deep_copier<VkDeviceQueueCreateInfo> {
+  static size_t size(size_t offset, VkDeviceQueueCreateInfo const& v) {
+    offset = detail::size_next(offset, v.pNext);
+    offset = detail::size_range(offset, v.pQueuePriorities, v.queueCount);
+    return offset;
+  }
+  static void fill(VkDeviceQueueCreateInfo& dst, VkDeviceQueueCreateInfo const& src, detail::cursor& c) {
+    dst.pNext = detail::copy_next(c, src.pNext);
+    dst.pQueuePriorities = detail::copy_range(c, src.pQueuePriorities, src.queueCount);
+  }
+};
+
+template <> struct deep_copier<VkDeviceCreateInfo> {
+  static size_t size(size_t offset, VkDeviceCreateInfo const& v) {
+    offset = detail::size_next(offset, v.pNext);
+    offset = detail::size_each<deep_copier<VkDeviceQueueCreateInfo>>(offset, v.pQueueCreateInfos, v.queueCreateInfoCount);
+    offset = detail::size_strings(offset, v.ppEnabledLayerNames, v.enabledLayerCount);
+    offset = detail::size_strings(offset, v.ppEnabledExtensionNames, v.enabledExtensionCount);
+    offset = detail::size_pointee<deep_copier<VkPhysicalDeviceFeatures>>(offset, v.pEnabledFeatures);
+    return offset;
+  }
+  static void fill(VkDeviceCreateInfo& dst, VkDeviceCreateInfo const& src, detail::cursor& c) {
+    dst.pNext = detail::copy_next(c, src.pNext);
+    dst.pQueueCreateInfos = detail::copy_each<deep_copier<VkDeviceQueueCreateInfo>>(c, src.pQueueCreateInfos, src.queueCreateInfoCount);
+    dst.ppEnabledLayerNames = detail::copy_strings(c, src.ppEnabledLayerNames, src.enabledLayerCount);
+    dst.ppEnabledExtensionNames = detail::copy_strings(c, src.ppEnabledExtensionNames, src.enabledExtensionCount);
+    dst.pEnabledFeatures = detail::copy_pointee<deep_copier<VkPhysicalDeviceFeatures>>(c, src.pEnabledFeatures);
+  }
+};
+
+template <> struct deep_copier<VkSwapchainCreateInfoKHR> {
+  static size_t size(size_t offset, VkSwapchainCreateInfoKHR const& v) {
+    offset = detail::size_next(offset, v.pNext);
+    offset = detail::size_range(offset, v.pQueueFamilyIndices, v.queueFamilyIndexCount);
+    return offset;
+  }
+  static void fill(VkSwapchainCreateInfoKHR& dst, VkSwapchainCreateInfoKHR const& src, detail::cursor& c) {
+    dst.pNext = detail::copy_next(c, src.pNext);
+    dst.pQueueFamilyIndices = detail::copy_range(c, src.pQueueFamilyIndices, src.queueFamilyIndexCount);
+  }
+};
+
+namespace detail {
+
+inline size_t size_next(size_t offset, void const* src) {
+  if (!src) {
+    return offset;
+  }
+  switch (static_cast<chain_link const*>(src)->sType) {
+  default:
+    return offset; // Referenced, not copied
+  }
+}
+
+inline void* copy_next(cursor& c, void const* src) {
+  if (!src) {
+    return nullptr;
+  }
+  switch (static_cast<chain_link const*>(src)->sType) {
+  default:
+    return const_cast<void*>(src);
+  }
+}
+
+} // detail
+
+template <typename T>
+T* deep_copy(T const& v, Arena& arena) {
+  detail::cursor c(arena.allocate(deep_copier<T>::size(sizeof(T), v)));
+  T* dst = c.take<T>(1);
+  *dst = v;
+  deep_copier<T>::fill(*dst, v, c);
+  return dst;
+}
+
+#if defined(VKGEN_EXTERN_TEMPLATES)
+extern template VkApplicationInfo* deep_copy<VkApplicationInfo>(VkApplicationInfo const&, Arena&);
+extern template VkInstanceCreateInfo* deep_copy<VkInstanceCreateInfo>(VkInstanceCreateInfo const&, Arena&);
+extern template VkAllocationCallbacks* deep_copy<VkAllocationCallbacks>(VkAllocationCallbacks const&, Arena&);
+extern template VkPhysicalDeviceFeatures* deep_copy<VkPhysicalDeviceFeatures>(VkPhysicalDeviceFeatures const&, Arena&);
+extern template VkDeviceQueueCreateInfo* deep_copy<VkDeviceQueueCreateInfo>(VkDeviceQueueCreateInfo const&, Arena&);
+extern template VkDeviceCreateInfo* deep_copy<VkDeviceCreateInfo>(VkDeviceCreateInfo const&, Arena&);
+extern template VkExtent2D* deep_copy<VkExtent2D>(VkExtent2D const&, Arena&);
+extern template VkSwapchainCreateInfoKHR* deep_copy<VkSwapchainCreateInfoKHR>(VkSwapchainCreateInfoKHR const&, Arena&);
+#endif
+
+} // vkgen
+
+#endif // VK_DEEP_COPY_INCLUDE
@@ -0,0 +1,110 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Dispatchers for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_DISPATCHER_INCLUDE
+#define VK_DISPATCHER_INCLUDE
+
+#include "vk_dispatch_tables.h"
+
+namespace vkgen {
+
+// Calls the prototypes exported by the Vulkan loader. Wrappers use this as
+// the default dispatcher, which is the same as calling the commands directly:
+//
+//   template <typename Dispatch = vkgen::DispatchLoaderStatic>
+//   void pushConstants(..., Dispatch const& d = Dispatch()) const {
+//     d.vkCmdPushConstants(m_commandBuffer, ...);
+//   }
+#if !defined(VK_NO_PROTOTYPES)
+class DispatchLoaderStatic {
+public:
+  PFN_vkVoidFunction vkGetInstanceProcAddr(VkInstance instance, const char* pName) const { return ::vkGetInstanceProcAddr(instance, pName); }
+  VkResult vkCreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkInstance* pInstance) const { return ::vkCreateInstance(pCreateInfo, pAllocator, pInstance); }
+  void vkDestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) const { return ::vkDestroyInstance(instance, pAllocator); }
+  VkResult vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) const { return ::vkEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices); }
+  PFN_vkVoidFunction vkGetDeviceProcAddr(VkDevice device, const char* pName) const { return ::vkGetDeviceProcAddr(device, pName); }
+  VkResult vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const { return ::vkCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice); }
+  void vkDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) const { return ::vkDestroyDevice(device, pAllocator); }
+  VkResult vkCreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) const { return ::vkCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain); }
+};
+#endif
+
+// Holds command pointers fetched through the vkgen dispatch tables. Global
+// and instance level commands are resolved with vkGetInstanceProcAddr, while
+// device level commands (including everything recorded into a command buffer)
+// are resolved with vkGetDeviceProcAddr and therefore call into the driver
+// without passing through a loader trampoline. Pointers are public and named
+// after their commands so that the dispatcher can be passed wherever a
+// DispatchLoaderStatic is accepted. Only one device should be loaded into a
+// given dispatcher.
+class DispatchLoaderDynamic {
+public:
+  DispatchLoaderDynamic() = default;
+  explicit DispatchLoaderDynamic(GlobalFunctions const& globals) { init(globals); }
+  DispatchLoaderDynamic(InstanceFunctions const& instance, DeviceFunctions const& device) { init(instance); init(device); }
+
+  void init(GlobalFunctions const& globals) {
+    vkCreateInstance = reinterpret_cast<PFN_vkCreateInstance>(globals.vkGetInstanceProcAddr(nullptr, "vkCreateInstance"));
+    if (!vkCreateInstance) {
+      throw VulkanProcNotFound("vkCreateInstance");
+    }
+  }
+
+  void init(InstanceFunctions const& instance) {
+    vkGetInstanceProcAddr = reinterpret_cast<PFN_vkGetInstanceProcAddr>(instance.vkGetInstanceProcAddr("vkGetInstanceProcAddr"));
+    if (!vkGetInstanceProcAddr) {
+      throw VulkanProcNotFound("vkGetInstanceProcAddr");
+    }
+    vkDestroyInstance = reinterpret_cast<PFN_vkDestroyInstance>(instance.vkGetInstanceProcAddr("vkDestroyInstance"));
+    if (!vkDestroyInstance) {
+      throw VulkanProcNotFound("vkDestroyInstance");
+    }
+    vkEnumeratePhysicalDevices = reinterpret_cast<PFN_vkEnumeratePhysicalDevices>(instance.vkGetInstanceProcAddr("vkEnumeratePhysicalDevices"));
+    if (!vkEnumeratePhysicalDevices) {
+      throw VulkanProcNotFound("vkEnumeratePhysicalDevices");
+    }
+    vkGetDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(instance.vkGetInstanceProcAddr("vkGetDeviceProcAddr"));
+    if (!vkGetDeviceProcAddr) {
+      throw VulkanProcNotFound("vkGetDeviceProcAddr");
+    }
+    vkCreateDevice = reinterpret_cast<PFN_vkCreateDevice>(instance.vkGetInstanceProcAddr("vkCreateDevice"));
+    if (!vkCreateDevice) {
+      throw VulkanProcNotFound("vkCreateDevice");
+    }
+  }
+
+  void init(DeviceFunctions const& device) {
+    vkDestroyDevice = reinterpret_cast<PFN_vkDestroyDevice>(device.vkGetDeviceProcAddr("vkDestroyDevice"));
+    if (!vkDestroyDevice) {
+      throw VulkanProcNotFound("vkDestroyDevice");
+    }
+    vkCreateSwapchainKHR = reinterpret_cast<PFN_vkCreateSwapchainKHR>(device.vkGetDeviceProcAddr("vkCreateSwapchainKHR"));
+  }
+
+  PFN_vkGetInstanceProcAddr vkGetInstanceProcAddr = nullptr;
+  PFN_vkCreateInstance vkCreateInstance = nullptr;
+  PFN_vkDestroyInstance vkDestroyInstance = nullptr;
+  PFN_vkEnumeratePhysicalDevices vkEnumeratePhysicalDevices = nullptr;
+  PFN_vkGetDeviceProcAddr vkGetDeviceProcAddr = nullptr;
+  PFN_vkCreateDevice vkCreateDevice = nullptr;
+  PFN_vkDestroyDevice vkDestroyDevice = nullptr;
+  PFN_vkCreateSwapchainKHR vkCreateSwapchainKHR = nullptr;
+};
+
+} // vkgen
+
+#endif // VK_DISPATCHER_INCLUDE
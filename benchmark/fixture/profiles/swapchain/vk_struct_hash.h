@@ -0,0 +1,1064 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Struct hashing for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#ifndef VK_STRUCT_HASH_INCLUDE
+#define VK_STRUCT_HASH_INCLUDE
+
+#include "vulkan_include.inl"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+namespace vkgen {
+
+// vkgen::hash<T> and vkgen::equal_to<T> are shallow: members are compared by
+// value, while pointer members (pNext included) are compared by address and
+// the data they point to is never read. Floats compare with operator==, which
+// means 0.0f and -0.0f are equal and hash the same. A struct without floats
+// and without padding (checked at compile time through sizeof) has bitwise set
+// and is compared with memcmp and hashed as one block of memory. Unions are
+// always treated as raw bytes, so zero-initialize them before writing a member
+// that does not cover the whole union.
+//
+// vkgen::deep_hash<T> and vkgen::deep_equal_to<T> compare content instead:
+// len annotated arrays, strings and single struct pointers are followed
+// whenever they are not null, so unused pointers must be null. pNext chains
+// are walked link by link. Links with an sType unknown to the generator
+// contribute only their sType to the hash and compare by address.
+template <typename T> struct hash;
+template <typename T> struct equal_to;
+template <typename T> struct deep_hash;
+template <typename T> struct deep_equal_to;
+
+namespace detail {
+
+inline uint64_t mix(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+// Consumes eight bytes at a time. A trailing partial word is zero-extended.
+inline uint64_t hash_bytes(uint64_t seed, void const* data, size_t size) {
+  unsigned char const* p = static_cast<unsigned char const*>(data);
+  uint64_t h = seed ^ (size * 0x9e3779b97f4a7c15ULL);
+  for (; size >= 8; p += 8, size -= 8) {
+    uint64_t k;
+    std::memcpy(&k, p, 8);
+    h = mix(h ^ k);
+  }
+  if (size > 0) {
+    uint64_t k = 0;
+    std::memcpy(&k, p, size);
+    h = mix(h ^ k);
+  }
+  return h;
+}
+
+template <typename T>
+inline uint64_t hash_value(uint64_t seed, T const& v) {
+  return hash_bytes(seed, &v, sizeof(v));
+}
+
+inline uint64_t hash_value(uint64_t seed, float v) {
+  if (v == 0.0f) {
+    v = 0.0f; // Fold -0.0f into 0.0f
+  }
+  return hash_bytes(seed, &v, sizeof(v));
+}
+
+template <size_t N>
+inline uint64_t hash_value(uint64_t seed, float const (&v)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    seed = hash_value(seed, v[i]);
+  }
+  return seed;
+}
+
+template <typename H, typename T, size_t N>
+inline uint64_t combine_each(uint64_t seed, T const (&v)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    seed = H::combine(seed, v[i]);
+  }
+  return seed;
+}
+
+template <typename T>
+inline bool equal_value(T const& a, T const& b) {
+  return a == b;
+}
+
+template <typename T, size_t N>
+inline bool equal_value(T const (&a)[N], T const (&b)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    if (!(a[i] == b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename E, typename T, size_t N>
+inline bool equal_each(T const (&a)[N], T const (&b)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    if (!E()(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Pointed-to scalars are hashed as one block of memory, except for floats.
+template <typename T>
+inline uint64_t hash_range(uint64_t seed, T const* p, size_t n) {
+  return hash_bytes(seed, p, p ? n * sizeof(T) : 0);
+}
+
+inline uint64_t hash_range(uint64_t seed, void const* p, size_t n) {
+  return hash_bytes(seed, p, p ? n : 0);
+}
+
+inline uint64_t hash_range(uint64_t seed, float const* p, size_t n) {
+  if (!p) {
+    n = 0;
+  }
+  seed = hash_value(seed, n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = hash_value(seed, p[i]);
+  }
+  return seed;
+}
+
+template <typename T>
+inline bool equal_range(T const* a, T const* b, size_t n) {
+  return n == 0 || a == b || (a && b && std::memcmp(a, b, n * sizeof(T)) == 0);
+}
+
+inline bool equal_range(void const* a, void const* b, size_t n) {
+  return n == 0 || a == b || (a && b && std::memcmp(a, b, n) == 0);
+}
+
+inline bool equal_range(float const* a, float const* b, size_t n) {
+  if (n == 0 || a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!(a[i] == b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename H, typename T>
+inline uint64_t combine_range(uint64_t seed, T const* p, size_t n) {
+  if (!p) {
+    n = 0;
+  }
+  seed = hash_value(seed, n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = H::combine(seed, p[i]);
+  }
+  return seed;
+}
+
+template <typename E, typename T>
+inline bool equal_each_range(T const* a, T const* b, size_t n) {
+  if (n == 0 || a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!E()(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename H, typename T>
+inline uint64_t combine_pointee(uint64_t seed, T const* p) {
+  return p ? H::combine(mix(seed), *p) : seed;
+}
+
+template <typename E, typename T>
+inline bool equal_pointee(T const* a, T const* b) {
+  return a == b || (a && b && E()(*a, *b));
+}
+
+inline uint64_t hash_string(uint64_t seed, char const* s) {
+  return s ? hash_bytes(mix(seed), s, std::strlen(s)) : seed;
+}
+
+inline bool equal_string(char const* a, char const* b) {
+  return a == b || (a && b && std::strcmp(a, b) == 0);
+}
+
+inline uint64_t hash_strings(uint64_t seed, char const* const* p, size_t n) {
+  if (!p) {
+    n = 0;
+  }
+  seed = hash_value(seed, n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = hash_string(seed, p[i]);
+  }
+  return seed;
+}
+
+inline bool equal_strings(char const* const* a, char const* const* b, size_t n) {
+  if (n == 0 || a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!equal_string(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Common beginning of all structs that can be part of a pNext chain. Shared
+// with the other vkgen headers.
+#ifndef VKGEN_CHAIN_LINK_DEFINED
+#define VKGEN_CHAIN_LINK_DEFINED
+struct chain_link {
+  VkStructureType sType;
+  void const* pNext;
+};
+#endif
+
+// Defined after all structs since any of them may be part of a chain
+inline uint64_t deep_hash_next(uint64_t seed, void const* next);
+inline bool deep_equal_next(void const* a, void const* b);
+
+} // detail
+
+template <> struct equal_to<VkApplicationInfo> {
+  static const bool bitwise = sizeof(VkApplicationInfo) == (sizeof(VkApplicationInfo::sType) + sizeof(VkApplicationInfo::pNext) + sizeof(VkApplicationInfo::pApplicationName) + sizeof(VkApplicationInfo::applicationVersion) + sizeof(VkApplicationInfo::pEngineName) + sizeof(VkApplicationInfo::engineVersion) + sizeof(VkApplicationInfo::apiVersion));
+  bool operator()(VkApplicationInfo const& a, VkApplicationInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.pApplicationName, b.pApplicationName) &&
+        detail::equal_value(a.applicationVersion, b.applicationVersion) &&
+        detail::equal_value(a.pEngineName, b.pEngineName) &&
+        detail::equal_value(a.engineVersion, b.engineVersion) &&
+        detail::equal_value(a.apiVersion, b.apiVersion);
+  }
+};
+
+template <> struct hash<VkApplicationInfo> {
+  static uint64_t combine(uint64_t seed, VkApplicationInfo const& v) {
+    if (equal_to<VkApplicationInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.pApplicationName);
+    seed = detail::hash_value(seed, v.applicationVersion);
+    seed = detail::hash_value(seed, v.pEngineName);
+    seed = detail::hash_value(seed, v.engineVersion);
+    seed = detail::hash_value(seed, v.apiVersion);
+    return seed;
+  }
+  size_t operator()(VkApplicationInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkApplicationInfo> {
+  static bool members(VkApplicationInfo const& a, VkApplicationInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.applicationVersion, b.applicationVersion) &&
+        detail::equal_value(a.engineVersion, b.engineVersion) &&
+        detail::equal_value(a.apiVersion, b.apiVersion) &&
+        detail::equal_string(a.pApplicationName, b.pApplicationName) &&
+        detail::equal_string(a.pEngineName, b.pEngineName);
+  }
+  bool operator()(VkApplicationInfo const& a, VkApplicationInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkApplicationInfo> {
+  static uint64_t members(uint64_t seed, VkApplicationInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_string(seed, v.pApplicationName);
+    seed = detail::hash_value(seed, v.applicationVersion);
+    seed = detail::hash_string(seed, v.pEngineName);
+    seed = detail::hash_value(seed, v.engineVersion);
+    seed = detail::hash_value(seed, v.apiVersion);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkApplicationInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkApplicationInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkInstanceCreateInfo> {
+  static const bool bitwise = sizeof(VkInstanceCreateInfo) == (sizeof(VkInstanceCreateInfo::sType) + sizeof(VkInstanceCreateInfo::pNext) + sizeof(VkInstanceCreateInfo::flags) + sizeof(VkInstanceCreateInfo::pApplicationInfo) + sizeof(VkInstanceCreateInfo::enabledLayerCount) + sizeof(VkInstanceCreateInfo::ppEnabledLayerNames) + sizeof(VkInstanceCreateInfo::enabledExtensionCount) + sizeof(VkInstanceCreateInfo::ppEnabledExtensionNames));
+  bool operator()(VkInstanceCreateInfo const& a, VkInstanceCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.pApplicationInfo, b.pApplicationInfo) &&
+        detail::equal_value(a.enabledLayerCount, b.enabledLayerCount) &&
+        detail::equal_value(a.ppEnabledLayerNames, b.ppEnabledLayerNames) &&
+        detail::equal_value(a.enabledExtensionCount, b.enabledExtensionCount) &&
+        detail::equal_value(a.ppEnabledExtensionNames, b.ppEnabledExtensionNames);
+  }
+};
+
+template <> struct hash<VkInstanceCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkInstanceCreateInfo const& v) {
+    if (equal_to<VkInstanceCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.pApplicationInfo);
+    seed = detail::hash_value(seed, v.enabledLayerCount);
+    seed = detail::hash_value(seed, v.ppEnabledLayerNames);
+    seed = detail::hash_value(seed, v.enabledExtensionCount);
+    seed = detail::hash_value(seed, v.ppEnabledExtensionNames);
+    return seed;
+  }
+  size_t operator()(VkInstanceCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkInstanceCreateInfo> {
+  static bool members(VkInstanceCreateInfo const& a, VkInstanceCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.enabledLayerCount, b.enabledLayerCount) &&
+        detail::equal_value(a.enabledExtensionCount, b.enabledExtensionCount) &&
+        detail::equal_pointee<deep_equal_to<VkApplicationInfo>>(a.pApplicationInfo, b.pApplicationInfo) &&
+        detail::equal_strings(a.ppEnabledLayerNames, b.ppEnabledLayerNames, a.enabledLayerCount) &&
+        detail::equal_strings(a.ppEnabledExtensionNames, b.ppEnabledExtensionNames, a.enabledExtensionCount);
+  }
+  bool operator()(VkInstanceCreateInfo const& a, VkInstanceCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkInstanceCreateInfo> {
+  static uint64_t members(uint64_t seed, VkInstanceCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::combine_pointee<deep_hash<VkApplicationInfo>>(seed, v.pApplicationInfo);
+    seed = detail::hash_value(seed, v.enabledLayerCount);
+    seed = detail::hash_strings(seed, v.ppEnabledLayerNames, v.enabledLayerCount);
+    seed = detail::hash_value(seed, v.enabledExtensionCount);
+    seed = detail::hash_strings(seed, v.ppEnabledExtensionNames, v.enabledExtensionCount);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkInstanceCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkInstanceCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkAllocationCallbacks> {
+  static const bool bitwise = sizeof(VkAllocationCallbacks) == (sizeof(VkAllocationCallbacks::pUserData) + sizeof(VkAllocationCallbacks::pfnAllocation) + sizeof(VkAllocationCallbacks::pfnFree));
+  bool operator()(VkAllocationCallbacks const& a, VkAllocationCallbacks const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.pUserData, b.pUserData) &&
+        detail::equal_value(a.pfnAllocation, b.pfnAllocation) &&
+        detail::equal_value(a.pfnFree, b.pfnFree);
+  }
+};
+
+template <> struct hash<VkAllocationCallbacks> {
+  static uint64_t combine(uint64_t seed, VkAllocationCallbacks const& v) {
+    if (equal_to<VkAllocationCallbacks>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.pUserData);
+    seed = detail::hash_value(seed, v.pfnAllocation);
+    seed = detail::hash_value(seed, v.pfnFree);
+    return seed;
+  }
+  size_t operator()(VkAllocationCallbacks const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkAllocationCallbacks> {
+  static bool members(VkAllocationCallbacks const& a, VkAllocationCallbacks const& b) {
+    return detail::equal_value(a.pUserData, b.pUserData) &&
+        detail::equal_value(a.pfnAllocation, b.pfnAllocation) &&
+        detail::equal_value(a.pfnFree, b.pfnFree);
+  }
+  bool operator()(VkAllocationCallbacks const& a, VkAllocationCallbacks const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkAllocationCallbacks> {
+  static uint64_t members(uint64_t seed, VkAllocationCallbacks const& v) {
+    seed = detail::hash_value(seed, v.pUserData);
+    seed = detail::hash_value(seed, v.pfnAllocation);
+    seed = detail::hash_value(seed, v.pfnFree);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkAllocationCallbacks const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkAllocationCallbacks const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkPhysicalDeviceFeatures> {
+  static const bool bitwise = sizeof(VkPhysicalDeviceFeatures) == (sizeof(VkPhysicalDeviceFeatures::robustBufferAccess) + sizeof(VkPhysicalDeviceFeatures::fullDrawIndexUint32) + sizeof(VkPhysicalDeviceFeatures::imageCubeArray) + sizeof(VkPhysicalDeviceFeatures::independentBlend) + sizeof(VkPhysicalDeviceFeatures::geometryShader) + sizeof(VkPhysicalDeviceFeatures::tessellationShader) + sizeof(VkPhysicalDeviceFeatures::sampleRateShading) + sizeof(VkPhysicalDeviceFeatures::dualSrcBlend) + sizeof(VkPhysicalDeviceFeatures::logicOp) + sizeof(VkPhysicalDeviceFeatures::multiDrawIndirect) + sizeof(VkPhysicalDeviceFeatures::drawIndirectFirstInstance) + sizeof(VkPhysicalDeviceFeatures::depthClamp) + sizeof(VkPhysicalDeviceFeatures::depthBiasClamp) + sizeof(VkPhysicalDeviceFeatures::fillModeNonSolid) + sizeof(VkPhysicalDeviceFeatures::depthBounds) + sizeof(VkPhysicalDeviceFeatures::wideLines) + sizeof(VkPhysicalDeviceFeatures::largePoints) + sizeof(VkPhysicalDeviceFeatures::alphaToOne) + sizeof(VkPhysicalDeviceFeatures::multiViewport) + sizeof(VkPhysicalDeviceFeatures::samplerAnisotropy) + sizeof(VkPhysicalDeviceFeatures::textureCompressionETC2) + sizeof(VkPhysicalDeviceFeatures::textureCompressionASTC_LDR) + sizeof(VkPhysicalDeviceFeatures::textureCompressionBC) + sizeof(VkPhysicalDeviceFeatures::occlusionQueryPrecise) + sizeof(VkPhysicalDeviceFeatures::pipelineStatisticsQuery) + sizeof(VkPhysicalDeviceFeatures::vertexPipelineStoresAndAtomics) + sizeof(VkPhysicalDeviceFeatures::fragmentStoresAndAtomics) + sizeof(VkPhysicalDeviceFeatures::shaderTessellationAndGeometryPointSize) + sizeof(VkPhysicalDeviceFeatures::shaderImageGatherExtended) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageExtendedFormats) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageMultisample) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageReadWithoutFormat) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageWriteWithoutFormat) + sizeof(VkPhysicalDeviceFeatures::shaderUniformBufferArrayDynamicIndexing) + sizeof(VkPhysicalDeviceFeatures::shaderSampledImageArrayDynamicIndexing) + sizeof(VkPhysicalDeviceFeatures::shaderStorageBufferArrayDynamicIndexing) + sizeof(VkPhysicalDeviceFeatures::shaderStorageImageArrayDynamicIndexing) + sizeof(VkPhysicalDeviceFeatures::shaderClipDistance) + sizeof(VkPhysicalDeviceFeatures::shaderCullDistance) + sizeof(VkPhysicalDeviceFeatures::shaderFloat64) + sizeof(VkPhysicalDeviceFeatures::shaderInt64) + sizeof(VkPhysicalDeviceFeatures::shaderInt16) + sizeof(VkPhysicalDeviceFeatures::shaderResourceResidency) + sizeof(VkPhysicalDeviceFeatures::shaderResourceMinLod) + sizeof(VkPhysicalDeviceFeatures::sparseBinding) + sizeof(VkPhysicalDeviceFeatures::sparseResidencyBuffer) + sizeof(VkPhysicalDeviceFeatures::sparseResidencyImage2D) + sizeof(VkPhysicalDeviceFeatures::sparseResidencyImage3D) + sizeof(VkPhysicalDeviceFeatures::sparseResidency2Samples) + sizeof(VkPhysicalDeviceFeatures::sparseResidency4Samples) + sizeof(VkPhysicalDeviceFeatures::sparseResidency8Samples) + sizeof(VkPhysicalDeviceFeatures::sparseResidency16Samples) + sizeof(VkPhysicalDeviceFeatures::sparseResidencyAliased) + sizeof(VkPhysicalDeviceFeatures::variableMultisampleRate) + sizeof(VkPhysicalDeviceFeatures::inheritedQueries));
+  bool operator()(VkPhysicalDeviceFeatures const& a, VkPhysicalDeviceFeatures const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.robustBufferAccess, b.robustBufferAccess) &&
+        detail::equal_value(a.fullDrawIndexUint32, b.fullDrawIndexUint32) &&
+        detail::equal_value(a.imageCubeArray, b.imageCubeArray) &&
+        detail::equal_value(a.independentBlend, b.independentBlend) &&
+        detail::equal_value(a.geometryShader, b.geometryShader) &&
+        detail::equal_value(a.tessellationShader, b.tessellationShader) &&
+        detail::equal_value(a.sampleRateShading, b.sampleRateShading) &&
+        detail::equal_value(a.dualSrcBlend, b.dualSrcBlend) &&
+        detail::equal_value(a.logicOp, b.logicOp) &&
+        detail::equal_value(a.multiDrawIndirect, b.multiDrawIndirect) &&
+        detail::equal_value(a.drawIndirectFirstInstance, b.drawIndirectFirstInstance) &&
+        detail::equal_value(a.depthClamp, b.depthClamp) &&
+        detail::equal_value(a.depthBiasClamp, b.depthBiasClamp) &&
+        detail::equal_value(a.fillModeNonSolid, b.fillModeNonSolid) &&
+        detail::equal_value(a.depthBounds, b.depthBounds) &&
+        detail::equal_value(a.wideLines, b.wideLines) &&
+        detail::equal_value(a.largePoints, b.largePoints) &&
+        detail::equal_value(a.alphaToOne, b.alphaToOne) &&
+        detail::equal_value(a.multiViewport, b.multiViewport) &&
+        detail::equal_value(a.samplerAnisotropy, b.samplerAnisotropy) &&
+        detail::equal_value(a.textureCompressionETC2, b.textureCompressionETC2) &&
+        detail::equal_value(a.textureCompressionASTC_LDR, b.textureCompressionASTC_LDR) &&
+        detail::equal_value(a.textureCompressionBC, b.textureCompressionBC) &&
+        detail::equal_value(a.occlusionQueryPrecise, b.occlusionQueryPrecise) &&
+        detail::equal_value(a.pipelineStatisticsQuery, b.pipelineStatisticsQuery) &&
+        detail::equal_value(a.vertexPipelineStoresAndAtomics, b.vertexPipelineStoresAndAtomics) &&
+        detail::equal_value(a.fragmentStoresAndAtomics, b.fragmentStoresAndAtomics) &&
+        detail::equal_value(a.shaderTessellationAndGeometryPointSize, b.shaderTessellationAndGeometryPointSize) &&
+        detail::equal_value(a.shaderImageGatherExtended, b.shaderImageGatherExtended) &&
+        detail::equal_value(a.shaderStorageImageExtendedFormats, b.shaderStorageImageExtendedFormats) &&
+        detail::equal_value(a.shaderStorageImageMultisample, b.shaderStorageImageMultisample) &&
+        detail::equal_value(a.shaderStorageImageReadWithoutFormat, b.shaderStorageImageReadWithoutFormat) &&
+        detail::equal_value(a.shaderStorageImageWriteWithoutFormat, b.shaderStorageImageWriteWithoutFormat) &&
+        detail::equal_value(a.shaderUniformBufferArrayDynamicIndexing, b.shaderUniformBufferArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderSampledImageArrayDynamicIndexing, b.shaderSampledImageArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderStorageBufferArrayDynamicIndexing, b.shaderStorageBufferArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderStorageImageArrayDynamicIndexing, b.shaderStorageImageArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderClipDistance, b.shaderClipDistance) &&
+        detail::equal_value(a.shaderCullDistance, b.shaderCullDistance) &&
+        detail::equal_value(a.shaderFloat64, b.shaderFloat64) &&
+        detail::equal_value(a.shaderInt64, b.shaderInt64) &&
+        detail::equal_value(a.shaderInt16, b.shaderInt16) &&
+        detail::equal_value(a.shaderResourceResidency, b.shaderResourceResidency) &&
+        detail::equal_value(a.shaderResourceMinLod, b.shaderResourceMinLod) &&
+        detail::equal_value(a.sparseBinding, b.sparseBinding) &&
+        detail::equal_value(a.sparseResidencyBuffer, b.sparseResidencyBuffer) &&
+        detail::equal_value(a.sparseResidencyImage2D, b.sparseResidencyImage2D) &&
+        detail::equal_value(a.sparseResidencyImage3D, b.sparseResidencyImage3D) &&
+        detail::equal_value(a.sparseResidency2Samples, b.sparseResidency2Samples) &&
+        detail::equal_value(a.sparseResidency4Samples, b.sparseResidency4Samples) &&
+        detail::equal_value(a.sparseResidency8Samples, b.sparseResidency8Samples) &&
+        detail::equal_value(a.sparseResidency16Samples, b.sparseResidency16Samples) &&
+        detail::equal_value(a.sparseResidencyAliased, b.sparseResidencyAliased) &&
+        detail::equal_value(a.variableMultisampleRate, b.variableMultisampleRate) &&
+        detail::equal_value(a.inheritedQueries, b.inheritedQueries);
+  }
+};
+
+template <> struct hash<VkPhysicalDeviceFeatures> {
+  static uint64_t combine(uint64_t seed, VkPhysicalDeviceFeatures const& v) {
+    if (equal_to<VkPhysicalDeviceFeatures>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.robustBufferAccess);
+    seed = detail::hash_value(seed, v.fullDrawIndexUint32);
+    seed = detail::hash_value(seed, v.imageCubeArray);
+    seed = detail::hash_value(seed, v.independentBlend);
+    seed = detail::hash_value(seed, v.geometryShader);
+    seed = detail::hash_value(seed, v.tessellationShader);
+    seed = detail::hash_value(seed, v.sampleRateShading);
+    seed = detail::hash_value(seed, v.dualSrcBlend);
+    seed = detail::hash_value(seed, v.logicOp);
+    seed = detail::hash_value(seed, v.multiDrawIndirect);
+    seed = detail::hash_value(seed, v.drawIndirectFirstInstance);
+    seed = detail::hash_value(seed, v.depthClamp);
+    seed = detail::hash_value(seed, v.depthBiasClamp);
+    seed = detail::hash_value(seed, v.fillModeNonSolid);
+    seed = detail::hash_value(seed, v.depthBounds);
+    seed = detail::hash_value(seed, v.wideLines);
+    seed = detail::hash_value(seed, v.largePoints);
+    seed = detail::hash_value(seed, v.alphaToOne);
+    seed = detail::hash_value(seed, v.multiViewport);
+    seed = detail::hash_value(seed, v.samplerAnisotropy);
+    seed = detail::hash_value(seed, v.textureCompressionETC2);
+    seed = detail::hash_value(seed, v.textureCompressionASTC_LDR);
+    seed = detail::hash_value(seed, v.textureCompressionBC);
+    seed = detail::hash_value(seed, v.occlusionQueryPrecise);
+    seed = detail::hash_value(seed, v.pipelineStatisticsQuery);
+    seed = detail::hash_value(seed, v.vertexPipelineStoresAndAtomics);
+    seed = detail::hash_value(seed, v.fragmentStoresAndAtomics);
+    seed = detail::hash_value(seed, v.shaderTessellationAndGeometryPointSize);
+    seed = detail::hash_value(seed, v.shaderImageGatherExtended);
+    seed = detail::hash_value(seed, v.shaderStorageImageExtendedFormats);
+    seed = detail::hash_value(seed, v.shaderStorageImageMultisample);
+    seed = detail::hash_value(seed, v.shaderStorageImageReadWithoutFormat);
+    seed = detail::hash_value(seed, v.shaderStorageImageWriteWithoutFormat);
+    seed = detail::hash_value(seed, v.shaderUniformBufferArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderSampledImageArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderStorageBufferArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderStorageImageArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderClipDistance);
+    seed = detail::hash_value(seed, v.shaderCullDistance);
+    seed = detail::hash_value(seed, v.shaderFloat64);
+    seed = detail::hash_value(seed, v.shaderInt64);
+    seed = detail::hash_value(seed, v.shaderInt16);
+    seed = detail::hash_value(seed, v.shaderResourceResidency);
+    seed = detail::hash_value(seed, v.shaderResourceMinLod);
+    seed = detail::hash_value(seed, v.sparseBinding);
+    seed = detail::hash_value(seed, v.sparseResidencyBuffer);
+    seed = detail::hash_value(seed, v.sparseResidencyImage2D);
+    seed = detail::hash_value(seed, v.sparseResidencyImage3D);
+    seed = detail::hash_value(seed, v.sparseResidency2Samples);
+    seed = detail::hash_value(seed, v.sparseResidency4Samples);
+    seed = detail::hash_value(seed, v.sparseResidency8Samples);
+    seed = detail::hash_value(seed, v.sparseResidency16Samples);
+    seed = detail::hash_value(seed, v.sparseResidencyAliased);
+    seed = detail::hash_value(seed, v.variableMultisampleRate);
+    seed = detail::hash_value(seed, v.inheritedQueries);
+    return seed;
+  }
+  size_t operator()(VkPhysicalDeviceFeatures const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkPhysicalDeviceFeatures> {
+  static bool members(VkPhysicalDeviceFeatures const& a, VkPhysicalDeviceFeatures const& b) {
+    return detail::equal_value(a.robustBufferAccess, b.robustBufferAccess) &&
+        detail::equal_value(a.fullDrawIndexUint32, b.fullDrawIndexUint32) &&
+        detail::equal_value(a.imageCubeArray, b.imageCubeArray) &&
+        detail::equal_value(a.independentBlend, b.independentBlend) &&
+        detail::equal_value(a.geometryShader, b.geometryShader) &&
+        detail::equal_value(a.tessellationShader, b.tessellationShader) &&
+        detail::equal_value(a.sampleRateShading, b.sampleRateShading) &&
+        detail::equal_value(a.dualSrcBlend, b.dualSrcBlend) &&
+        detail::equal_value(a.logicOp, b.logicOp) &&
+        detail::equal_value(a.multiDrawIndirect, b.multiDrawIndirect) &&
+        detail::equal_value(a.drawIndirectFirstInstance, b.drawIndirectFirstInstance) &&
+        detail::equal_value(a.depthClamp, b.depthClamp) &&
+        detail::equal_value(a.depthBiasClamp, b.depthBiasClamp) &&
+        detail::equal_value(a.fillModeNonSolid, b.fillModeNonSolid) &&
+        detail::equal_value(a.depthBounds, b.depthBounds) &&
+        detail::equal_value(a.wideLines, b.wideLines) &&
+        detail::equal_value(a.largePoints, b.largePoints) &&
+        detail::equal_value(a.alphaToOne, b.alphaToOne) &&
+        detail::equal_value(a.multiViewport, b.multiViewport) &&
+        detail::equal_value(a.samplerAnisotropy, b.samplerAnisotropy) &&
+        detail::equal_value(a.textureCompressionETC2, b.textureCompressionETC2) &&
+        detail::equal_value(a.textureCompressionASTC_LDR, b.textureCompressionASTC_LDR) &&
+        detail::equal_value(a.textureCompressionBC, b.textureCompressionBC) &&
+        detail::equal_value(a.occlusionQueryPrecise, b.occlusionQueryPrecise) &&
+        detail::equal_value(a.pipelineStatisticsQuery, b.pipelineStatisticsQuery) &&
+        detail::equal_value(a.vertexPipelineStoresAndAtomics, b.vertexPipelineStoresAndAtomics) &&
+        detail::equal_value(a.fragmentStoresAndAtomics, b.fragmentStoresAndAtomics) &&
+        detail::equal_value(a.shaderTessellationAndGeometryPointSize, b.shaderTessellationAndGeometryPointSize) &&
+        detail::equal_value(a.shaderImageGatherExtended, b.shaderImageGatherExtended) &&
+        detail::equal_value(a.shaderStorageImageExtendedFormats, b.shaderStorageImageExtendedFormats) &&
+        detail::equal_value(a.shaderStorageImageMultisample, b.shaderStorageImageMultisample) &&
+        detail::equal_value(a.shaderStorageImageReadWithoutFormat, b.shaderStorageImageReadWithoutFormat) &&
+        detail::equal_value(a.shaderStorageImageWriteWithoutFormat, b.shaderStorageImageWriteWithoutFormat) &&
+        detail::equal_value(a.shaderUniformBufferArrayDynamicIndexing, b.shaderUniformBufferArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderSampledImageArrayDynamicIndexing, b.shaderSampledImageArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderStorageBufferArrayDynamicIndexing, b.shaderStorageBufferArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderStorageImageArrayDynamicIndexing, b.shaderStorageImageArrayDynamicIndexing) &&
+        detail::equal_value(a.shaderClipDistance, b.shaderClipDistance) &&
+        detail::equal_value(a.shaderCullDistance, b.shaderCullDistance) &&
+        detail::equal_value(a.shaderFloat64, b.shaderFloat64) &&
+        detail::equal_value(a.shaderInt64, b.shaderInt64) &&
+        detail::equal_value(a.shaderInt16, b.shaderInt16) &&
+        detail::equal_value(a.shaderResourceResidency, b.shaderResourceResidency) &&
+        detail::equal_value(a.shaderResourceMinLod, b.shaderResourceMinLod) &&
+        detail::equal_value(a.sparseBinding, b.sparseBinding) &&
+        detail::equal_value(a.sparseResidencyBuffer, b.sparseResidencyBuffer) &&
+        detail::equal_value(a.sparseResidencyImage2D, b.sparseResidencyImage2D) &&
+        detail::equal_value(a.sparseResidencyImage3D, b.sparseResidencyImage3D) &&
+        detail::equal_value(a.sparseResidency2Samples, b.sparseResidency2Samples) &&
+        detail::equal_value(a.sparseResidency4Samples, b.sparseResidency4Samples) &&
+        detail::equal_value(a.sparseResidency8Samples, b.sparseResidency8Samples) &&
+        detail::equal_value(a.sparseResidency16Samples, b.sparseResidency16Samples) &&
+        detail::equal_value(a.sparseResidencyAliased, b.sparseResidencyAliased) &&
+        detail::equal_value(a.variableMultisampleRate, b.variableMultisampleRate) &&
+        detail::equal_value(a.inheritedQueries, b.inheritedQueries);
+  }
+  bool operator()(VkPhysicalDeviceFeatures const& a, VkPhysicalDeviceFeatures const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkPhysicalDeviceFeatures> {
+  static uint64_t members(uint64_t seed, VkPhysicalDeviceFeatures const& v) {
+    seed = detail::hash_value(seed, v.robustBufferAccess);
+    seed = detail::hash_value(seed, v.fullDrawIndexUint32);
+    seed = detail::hash_value(seed, v.imageCubeArray);
+    seed = detail::hash_value(seed, v.independentBlend);
+    seed = detail::hash_value(seed, v.geometryShader);
+    seed = detail::hash_value(seed, v.tessellationShader);
+    seed = detail::hash_value(seed, v.sampleRateShading);
+    seed = detail::hash_value(seed, v.dualSrcBlend);
+    seed = detail::hash_value(seed, v.logicOp);
+    seed = detail::hash_value(seed, v.multiDrawIndirect);
+    seed = detail::hash_value(seed, v.drawIndirectFirstInstance);
+    seed = detail::hash_value(seed, v.depthClamp);
+    seed = detail::hash_value(seed, v.depthBiasClamp);
+    seed = detail::hash_value(seed, v.fillModeNonSolid);
+    seed = detail::hash_value(seed, v.depthBounds);
+    seed = detail::hash_value(seed, v.wideLines);
+    seed = detail::hash_value(seed, v.largePoints);
+    seed = detail::hash_value(seed, v.alphaToOne);
+    seed = detail::hash_value(seed, v.multiViewport);
+    seed = detail::hash_value(seed, v.samplerAnisotropy);
+    seed = detail::hash_value(seed, v.textureCompressionETC2);
+    seed = detail::hash_value(seed, v.textureCompressionASTC_LDR);
+    seed = detail::hash_value(seed, v.textureCompressionBC);
+    seed = detail::hash_value(seed, v.occlusionQueryPrecise);
+    seed = detail::hash_value(seed, v.pipelineStatisticsQuery);
+    seed = detail::hash_value(seed, v.vertexPipelineStoresAndAtomics);
+    seed = detail::hash_value(seed, v.fragmentStoresAndAtomics);
+    seed = detail::hash_value(seed, v.shaderTessellationAndGeometryPointSize);
+    seed = detail::hash_value(seed, v.shaderImageGatherExtended);
+    seed = detail::hash_value(seed, v.shaderStorageImageExtendedFormats);
+    seed = detail::hash_value(seed, v.shaderStorageImageMultisample);
+    seed = detail::hash_value(seed, v.shaderStorageImageReadWithoutFormat);
+    seed = detail::hash_value(seed, v.shaderStorageImageWriteWithoutFormat);
+    seed = detail::hash_value(seed, v.shaderUniformBufferArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderSampledImageArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderStorageBufferArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderStorageImageArrayDynamicIndexing);
+    seed = detail::hash_value(seed, v.shaderClipDistance);
+    seed = detail::hash_value(seed, v.shaderCullDistance);
+    seed = detail::hash_value(seed, v.shaderFloat64);
+    seed = detail::hash_value(seed, v.shaderInt64);
+    seed = detail::hash_value(seed, v.shaderInt16);
+    seed = detail::hash_value(seed, v.shaderResourceResidency);
+    seed = detail::hash_value(seed, v.shaderResourceMinLod);
+    seed = detail::hash_value(seed, v.sparseBinding);
+    seed = detail::hash_value(seed, v.sparseResidencyBuffer);
+    seed = detail::hash_value(seed, v.sparseResidencyImage2D);
+    seed = detail::hash_value(seed, v.sparseResidencyImage3D);
+    seed = detail::hash_value(seed, v.sparseResidency2Samples);
+    seed = detail::hash_value(seed, v.sparseResidency4Samples);
+    seed = detail::hash_value(seed, v.sparseResidency8Samples);
+    seed = detail::hash_value(seed, v.sparseResidency16Samples);
+    seed = detail::hash_value(seed, v.sparseResidencyAliased);
+    seed = detail::hash_value(seed, v.variableMultisampleRate);
+    seed = detail::hash_value(seed, v.inheritedQueries);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkPhysicalDeviceFeatures const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkPhysicalDeviceFeatures const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkDeviceQueueCreateInfo> {
+  static const bool bitwise = sizeof(VkDeviceQueueCreateInfo) == (sizeof(VkDeviceQueueCreateInfo::sType) + sizeof(VkDeviceQueueCreateInfo::pNext) + sizeof(VkDeviceQueueCreateInfo::flags) + sizeof(VkDeviceQueueCreateInfo::queueFamilyIndex) + sizeof(VkDeviceQueueCreateInfo::queueCount) + sizeof(VkDeviceQueueCreateInfo::pQueuePriorities));
+  bool operator()(VkDeviceQueueCreateInfo const& a, VkDeviceQueueCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.queueFamilyIndex, b.queueFamilyIndex) &&
+        detail::equal_value(a.queueCount, b.queueCount) &&
+        detail::equal_value(a.pQueuePriorities, b.pQueuePriorities);
+  }
+};
+
+template <> struct hash<VkDeviceQueueCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkDeviceQueueCreateInfo const& v) {
+    if (equal_to<VkDeviceQueueCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.queueFamilyIndex);
+    seed = detail::hash_value(seed, v.queueCount);
+    seed = detail::hash_value(seed, v.pQueuePriorities);
+    return seed;
+  }
+  size_t operator()(VkDeviceQueueCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkDeviceQueueCreateInfo> {
+  static bool members(VkDeviceQueueCreateInfo const& a, VkDeviceQueueCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.queueFamilyIndex, b.queueFamilyIndex) &&
+        detail::equal_value(a.queueCount, b.queueCount) &&
+        detail::equal_range(a.pQueuePriorities, b.pQueuePriorities, a.queueCount);
+  }
+  bool operator()(VkDeviceQueueCreateInfo const& a, VkDeviceQueueCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkDeviceQueueCreateInfo> {
+  static uint64_t members(uint64_t seed, VkDeviceQueueCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.queueFamilyIndex);
+    seed = detail::hash_value(seed, v.queueCount);
+    seed = detail::hash_range(seed, v.pQueuePriorities, v.queueCount);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkDeviceQueueCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkDeviceQueueCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkDeviceCreateInfo> {
+  static const bool bitwise = sizeof(VkDeviceCreateInfo) == (sizeof(VkDeviceCreateInfo::sType) + sizeof(VkDeviceCreateInfo::pNext) + sizeof(VkDeviceCreateInfo::flags) + sizeof(VkDeviceCreateInfo::queueCreateInfoCount) + sizeof(VkDeviceCreateInfo::pQueueCreateInfos) + sizeof(VkDeviceCreateInfo::enabledLayerCount) + sizeof(VkDeviceCreateInfo::ppEnabledLayerNames) + sizeof(VkDeviceCreateInfo::enabledExtensionCount) + sizeof(VkDeviceCreateInfo::ppEnabledExtensionNames) + sizeof(VkDeviceCreateInfo::pEnabledFeatures));
+  bool operator()(VkDeviceCreateInfo const& a, VkDeviceCreateInfo const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.queueCreateInfoCount, b.queueCreateInfoCount) &&
+        detail::equal_value(a.pQueueCreateInfos, b.pQueueCreateInfos) &&
+        detail::equal_value(a.enabledLayerCount, b.enabledLayerCount) &&
+        detail::equal_value(a.ppEnabledLayerNames, b.ppEnabledLayerNames) &&
+        detail::equal_value(a.enabledExtensionCount, b.enabledExtensionCount) &&
+        detail::equal_value(a.ppEnabledExtensionNames, b.ppEnabledExtensionNames) &&
+        detail::equal_value(a.pEnabledFeatures, b.pEnabledFeatures);
+  }
+};
+
+template <> struct hash<VkDeviceCreateInfo> {
+  static uint64_t combine(uint64_t seed, VkDeviceCreateInfo const& v) {
+    if (equal_to<VkDeviceCreateInfo>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.queueCreateInfoCount);
+    seed = detail::hash_value(seed, v.pQueueCreateInfos);
+    seed = detail::hash_value(seed, v.enabledLayerCount);
+    seed = detail::hash_value(seed, v.ppEnabledLayerNames);
+    seed = detail::hash_value(seed, v.enabledExtensionCount);
+    seed = detail::hash_value(seed, v.ppEnabledExtensionNames);
+    seed = detail::hash_value(seed, v.pEnabledFeatures);
+    return seed;
+  }
+  size_t operator()(VkDeviceCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkDeviceCreateInfo> {
+  static bool members(VkDeviceCreateInfo const& a, VkDeviceCreateInfo const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.queueCreateInfoCount, b.queueCreateInfoCount) &&
+        detail::equal_value(a.enabledLayerCount, b.enabledLayerCount) &&
+        detail::equal_value(a.enabledExtensionCount, b.enabledExtensionCount) &&
+        detail::equal_each_range<deep_equal_to<VkDeviceQueueCreateInfo>>(a.pQueueCreateInfos, b.pQueueCreateInfos, a.queueCreateInfoCount) &&
+        detail::equal_strings(a.ppEnabledLayerNames, b.ppEnabledLayerNames, a.enabledLayerCount) &&
+        detail::equal_strings(a.ppEnabledExtensionNames, b.ppEnabledExtensionNames, a.enabledExtensionCount) &&
+        detail::equal_pointee<deep_equal_to<VkPhysicalDeviceFeatures>>(a.pEnabledFeatures, b.pEnabledFeatures);
+  }
+  bool operator()(VkDeviceCreateInfo const& a, VkDeviceCreateInfo const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkDeviceCreateInfo> {
+  static uint64_t members(uint64_t seed, VkDeviceCreateInfo const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.queueCreateInfoCount);
+    seed = detail::combine_range<deep_hash<VkDeviceQueueCreateInfo>>(seed, v.pQueueCreateInfos, v.queueCreateInfoCount);
+    seed = detail::hash_value(seed, v.enabledLayerCount);
+    seed = detail::hash_strings(seed, v.ppEnabledLayerNames, v.enabledLayerCount);
+    seed = detail::hash_value(seed, v.enabledExtensionCount);
+    seed = detail::hash_strings(seed, v.ppEnabledExtensionNames, v.enabledExtensionCount);
+    seed = detail::combine_pointee<deep_hash<VkPhysicalDeviceFeatures>>(seed, v.pEnabledFeatures);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkDeviceCreateInfo const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkDeviceCreateInfo const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkExtent2D> {
+  static const bool bitwise = sizeof(VkExtent2D) == (sizeof(VkExtent2D::width) + sizeof(VkExtent2D::height));
+  bool operator()(VkExtent2D const& a, VkExtent2D const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.width, b.width) &&
+        detail::equal_value(a.height, b.height);
+  }
+};
+
+template <> struct hash<VkExtent2D> {
+  static uint64_t combine(uint64_t seed, VkExtent2D const& v) {
+    if (equal_to<VkExtent2D>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.width);
+    seed = detail::hash_value(seed, v.height);
+    return seed;
+  }
+  size_t operator()(VkExtent2D const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkExtent2D> {
+  static bool members(VkExtent2D const& a, VkExtent2D const& b) {
+    return detail::equal_value(a.width, b.width) &&
+        detail::equal_value(a.height, b.height);
+  }
+  bool operator()(VkExtent2D const& a, VkExtent2D const& b) const {
+    return members(a, b);
+  }
+};
+
+template <> struct deep_hash<VkExtent2D> {
+  static uint64_t members(uint64_t seed, VkExtent2D const& v) {
+    seed = detail::hash_value(seed, v.width);
+    seed = detail::hash_value(seed, v.height);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkExtent2D const& v) {
+    return members(seed, v);
+  }
+  size_t operator()(VkExtent2D const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct equal_to<VkSwapchainCreateInfoKHR> {
+  static const bool bitwise = sizeof(VkSwapchainCreateInfoKHR) == (sizeof(VkSwapchainCreateInfoKHR::sType) + sizeof(VkSwapchainCreateInfoKHR::pNext) + sizeof(VkSwapchainCreateInfoKHR::flags) + sizeof(VkSwapchainCreateInfoKHR::surface) + sizeof(VkSwapchainCreateInfoKHR::minImageCount) + sizeof(VkSwapchainCreateInfoKHR::imageFormat) + sizeof(VkSwapchainCreateInfoKHR::imageColorSpace) + sizeof(VkSwapchainCreateInfoKHR::imageExtent) + sizeof(VkSwapchainCreateInfoKHR::imageArrayLayers) + sizeof(VkSwapchainCreateInfoKHR::imageUsage) + sizeof(VkSwapchainCreateInfoKHR::imageSharingMode) + sizeof(VkSwapchainCreateInfoKHR::queueFamilyIndexCount) + sizeof(VkSwapchainCreateInfoKHR::pQueueFamilyIndices) + sizeof(VkSwapchainCreateInfoKHR::preTransform) + sizeof(VkSwapchainCreateInfoKHR::compositeAlpha) + sizeof(VkSwapchainCreateInfoKHR::presentMode) + sizeof(VkSwapchainCreateInfoKHR::clipped) + sizeof(VkSwapchainCreateInfoKHR::oldSwapchain)) && equal_to<VkExtent2D>::bitwise;
+  bool operator()(VkSwapchainCreateInfoKHR const& a, VkSwapchainCreateInfoKHR const& b) const {
+    if (bitwise) {
+      return std::memcmp(&a, &b, sizeof(a)) == 0;
+    }
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.pNext, b.pNext) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.surface, b.surface) &&
+        detail::equal_value(a.minImageCount, b.minImageCount) &&
+        detail::equal_value(a.imageFormat, b.imageFormat) &&
+        detail::equal_value(a.imageColorSpace, b.imageColorSpace) &&
+        equal_to<VkExtent2D>()(a.imageExtent, b.imageExtent) &&
+        detail::equal_value(a.imageArrayLayers, b.imageArrayLayers) &&
+        detail::equal_value(a.imageUsage, b.imageUsage) &&
+        detail::equal_value(a.imageSharingMode, b.imageSharingMode) &&
+        detail::equal_value(a.queueFamilyIndexCount, b.queueFamilyIndexCount) &&
+        detail::equal_value(a.pQueueFamilyIndices, b.pQueueFamilyIndices) &&
+        detail::equal_value(a.preTransform, b.preTransform) &&
+        detail::equal_value(a.compositeAlpha, b.compositeAlpha) &&
+        detail::equal_value(a.presentMode, b.presentMode) &&
+        detail::equal_value(a.clipped, b.clipped) &&
+        detail::equal_value(a.oldSwapchain, b.oldSwapchain);
+  }
+};
+
+template <> struct hash<VkSwapchainCreateInfoKHR> {
+  static uint64_t combine(uint64_t seed, VkSwapchainCreateInfoKHR const& v) {
+    if (equal_to<VkSwapchainCreateInfoKHR>::bitwise) {
+      return detail::hash_bytes(seed, &v, sizeof(v));
+    }
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.pNext);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.surface);
+    seed = detail::hash_value(seed, v.minImageCount);
+    seed = detail::hash_value(seed, v.imageFormat);
+    seed = detail::hash_value(seed, v.imageColorSpace);
+    seed = hash<VkExtent2D>::combine(seed, v.imageExtent);
+    seed = detail::hash_value(seed, v.imageArrayLayers);
+    seed = detail::hash_value(seed, v.imageUsage);
+    seed = detail::hash_value(seed, v.imageSharingMode);
+    seed = detail::hash_value(seed, v.queueFamilyIndexCount);
+    seed = detail::hash_value(seed, v.pQueueFamilyIndices);
+    seed = detail::hash_value(seed, v.preTransform);
+    seed = detail::hash_value(seed, v.compositeAlpha);
+    seed = detail::hash_value(seed, v.presentMode);
+    seed = detail::hash_value(seed, v.clipped);
+    seed = detail::hash_value(seed, v.oldSwapchain);
+    return seed;
+  }
+  size_t operator()(VkSwapchainCreateInfoKHR const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+template <> struct deep_equal_to<VkSwapchainCreateInfoKHR> {
+  static bool members(VkSwapchainCreateInfoKHR const& a, VkSwapchainCreateInfoKHR const& b) {
+    return detail::equal_value(a.sType, b.sType) &&
+        detail::equal_value(a.flags, b.flags) &&
+        detail::equal_value(a.surface, b.surface) &&
+        detail::equal_value(a.minImageCount, b.minImageCount) &&
+        detail::equal_value(a.imageFormat, b.imageFormat) &&
+        detail::equal_value(a.imageColorSpace, b.imageColorSpace) &&
+        deep_equal_to<VkExtent2D>()(a.imageExtent, b.imageExtent) &&
+        detail::equal_value(a.imageArrayLayers, b.imageArrayLayers) &&
+        detail::equal_value(a.imageUsage, b.imageUsage) &&
+        detail::equal_value(a.imageSharingMode, b.imageSharingMode) &&
+        detail::equal_value(a.queueFamilyIndexCount, b.queueFamilyIndexCount) &&
+        detail::equal_value(a.preTransform, b.preTransform) &&
+        detail::equal_value(a.compositeAlpha, b.compositeAlpha) &&
+        detail::equal_value(a.presentMode, b.presentMode) &&
+        detail::equal_value(a.clipped, b.clipped) &&
+        detail::equal_value(a.oldSwapchain, b.oldSwapchain) &&
+        detail::equal_range(a.pQueueFamilyIndices, b.pQueueFamilyIndices, a.queueFamilyIndexCount);
+  }
+  bool operator()(VkSwapchainCreateInfoKHR const& a, VkSwapchainCreateInfoKHR const& b) const {
+    return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);
+  }
+};
+
+template <> struct deep_hash<VkSwapchainCreateInfoKHR> {
+  static uint64_t members(uint64_t seed, VkSwapchainCreateInfoKHR const& v) {
+    seed = detail::hash_value(seed, v.sType);
+    seed = detail::hash_value(seed, v.flags);
+    seed = detail::hash_value(seed, v.surface);
+    seed = detail::hash_value(seed, v.minImageCount);
+    seed = detail::hash_value(seed, v.imageFormat);
+    seed = detail::hash_value(seed, v.imageColorSpace);
+    seed = deep_hash<VkExtent2D>::combine(seed, v.imageExtent);
+    seed = detail::hash_value(seed, v.imageArrayLayers);
+    seed = detail::hash_value(seed, v.imageUsage);
+    seed = detail::hash_value(seed, v.imageSharingMode);
+    seed = detail::hash_value(seed, v.queueFamilyIndexCount);
+    seed = detail::hash_range(seed, v.pQueueFamilyIndices, v.queueFamilyIndexCount);
+    seed = detail::hash_value(seed, v.preTransform);
+    seed = detail::hash_value(seed, v.compositeAlpha);
+    seed = detail::hash_value(seed, v.presentMode);
+    seed = detail::hash_value(seed, v.clipped);
+    seed = detail::hash_value(seed, v.oldSwapchain);
+    return seed;
+  }
+  static uint64_t combine(uint64_t seed, VkSwapchainCreateInfoKHR const& v) {
+    return detail::deep_hash_next(members(seed, v), v.pNext);
+  }
+  size_t operator()(VkSwapchainCreateInfoKHR const& v) const {
+    return static_cast<size_t>(combine(0, v));
+  }
+};
+
+namespace detail {
+
+inline uint64_t deep_hash_next(uint64_t seed, void const* next) {
+  for (; next; next = static_cast<chain_link const*>(next)->pNext) {
+    VkStructureType s_type = static_cast<chain_link const*>(next)->sType;
+    seed = hash_value(seed, s_type);
+    switch (s_type) {
+    default:
+      break; // Unknown structs contribute only their sType
+    }
+  }
+  return seed;
+}
+
+inline bool deep_equal_next(void const* a, void const* b) {
+  for (; a && b; a = static_cast<chain_link const*>(a)->pNext, b = static_cast<chain_link const*>(b)->pNext) {
+    if (a == b) {
+      return true; // Shared tail
+    }
+    VkStructureType s_type = static_cast<chain_link const*>(a)->sType;
+    if (s_type != static_cast<chain_link const*>(b)->sType) {
+      return false;
+    }
+    switch (s_type) {
+    default:
+      return false; // Unknown structs compare by address
+    }
+  }
+  return a == b;
+}
+
+} // detail
+
+} // vkgen
+
+namespace std {
+
+template <> struct hash<VkApplicationInfo> : public vkgen::hash<VkApplicationInfo> {};
+template <> struct hash<VkInstanceCreateInfo> : public vkgen::hash<VkInstanceCreateInfo> {};
+template <> struct hash<VkAllocationCallbacks> : public vkgen::hash<VkAllocationCallbacks> {};
+template <> struct hash<VkPhysicalDeviceFeatures> : public vkgen::hash<VkPhysicalDeviceFeatures> {};
+template <> struct hash<VkDeviceQueueCreateInfo> : public vkgen::hash<VkDeviceQueueCreateInfo> {};
+template <> struct hash<VkDeviceCreateInfo> : public vkgen::hash<VkDeviceCreateInfo> {};
+template <> struct hash<VkExtent2D> : public vkgen::hash<VkExtent2D> {};
+template <> struct hash<VkSwapchainCreateInfoKHR> : public vkgen::hash<VkSwapchainCreateInfoKHR> {};
+
+} // std
+
+#endif // VK_STRUCT_HASH_INCLUDE
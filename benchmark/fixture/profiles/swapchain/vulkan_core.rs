@@ -0,0 +1,975 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+use super::macros::*;
+extern crate libloading;
+pub use ::std::os::raw::{c_void, c_char, c_int, c_ulong};
+
+pub fn VK_MAKE_VERSION(major: u32, minor: u32, patch: u32) -> u32 {
+    (major << 22) | (minor << 12) | patch
+}
+
+// Common beginning of structs that can be part of a pNext chain, used by
+// builders to link them together.
+#[repr(C)]
+pub struct ChainLink {
+    pub sType: VkStructureType,
+    pub pNext: *mut ChainLink,
+}
+
+pub type VkFlags = u32;
+pub type VkBool32 = u32;
+
+pub type VkInstance = usize;
+pub type VkPhysicalDevice = usize;
+pub type VkDevice = usize;
+
+#[repr(C)]
+pub enum VkResult {
+    VK_SUCCESS = 0,
+    VK_NOT_READY = 1,
+    VK_TIMEOUT = 2,
+    VK_INCOMPLETE = 5,
+    VK_ERROR_OUT_OF_HOST_MEMORY = -1,
+    VK_ERROR_OUT_OF_DEVICE_MEMORY = -2,
+    VK_ERROR_INITIALIZATION_FAILED = -3,
+    VK_ERROR_DEVICE_LOST = -4,
+    VK_ERROR_LAYER_NOT_PRESENT = -6,
+    VK_ERROR_EXTENSION_NOT_PRESENT = -7,
+    VK_ERROR_SURFACE_LOST_KHR = -1000000000,
+}
+
+#[repr(C)]
+pub enum VkStructureType {
+    VK_STRUCTURE_TYPE_APPLICATION_INFO = 0,
+    VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO = 1,
+    VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO = 2,
+    VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO = 3,
+    VK_STRUCTURE_TYPE_SUBMIT_INFO = 4,
+    VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO = 16,
+    VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO = 18,
+    VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO = 19,
+    VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO = 20,
+    VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO = 21,
+    VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO = 22,
+    VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO = 23,
+    VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO = 24,
+    VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO = 25,
+    VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO = 26,
+    VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO = 27,
+    VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO = 28,
+    VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO = 30,
+    VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO = 31,
+    VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO = 32,
+    VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO = 39,
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO = 40,
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO = 41,
+    VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO = 42,
+    VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR = 1000001000,
+    VK_STRUCTURE_TYPE_PRESENT_INFO_KHR = 1000001001,
+}
+
+#[repr(C)]
+pub enum VkFormat {
+    VK_FORMAT_UNDEFINED = 0,
+    VK_FORMAT_R4G4_UNORM_PACK8 = 1,
+    VK_FORMAT_R8G8B8A8_UNORM = 37,
+    VK_FORMAT_B8G8R8A8_UNORM = 44,
+    VK_FORMAT_R32G32B32_SFLOAT = 106,
+}
+
+#[repr(C)]
+pub enum VkSharingMode {
+    VK_SHARING_MODE_EXCLUSIVE = 0,
+    VK_SHARING_MODE_CONCURRENT = 1,
+}
+
+vulkan_flags!(VkInstanceCreateFlags);
+vulkan_flags!(VkDeviceCreateFlags);
+vulkan_flags!(VkDeviceQueueCreateFlags);
+vulkan_flags!(VkImageUsageFlags, VkImageUsageFlagBits, {
+    VK_IMAGE_USAGE_TRANSFER_SRC_BIT = 0x00000001,
+    VK_IMAGE_USAGE_TRANSFER_DST_BIT = 0x00000002,
+    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT = 0x00000010,
+});
+
+pub type PFN_vkAllocationFunction = vk_fun!((pUserData: *mut c_void) -> *mut c_void);
+pub type PFN_vkFreeFunction = vk_fun!((pUserData: *mut c_void) -> ());
+pub type PFN_vkVoidFunction = vk_fun!(() -> ());
+
+#[repr(C)]
+pub struct VkApplicationInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub pApplicationName: *const c_char,
+    pub applicationVersion: u32,
+    pub pEngineName: *const c_char,
+    pub engineVersion: u32,
+    pub apiVersion: u32,
+}
+impl Default for VkApplicationInfo {
+    fn default() -> VkApplicationInfo {
+        VkApplicationInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_APPLICATION_INFO,
+            pNext: ::std::ptr::null(),
+            pApplicationName: ::std::ptr::null(),
+            applicationVersion: Default::default(),
+            pEngineName: ::std::ptr::null(),
+            engineVersion: Default::default(),
+            apiVersion: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkApplicationInfoBuilder<'a> {
+    inner: VkApplicationInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkApplicationInfo {
+    pub fn builder<'a>() -> VkApplicationInfoBuilder<'a> {
+        VkApplicationInfoBuilder { inner: VkApplicationInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkApplicationInfoBuilder<'a> {
+    pub fn pApplicationName(mut self, v: Option<&'a ::std::ffi::CStr>) -> Self {
+        self.inner.pApplicationName = v.map_or(::std::ptr::null(), |s| s.as_ptr());
+        self
+    }
+    pub fn applicationVersion(mut self, v: u32) -> Self {
+        self.inner.applicationVersion = v;
+        self
+    }
+    pub fn pEngineName(mut self, v: Option<&'a ::std::ffi::CStr>) -> Self {
+        self.inner.pEngineName = v.map_or(::std::ptr::null(), |s| s.as_ptr());
+        self
+    }
+    pub fn engineVersion(mut self, v: u32) -> Self {
+        self.inner.engineVersion = v;
+        self
+    }
+    pub fn apiVersion(mut self, v: u32) -> Self {
+        self.inner.apiVersion = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkApplicationInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkApplicationInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkApplicationInfoBuilder<'a> {
+    type Target = VkApplicationInfo;
+    fn deref(&self) -> &VkApplicationInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkApplicationInfo {}
+
+#[repr(C)]
+pub struct VkInstanceCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkInstanceCreateFlags,
+    pub pApplicationInfo: *const VkApplicationInfo,
+    pub enabledLayerCount: u32,
+    pub ppEnabledLayerNames: *const *const c_char,
+    pub enabledExtensionCount: u32,
+    pub ppEnabledExtensionNames: *const *const c_char,
+}
+impl Default for VkInstanceCreateInfo {
+    fn default() -> VkInstanceCreateInfo {
+        VkInstanceCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            pApplicationInfo: ::std::ptr::null(),
+            enabledLayerCount: Default::default(),
+            ppEnabledLayerNames: ::std::ptr::null(),
+            enabledExtensionCount: Default::default(),
+            ppEnabledExtensionNames: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkInstanceCreateInfoBuilder<'a> {
+    inner: VkInstanceCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkInstanceCreateInfo {
+    pub fn builder<'a>() -> VkInstanceCreateInfoBuilder<'a> {
+        VkInstanceCreateInfoBuilder { inner: VkInstanceCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkInstanceCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkInstanceCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pApplicationInfo(mut self, v: Option<&'a VkApplicationInfo>) -> Self {
+        self.inner.pApplicationInfo = v.map_or(::std::ptr::null(), |r| r as *const VkApplicationInfo);
+        self
+    }
+    pub fn ppEnabledLayerNames(mut self, v: &'a [*const c_char]) -> Self {
+        self.inner.enabledLayerCount = v.len() as u32;
+        self.inner.ppEnabledLayerNames = v.as_ptr();
+        self
+    }
+    pub fn ppEnabledExtensionNames(mut self, v: &'a [*const c_char]) -> Self {
+        self.inner.enabledExtensionCount = v.len() as u32;
+        self.inner.ppEnabledExtensionNames = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkInstanceCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkInstanceCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkInstanceCreateInfoBuilder<'a> {
+    type Target = VkInstanceCreateInfo;
+    fn deref(&self) -> &VkInstanceCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkInstanceCreateInfo {}
+
+#[repr(C)]
+pub struct VkAllocationCallbacks {
+    pub pUserData: *mut c_void,
+    pub pfnAllocation: Option<PFN_vkAllocationFunction>,
+    pub pfnFree: Option<PFN_vkFreeFunction>,
+}
+impl Default for VkAllocationCallbacks {
+    fn default() -> VkAllocationCallbacks {
+        VkAllocationCallbacks {
+            pUserData: ::std::ptr::null_mut(),
+            pfnAllocation: None,
+            pfnFree: None,
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkAllocationCallbacksBuilder<'a> {
+    inner: VkAllocationCallbacks,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkAllocationCallbacks {
+    pub fn builder<'a>() -> VkAllocationCallbacksBuilder<'a> {
+        VkAllocationCallbacksBuilder { inner: VkAllocationCallbacks::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkAllocationCallbacksBuilder<'a> {
+    pub fn pUserData(mut self, v: *mut c_void) -> Self {
+        self.inner.pUserData = v;
+        self
+    }
+    pub fn pfnAllocation(mut self, v: Option<PFN_vkAllocationFunction>) -> Self {
+        self.inner.pfnAllocation = v;
+        self
+    }
+    pub fn pfnFree(mut self, v: Option<PFN_vkFreeFunction>) -> Self {
+        self.inner.pfnFree = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkAllocationCallbacks {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkAllocationCallbacksBuilder<'a> {
+    type Target = VkAllocationCallbacks;
+    fn deref(&self) -> &VkAllocationCallbacks {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkPhysicalDeviceFeatures {
+    pub robustBufferAccess: VkBool32,
+    pub fullDrawIndexUint32: VkBool32,
+    pub imageCubeArray: VkBool32,
+    pub independentBlend: VkBool32,
+    pub geometryShader: VkBool32,
+    pub tessellationShader: VkBool32,
+    pub sampleRateShading: VkBool32,
+    pub dualSrcBlend: VkBool32,
+    pub logicOp: VkBool32,
+    pub multiDrawIndirect: VkBool32,
+    pub drawIndirectFirstInstance: VkBool32,
+    pub depthClamp: VkBool32,
+    pub depthBiasClamp: VkBool32,
+    pub fillModeNonSolid: VkBool32,
+    pub depthBounds: VkBool32,
+    pub wideLines: VkBool32,
+    pub largePoints: VkBool32,
+    pub alphaToOne: VkBool32,
+    pub multiViewport: VkBool32,
+    pub samplerAnisotropy: VkBool32,
+    pub textureCompressionETC2: VkBool32,
+    pub textureCompressionASTC_LDR: VkBool32,
+    pub textureCompressionBC: VkBool32,
+    pub occlusionQueryPrecise: VkBool32,
+    pub pipelineStatisticsQuery: VkBool32,
+    pub vertexPipelineStoresAndAtomics: VkBool32,
+    pub fragmentStoresAndAtomics: VkBool32,
+    pub shaderTessellationAndGeometryPointSize: VkBool32,
+    pub shaderImageGatherExtended: VkBool32,
+    pub shaderStorageImageExtendedFormats: VkBool32,
+    pub shaderStorageImageMultisample: VkBool32,
+    pub shaderStorageImageReadWithoutFormat: VkBool32,
+    pub shaderStorageImageWriteWithoutFormat: VkBool32,
+    pub shaderUniformBufferArrayDynamicIndexing: VkBool32,
+    pub shaderSampledImageArrayDynamicIndexing: VkBool32,
+    pub shaderStorageBufferArrayDynamicIndexing: VkBool32,
+    pub shaderStorageImageArrayDynamicIndexing: VkBool32,
+    pub shaderClipDistance: VkBool32,
+    pub shaderCullDistance: VkBool32,
+    pub shaderFloat64: VkBool32,
+    pub shaderInt64: VkBool32,
+    pub shaderInt16: VkBool32,
+    pub shaderResourceResidency: VkBool32,
+    pub shaderResourceMinLod: VkBool32,
+    pub sparseBinding: VkBool32,
+    pub sparseResidencyBuffer: VkBool32,
+    pub sparseResidencyImage2D: VkBool32,
+    pub sparseResidencyImage3D: VkBool32,
+    pub sparseResidency2Samples: VkBool32,
+    pub sparseResidency4Samples: VkBool32,
+    pub sparseResidency8Samples: VkBool32,
+    pub sparseResidency16Samples: VkBool32,
+    pub sparseResidencyAliased: VkBool32,
+    pub variableMultisampleRate: VkBool32,
+    pub inheritedQueries: VkBool32,
+}
+impl Default for VkPhysicalDeviceFeatures {
+    fn default() -> VkPhysicalDeviceFeatures {
+        VkPhysicalDeviceFeatures {
+            robustBufferAccess: Default::default(),
+            fullDrawIndexUint32: Default::default(),
+            imageCubeArray: Default::default(),
+            independentBlend: Default::default(),
+            geometryShader: Default::default(),
+            tessellationShader: Default::default(),
+            sampleRateShading: Default::default(),
+            dualSrcBlend: Default::default(),
+            logicOp: Default::default(),
+            multiDrawIndirect: Default::default(),
+            drawIndirectFirstInstance: Default::default(),
+            depthClamp: Default::default(),
+            depthBiasClamp: Default::default(),
+            fillModeNonSolid: Default::default(),
+            depthBounds: Default::default(),
+            wideLines: Default::default(),
+            largePoints: Default::default(),
+            alphaToOne: Default::default(),
+            multiViewport: Default::default(),
+            samplerAnisotropy: Default::default(),
+            textureCompressionETC2: Default::default(),
+            textureCompressionASTC_LDR: Default::default(),
+            textureCompressionBC: Default::default(),
+            occlusionQueryPrecise: Default::default(),
+            pipelineStatisticsQuery: Default::default(),
+            vertexPipelineStoresAndAtomics: Default::default(),
+            fragmentStoresAndAtomics: Default::default(),
+            shaderTessellationAndGeometryPointSize: Default::default(),
+            shaderImageGatherExtended: Default::default(),
+            shaderStorageImageExtendedFormats: Default::default(),
+            shaderStorageImageMultisample: Default::default(),
+            shaderStorageImageReadWithoutFormat: Default::default(),
+            shaderStorageImageWriteWithoutFormat: Default::default(),
+            shaderUniformBufferArrayDynamicIndexing: Default::default(),
+            shaderSampledImageArrayDynamicIndexing: Default::default(),
+            shaderStorageBufferArrayDynamicIndexing: Default::default(),
+            shaderStorageImageArrayDynamicIndexing: Default::default(),
+            shaderClipDistance: Default::default(),
+            shaderCullDistance: Default::default(),
+            shaderFloat64: Default::default(),
+            shaderInt64: Default::default(),
+            shaderInt16: Default::default(),
+            shaderResourceResidency: Default::default(),
+            shaderResourceMinLod: Default::default(),
+            sparseBinding: Default::default(),
+            sparseResidencyBuffer: Default::default(),
+            sparseResidencyImage2D: Default::default(),
+            sparseResidencyImage3D: Default::default(),
+            sparseResidency2Samples: Default::default(),
+            sparseResidency4Samples: Default::default(),
+            sparseResidency8Samples: Default::default(),
+            sparseResidency16Samples: Default::default(),
+            sparseResidencyAliased: Default::default(),
+            variableMultisampleRate: Default::default(),
+            inheritedQueries: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkPhysicalDeviceFeaturesBuilder<'a> {
+    inner: VkPhysicalDeviceFeatures,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkPhysicalDeviceFeatures {
+    pub fn builder<'a>() -> VkPhysicalDeviceFeaturesBuilder<'a> {
+        VkPhysicalDeviceFeaturesBuilder { inner: VkPhysicalDeviceFeatures::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkPhysicalDeviceFeaturesBuilder<'a> {
+    pub fn robustBufferAccess(mut self, v: VkBool32) -> Self {
+        self.inner.robustBufferAccess = v;
+        self
+    }
+    pub fn fullDrawIndexUint32(mut self, v: VkBool32) -> Self {
+        self.inner.fullDrawIndexUint32 = v;
+        self
+    }
+    pub fn imageCubeArray(mut self, v: VkBool32) -> Self {
+        self.inner.imageCubeArray = v;
+        self
+    }
+    pub fn independentBlend(mut self, v: VkBool32) -> Self {
+        self.inner.independentBlend = v;
+        self
+    }
+    pub fn geometryShader(mut self, v: VkBool32) -> Self {
+        self.inner.geometryShader = v;
+        self
+    }
+    pub fn tessellationShader(mut self, v: VkBool32) -> Self {
+        self.inner.tessellationShader = v;
+        self
+    }
+    pub fn sampleRateShading(mut self, v: VkBool32) -> Self {
+        self.inner.sampleRateShading = v;
+        self
+    }
+    pub fn dualSrcBlend(mut self, v: VkBool32) -> Self {
+        self.inner.dualSrcBlend = v;
+        self
+    }
+    pub fn logicOp(mut self, v: VkBool32) -> Self {
+        self.inner.logicOp = v;
+        self
+    }
+    pub fn multiDrawIndirect(mut self, v: VkBool32) -> Self {
+        self.inner.multiDrawIndirect = v;
+        self
+    }
+    pub fn drawIndirectFirstInstance(mut self, v: VkBool32) -> Self {
+        self.inner.drawIndirectFirstInstance = v;
+        self
+    }
+    pub fn depthClamp(mut self, v: VkBool32) -> Self {
+        self.inner.depthClamp = v;
+        self
+    }
+    pub fn depthBiasClamp(mut self, v: VkBool32) -> Self {
+        self.inner.depthBiasClamp = v;
+        self
+    }
+    pub fn fillModeNonSolid(mut self, v: VkBool32) -> Self {
+        self.inner.fillModeNonSolid = v;
+        self
+    }
+    pub fn depthBounds(mut self, v: VkBool32) -> Self {
+        self.inner.depthBounds = v;
+        self
+    }
+    pub fn wideLines(mut self, v: VkBool32) -> Self {
+        self.inner.wideLines = v;
+        self
+    }
+    pub fn largePoints(mut self, v: VkBool32) -> Self {
+        self.inner.largePoints = v;
+        self
+    }
+    pub fn alphaToOne(mut self, v: VkBool32) -> Self {
+        self.inner.alphaToOne = v;
+        self
+    }
+    pub fn multiViewport(mut self, v: VkBool32) -> Self {
+        self.inner.multiViewport = v;
+        self
+    }
+    pub fn samplerAnisotropy(mut self, v: VkBool32) -> Self {
+        self.inner.samplerAnisotropy = v;
+        self
+    }
+    pub fn textureCompressionETC2(mut self, v: VkBool32) -> Self {
+        self.inner.textureCompressionETC2 = v;
+        self
+    }
+    pub fn textureCompressionASTC_LDR(mut self, v: VkBool32) -> Self {
+        self.inner.textureCompressionASTC_LDR = v;
+        self
+    }
+    pub fn textureCompressionBC(mut self, v: VkBool32) -> Self {
+        self.inner.textureCompressionBC = v;
+        self
+    }
+    pub fn occlusionQueryPrecise(mut self, v: VkBool32) -> Self {
+        self.inner.occlusionQueryPrecise = v;
+        self
+    }
+    pub fn pipelineStatisticsQuery(mut self, v: VkBool32) -> Self {
+        self.inner.pipelineStatisticsQuery = v;
+        self
+    }
+    pub fn vertexPipelineStoresAndAtomics(mut self, v: VkBool32) -> Self {
+        self.inner.vertexPipelineStoresAndAtomics = v;
+        self
+    }
+    pub fn fragmentStoresAndAtomics(mut self, v: VkBool32) -> Self {
+        self.inner.fragmentStoresAndAtomics = v;
+        self
+    }
+    pub fn shaderTessellationAndGeometryPointSize(mut self, v: VkBool32) -> Self {
+        self.inner.shaderTessellationAndGeometryPointSize = v;
+        self
+    }
+    pub fn shaderImageGatherExtended(mut self, v: VkBool32) -> Self {
+        self.inner.shaderImageGatherExtended = v;
+        self
+    }
+    pub fn shaderStorageImageExtendedFormats(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageExtendedFormats = v;
+        self
+    }
+    pub fn shaderStorageImageMultisample(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageMultisample = v;
+        self
+    }
+    pub fn shaderStorageImageReadWithoutFormat(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageReadWithoutFormat = v;
+        self
+    }
+    pub fn shaderStorageImageWriteWithoutFormat(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageWriteWithoutFormat = v;
+        self
+    }
+    pub fn shaderUniformBufferArrayDynamicIndexing(mut self, v: VkBool32) -> Self {
+        self.inner.shaderUniformBufferArrayDynamicIndexing = v;
+        self
+    }
+    pub fn shaderSampledImageArrayDynamicIndexing(mut self, v: VkBool32) -> Self {
+        self.inner.shaderSampledImageArrayDynamicIndexing = v;
+        self
+    }
+    pub fn shaderStorageBufferArrayDynamicIndexing(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageBufferArrayDynamicIndexing = v;
+        self
+    }
+    pub fn shaderStorageImageArrayDynamicIndexing(mut self, v: VkBool32) -> Self {
+        self.inner.shaderStorageImageArrayDynamicIndexing = v;
+        self
+    }
+    pub fn shaderClipDistance(mut self, v: VkBool32) -> Self {
+        self.inner.shaderClipDistance = v;
+        self
+    }
+    pub fn shaderCullDistance(mut self, v: VkBool32) -> Self {
+        self.inner.shaderCullDistance = v;
+        self
+    }
+    pub fn shaderFloat64(mut self, v: VkBool32) -> Self {
+        self.inner.shaderFloat64 = v;
+        self
+    }
+    pub fn shaderInt64(mut self, v: VkBool32) -> Self {
+        self.inner.shaderInt64 = v;
+        self
+    }
+    pub fn shaderInt16(mut self, v: VkBool32) -> Self {
+        self.inner.shaderInt16 = v;
+        self
+    }
+    pub fn shaderResourceResidency(mut self, v: VkBool32) -> Self {
+        self.inner.shaderResourceResidency = v;
+        self
+    }
+    pub fn shaderResourceMinLod(mut self, v: VkBool32) -> Self {
+        self.inner.shaderResourceMinLod = v;
+        self
+    }
+    pub fn sparseBinding(mut self, v: VkBool32) -> Self {
+        self.inner.sparseBinding = v;
+        self
+    }
+    pub fn sparseResidencyBuffer(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidencyBuffer = v;
+        self
+    }
+    pub fn sparseResidencyImage2D(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidencyImage2D = v;
+        self
+    }
+    pub fn sparseResidencyImage3D(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidencyImage3D = v;
+        self
+    }
+    pub fn sparseResidency2Samples(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidency2Samples = v;
+        self
+    }
+    pub fn sparseResidency4Samples(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidency4Samples = v;
+        self
+    }
+    pub fn sparseResidency8Samples(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidency8Samples = v;
+        self
+    }
+    pub fn sparseResidency16Samples(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidency16Samples = v;
+        self
+    }
+    pub fn sparseResidencyAliased(mut self, v: VkBool32) -> Self {
+        self.inner.sparseResidencyAliased = v;
+        self
+    }
+    pub fn variableMultisampleRate(mut self, v: VkBool32) -> Self {
+        self.inner.variableMultisampleRate = v;
+        self
+    }
+    pub fn inheritedQueries(mut self, v: VkBool32) -> Self {
+        self.inner.inheritedQueries = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkPhysicalDeviceFeatures {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkPhysicalDeviceFeaturesBuilder<'a> {
+    type Target = VkPhysicalDeviceFeatures;
+    fn deref(&self) -> &VkPhysicalDeviceFeatures {
+        &self.inner
+    }
+}
+
+#[repr(C)]
+pub struct VkDeviceQueueCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkDeviceQueueCreateFlags,
+    pub queueFamilyIndex: u32,
+    pub queueCount: u32,
+    pub pQueuePriorities: *const f32,
+}
+impl Default for VkDeviceQueueCreateInfo {
+    fn default() -> VkDeviceQueueCreateInfo {
+        VkDeviceQueueCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            queueFamilyIndex: Default::default(),
+            queueCount: Default::default(),
+            pQueuePriorities: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkDeviceQueueCreateInfoBuilder<'a> {
+    inner: VkDeviceQueueCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkDeviceQueueCreateInfo {
+    pub fn builder<'a>() -> VkDeviceQueueCreateInfoBuilder<'a> {
+        VkDeviceQueueCreateInfoBuilder { inner: VkDeviceQueueCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkDeviceQueueCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkDeviceQueueCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn queueFamilyIndex(mut self, v: u32) -> Self {
+        self.inner.queueFamilyIndex = v;
+        self
+    }
+    pub fn pQueuePriorities(mut self, v: &'a [f32]) -> Self {
+        self.inner.queueCount = v.len() as u32;
+        self.inner.pQueuePriorities = v.as_ptr();
+        self
+    }
+    pub fn push_next<T: ExtendsVkDeviceQueueCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkDeviceQueueCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkDeviceQueueCreateInfoBuilder<'a> {
+    type Target = VkDeviceQueueCreateInfo;
+    fn deref(&self) -> &VkDeviceQueueCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkDeviceQueueCreateInfo {}
+
+#[repr(C)]
+pub struct VkDeviceCreateInfo {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkDeviceCreateFlags,
+    pub queueCreateInfoCount: u32,
+    pub pQueueCreateInfos: *const VkDeviceQueueCreateInfo,
+    pub enabledLayerCount: u32,
+    pub ppEnabledLayerNames: *const *const c_char,
+    pub enabledExtensionCount: u32,
+    pub ppEnabledExtensionNames: *const *const c_char,
+    pub pEnabledFeatures: *const VkPhysicalDeviceFeatures,
+}
+impl Default for VkDeviceCreateInfo {
+    fn default() -> VkDeviceCreateInfo {
+        VkDeviceCreateInfo {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            queueCreateInfoCount: Default::default(),
+            pQueueCreateInfos: ::std::ptr::null(),
+            enabledLayerCount: Default::default(),
+            ppEnabledLayerNames: ::std::ptr::null(),
+            enabledExtensionCount: Default::default(),
+            ppEnabledExtensionNames: ::std::ptr::null(),
+            pEnabledFeatures: ::std::ptr::null(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkDeviceCreateInfoBuilder<'a> {
+    inner: VkDeviceCreateInfo,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkDeviceCreateInfo {
+    pub fn builder<'a>() -> VkDeviceCreateInfoBuilder<'a> {
+        VkDeviceCreateInfoBuilder { inner: VkDeviceCreateInfo::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkDeviceCreateInfoBuilder<'a> {
+    pub fn flags(mut self, v: VkDeviceCreateFlags) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn pQueueCreateInfos(mut self, v: &'a [VkDeviceQueueCreateInfo]) -> Self {
+        self.inner.queueCreateInfoCount = v.len() as u32;
+        self.inner.pQueueCreateInfos = v.as_ptr();
+        self
+    }
+    pub fn ppEnabledLayerNames(mut self, v: &'a [*const c_char]) -> Self {
+        self.inner.enabledLayerCount = v.len() as u32;
+        self.inner.ppEnabledLayerNames = v.as_ptr();
+        self
+    }
+    pub fn ppEnabledExtensionNames(mut self, v: &'a [*const c_char]) -> Self {
+        self.inner.enabledExtensionCount = v.len() as u32;
+        self.inner.ppEnabledExtensionNames = v.as_ptr();
+        self
+    }
+    pub fn pEnabledFeatures(mut self, v: Option<&'a VkPhysicalDeviceFeatures>) -> Self {
+        self.inner.pEnabledFeatures = v.map_or(::std::ptr::null(), |r| r as *const VkPhysicalDeviceFeatures);
+        self
+    }
+    pub fn push_next<T: ExtendsVkDeviceCreateInfo>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkDeviceCreateInfo {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkDeviceCreateInfoBuilder<'a> {
+    type Target = VkDeviceCreateInfo;
+    fn deref(&self) -> &VkDeviceCreateInfo {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkDeviceCreateInfo {}
+
+#[repr(C)]
+pub struct VkExtent2D {
+    pub width: u32,
+    pub height: u32,
+}
+impl Default for VkExtent2D {
+    fn default() -> VkExtent2D {
+        VkExtent2D {
+            width: Default::default(),
+            height: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkExtent2DBuilder<'a> {
+    inner: VkExtent2D,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkExtent2D {
+    pub fn builder<'a>() -> VkExtent2DBuilder<'a> {
+        VkExtent2DBuilder { inner: VkExtent2D::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkExtent2DBuilder<'a> {
+    pub fn width(mut self, v: u32) -> Self {
+        self.inner.width = v;
+        self
+    }
+    pub fn height(mut self, v: u32) -> Self {
+        self.inner.height = v;
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkExtent2D {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkExtent2DBuilder<'a> {
+    type Target = VkExtent2D;
+    fn deref(&self) -> &VkExtent2D {
+        &self.inner
+    }
+}
+
+/*
+ * ------------------------------------------------------------------------
+ * Entry dispatch table. Represents the Vulkan entry point that can be used
+ * to get other Vulkan functions. Holds the library handle so that it does
+ * not get unloaded. This is very similar to the macros used for generating
+ * global-, instance-, and dispatch tables, except explicit since the entry
+ * is just a single function.
+ * ------------------------------------------------------------------------
+*/
+type PFN_vkGetInstanceProcAddr = vk_fun!((instance: VkInstance, pName: *const c_char) -> Option<PFN_vkVoidFunction>);
+pub struct VulkanEntry {
+    #[allow(dead_code)]
+    vulkan_lib: libloading::Library,
+    vkGetInstanceProcAddr: PFN_vkGetInstanceProcAddr,
+}
+
+impl VulkanEntry {
+    pub fn new(loader_path: &str) -> Result<VulkanEntry, String> {
+        let lib = match libloading::Library::new(loader_path) {
+            Ok(lib) => lib,
+            Err(_) => return Err(String::from("Failed to open Vulkan loader")),
+        };
+
+        let vkGetInstanceProcAddr: PFN_vkGetInstanceProcAddr = unsafe {
+            match lib.get::<PFN_vkGetInstanceProcAddr>(b"vkGetInstanceProcAddr\0") {
+                Ok(symbol) => *symbol, // Deref Symbol, not function pointer
+                Err(_) => return Err(String::from("Could not load vkGetInstanceProcAddr")),
+            }
+        };
+
+        // Since I can't keep the library and the loaded function in the
+        // same struct (Rust would then not be able to drop it because of
+        // the symbol references into itself via the library) I have opted
+        // to just storing the raw loaded function. This should be fine as
+        // long as the library is also saved to prevent unloading it. Since
+        // I return a Result, Rust makes sure that the struct can only be
+        // used if properly initialized.
+        Ok(VulkanEntry {
+            vulkan_lib: lib, // Save this so that the library is not freed
+            vkGetInstanceProcAddr: vkGetInstanceProcAddr,
+        })
+    }
+
+    #[inline]
+    pub unsafe fn vkGetInstanceProcAddr(&self, instance: VkInstance, pName: *const c_char) -> Option<PFN_vkVoidFunction> {
+        (self.vkGetInstanceProcAddr)(instance, pName)
+    }
+}
+
+global_dispatch_table!{
+    vkCreateInstance => (pCreateInfo: *const VkInstanceCreateInfo, pAllocator: *const VkAllocationCallbacks, pInstance: *mut VkInstance) -> VkResult,
+}
+
+instance_dispatch_table!{
+    vkDestroyInstance => (instance: VkInstance, pAllocator: *const VkAllocationCallbacks) -> (),
+    vkEnumeratePhysicalDevices => (instance: VkInstance, pPhysicalDeviceCount: *mut u32, pPhysicalDevices: *mut VkPhysicalDevice) -> VkResult,
+    vkGetDeviceProcAddr => (device: VkDevice, pName: *const c_char) -> Option<PFN_vkVoidFunction>,
+    vkCreateDevice => (physicalDevice: VkPhysicalDevice, pCreateInfo: *const VkDeviceCreateInfo, pAllocator: *const VkAllocationCallbacks, pDevice: *mut VkDevice) -> VkResult,
+}
+
+impl InstanceDispatchTable {
+    pub unsafe fn vkEnumeratePhysicalDevices_into(&self, instance: VkInstance, out: &mut Vec<VkPhysicalDevice>) -> VkResult {
+        out.clear();
+        loop {
+            let mut count = out.capacity() as u32;
+            if count > 0 {
+                match self.vkEnumeratePhysicalDevices(instance, &mut count, out.as_mut_ptr()) {
+                    VkResult::VK_SUCCESS => {
+                        out.set_len(count as usize);
+                        return VkResult::VK_SUCCESS;
+                    },
+                    VkResult::VK_INCOMPLETE => {},
+                    other => return other,
+                }
+            }
+            match self.vkEnumeratePhysicalDevices(instance, &mut count, ::std::ptr::null_mut()) {
+                VkResult::VK_SUCCESS => {},
+                other => return other,
+            }
+            if count == 0 {
+                return VkResult::VK_SUCCESS;
+            }
+            out.reserve(count as usize);
+        }
+    }
+}
+
+device_dispatch_table!{
+    vkDestroyDevice => (device: VkDevice, pAllocator: *const VkAllocationCallbacks) -> (),
+}
@@ -0,0 +1,187 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Layout checks for the Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#include <stddef.h>
+#include <stdio.h>
+#include "vulkan_include.inl"
+
+#define ALIGNOF(T) offsetof(struct { char c; T t; }, t)
+#define CHECK_TYPE(T) fprintf(out, "%sconst _: () = assert!(size_of::<" #T ">() == %lu && align_of::<" #T ">() == %lu);\n", cfg, (unsigned long)sizeof(T), (unsigned long)ALIGNOF(T))
+#define CHECK_MEMBER(T, M, RUST_M) fprintf(out, "%sconst _: () = assert!(offset_of!(" #T ", " RUST_M ") == %lu);\n", cfg, (unsigned long)offsetof(T, M))
+
+int main(int argc, char** argv) {
+  FILE* out = (argc > 1) ? fopen(argv[1], "w") : stdout;
+  char const* cfg = ""; /* Attribute making the check conditional like the struct */
+  if (!out) {
+    fprintf(stderr, "Failed to open %s for output\n", argv[1]);
+    return 1;
+  }
+
+  fprintf(out, "// Layout assertions for the Rust bindings for Vulkan 1.0.57, printed by vulkan_layout.c.\n");
+  fprintf(out, "\n");
+  fprintf(out, "#![allow(unused_imports)]\n");
+  fprintf(out, "\n");
+  fprintf(out, "use super::core::*;\n");
+  fprintf(out, "use super::extensions::*;\n");
+  fprintf(out, "use std::mem::{align_of, offset_of, size_of};\n");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkApplicationInfo);
+  CHECK_MEMBER(VkApplicationInfo, sType, "sType");
+  CHECK_MEMBER(VkApplicationInfo, pNext, "pNext");
+  CHECK_MEMBER(VkApplicationInfo, pApplicationName, "pApplicationName");
+  CHECK_MEMBER(VkApplicationInfo, applicationVersion, "applicationVersion");
+  CHECK_MEMBER(VkApplicationInfo, pEngineName, "pEngineName");
+  CHECK_MEMBER(VkApplicationInfo, engineVersion, "engineVersion");
+  CHECK_MEMBER(VkApplicationInfo, apiVersion, "apiVersion");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkInstanceCreateInfo);
+  CHECK_MEMBER(VkInstanceCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkInstanceCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkInstanceCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkInstanceCreateInfo, pApplicationInfo, "pApplicationInfo");
+  CHECK_MEMBER(VkInstanceCreateInfo, enabledLayerCount, "enabledLayerCount");
+  CHECK_MEMBER(VkInstanceCreateInfo, ppEnabledLayerNames, "ppEnabledLayerNames");
+  CHECK_MEMBER(VkInstanceCreateInfo, enabledExtensionCount, "enabledExtensionCount");
+  CHECK_MEMBER(VkInstanceCreateInfo, ppEnabledExtensionNames, "ppEnabledExtensionNames");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkAllocationCallbacks);
+  CHECK_MEMBER(VkAllocationCallbacks, pUserData, "pUserData");
+  CHECK_MEMBER(VkAllocationCallbacks, pfnAllocation, "pfnAllocation");
+  CHECK_MEMBER(VkAllocationCallbacks, pfnFree, "pfnFree");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkPhysicalDeviceFeatures);
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, robustBufferAccess, "robustBufferAccess");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, fullDrawIndexUint32, "fullDrawIndexUint32");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, imageCubeArray, "imageCubeArray");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, independentBlend, "independentBlend");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, geometryShader, "geometryShader");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, tessellationShader, "tessellationShader");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sampleRateShading, "sampleRateShading");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, dualSrcBlend, "dualSrcBlend");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, logicOp, "logicOp");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, multiDrawIndirect, "multiDrawIndirect");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, drawIndirectFirstInstance, "drawIndirectFirstInstance");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, depthClamp, "depthClamp");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, depthBiasClamp, "depthBiasClamp");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, fillModeNonSolid, "fillModeNonSolid");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, depthBounds, "depthBounds");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, wideLines, "wideLines");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, largePoints, "largePoints");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, alphaToOne, "alphaToOne");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, multiViewport, "multiViewport");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, samplerAnisotropy, "samplerAnisotropy");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, textureCompressionETC2, "textureCompressionETC2");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, textureCompressionASTC_LDR, "textureCompressionASTC_LDR");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, textureCompressionBC, "textureCompressionBC");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, occlusionQueryPrecise, "occlusionQueryPrecise");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, pipelineStatisticsQuery, "pipelineStatisticsQuery");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, vertexPipelineStoresAndAtomics, "vertexPipelineStoresAndAtomics");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, fragmentStoresAndAtomics, "fragmentStoresAndAtomics");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderTessellationAndGeometryPointSize, "shaderTessellationAndGeometryPointSize");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderImageGatherExtended, "shaderImageGatherExtended");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageExtendedFormats, "shaderStorageImageExtendedFormats");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageMultisample, "shaderStorageImageMultisample");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageReadWithoutFormat, "shaderStorageImageReadWithoutFormat");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageWriteWithoutFormat, "shaderStorageImageWriteWithoutFormat");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderUniformBufferArrayDynamicIndexing, "shaderUniformBufferArrayDynamicIndexing");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderSampledImageArrayDynamicIndexing, "shaderSampledImageArrayDynamicIndexing");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageBufferArrayDynamicIndexing, "shaderStorageBufferArrayDynamicIndexing");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderStorageImageArrayDynamicIndexing, "shaderStorageImageArrayDynamicIndexing");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderClipDistance, "shaderClipDistance");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderCullDistance, "shaderCullDistance");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderFloat64, "shaderFloat64");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderInt64, "shaderInt64");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderInt16, "shaderInt16");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderResourceResidency, "shaderResourceResidency");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, shaderResourceMinLod, "shaderResourceMinLod");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseBinding, "sparseBinding");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidencyBuffer, "sparseResidencyBuffer");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidencyImage2D, "sparseResidencyImage2D");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidencyImage3D, "sparseResidencyImage3D");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidency2Samples, "sparseResidency2Samples");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidency4Samples, "sparseResidency4Samples");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidency8Samples, "sparseResidency8Samples");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidency16Samples, "sparseResidency16Samples");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, sparseResidencyAliased, "sparseResidencyAliased");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, variableMultisampleRate, "variableMultisampleRate");
+  CHECK_MEMBER(VkPhysicalDeviceFeatures, inheritedQueries, "inheritedQueries");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkDeviceQueueCreateInfo);
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, queueFamilyIndex, "queueFamilyIndex");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, queueCount, "queueCount");
+  CHECK_MEMBER(VkDeviceQueueCreateInfo, pQueuePriorities, "pQueuePriorities");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkDeviceCreateInfo);
+  CHECK_MEMBER(VkDeviceCreateInfo, sType, "sType");
+  CHECK_MEMBER(VkDeviceCreateInfo, pNext, "pNext");
+  CHECK_MEMBER(VkDeviceCreateInfo, flags, "flags");
+  CHECK_MEMBER(VkDeviceCreateInfo, queueCreateInfoCount, "queueCreateInfoCount");
+  CHECK_MEMBER(VkDeviceCreateInfo, pQueueCreateInfos, "pQueueCreateInfos");
+  CHECK_MEMBER(VkDeviceCreateInfo, enabledLayerCount, "enabledLayerCount");
+  CHECK_MEMBER(VkDeviceCreateInfo, ppEnabledLayerNames, "ppEnabledLayerNames");
+  CHECK_MEMBER(VkDeviceCreateInfo, enabledExtensionCount, "enabledExtensionCount");
+  CHECK_MEMBER(VkDeviceCreateInfo, ppEnabledExtensionNames, "ppEnabledExtensionNames");
+  CHECK_MEMBER(VkDeviceCreateInfo, pEnabledFeatures, "pEnabledFeatures");
+
+  fprintf(out, "\n");
+  cfg = "";
+  CHECK_TYPE(VkExtent2D);
+  CHECK_MEMBER(VkExtent2D, width, "width");
+  CHECK_MEMBER(VkExtent2D, height, "height");
+
+  fprintf(out, "\n");
+  cfg = "#[cfg(feature = \"VK_KHR_swapchain\")] ";
+  CHECK_TYPE(VkSwapchainCreateInfoKHR);
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, sType, "sType");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, pNext, "pNext");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, flags, "flags");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, surface, "surface");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, minImageCount, "minImageCount");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageFormat, "imageFormat");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageColorSpace, "imageColorSpace");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageExtent, "imageExtent");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageArrayLayers, "imageArrayLayers");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageUsage, "imageUsage");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, imageSharingMode, "imageSharingMode");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, queueFamilyIndexCount, "queueFamilyIndexCount");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, pQueueFamilyIndices, "pQueueFamilyIndices");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, preTransform, "preTransform");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, compositeAlpha, "compositeAlpha");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, presentMode, "presentMode");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, clipped, "clipped");
+  CHECK_MEMBER(VkSwapchainCreateInfoKHR, oldSwapchain, "oldSwapchain");
+
+  if (out != stdout) {
+    fclose(out);
+  }
+  return 0;
+}
@@ -0,0 +1,185 @@
+// Copyright (c) 2015-2017 The Khronos Group Inc.
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// 
+//     http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Rust bindings for Vulkan 1.0.57, generated from the Khronos Vulkan API XML Registry.
+// See https://github.com/andens/Vulkan-Hpp for generator details.
+
+#![allow(unused_imports)]
+
+use super::super::macros::*;
+use super::super::core::*;
+use super::*;
+
+/*
+ * ------------------------------------------------------
+ * VK_KHR_swapchain
+ * ------------------------------------------------------
+*/
+
+pub type VkSwapchainKHR = u64;
+
+#[repr(C)]
+pub enum VkPresentModeKHR {
+    VK_PRESENT_MODE_IMMEDIATE_KHR = 0,
+    VK_PRESENT_MODE_MAILBOX_KHR = 1,
+    VK_PRESENT_MODE_FIFO_KHR = 2,
+}
+
+vulkan_flags!(VkSwapchainCreateFlagsKHR);
+
+#[repr(C)]
+pub struct VkSwapchainCreateInfoKHR {
+    pub sType: VkStructureType,
+    pub pNext: *const c_void,
+    pub flags: VkSwapchainCreateFlagsKHR,
+    pub surface: VkSurfaceKHR,
+    pub minImageCount: u32,
+    pub imageFormat: VkFormat,
+    pub imageColorSpace: VkColorSpaceKHR,
+    pub imageExtent: VkExtent2D,
+    pub imageArrayLayers: u32,
+    pub imageUsage: VkImageUsageFlags,
+    pub imageSharingMode: VkSharingMode,
+    pub queueFamilyIndexCount: u32,
+    pub pQueueFamilyIndices: *const u32,
+    pub preTransform: VkSurfaceTransformFlagBitsKHR,
+    pub compositeAlpha: VkCompositeAlphaFlagBitsKHR,
+    pub presentMode: VkPresentModeKHR,
+    pub clipped: VkBool32,
+    pub oldSwapchain: VkSwapchainKHR,
+}
+impl Default for VkSwapchainCreateInfoKHR {
+    fn default() -> VkSwapchainCreateInfoKHR {
+        VkSwapchainCreateInfoKHR {
+            sType: VkStructureType::VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+            pNext: ::std::ptr::null(),
+            flags: Default::default(),
+            surface: Default::default(),
+            minImageCount: Default::default(),
+            imageFormat: VkFormat::VK_FORMAT_UNDEFINED,
+            imageColorSpace: VkColorSpaceKHR::VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+            imageExtent: Default::default(),
+            imageArrayLayers: Default::default(),
+            imageUsage: Default::default(),
+            imageSharingMode: VkSharingMode::VK_SHARING_MODE_EXCLUSIVE,
+            queueFamilyIndexCount: Default::default(),
+            pQueueFamilyIndices: ::std::ptr::null(),
+            preTransform: VkSurfaceTransformFlagBitsKHR::VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR,
+            compositeAlpha: VkCompositeAlphaFlagBitsKHR::VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+            presentMode: VkPresentModeKHR::VK_PRESENT_MODE_IMMEDIATE_KHR,
+            clipped: Default::default(),
+            oldSwapchain: Default::default(),
+        }
+    }
+}
+#[repr(transparent)]
+pub struct VkSwapchainCreateInfoKHRBuilder<'a> {
+    inner: VkSwapchainCreateInfoKHR,
+    marker: ::std::marker::PhantomData<&'a ()>,
+}
+impl VkSwapchainCreateInfoKHR {
+    pub fn builder<'a>() -> VkSwapchainCreateInfoKHRBuilder<'a> {
+        VkSwapchainCreateInfoKHRBuilder { inner: VkSwapchainCreateInfoKHR::default(), marker: ::std::marker::PhantomData }
+    }
+}
+impl<'a> VkSwapchainCreateInfoKHRBuilder<'a> {
+    pub fn flags(mut self, v: VkSwapchainCreateFlagsKHR) -> Self {
+        self.inner.flags = v;
+        self
+    }
+    pub fn surface(mut self, v: VkSurfaceKHR) -> Self {
+        self.inner.surface = v;
+        self
+    }
+    pub fn minImageCount(mut self, v: u32) -> Self {
+        self.inner.minImageCount = v;
+        self
+    }
+    pub fn imageFormat(mut self, v: VkFormat) -> Self {
+        self.inner.imageFormat = v;
+        self
+    }
+    pub fn imageColorSpace(mut self, v: VkColorSpaceKHR) -> Self {
+        self.inner.imageColorSpace = v;
+        self
+    }
+    pub fn imageExtent(mut self, v: VkExtent2D) -> Self {
+        self.inner.imageExtent = v;
+        self
+    }
+    pub fn imageArrayLayers(mut self, v: u32) -> Self {
+        self.inner.imageArrayLayers = v;
+        self
+    }
+    pub fn imageUsage(mut self, v: VkImageUsageFlags) -> Self {
+        self.inner.imageUsage = v;
+        self
+    }
+    pub fn imageSharingMode(mut self, v: VkSharingMode) -> Self {
+        self.inner.imageSharingMode = v;
+        self
+    }
+    pub fn pQueueFamilyIndices(mut self, v: &'a [u32]) -> Self {
+        self.inner.queueFamilyIndexCount = v.len() as u32;
+        self.inner.pQueueFamilyIndices = v.as_ptr();
+        self
+    }
+    pub fn preTransform(mut self, v: VkSurfaceTransformFlagBitsKHR) -> Self {
+        self.inner.preTransform = v;
+        self
+    }
+    pub fn compositeAlpha(mut self, v: VkCompositeAlphaFlagBitsKHR) -> Self {
+        self.inner.compositeAlpha = v;
+        self
+    }
+    pub fn presentMode(mut self, v: VkPresentModeKHR) -> Self {
+        self.inner.presentMode = v;
+        self
+    }
+    pub fn clipped(mut self, v: VkBool32) -> Self {
+        self.inner.clipped = v;
+        self
+    }
+    pub fn oldSwapchain(mut self, v: VkSwapchainKHR) -> Self {
+        self.inner.oldSwapchain = v;
+        self
+    }
+    pub fn push_next<T: ExtendsVkSwapchainCreateInfoKHR>(mut self, next: &'a mut T) -> Self {
+        unsafe {
+            let next = next as *mut T as *mut ChainLink;
+            let mut last = next;
+            while !(*last).pNext.is_null() {
+                last = (*last).pNext;
+            }
+            (*last).pNext = self.inner.pNext as *mut ChainLink;
+            self.inner.pNext = next as _;
+        }
+        self
+    }
+    // Gives up the borrow; the caller must keep referenced data alive.
+    pub fn build(self) -> VkSwapchainCreateInfoKHR {
+        self.inner
+    }
+}
+impl<'a> ::std::ops::Deref for VkSwapchainCreateInfoKHRBuilder<'a> {
+    type Target = VkSwapchainCreateInfoKHR;
+    fn deref(&self) -> &VkSwapchainCreateInfoKHR {
+        &self.inner
+    }
+}
+pub unsafe trait ExtendsVkSwapchainCreateInfoKHR {}
+
+extension_dispatch_table!{VK_KHR_swapchain | device, {
+    [device] vkCreateSwapchainKHR => (device: VkDevice, pCreateInfo: *const VkSwapchainCreateInfoKHR, pAllocator: *const VkAllocationCallbacks, pSwapchain: *mut VkSwapchainKHR) -> VkResult,
+}}
@@ -0,0 +1,73 @@
+# Runs the generator on synthetic registries of increasing size and collects
+# the --stats report of each run. Invoked by the benchmark target with
+# SYNTHESIZE (the synthesize_registry tool), GENERATOR, WORK_DIR, SCALES (a
+# list of registry sizes relative to Vulkan 1.0) and CONFIG (the build type of
+# the generator) defined.
+
+if(NOT CONFIG MATCHES "^(Release|RelWithDebInfo|MinSizeRel)$")
+  message(WARNING "Benchmarking a ${CONFIG} build of the generator. Configure with CMAKE_BUILD_TYPE=Release for representative timings.")
+endif()
+
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# The generator waits for input after an error, so it reads from an empty file
+file(WRITE ${WORK_DIR}/no_input "")
+
+foreach(scale ${SCALES})
+  set(registry ${WORK_DIR}/vk_synthetic_${scale}x.xml)
+  set(out_dir ${WORK_DIR}/out_${scale}x)
+  set(stats ${WORK_DIR}/stats_${scale}x.json)
+  file(MAKE_DIRECTORY ${out_dir})
+
+  execute_process(COMMAND ${SYNTHESIZE} --scale=${scale} ${registry} RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Failed to synthesize the ${scale}x registry")
+  endif()
+
+  execute_process(COMMAND ${GENERATOR} ${registry} --out=${out_dir} --stats=${stats}
+    INPUT_FILE ${WORK_DIR}/no_input
+    RESULT_VARIABLE result
+  )
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "The generator failed on the ${scale}x registry")
+  endif()
+endforeach()
+
+# Wall time of every phase side by side, to see how each of them scales
+if(CMAKE_VERSION VERSION_LESS 3.19)
+  message(STATUS "Reports written to ${WORK_DIR}/stats_<scale>x.json")
+  return()
+endif()
+
+set(header "phase")
+foreach(scale ${SCALES})
+  file(READ ${WORK_DIR}/stats_${scale}x.json json_${scale})
+  string(APPEND header "\t${scale}x ms")
+endforeach()
+message("")
+message("${header}")
+
+list(GET SCALES 0 first_scale)
+string(JSON phase_count LENGTH "${json_${first_scale}}" phases)
+math(EXPR last_phase "${phase_count} - 1")
+foreach(i RANGE ${last_phase})
+  string(JSON name GET "${json_${first_scale}}" phases ${i} name)
+  set(line "${name}")
+  foreach(scale ${SCALES})
+    # Generators may start in any order, so phases are matched by name
+    set(wall "-")
+    string(JSON count LENGTH "${json_${scale}}" phases)
+    math(EXPR last "${count} - 1")
+    foreach(j RANGE ${last})
+      string(JSON other GET "${json_${scale}}" phases ${j} name)
+      if(other STREQUAL name)
+        string(JSON wall GET "${json_${scale}}" phases ${j} wall_ms)
+        string(REGEX REPLACE "^([0-9]+)(\\.[0-9])?.*$" "\\1\\2" wall "${wall}")
+      endif()
+    endforeach()
+    string(APPEND line "\t${wall}")
+  endforeach()
+  message("${line}")
+endforeach()
+message("")
+message(STATUS "Reports written to ${WORK_DIR}/stats_<scale>x.json")
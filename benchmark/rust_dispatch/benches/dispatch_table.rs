@@ -0,0 +1,31 @@
+// Times DeviceDispatchTable::new, which resolves every device command through
+// vkGetDeviceProcAddr, against LazyDeviceDispatchTable::new, which resolves
+// none of them up front. The stub answers every lookup with the same function,
+// so the time is spent passing names to the loader and filling the table.
+
+#[macro_use]
+extern crate criterion;
+extern crate vkgen_dispatch_bench;
+
+use criterion::{black_box, Criterion};
+use vkgen_dispatch_bench::vulkan::core::*;
+
+// The stub accepts any handle
+const INSTANCE: VkInstance = 1;
+const DEVICE: VkDevice = 1;
+
+fn dispatch_table(c: &mut Criterion) {
+    let stub = ::std::env::var("VKGEN_STUB_LIBRARY").expect("VKGEN_STUB_LIBRARY must name the stub Vulkan library");
+    let vulkan_entry = VulkanEntry::new(&stub).unwrap();
+    let instance_table = InstanceDispatchTable::new(&vulkan_entry, INSTANCE).unwrap();
+
+    c.bench_function("DeviceDispatchTable::new", |b| {
+        b.iter(|| DeviceDispatchTable::new(&instance_table, black_box(DEVICE)).unwrap())
+    });
+    c.bench_function("LazyDeviceDispatchTable::new", |b| {
+        b.iter(|| LazyDeviceDispatchTable::new(&instance_table, black_box(DEVICE)))
+    });
+}
+
+criterion_group!(benches, dispatch_table);
+criterion_main!(benches);
@@ -0,0 +1,18 @@
+// Points src/lib.rs at the bindings the generator wrote to VKGEN_RUST_DIR.
+// Modules declared in vulkan.rs are found next to it.
+
+use std::env;
+use std::fs;
+use std::path::Path;
+
+fn main() {
+    println!("cargo:rerun-if-env-changed=VKGEN_RUST_DIR");
+    let dir = env::var("VKGEN_RUST_DIR").expect("VKGEN_RUST_DIR must name the directory holding the generated vulkan.rs");
+    let vulkan = Path::new(&dir).join("vulkan.rs");
+    if !vulkan.exists() {
+        panic!("{} does not exist", vulkan.display());
+    }
+
+    let bindings = Path::new(&env::var("OUT_DIR").unwrap()).join("bindings.rs");
+    fs::write(&bindings, format!("#[path = {:?}]\npub mod vulkan;\n", vulkan)).unwrap();
+}
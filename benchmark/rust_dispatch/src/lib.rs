@@ -0,0 +1,4 @@
+// The generated bindings, compiled without extension features since the
+// benchmark only uses the core dispatch tables.
+
+include!(concat!(env!("OUT_DIR"), "/bindings.rs"));
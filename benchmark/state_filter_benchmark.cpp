@@ -0,0 +1,155 @@
+// Records the draws of a frame directly through CommandBufferFunctions and
+// through a vkgen::StateFilter on the stub Vulkan implementation, and prints
+// the time per draw of both along with the calls the filter dropped. Every
+// draw sets all of the state it needs, as a renderer without redundancy
+// checks of its own does, and draws are sorted by pipeline, material and
+// mesh so that consecutive draws share most of it.
+//
+// usage: StateFilterBenchmark <stub library>
+
+#include "vk_state_filter.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace vkgen;
+
+namespace {
+
+int const draws_per_frame = 10000;
+int const frames = 100;
+int const pipelines = 8;
+int const materials = 64;
+int const meshes = 256;
+
+// The stub accepts any handle
+template <typename T>
+T handle(uint64_t value) {
+  return (T)(uintptr_t)value;
+}
+
+// Dispatch tables are created from handles of objects the application
+// created, which the stub does not
+struct Instance : InstanceFunctions {
+  explicit Instance(GlobalFunctions* globals) : InstanceFunctions(handle<VkInstance>(1), globals) {}
+};
+
+struct Device : DeviceFunctions {
+  explicit Device(Instance* instance) : DeviceFunctions(handle<VkDevice>(1), instance) {}
+};
+
+struct CommandBuffer : CommandBufferFunctions {
+  explicit CommandBuffer(Device* device) : CommandBufferFunctions(handle<VkCommandBuffer>(1), device) {}
+};
+
+struct Draw {
+  int pipeline;
+  int material;
+  int mesh;
+};
+
+// Draws in the order a render queue sorted by state would issue them
+std::vector<Draw> sorted_draws() {
+  std::vector<Draw> draws;
+  for (int i = 0; i < draws_per_frame; ++i) {
+    Draw d;
+    d.pipeline = i * pipelines / draws_per_frame;
+    d.material = i * materials / draws_per_frame;
+    d.mesh = i * meshes / draws_per_frame;
+    draws.push_back(d);
+  }
+  return draws;
+}
+
+// Called with CommandBufferFunctions and StateFilter, which have the same
+// recording members
+template <typename Recorder>
+void record_frame(Recorder& recorder, std::vector<Draw> const& draws) {
+  VkCommandBufferBeginInfo begin_info = {};
+  begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+  recorder.vkBeginCommandBuffer(&begin_info);
+
+  VkViewport viewport = { 0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f };
+  VkRect2D scissor = { { 0, 0 }, { 1920, 1080 } };
+  VkPipelineLayout layout = handle<VkPipelineLayout>(1);
+
+  for (auto& d : draws) {
+    recorder.vkCmdBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, handle<VkPipeline>(100 + d.pipeline));
+    recorder.vkCmdSetViewport(0, 1, &viewport);
+    recorder.vkCmdSetScissor(0, 1, &scissor);
+
+    VkDescriptorSet sets[2] = { handle<VkDescriptorSet>(1), handle<VkDescriptorSet>(1000 + d.material) };
+    recorder.vkCmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, layout, 0, 2, sets, 0, nullptr);
+
+    VkBuffer vertex_buffer = handle<VkBuffer>(10000 + d.mesh);
+    VkDeviceSize offset = 0;
+    recorder.vkCmdBindVertexBuffers(0, 1, &vertex_buffer, &offset);
+    recorder.vkCmdBindIndexBuffer(handle<VkBuffer>(2), 0, VK_INDEX_TYPE_UINT16);
+
+    recorder.vkCmdDrawIndexed(36, 1, 0, 0, 0);
+  }
+
+  recorder.vkEndCommandBuffer();
+}
+
+// Average time to record a draw, in nanoseconds
+template <typename Recorder>
+double measure(Recorder& recorder, std::vector<Draw> const& draws) {
+  record_frame(recorder, draws);
+
+  auto begin = std::chrono::steady_clock::now();
+  for (int i = 0; i < frames; ++i) {
+    record_frame(recorder, draws);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - begin).count() / (double(frames) * draws.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s <stub library>\n", argv[0]);
+    return 1;
+  }
+
+  try {
+    GlobalFunctions globals(argv[1]);
+    Instance instance(&globals);
+    Device device(&instance);
+    CommandBuffer command_buffer(&device);
+    StateFilter filter(command_buffer);
+    std::vector<Draw> draws = sorted_draws();
+
+    double direct = measure(command_buffer, draws);
+    filter.reset_counters();
+    double filtered = measure(filter, draws);
+
+    char const* work = getenv("VKGEN_STUB_WORK");
+    StateFilterCounters const& counters = filter.counters();
+    double calls = double(counters.forwarded + counters.eliminated());
+
+    printf("\n");
+#if !defined(NDEBUG)
+    printf("Built without NDEBUG, timings of the inline filter are not representative\n");
+#endif
+    printf("stub work per call: %s\n", work ? work : "0");
+    printf("direct:   %.1f ns per draw\n", direct);
+    printf("filtered: %.1f ns per draw\n", filtered);
+    printf("calls dropped: %.1f%%\n", 100.0 * counters.eliminated() / calls);
+    printf("  vkCmdBindPipeline       %llu\n", static_cast<unsigned long long>(counters.vkCmdBindPipeline));
+    printf("  vkCmdSetViewport        %llu\n", static_cast<unsigned long long>(counters.vkCmdSetViewport));
+    printf("  vkCmdSetScissor         %llu\n", static_cast<unsigned long long>(counters.vkCmdSetScissor));
+    printf("  vkCmdBindDescriptorSets %llu\n", static_cast<unsigned long long>(counters.vkCmdBindDescriptorSets));
+    printf("  vkCmdBindVertexBuffers  %llu\n", static_cast<unsigned long long>(counters.vkCmdBindVertexBuffers));
+    printf("  vkCmdBindIndexBuffer    %llu\n", static_cast<unsigned long long>(counters.vkCmdBindIndexBuffer));
+  }
+  catch (std::exception& e) {
+    fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,64 @@
+// A Vulkan implementation for benchmarks, standing in for the loader and
+// driver. vkgen::GlobalFunctions loads it like the Vulkan library and every
+// command it resolves returns VK_SUCCESS after a fixed amount of busy work,
+// set with the VKGEN_STUB_WORK environment variable, so that measurements
+// show the cost of calling into a driver without depending on one. Only
+// recording commands, which neither write through their parameters nor
+// create objects, can be called meaningfully. Only the few types it needs are
+// declared, as in vulkan.h, so that it builds without the Vulkan headers.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_WIN32)
+#define STUB_EXPORT __declspec(dllexport)
+#define VKAPI_CALL __stdcall
+#define VKAPI_PTR VKAPI_CALL
+#else
+#define STUB_EXPORT __attribute__((visibility("default")))
+#define VKAPI_CALL
+#define VKAPI_PTR
+#endif
+
+typedef struct VkInstance_T* VkInstance;
+typedef struct VkDevice_T* VkDevice;
+typedef int32_t VkResult;
+typedef void (VKAPI_PTR *PFN_vkVoidFunction)(void);
+
+#define VK_SUCCESS 0
+#define VK_NULL_HANDLE 0
+
+namespace {
+
+unsigned int work = 0;
+volatile unsigned int sink = 0;
+
+// Called through the function pointer types of all commands. Parameters are
+// ignored and VK_SUCCESS is returned in the register results are read from.
+VkResult VKAPI_PTR stub_command() {
+  for (unsigned int i = 0; i < work; ++i) {
+    sink = sink + i;
+  }
+  return VK_SUCCESS;
+}
+
+PFN_vkVoidFunction VKAPI_PTR stub_get_device_proc_addr(VkDevice device, const char* pName) {
+  if (strcmp(pName, "vkGetDeviceProcAddr") == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(stub_get_device_proc_addr);
+  }
+  return reinterpret_cast<PFN_vkVoidFunction>(stub_command);
+}
+
+} // namespace
+
+extern "C" STUB_EXPORT PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName) {
+  if (char const* value = getenv("VKGEN_STUB_WORK")) {
+    work = static_cast<unsigned int>(strtoul(value, nullptr, 10));
+  }
+
+  if (strcmp(pName, "vkGetInstanceProcAddr") == 0) {
+    return reinterpret_cast<PFN_vkVoidFunction>(vkGetInstanceProcAddr);
+  }
+  return stub_get_device_proc_addr(VK_NULL_HANDLE, pName);
+}
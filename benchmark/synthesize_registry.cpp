@@ -0,0 +1,534 @@
+// Writes a synthetic registry shaped like vk.xml for benchmarking the
+// generator on inputs of arbitrary size. The registry contains a small fixed
+// core (platform types, the dispatchable handles and the commands the
+// generators rely on) followed by generated enums, bitmasks, handles, structs,
+// commands and extensions. Structs nest and extensions require each other in
+// chains whose length is given by the dependency depth. Everything is derived
+// from the counts, so the same options always give the same registry.
+//
+// Usage: synthesize_registry [options] <output file>
+//   --scale=N       Multiplies all counts below (default 1)
+//   --enums=N       Enums and as many bitmask types (default 40)
+//   --handles=N     Non-dispatchable handles (default 30)
+//   --structs=N     Structs (default 300)
+//   --commands=N    Core commands (default 250)
+//   --extensions=N  Extensions (default 60)
+//   --depth=N       Length of struct nesting and extension require chains (default 4)
+//
+// The defaults are roughly the size of the Vulkan 1.0 registry.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace {
+
+struct Options {
+  size_t enums = 40;
+  size_t handles = 30;
+  size_t structs = 300;
+  size_t commands = 250;
+  size_t extensions = 60;
+  size_t depth = 4;
+};
+
+char const* const tags[] = { "KHR", "EXT", "AMD", "NV", "GOOGLE", "QCOM" };
+size_t const tag_count = sizeof(tags) / sizeof(tags[0]);
+
+// Bits used by core bitmasks. Extensions add bits above these.
+size_t const core_bits = 4;
+
+string n(size_t i) {
+  return to_string(i);
+}
+
+// Unions are left out since the Rust generator only knows the unions of the
+// actual registry.
+string struct_name(size_t i) {
+  return "VkSynthStruct" + n(i);
+}
+
+// Even structs carry sType and pNext, so extension structs extend those.
+bool has_stype(size_t i) {
+  return i % 2 == 0;
+}
+
+string extension_tag(size_t i) {
+  return tags[i % tag_count];
+}
+
+string extension_name(size_t i) {
+  return "VK_" + extension_tag(i) + "_synth_extension_" + n(i);
+}
+
+bool disabled(size_t i) {
+  return i % 25 == 24;
+}
+
+bool instance_extension(size_t i) {
+  return i % 4 == 0;
+}
+
+void write_core_types(ostream& out, Options const& o) {
+  out << R"(    <types>
+        <type name="vk_platform" category="include">#include "<name>vk_platform.h</name>"</type>
+        <type requires="vk_platform" name="void"/>
+        <type requires="vk_platform" name="char"/>
+        <type requires="vk_platform" name="float"/>
+        <type requires="vk_platform" name="uint8_t"/>
+        <type requires="vk_platform" name="uint32_t"/>
+        <type requires="vk_platform" name="uint64_t"/>
+        <type requires="vk_platform" name="int32_t"/>
+        <type requires="vk_platform" name="size_t"/>
+        <type category="define">#define <name>VK_MAKE_VERSION</name>(major, minor, patch) \
+    (((major) &lt;&lt; 22) | ((minor) &lt;&lt; 12) | (patch))</type>
+        <type category="define">// Vulkan 1.0 version number
+#define <name>VK_API_VERSION_1_0</name> <type>VK_MAKE_VERSION</type>(1, 0, 0)// Patch version should always be set to 0</type>
+        <type category="define">// Version of this file
+#define <name>VK_HEADER_VERSION</name> 0</type>
+        <type category="define">
+#define <name>VK_NULL_HANDLE</name> 0</type>
+        <type category="basetype">typedef <type>uint32_t</type> <name>VkBool32</name>;</type>
+        <type category="basetype">typedef <type>uint32_t</type> <name>VkFlags</name>;</type>
+        <type category="basetype">typedef <type>uint64_t</type> <name>VkDeviceSize</name>;</type>
+        <type name="VkResult" category="enum"/>
+        <type name="VkStructureType" category="enum"/>
+)";
+
+  for (size_t i = 0; i < o.enums; ++i) {
+    out << "        <type name=\"VkSynthEnum" << i << "\" category=\"enum\"/>" << endl;
+    out << "        <type name=\"VkSynthFlagBits" << i << "\" category=\"enum\"/>" << endl;
+    out << "        <type requires=\"VkSynthFlagBits" << i << "\" category=\"bitmask\">typedef <type>VkFlags</type> <name>VkSynthFlags" << i << "</name>;</type>" << endl;
+  }
+
+  out << R"(        <type category="handle"><type>VK_DEFINE_HANDLE</type>(<name>VkInstance</name>)</type>
+        <type category="handle" parent="VkInstance"><type>VK_DEFINE_HANDLE</type>(<name>VkPhysicalDevice</name>)</type>
+        <type category="handle" parent="VkPhysicalDevice"><type>VK_DEFINE_HANDLE</type>(<name>VkDevice</name>)</type>
+        <type category="handle" parent="VkDevice"><type>VK_DEFINE_HANDLE</type>(<name>VkQueue</name>)</type>
+        <type category="handle" parent="VkDevice"><type>VK_DEFINE_NON_DISPATCHABLE_HANDLE</type>(<name>VkCommandPool</name>)</type>
+        <type category="handle" parent="VkCommandPool"><type>VK_DEFINE_HANDLE</type>(<name>VkCommandBuffer</name>)</type>
+)";
+  for (size_t i = 0; i < o.handles; ++i) {
+    out << "        <type category=\"handle\" parent=\"VkDevice\"><type>VK_DEFINE_NON_DISPATCHABLE_HANDLE</type>(<name>VkSynthObject" << i << "</name>)</type>" << endl;
+  }
+
+  out << R"(        <type category="funcpointer">typedef void (VKAPI_PTR *<name>PFN_vkVoidFunction</name>)(void);</type>
+        <type category="struct" name="VkInstanceCreateInfo">
+            <member values="VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO"><type>VkStructureType</type> <name>sType</name></member>
+            <member>const <type>void</type>* <name>pNext</name></member>
+            <member optional="true"><type>uint32_t</type> <name>enabledExtensionCount</name></member>
+            <member len="enabledExtensionCount,null-terminated">const <type>char</type>* const*      <name>ppEnabledExtensionNames</name></member>
+        </type>
+        <type category="struct" name="VkDeviceCreateInfo">
+            <member values="VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO"><type>VkStructureType</type> <name>sType</name></member>
+            <member>const <type>void</type>* <name>pNext</name></member>
+            <member optional="true"><type>uint32_t</type> <name>enabledExtensionCount</name></member>
+            <member len="enabledExtensionCount,null-terminated">const <type>char</type>* const*      <name>ppEnabledExtensionNames</name></member>
+        </type>
+)";
+}
+
+void write_struct(ostream& out, size_t i, Options const& o) {
+  out << "        <type category=\"struct\" name=\"" << struct_name(i) << "\">" << endl;
+  if (has_stype(i)) {
+    out << "            <member values=\"VK_STRUCTURE_TYPE_SYNTH_STRUCT_" << i << "\"><type>VkStructureType</type> <name>sType</name></member>" << endl;
+    out << "            <member>const <type>void</type>* <name>pNext</name></member>" << endl;
+  }
+  out << "            <member optional=\"true\"><type>VkSynthFlags" << i % o.enums << "</type> <name>flags</name></member>" << endl;
+  out << "            <member><type>VkSynthEnum" << (i * 7) % o.enums << "</type> <name>mode</name></member>" << endl;
+  out << "            <member><type>VkBool32</type> <name>enable</name></member>" << endl;
+  out << "            <member><type>VkDeviceSize</type> <name>size</name></member>" << endl;
+  out << "            <member><type>float</type> <name>weights</name>[4]</member>" << endl;
+  out << "            <member><type>char</type> <name>name</name>[<enum>VK_SYNTH_MAX_NAME_SIZE</enum>]</member>" << endl;
+  if (o.handles) {
+    out << "            <member optional=\"true\"><type>VkSynthObject" << i % o.handles << "</type> <name>object</name></member>" << endl;
+  }
+  out << "            <member optional=\"true\"><type>uint32_t</type> <name>valueCount</name></member>" << endl;
+  out << "            <member len=\"valueCount\">const <type>uint32_t</type>* <name>pValues</name></member>" << endl;
+
+  // Every struct but the first of a chain refers to the previous one, both
+  // by value and through an array.
+  if (i % o.depth != 0) {
+    out << "            <member><type>" << struct_name(i - 1) << "</type> <name>base</name></member>" << endl;
+    out << "            <member optional=\"true\"><type>uint32_t</type> <name>childCount</name></member>" << endl;
+    out << "            <member len=\"childCount\">const <type>" << struct_name(i - 1) << "</type>* <name>pChildren</name></member>" << endl;
+  }
+  out << "        </type>" << endl;
+}
+
+// Extension structs extend an even core struct, which has sType and pNext.
+size_t extended_struct(size_t i, Options const& o) {
+  return ((i * 2) % o.structs) & ~size_t(1);
+}
+
+void write_extension_types(ostream& out, size_t i, Options const& o) {
+  string tag = extension_tag(i);
+  out << "        <type category=\"bitmask\">typedef <type>VkFlags</type> <name>VkSynthExtension" << i << "Flags" << tag << "</name>;</type>" << endl;
+  out << "        <type category=\"struct\" name=\"VkSynthExtension" << i << "Info" << tag << "\" structextends=\"" << struct_name(extended_struct(i, o)) << "\">" << endl;
+  out << "            <member values=\"VK_STRUCTURE_TYPE_SYNTH_EXTENSION_" << i << "_INFO_" << tag << "\"><type>VkStructureType</type> <name>sType</name></member>" << endl;
+  out << "            <member>const <type>void</type>* <name>pNext</name></member>" << endl;
+  out << "            <member optional=\"true\"><type>VkSynthExtension" << i << "Flags" << tag << "</type> <name>flags</name></member>" << endl;
+  out << "            <member><type>uint32_t</type> <name>level</name></member>" << endl;
+  out << "            <member optional=\"true\"><type>uint32_t</type> <name>structCount</name></member>" << endl;
+  out << "            <member len=\"structCount\">const <type>" << struct_name((i * 3) % o.structs) << "</type>* <name>pStructs</name></member>" << endl;
+  out << "        </type>" << endl;
+}
+
+void write_enums(ostream& out, Options const& o) {
+  out << R"xml(    <enums name="API Constants" comment="Misc. hardcoded constants - not an enumerated type">
+        <enum value="256" name="VK_SYNTH_MAX_NAME_SIZE"/>
+        <enum value="1000.0f" name="VK_SYNTH_DEFAULT_WEIGHT"/>
+        <enum value="(~0U)" name="VK_SYNTH_REMAINING"/>
+        <enum value="(~0ULL)" name="VK_SYNTH_WHOLE_SIZE"/>
+        <enum value="1" name="VK_TRUE"/>
+        <enum value="0" name="VK_FALSE"/>
+    </enums>
+    <enums name="VkResult" type="enum">
+        <enum value="0" name="VK_SUCCESS"/>
+        <enum value="5" name="VK_INCOMPLETE"/>
+        <enum value="-1" name="VK_ERROR_OUT_OF_HOST_MEMORY"/>
+        <enum value="-2" name="VK_ERROR_OUT_OF_DEVICE_MEMORY"/>
+    </enums>
+    <enums name="VkStructureType" type="enum">
+        <enum value="0" name="VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO"/>
+        <enum value="1" name="VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO"/>
+)xml";
+  size_t value = 2;
+  for (size_t i = 0; i < o.structs; ++i) {
+    if (has_stype(i)) {
+      out << "        <enum value=\"" << value++ << "\" name=\"VK_STRUCTURE_TYPE_SYNTH_STRUCT_" << i << "\"/>" << endl;
+    }
+  }
+  out << "    </enums>" << endl;
+
+  for (size_t i = 0; i < o.enums; ++i) {
+    out << "    <enums name=\"VkSynthEnum" << i << "\" type=\"enum\">" << endl;
+    for (size_t v = 0; v < 8; ++v) {
+      out << "        <enum value=\"" << v << "\" name=\"VK_SYNTH_ENUM_" << i << "_VALUE_" << v << "\"/>" << endl;
+    }
+    out << "    </enums>" << endl;
+
+    out << "    <enums name=\"VkSynthFlagBits" << i << "\" type=\"bitmask\">" << endl;
+    for (size_t b = 0; b < core_bits; ++b) {
+      out << "        <enum bitpos=\"" << b << "\" name=\"VK_SYNTH_FLAG_" << i << "_BIT_" << b << "\"/>" << endl;
+    }
+    out << "    </enums>" << endl;
+  }
+}
+
+// Writes a command of one of the shapes found in the registry: device
+// commands creating objects from a struct (0), commands recorded into command
+// buffers (1) and instance level queries (2). |i| picks the types used.
+void write_command(ostream& out, string const& name, size_t shape, size_t i, Options const& o) {
+  size_t s = (i * 5) % o.structs;
+  switch (shape) {
+    case 0:
+      out << "        <command successcodes=\"VK_SUCCESS\" errorcodes=\"VK_ERROR_OUT_OF_HOST_MEMORY\">" << endl;
+      out << "            <proto><type>VkResult</type> <name>" << name << "</name></proto>" << endl;
+      out << "            <param><type>VkDevice</type> <name>device</name></param>" << endl;
+      out << "            <param>const <type>" << struct_name(s) << "</type>* <name>pInfo</name></param>" << endl;
+      if (o.handles) {
+        out << "            <param><type>uint32_t</type> <name>objectCount</name></param>" << endl;
+        out << "            <param len=\"objectCount\"><type>VkSynthObject" << i % o.handles << "</type>* <name>pObjects</name></param>" << endl;
+      }
+      break;
+    case 1:
+      out << "        <command>" << endl;
+      out << "            <proto><type>void</type> <name>" << name << "</name></proto>" << endl;
+      out << "            <param externsync=\"true\"><type>VkCommandBuffer</type> <name>commandBuffer</name></param>" << endl;
+      out << "            <param><type>VkSynthEnum" << i % o.enums << "</type> <name>mode</name></param>" << endl;
+      out << "            <param optional=\"true\"><type>VkSynthFlags" << (i * 3) % o.enums << "</type> <name>flags</name></param>" << endl;
+      out << "            <param><type>float</type> <name>weights</name>[4]</param>" << endl;
+      break;
+    default:
+      out << "        <command>" << endl;
+      out << "            <proto><type>void</type> <name>" << name << "</name></proto>" << endl;
+      out << "            <param><type>VkPhysicalDevice</type> <name>physicalDevice</name></param>" << endl;
+      out << "            <param><type>" << struct_name(s) << "</type>* <name>pProperties</name></param>" << endl;
+      break;
+  }
+  out << "        </command>" << endl;
+}
+
+string core_command_name(size_t i) {
+  return (i % 3 == 1 ? "vkCmdSynth" : "vkSynthCommand") + n(i);
+}
+
+// Extensions add one command of each shape, except instance extensions which
+// may only add instance level commands.
+vector<pair<string, size_t>> extension_commands(size_t i) {
+  string tag = extension_tag(i);
+  vector<pair<string, size_t>> commands;
+  if (instance_extension(i)) {
+    commands.push_back(make_pair("vkSynthExtension" + n(i) + "Query" + tag, 2));
+  }
+  else {
+    commands.push_back(make_pair("vkSynthExtension" + n(i) + "Create" + tag, 0));
+    commands.push_back(make_pair("vkCmdSynthExtension" + n(i) + tag, 1));
+    commands.push_back(make_pair("vkSynthExtension" + n(i) + "Query" + tag, 2));
+  }
+  return commands;
+}
+
+void write_commands(ostream& out, Options const& o) {
+  out << R"(    <commands>
+        <command>
+            <proto><type>PFN_vkVoidFunction</type> <name>vkGetInstanceProcAddr</name></proto>
+            <param optional="true"><type>VkInstance</type> <name>instance</name></param>
+            <param len="null-terminated">const <type>char</type>* <name>pName</name></param>
+        </command>
+        <command>
+            <proto><type>PFN_vkVoidFunction</type> <name>vkGetDeviceProcAddr</name></proto>
+            <param><type>VkDevice</type> <name>device</name></param>
+            <param len="null-terminated">const <type>char</type>* <name>pName</name></param>
+        </command>
+        <command successcodes="VK_SUCCESS" errorcodes="VK_ERROR_OUT_OF_HOST_MEMORY">
+            <proto><type>VkResult</type> <name>vkCreateInstance</name></proto>
+            <param>const <type>VkInstanceCreateInfo</type>* <name>pCreateInfo</name></param>
+            <param><type>VkInstance</type>* <name>pInstance</name></param>
+        </command>
+        <command>
+            <proto><type>void</type> <name>vkDestroyInstance</name></proto>
+            <param optional="true" externsync="true"><type>VkInstance</type> <name>instance</name></param>
+        </command>
+        <command successcodes="VK_SUCCESS,VK_INCOMPLETE">
+            <proto><type>VkResult</type> <name>vkEnumeratePhysicalDevices</name></proto>
+            <param><type>VkInstance</type> <name>instance</name></param>
+            <param optional="false,true"><type>uint32_t</type>* <name>pPhysicalDeviceCount</name></param>
+            <param optional="true" len="pPhysicalDeviceCount"><type>VkPhysicalDevice</type>* <name>pPhysicalDevices</name></param>
+        </command>
+        <command successcodes="VK_SUCCESS" errorcodes="VK_ERROR_OUT_OF_HOST_MEMORY">
+            <proto><type>VkResult</type> <name>vkCreateDevice</name></proto>
+            <param><type>VkPhysicalDevice</type> <name>physicalDevice</name></param>
+            <param>const <type>VkDeviceCreateInfo</type>* <name>pCreateInfo</name></param>
+            <param><type>VkDevice</type>* <name>pDevice</name></param>
+        </command>
+        <command>
+            <proto><type>void</type> <name>vkDestroyDevice</name></proto>
+            <param optional="true" externsync="true"><type>VkDevice</type> <name>device</name></param>
+        </command>
+        <command>
+            <proto><type>void</type> <name>vkGetDeviceQueue</name></proto>
+            <param><type>VkDevice</type> <name>device</name></param>
+            <param><type>uint32_t</type> <name>queueFamilyIndex</name></param>
+            <param><type>VkQueue</type>* <name>pQueue</name></param>
+        </command>
+)";
+
+  for (size_t i = 0; i < o.commands; ++i) {
+    write_command(out, core_command_name(i), i % 3, i, o);
+  }
+  for (size_t i = 0; i < o.extensions; ++i) {
+    if (disabled(i)) {
+      continue;
+    }
+    for (auto& c : extension_commands(i)) {
+      write_command(out, c.first, c.second, i, o);
+    }
+  }
+  out << "    </commands>" << endl;
+}
+
+void write_feature(ostream& out, Options const& o) {
+  out << R"(    <feature api="vulkan" name="VK_VERSION_1_0" number="1.0" comment="Vulkan core API interface definitions">
+        <require comment="Header boilerplate">
+            <type name="vk_platform"/>
+            <type name="VK_NULL_HANDLE"/>
+            <type name="VK_API_VERSION_1_0"/>
+            <type name="VK_HEADER_VERSION"/>
+        </require>
+        <require comment="API constants">
+            <enum name="VK_SYNTH_MAX_NAME_SIZE"/>
+            <enum name="VK_SYNTH_DEFAULT_WEIGHT"/>
+            <enum name="VK_SYNTH_REMAINING"/>
+            <enum name="VK_SYNTH_WHOLE_SIZE"/>
+            <enum name="VK_TRUE"/>
+            <enum name="VK_FALSE"/>
+        </require>
+        <require comment="Device initialization">
+            <command name="vkGetInstanceProcAddr"/>
+            <command name="vkGetDeviceProcAddr"/>
+            <command name="vkCreateInstance"/>
+            <command name="vkDestroyInstance"/>
+            <command name="vkEnumeratePhysicalDevices"/>
+            <command name="vkCreateDevice"/>
+            <command name="vkDestroyDevice"/>
+            <command name="vkGetDeviceQueue"/>
+        </require>
+        <require comment="Synthetic commands">
+)";
+  for (size_t i = 0; i < o.commands; ++i) {
+    out << "            <command name=\"" << core_command_name(i) << "\"/>" << endl;
+  }
+  out << "        </require>" << endl;
+
+  // Not every type is reachable from a command, so all of them are listed.
+  out << "        <require comment=\"Synthetic types\">" << endl;
+  for (size_t i = 0; i < o.enums; ++i) {
+    out << "            <type name=\"VkSynthFlags" << i << "\"/>" << endl;
+    out << "            <type name=\"VkSynthEnum" << i << "\"/>" << endl;
+  }
+  for (size_t i = 0; i < o.handles; ++i) {
+    out << "            <type name=\"VkSynthObject" << i << "\"/>" << endl;
+  }
+  for (size_t i = 0; i < o.structs; ++i) {
+    out << "            <type name=\"" << struct_name(i) << "\"/>" << endl;
+  }
+  out << "        </require>" << endl;
+  out << "    </feature>" << endl;
+}
+
+void write_extensions(ostream& out, Options const& o) {
+  out << "    <extensions>" << endl;
+  for (size_t i = 0; i < o.extensions; ++i) {
+    string tag = extension_tag(i);
+    string upper = "VK_" + tag + "_SYNTH_EXTENSION_" + n(i);
+
+    out << "        <extension name=\"" << extension_name(i) << "\" number=\"" << i + 1 << "\"";
+    if (disabled(i)) {
+      out << " author=\"" << tag << "\" contact=\"Contact\" supported=\"disabled\">" << endl;
+      out << "            <require>" << endl;
+      out << "                <enum value=\"0\" name=\"" << upper << "_SPEC_VERSION\"/>" << endl;
+      out << "            </require>" << endl;
+      out << "        </extension>" << endl;
+      continue;
+    }
+
+    out << " type=\"" << (instance_extension(i) ? "instance" : "device") << "\"";
+    // Chains of extensions requiring the previous one. Disabled extensions
+    // are skipped, and instance extensions only require other instance
+    // extensions.
+    if (i % o.depth != 0 && !disabled(i - 1) && (!instance_extension(i) || instance_extension(i - 1))) {
+      out << " requires=\"" << extension_name(i - 1) << "\"";
+    }
+    if (i % 10 == 9) {
+      out << " protect=\"VK_USE_PLATFORM_WIN32_KHR\"";
+    }
+    out << " author=\"" << tag << "\" contact=\"Contact\" supported=\"vulkan\">" << endl;
+
+    out << "            <require>" << endl;
+    out << "                <enum value=\"1\" name=\"" << upper << "_SPEC_VERSION\"/>" << endl;
+    out << "                <enum value=\"&quot;" << extension_name(i) << "&quot;\" name=\"" << upper << "_EXTENSION_NAME\"/>" << endl;
+    out << "                <enum offset=\"0\" extends=\"VkStructureType\" name=\"VK_STRUCTURE_TYPE_SYNTH_EXTENSION_" << i << "_INFO_" << tag << "\"/>" << endl;
+    out << "                <enum offset=\"1\" extends=\"VkSynthEnum" << i % o.enums << "\" name=\"VK_SYNTH_ENUM_" << i % o.enums << "_EXTENSION_" << i << "_" << tag << "\"/>" << endl;
+    out << "                <enum offset=\"2\" extends=\"VkResult\" dir=\"-\" name=\"VK_ERROR_SYNTH_EXTENSION_" << i << "_" << tag << "\"/>" << endl;
+    size_t bit = core_bits + (i / o.enums) % (31 - core_bits);
+    out << "                <enum bitpos=\"" << bit << "\" extends=\"VkSynthFlagBits" << i % o.enums << "\" name=\"VK_SYNTH_FLAG_" << i % o.enums << "_EXTENSION_" << i << "_BIT_" << tag << "\"/>" << endl;
+    out << "                <type name=\"VkSynthExtension" << i << "Flags" << tag << "\"/>" << endl;
+    out << "                <type name=\"VkSynthExtension" << i << "Info" << tag << "\"/>" << endl;
+    for (auto& c : extension_commands(i)) {
+      out << "                <command name=\"" << c.first << "\"/>" << endl;
+    }
+    out << "            </require>" << endl;
+    out << "        </extension>" << endl;
+  }
+  out << "    </extensions>" << endl;
+}
+
+void write_registry(ostream& out, Options const& o) {
+  out << R"(<?xml version="1.0" encoding="UTF-8"?>
+<registry>
+    <comment>
+Copyright (c) 2015-2017 The Khronos Group Inc.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+------------------------------------------------------------------------
+
+This is a synthetic registry generated for benchmarking.
+    </comment>
+    <tags>
+)";
+  for (auto tag : tags) {
+    out << "        <tag name=\"" << tag << "\" author=\"Author\" contact=\"Contact\"/>" << endl;
+  }
+  out << "    </tags>" << endl;
+
+  write_core_types(out, o);
+  for (size_t i = 0; i < o.structs; ++i) {
+    write_struct(out, i, o);
+  }
+  for (size_t i = 0; i < o.extensions; ++i) {
+    if (!disabled(i)) {
+      write_extension_types(out, i, o);
+    }
+  }
+  out << "    </types>" << endl;
+
+  write_enums(out, o);
+  write_commands(out, o);
+  write_feature(out, o);
+  write_extensions(out, o);
+  out << "</registry>" << endl;
+}
+
+bool read_count(string const& arg, string const& option, size_t& count) {
+  string prefix = "--" + option + "=";
+  if (arg.compare(0, prefix.size(), prefix) != 0) {
+    return false;
+  }
+  count = strtoul(arg.c_str() + prefix.size(), nullptr, 10);
+  return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  Options o;
+  size_t scale = 1;
+  string output;
+
+  for (int i = 1; i < argc; ++i) {
+    string arg = argv[i];
+    if (read_count(arg, "scale", scale) ||
+        read_count(arg, "enums", o.enums) ||
+        read_count(arg, "handles", o.handles) ||
+        read_count(arg, "structs", o.structs) ||
+        read_count(arg, "commands", o.commands) ||
+        read_count(arg, "extensions", o.extensions) ||
+        read_count(arg, "depth", o.depth)) {
+      continue;
+    }
+    if (arg.compare(0, 2, "--") == 0) {
+      cerr << "Unknown option " << arg << endl;
+      return 1;
+    }
+    output = arg;
+  }
+
+  if (output.empty() || scale == 0 || o.enums == 0 || o.structs == 0 || o.depth == 0) {
+    cerr << "Usage: synthesize_registry [--scale=N] [--enums=N] [--handles=N] [--structs=N] [--commands=N] [--extensions=N] [--depth=N] <output file>" << endl;
+    return 1;
+  }
+
+  o.enums *= scale;
+  o.handles *= scale;
+  o.structs *= scale;
+  o.commands *= scale;
+  o.extensions *= scale;
+
+  ofstream out(output);
+  if (!out.is_open()) {
+    cerr << "Failed to open " << output << " for writing" << endl;
+    return 1;
+  }
+  write_registry(out, o);
+
+  cout << "Wrote " << output << ": " << o.enums << " enums, " << o.enums << " bitmasks, " << o.handles << " handles, "
+       << o.structs << " structs, " << o.commands << " commands, " << o.extensions << " extensions, depth " << o.depth << endl;
+  return 0;
+}
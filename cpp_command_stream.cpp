@@ -0,0 +1,406 @@
+#include "cpp_command_stream.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace {
+
+// How a parameter is stored in the record of a command
+enum class StreamParam {
+  Value, // Scalars, handles and structs passed by value
+  FixedArray, // Fixed size arrays, copied into the record
+  Range, // len annotated pointer to scalars or untyped data
+  StructRange, // len annotated pointer to structs
+  Pointee, // Single pointer to a struct
+  String, // Null terminated string
+  Identity, // Other pointers, stored as they are
+};
+
+StreamParam stream_param(vkspec::Command* c, vkspec::Command::Parameter const& p) {
+  if (p.array_size != "") {
+    return StreamParam::FixedArray;
+  }
+
+  size_t depth = count(p.complete_type.begin(), p.complete_type.end(), '*');
+  if (depth == 0) {
+    return StreamParam::Value;
+  }
+
+  // Only data the command reads is copied. Commands writing through a
+  // pointer get it as it was passed.
+  if (depth > 1 || !p.const_modifier) {
+    return StreamParam::Identity;
+  }
+
+  if (p.len.empty()) {
+    return p.pure_type->to_struct() ? StreamParam::Pointee : StreamParam::Identity;
+  }
+  if (p.len.size() == 1 && p.len[0] == "null-terminated" && p.pure_type->name() == "char") {
+    return StreamParam::String;
+  }
+  if (len_expression(c, p) == "") {
+    return StreamParam::Identity;
+  }
+  return p.pure_type->to_struct() ? StreamParam::StructRange : StreamParam::Range;
+}
+
+} // namespace
+
+CppCommandStreamGenerator::CppCommandStreamGenerator(string const& out_dir, string const& license, int major, int minor, int patch) {
+  header.open(out_dir + "/vk_command_stream.h");
+  cpp.open(out_dir + "/vk_command_stream.cpp");
+  if (!header.is_open() || !cpp.is_open()) {
+    throw std::runtime_error("Failed to open files for output");
+  }
+
+  ind_h = new IndentingOStreambuf(header, 2);
+  ind_cpp = new IndentingOStreambuf(cpp, 2);
+
+  header << license << endl;
+  header << endl;
+  header << "// Command streams for Vulkan " << major << "." << minor << "." << patch << ", generated from the Khronos Vulkan API XML Registry." << endl;
+  header << "// See https://github.com/andens/Vulkan-Hpp for generator details." << endl;
+  header << endl;
+  header << "#ifndef VK_COMMAND_STREAM_INCLUDE" << endl;
+  header << "#define VK_COMMAND_STREAM_INCLUDE" << endl;
+  header << endl;
+  header << "#include \"vk_deep_copy.h\"" << endl;
+  header << "#include \"vk_dispatch_tables.h\"" << endl;
+  header << "#include <algorithm>" << endl;
+  header << "#include <cstdint>" << endl;
+  header << "#include <cstring>" << endl;
+  header << endl;
+  header << "namespace vkgen {" << endl;
+
+  cpp << "#include \"vk_command_stream.h\"" << endl;
+  cpp << endl;
+  cpp << "namespace vkgen {" << endl;
+}
+
+CppCommandStreamGenerator::~CppCommandStreamGenerator() {
+  header << endl;
+  header << "} // vkgen" << endl;
+  header << endl;
+  header << "#endif // VK_COMMAND_STREAM_INCLUDE" << endl;
+
+  cpp << endl;
+  cpp << "} // vkgen" << endl;
+
+  delete ind_h;
+  delete ind_cpp;
+
+  header.close();
+  cpp.close();
+}
+
+void CppCommandStreamGenerator::gen_device_command(vkspec::Command* c) {
+  add_command(c);
+}
+
+void CppCommandStreamGenerator::end_extension(vkspec::Extension* e) {
+  for (auto c : e->commands()) {
+    add_command(c);
+  }
+}
+
+// Same selection as the vkCmd* members of CommandBufferFunctions
+void CppCommandStreamGenerator::add_command(vkspec::Command* c) {
+  if (c->name().compare(0, 5, "vkCmd") != 0 || c->params().front().pure_type->name() != "VkCommandBuffer") {
+    return;
+  }
+
+  // Recording cannot report a result, and no vkCmd* command has one
+  assert(c->complete_return_type() == "void");
+  _commands.push_back(c);
+}
+
+void CppCommandStreamGenerator::end_extensions() {
+  // Without vkCmd* commands, as in profiles that keep none, there is nothing
+  // to record and possibly no CommandBufferFunctions to replay on
+  if (_commands.empty()) {
+    return;
+  }
+
+  header << R"(
+// vkgen::CommandStream records commands for a command buffer without calling
+// into the driver, so that commands can be prepared on any thread and handed
+// to the threads that own the command buffers. Recording a command bumps a
+// pointer and stores the arguments; arrays, strings and structs the command
+// reads are copied into the stream the way vkgen::deep_copy copies them, so
+// the caller's data may go away right after recording. Other pointers, such
+// as pointers to data of unknown size, are stored as they are and must stay
+// valid until the stream has been replayed.
+//
+// replay calls the recorded commands, in order, on the command buffer of a
+// dispatch table. It may be called any number of times, from any thread and
+// concurrently, as long as nothing is being recorded at the same time. reset
+// empties the stream but keeps its memory for recording again.
+//
+// Opcodes depend on the platform defines of the build, so streams are only
+// meant to be replayed by the program that recorded them.
+
+enum class CommandOp : uint32_t {
+)";
+
+  ind_h->increase();
+  for (auto c : _commands) {
+    print_protect_begin(header, ind_h, 1, c);
+    header << c->name() << "," << endl;
+    print_protect_end(header, ind_h, 1, c);
+  }
+  ind_h->decrease();
+  header << "};" << endl;
+
+  header << R"(
+namespace detail {
+
+// Records are packed at the alignment of the largest Vulkan scalars. Untyped
+// data such as push constants is copied byte by byte and needs no more.
+static size_t const record_alignment = 8;
+
+// Begins every record. |size| includes the data copied behind the record and
+// the padding up to the next record.
+struct command_header {
+  CommandOp op;
+  uint32_t size;
+};
+)";
+
+  for (auto c : _commands) {
+    write_record(c);
+  }
+
+  header << R"(
+} // detail
+
+class CommandStream {
+public:
+  explicit CommandStream(size_t chunk_size = 64 * 1024) : _chunk_size(chunk_size) {}
+  ~CommandStream();
+  CommandStream(CommandStream const&) = delete;
+  CommandStream& operator=(CommandStream const&) = delete;
+
+)";
+
+  ind_h->increase();
+  for (auto c : _commands) {
+    print_protect_begin(header, ind_h, 1, c);
+    header << "void " << c->name() << "(";
+    string comma = "";
+    for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+      header << comma << p->complete_type << " " << p->name;
+      if (p->array_size != "") {
+        header << "[" << p->array_size << "]";
+      }
+      comma = ", ";
+    }
+    header << ");" << endl;
+    print_protect_end(header, ind_h, 1, c);
+  }
+  ind_h->decrease();
+
+  header << R"(
+  void replay(CommandBufferFunctions const& command_buffer) const;
+  void reset();
+  bool empty() const { return _chunks.empty() || (_current == 0 && _chunks[0].used == 0); }
+
+private:
+  // Records are laid out back to back in each chunk, and chunks are replayed
+  // in order up to the current one. Chunks never move, so pointers into them
+  // stay valid while more commands are recorded.
+  struct Chunk {
+    unsigned char* data;
+    size_t capacity;
+    size_t used;
+  };
+
+  // Returns a block of |size| bytes beginning with the header of a record
+  void* _record(CommandOp op, size_t size) {
+    size = detail::align(size, detail::record_alignment);
+    while (_current < _chunks.size() && _chunks[_current].used + size > _chunks[_current].capacity) {
+      ++_current;
+    }
+    if (_current == _chunks.size()) {
+      _new_chunk(std::max(size, _chunk_size));
+    }
+
+    Chunk& chunk = _chunks[_current];
+    detail::command_header* header = reinterpret_cast<detail::command_header*>(chunk.data + chunk.used);
+    header->op = op;
+    header->size = static_cast<uint32_t>(size);
+    chunk.used += size;
+    return header;
+  }
+
+  void _new_chunk(size_t capacity);
+
+private:
+  std::vector<Chunk> _chunks;
+  size_t _current = 0;
+  size_t _chunk_size;
+};
+)";
+
+  for (auto c : _commands) {
+    write_recorder(c);
+  }
+
+  cpp << R"(
+CommandStream::~CommandStream() {
+  for (auto& chunk : _chunks) {
+    std::free(chunk.data);
+  }
+}
+
+void CommandStream::reset() {
+  for (auto& chunk : _chunks) {
+    chunk.used = 0;
+  }
+  _current = 0;
+}
+
+void CommandStream::_new_chunk(size_t capacity) {
+  void* data = std::malloc(capacity);
+  if (!data) {
+    throw std::bad_alloc();
+  }
+  Chunk chunk = { static_cast<unsigned char*>(data), capacity, 0 };
+  _chunks.push_back(chunk);
+}
+
+void CommandStream::replay(CommandBufferFunctions const& command_buffer) const {
+  for (size_t i = 0; i < _chunks.size() && i <= _current; ++i) {
+    unsigned char const* data = _chunks[i].data;
+    for (size_t offset = 0; offset < _chunks[i].used;) {
+      detail::command_header const* header = reinterpret_cast<detail::command_header const*>(data + offset);
+      switch (header->op) {
+)";
+
+  ind_cpp->increase();
+  ind_cpp->increase();
+  ind_cpp->increase();
+  for (auto c : _commands) {
+    write_replay(c);
+  }
+  ind_cpp->decrease();
+  ind_cpp->decrease();
+  ind_cpp->decrease();
+
+  cpp << R"(      }
+      offset += header->size;
+    }
+  }
+}
+)";
+}
+
+void CppCommandStreamGenerator::write_record(vkspec::Command* c) {
+  header << endl;
+  print_protect_begin(header, ind_h, 0, c);
+  header << "struct " << c->name() << "_record {" << endl;
+  ind_h->increase();
+  header << "command_header header;" << endl;
+  for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+    if (stream_param(c, *p) == StreamParam::FixedArray) {
+      header << p->pure_type->name() << " " << p->name << "[" << p->array_size << "];" << endl;
+    }
+    else {
+      header << p->complete_type << " " << p->name << ";" << endl;
+    }
+  }
+  ind_h->decrease();
+  header << "};" << endl;
+  print_protect_end(header, ind_h, 0, c);
+}
+
+// Sizes the record and everything copied behind it, then fills both in the
+// same order, as vk_deep_copy.h does for structs.
+void CppCommandStreamGenerator::write_recorder(vkspec::Command* c) {
+  header << endl;
+  print_protect_begin(header, ind_h, 0, c);
+  header << "inline void CommandStream::" << c->name() << "(";
+  string comma = "";
+  for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+    header << comma << p->complete_type << " " << p->name;
+    if (p->array_size != "") {
+      header << "[" << p->array_size << "]";
+    }
+    comma = ", ";
+  }
+  header << ") {" << endl;
+  ind_h->increase();
+
+  string record = "detail::" + c->name() + "_record";
+  header << "size_t record_size = sizeof(" << record << ");" << endl;
+  for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+    string pure = p->pure_type->name();
+    switch (stream_param(c, *p)) {
+      case StreamParam::Range:
+        header << "record_size = detail::size_range(record_size, " << p->name << ", " << len_expression(c, *p) << ");" << endl;
+        break;
+      case StreamParam::StructRange:
+        header << "record_size = detail::size_each<deep_copier<" << pure << ">>(record_size, " << p->name << ", " << len_expression(c, *p) << ");" << endl;
+        break;
+      case StreamParam::Pointee:
+        header << "record_size = detail::size_pointee<deep_copier<" << pure << ">>(record_size, " << p->name << ");" << endl;
+        break;
+      case StreamParam::String:
+        header << "record_size = detail::size_string(record_size, " << p->name << ");" << endl;
+        break;
+      default:
+        break;
+    }
+  }
+
+  header << "detail::cursor block(_record(CommandOp::" << c->name() << ", record_size));" << endl;
+  header << record << "* record = block.take<" << record << ">(1);" << endl;
+  for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+    string pure = p->pure_type->name();
+    string dst = "record->" + p->name;
+    switch (stream_param(c, *p)) {
+      case StreamParam::Value:
+      case StreamParam::Identity:
+        header << dst << " = " << p->name << ";" << endl;
+        break;
+      case StreamParam::FixedArray:
+        header << "std::memcpy(" << dst << ", " << p->name << ", sizeof(" << dst << "));" << endl;
+        break;
+      case StreamParam::Range:
+        header << dst << " = detail::copy_range(block, " << p->name << ", " << len_expression(c, *p) << ");" << endl;
+        break;
+      case StreamParam::StructRange:
+        header << dst << " = detail::copy_each<deep_copier<" << pure << ">>(block, " << p->name << ", " << len_expression(c, *p) << ");" << endl;
+        break;
+      case StreamParam::Pointee:
+        header << dst << " = detail::copy_pointee<deep_copier<" << pure << ">>(block, " << p->name << ");" << endl;
+        break;
+      case StreamParam::String:
+        header << dst << " = detail::copy_string(block, " << p->name << ");" << endl;
+        break;
+    }
+  }
+
+  ind_h->decrease();
+  header << "}" << endl;
+  print_protect_end(header, ind_h, 0, c);
+}
+
+void CppCommandStreamGenerator::write_replay(vkspec::Command* c) {
+  print_protect_begin(cpp, ind_cpp, 3, c);
+  string record = "detail::" + c->name() + "_record";
+  cpp << "case CommandOp::" << c->name() << ": {" << endl;
+  ind_cpp->increase();
+  cpp << record << " const* record = reinterpret_cast<" << record << " const*>(header);" << endl;
+  cpp << "command_buffer." << c->name() << "(";
+  string comma = "";
+  for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+    cpp << comma << "record->" << p->name;
+    comma = ", ";
+  }
+  cpp << ");" << endl;
+  cpp << "break;" << endl;
+  ind_cpp->decrease();
+  cpp << "}" << endl;
+  print_protect_end(cpp, ind_cpp, 3, c);
+}
@@ -0,0 +1,61 @@
+#ifndef CPP_COMMAND_STREAM_INCLUDE
+#define CPP_COMMAND_STREAM_INCLUDE
+
+#include "vkspec.h"
+#include "cpp_struct_graph.h"
+#include "indenting_stream_buf.h"
+#include <fstream>
+
+// Generates vk_command_stream.h and vk_command_stream.cpp containing
+// vkgen::CommandStream, which records the vkCmd* commands of
+// CommandBufferFunctions without calling into the driver. Every command is
+// stored as an opcode followed by its arguments, with arrays and the structs
+// reachable from them copied right behind it using the vk_deep_copy.h
+// copiers. CommandStream::replay later makes the calls on a real command
+// buffer through its dispatch table, as many times as needed.
+class CppCommandStreamGenerator : public vkspec::IGenerator {
+public:
+  CppCommandStreamGenerator(std::string const& out_dir, std::string const& license, int major, int minor, int patch);
+  ~CppCommandStreamGenerator();
+
+  virtual void begin_core() override final {}
+  virtual void end_core() override final {}
+  virtual void gen_scalar_typedef(vkspec::ScalarTypedef* t) override final {}
+  virtual void gen_function_typedef(vkspec::FunctionTypedef* t) override final {}
+  virtual void gen_handle_typedef(vkspec::HandleTypedef* t) override final {}
+  virtual void gen_struct(vkspec::Struct* t) override final {}
+  virtual void gen_enum(vkspec::Enum* t) override final {}
+  virtual void gen_api_constant(vkspec::ApiConstant* t) override final {}
+  virtual void gen_bitmasks(vkspec::Bitmasks* t) override final {}
+  virtual void begin_entry() override final {}
+  virtual void gen_entry_command(vkspec::Command* c) override final {}
+  virtual void end_entry() override final {}
+  virtual void begin_global_commands() override final {}
+  virtual void gen_global_command(vkspec::Command* c) override final {}
+  virtual void end_global_commands() override final {}
+  virtual void begin_instance_commands() override final {}
+  virtual void gen_instance_command(vkspec::Command* c) override final {}
+  virtual void end_instance_commands() override final {}
+  virtual void begin_device_commands() override final {}
+  virtual void gen_device_command(vkspec::Command* c) override final;
+  virtual void end_device_commands() override final {}
+  virtual void begin_extensions() override final {}
+  virtual void end_extensions() override final;
+  virtual void begin_extension(vkspec::Extension* e) override final {}
+  virtual void end_extension(vkspec::Extension* e) override final;
+
+private:
+  void add_command(vkspec::Command* c);
+  void write_record(vkspec::Command* c);
+  void write_recorder(vkspec::Command* c);
+  void write_replay(vkspec::Command* c);
+
+private:
+  std::ofstream header;
+  std::ofstream cpp;
+  IndentingOStreambuf* ind_h = nullptr;
+  IndentingOStreambuf* ind_cpp = nullptr;
+  std::vector<vkspec::Command*> _commands;
+};
+
+#endif
@@ -0,0 +1,513 @@
+#include "cpp_deep_copy.h"
+
+using namespace std;
+
+CppDeepCopyGenerator::CppDeepCopyGenerator(string const& out_dir, string const& license, int major, int minor, int patch) {
+  header.open(out_dir + "/vk_deep_copy.h");
+  cpp.open(out_dir + "/vk_deep_copy.cpp");
+  if (!header.is_open() || !cpp.is_open()) {
+    throw std::runtime_error("Failed to open files for output");
+  }
+
+  ind_h = new IndentingOStreambuf(header, 2);
+
+  header << license << endl;
+  header << endl;
+  header << "// Deep copies for Vulkan " << major << "." << minor << "." << patch << ", generated from the Khronos Vulkan API XML Registry." << endl;
+  header << "// See https://github.com/andens/Vulkan-Hpp for generator details." << endl;
+  header << endl;
+  header << "#ifndef VK_DEEP_COPY_INCLUDE" << endl;
+  header << "#define VK_DEEP_COPY_INCLUDE" << endl;
+  header << endl;
+  header << "#include \"vulkan_include.inl\"" << endl;
+  header << "#include <cstddef>" << endl;
+  header << "#include <cstdlib>" << endl;
+  header << "#include <cstring>" << endl;
+  header << "#include <new>" << endl;
+  header << "#include <vector>" << endl;
+  header << endl;
+  header << "namespace vkgen {" << endl;
+
+  cpp << "#include \"vk_deep_copy.h\"" << endl;
+  cpp << endl;
+  cpp << "namespace vkgen {" << endl;
+  cpp << endl;
+
+  header << R"(
+// vkgen::deep_copy(v, arena) copies v and the data reachable from it into one
+// contiguous block of the arena and returns the copy, whose pointers all refer
+// into the block. len annotated arrays, strings and single struct pointers are
+// followed whenever they are not null, so unused pointers must be null. Other
+// pointers, such as pUserData and function pointers, are copied as they are.
+// pNext chains are copied up to the first struct unknown to the generator,
+// which is referenced rather than copied.
+//
+// Defining VKGEN_EXTERN_TEMPLATES declares deep_copy for every struct as an
+// extern template. The copies are then compiled once, in vk_deep_copy.cpp,
+// instead of in every translation unit making them.
+
+namespace detail {
+
+inline size_t align(size_t offset, size_t alignment) {
+  return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+} // detail
+
+// Owns the memory of deep copies. Blocks are carved out of larger chunks; a
+// block larger than a chunk gets a chunk of its own. Memory is released by
+// reset or when the arena is destroyed. An arena is not thread safe, but the
+// copies it holds can be handed to other threads.
+class Arena {
+public:
+  explicit Arena(size_t chunk_size = 64 * 1024) : _chunk_size(chunk_size) {}
+  ~Arena() { reset(); }
+  Arena(Arena const&) = delete;
+  Arena& operator=(Arena const&) = delete;
+
+  // The returned block is suitably aligned for any Vulkan struct
+  void* allocate(size_t size) {
+    size = detail::align(size, alignof(std::max_align_t));
+    if (size > _chunk_size) {
+      return _new_chunk(size); // The current chunk keeps being filled afterwards
+    }
+    if (!_current || _used + size > _chunk_size) {
+      _current = _new_chunk(_chunk_size);
+      _used = 0;
+    }
+    void* block = _current + _used;
+    _used += size;
+    return block;
+  }
+
+  void reset() {
+    for (auto c : _chunks) {
+      std::free(c);
+    }
+    _chunks.clear();
+    _current = nullptr;
+    _used = 0;
+  }
+
+private:
+  unsigned char* _new_chunk(size_t size) {
+    void* chunk = std::malloc(size);
+    if (!chunk) {
+      throw std::bad_alloc();
+    }
+    _chunks.push_back(static_cast<unsigned char*>(chunk));
+    return _chunks.back();
+  }
+
+private:
+  std::vector<unsigned char*> _chunks;
+  unsigned char* _current = nullptr;
+  size_t _chunk_size;
+  size_t _used = 0;
+};
+
+namespace detail {
+
+// Hands out consecutive pieces of a block, matching the offsets computed when
+// sizing the block
+class cursor {
+public:
+  explicit cursor(void* block) : _block(static_cast<unsigned char*>(block)) {}
+
+  template <typename T>
+  T* take(size_t n) {
+    _offset = align(_offset, alignof(T));
+    T* p = reinterpret_cast<T*>(_block + _offset);
+    _offset += n * sizeof(T);
+    return p;
+  }
+
+private:
+  unsigned char* _block;
+  size_t _offset = 0;
+};
+
+template <typename T>
+inline size_t reserve(size_t offset, size_t n) {
+  return align(offset, alignof(T)) + n * sizeof(T);
+}
+
+// Untyped data, such as specialization constants, gets the strictest alignment
+struct max_aligned {
+  alignas(std::max_align_t) unsigned char bytes[1];
+};
+
+template <typename T>
+inline size_t size_range(size_t offset, T const* src, size_t n) {
+  return src ? reserve<T>(offset, n) : offset;
+}
+
+inline size_t size_range(size_t offset, void const* src, size_t n) {
+  return src ? align(offset, alignof(max_aligned)) + n : offset;
+}
+
+template <typename T>
+inline T* copy_range(cursor& c, T const* src, size_t n) {
+  if (!src) {
+    return nullptr;
+  }
+  T* dst = c.take<T>(n);
+  std::memcpy(dst, src, n * sizeof(T));
+  return dst;
+}
+
+inline void* copy_range(cursor& c, void const* src, size_t n) {
+  if (!src) {
+    return nullptr;
+  }
+  void* dst = c.take<max_aligned>(0);
+  c.take<unsigned char>(n);
+  std::memcpy(dst, src, n);
+  return dst;
+}
+
+template <typename C, typename T>
+inline size_t size_each(size_t offset, T const* src, size_t n) {
+  if (!src) {
+    return offset;
+  }
+  offset = reserve<T>(offset, n);
+  for (size_t i = 0; i < n; ++i) {
+    offset = C::size(offset, src[i]);
+  }
+  return offset;
+}
+
+template <typename C, typename T>
+inline T* copy_each(cursor& c, T const* src, size_t n) {
+  T* dst = copy_range(c, src, n);
+  for (size_t i = 0; dst && i < n; ++i) {
+    C::fill(dst[i], src[i], c);
+  }
+  return dst;
+}
+
+template <typename C, typename T, size_t N>
+inline size_t size_each(size_t offset, T const (&src)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    offset = C::size(offset, src[i]);
+  }
+  return offset;
+}
+
+template <typename C, typename T, size_t N>
+inline void fill_each(T (&dst)[N], T const (&src)[N], cursor& c) {
+  for (size_t i = 0; i < N; ++i) {
+    C::fill(dst[i], src[i], c);
+  }
+}
+
+template <typename C, typename T>
+inline size_t size_pointee(size_t offset, T const* src) {
+  return src ? C::size(reserve<T>(offset, 1), *src) : offset;
+}
+
+template <typename C, typename T>
+inline T* copy_pointee(cursor& c, T const* src) {
+  return copy_each<C>(c, src, 1);
+}
+
+inline size_t size_string(size_t offset, char const* src) {
+  return src ? offset + std::strlen(src) + 1 : offset;
+}
+
+inline char* copy_string(cursor& c, char const* src) {
+  return src ? copy_range(c, src, std::strlen(src) + 1) : nullptr;
+}
+
+inline size_t size_strings(size_t offset, char const* const* src, size_t n) {
+  if (!src) {
+    return offset;
+  }
+  offset = reserve<char const*>(offset, n);
+  for (size_t i = 0; i < n; ++i) {
+    offset = size_string(offset, src[i]);
+  }
+  return offset;
+}
+
+inline char const** copy_strings(cursor& c, char const* const* src, size_t n) {
+  if (!src) {
+    return nullptr;
+  }
+  char const** dst = c.take<char const*>(n);
+  for (size_t i = 0; i < n; ++i) {
+    dst[i] = copy_string(c, src[i]);
+  }
+  return dst;
+}
+
+// Common beginning of all structs that can be part of a pNext chain. Shared
+// with the other vkgen headers.
+#ifndef VKGEN_CHAIN_LINK_DEFINED
+#define VKGEN_CHAIN_LINK_DEFINED
+struct chain_link {
+  VkStructureType sType;
+  void const* pNext;
+};
+#endif
+
+// Defined after all structs since any of them may be part of a chain
+inline size_t size_next(size_t offset, void const* src);
+inline void* copy_next(cursor& c, void const* src);
+
+} // detail
+
+// Computes the size of the data reachable from a struct and copies it.
+// Structs without pointers to follow use this primary template, which has
+// nothing to do beyond the plain copy made by the caller.
+template <typename T>
+struct deep_copier {
+  static size_t size(size_t offset, T const&) { return offset; }
+  static void fill(T&, T const&, detail::cursor&) {}
+};
+)";
+}
+
+CppDeepCopyGenerator::~CppDeepCopyGenerator() {
+  header << endl;
+  header << "#endif // VK_DEEP_COPY_INCLUDE" << endl;
+
+  cpp << endl;
+  cpp << "} // vkgen" << endl;
+
+  delete ind_h;
+
+  header.close();
+  cpp.close();
+}
+
+void CppDeepCopyGenerator::gen_struct(vkspec::Struct* t) {
+  _structs.push_back(t);
+
+  if (!needs_copier(t)) {
+    return;
+  }
+
+  header << endl;
+  print_protect_begin(header, t);
+  write_copier(t);
+  print_protect_end(header, t);
+
+  if (!t->extends().empty() && structure_type(t) != "") {
+    _chain_structs.push_back(t);
+  }
+}
+
+void CppDeepCopyGenerator::end_extensions() {
+  header << endl;
+  write_next();
+  header << R"(
+template <typename T>
+T* deep_copy(T const& v, Arena& arena) {
+  detail::cursor c(arena.allocate(deep_copier<T>::size(sizeof(T), v)));
+  T* dst = c.take<T>(1);
+  *dst = v;
+  deep_copier<T>::fill(*dst, v, c);
+  return dst;
+}
+)";
+
+  header << endl;
+  header << "#if defined(VKGEN_EXTERN_TEMPLATES)" << endl;
+  for (auto t : _structs) {
+    print_protect_begin(header, t);
+    header << "extern template " << t->name() << "* deep_copy<" << t->name() << ">(" << t->name() << " const&, Arena&);" << endl;
+    print_protect_end(header, t);
+
+    print_protect_begin(cpp, t);
+    cpp << "template " << t->name() << "* deep_copy<" << t->name() << ">(" << t->name() << " const&, Arena&);" << endl;
+    print_protect_end(cpp, t);
+  }
+  header << "#endif" << endl;
+
+  header << endl;
+  header << "} // vkgen" << endl;
+}
+
+void CppDeepCopyGenerator::write_copier(vkspec::Struct* t) {
+  // Both functions must visit members in the same order
+  header << "template <> struct deep_copier<" << t->name() << "> {" << endl;
+  ind_h->increase();
+
+  header << "static size_t size(size_t offset, " << t->name() << " const& v) {" << endl;
+  ind_h->increase();
+  for (auto& m : t->members()) {
+    string pure = m.pure_type->name();
+    string v = "v." + m.name;
+    switch (graph_member(t, m)) {
+    case GraphMember::Value:
+    case GraphMember::Identity:
+      break;
+    case GraphMember::Struct:
+      if (needs_copier(m.pure_type->to_struct())) {
+        header << "offset = deep_copier<" << pure << ">::size(offset, " << v << ");" << endl;
+      }
+      break;
+    case GraphMember::StructArray:
+      if (needs_copier(m.pure_type->to_struct())) {
+        header << "offset = detail::size_each<deep_copier<" << pure << ">>(offset, " << v << ");" << endl;
+      }
+      break;
+    case GraphMember::Range:
+      header << "offset = detail::size_range(offset, " << v << ", " << len_expression(t, m, "v") << ");" << endl;
+      break;
+    case GraphMember::StructRange:
+      header << "offset = detail::size_each<deep_copier<" << pure << ">>(offset, " << v << ", " << len_expression(t, m, "v") << ");" << endl;
+      break;
+    case GraphMember::Pointee:
+      header << "offset = detail::size_pointee<deep_copier<" << pure << ">>(offset, " << v << ");" << endl;
+      break;
+    case GraphMember::String:
+      header << "offset = detail::size_string(offset, " << v << ");" << endl;
+      break;
+    case GraphMember::Strings:
+      header << "offset = detail::size_strings(offset, " << v << ", " << len_expression(t, m, "v") << ");" << endl;
+      break;
+    case GraphMember::Next:
+      header << "offset = detail::size_next(offset, " << v << ");" << endl;
+      break;
+    }
+  }
+  header << "return offset;" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+
+  header << "static void fill(" << t->name() << "& dst, " << t->name() << " const& src, detail::cursor& c) {" << endl;
+  ind_h->increase();
+  for (auto& m : t->members()) {
+    string pure = m.pure_type->name();
+    string dst = "dst." + m.name;
+    string src = "src." + m.name;
+    switch (graph_member(t, m)) {
+    case GraphMember::Value:
+    case GraphMember::Identity:
+      break;
+    case GraphMember::Struct:
+      if (needs_copier(m.pure_type->to_struct())) {
+        header << "deep_copier<" << pure << ">::fill(" << dst << ", " << src << ", c);" << endl;
+      }
+      break;
+    case GraphMember::StructArray:
+      if (needs_copier(m.pure_type->to_struct())) {
+        header << "detail::fill_each<deep_copier<" << pure << ">>(" << dst << ", " << src << ", c);" << endl;
+      }
+      break;
+    case GraphMember::Range:
+      header << dst << " = detail::copy_range(c, " << src << ", " << len_expression(t, m, "src") << ");" << endl;
+      break;
+    case GraphMember::StructRange:
+      header << dst << " = detail::copy_each<deep_copier<" << pure << ">>(c, " << src << ", " << len_expression(t, m, "src") << ");" << endl;
+      break;
+    case GraphMember::Pointee:
+      header << dst << " = detail::copy_pointee<deep_copier<" << pure << ">>(c, " << src << ");" << endl;
+      break;
+    case GraphMember::String:
+      header << dst << " = detail::copy_string(c, " << src << ");" << endl;
+      break;
+    case GraphMember::Strings:
+      header << dst << " = detail::copy_strings(c, " << src << ", " << len_expression(t, m, "src") << ");" << endl;
+      break;
+    case GraphMember::Next:
+      header << dst << " = detail::copy_next(c, " << src << ");" << endl;
+      break;
+    }
+  }
+  ind_h->decrease();
+  header << "}" << endl;
+
+  ind_h->decrease();
+  header << "};" << endl;
+}
+
+void CppDeepCopyGenerator::write_next() {
+  header << "namespace detail {" << endl;
+  header << endl;
+
+  header << "inline size_t size_next(size_t offset, void const* src) {" << endl;
+  ind_h->increase();
+  header << "if (!src) {" << endl;
+  ind_h->increase();
+  header << "return offset;" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  header << "switch (static_cast<chain_link const*>(src)->sType) {" << endl;
+  for (auto t : _chain_structs) {
+    print_protect_begin(header, t);
+    header << "case " << structure_type(t) << ":" << endl;
+    ind_h->increase();
+    header << "return size_pointee<deep_copier<" << t->name() << ">>(offset, static_cast<" << t->name() << " const*>(src));" << endl;
+    ind_h->decrease();
+    print_protect_end(header, t);
+  }
+  header << "default:" << endl;
+  ind_h->increase();
+  header << "return offset; // Referenced, not copied" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  header << endl;
+
+  header << "inline void* copy_next(cursor& c, void const* src) {" << endl;
+  ind_h->increase();
+  header << "if (!src) {" << endl;
+  ind_h->increase();
+  header << "return nullptr;" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  header << "switch (static_cast<chain_link const*>(src)->sType) {" << endl;
+  for (auto t : _chain_structs) {
+    print_protect_begin(header, t);
+    header << "case " << structure_type(t) << ":" << endl;
+    ind_h->increase();
+    header << "return copy_pointee<deep_copier<" << t->name() << ">>(c, static_cast<" << t->name() << " const*>(src));" << endl;
+    ind_h->decrease();
+    print_protect_end(header, t);
+  }
+  header << "default:" << endl;
+  ind_h->increase();
+  header << "return const_cast<void*>(src);" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+
+  header << endl;
+  header << "} // detail" << endl;
+}
+
+// A struct needs a copier if it has data to follow, directly or through
+// struct members held by value
+bool CppDeepCopyGenerator::needs_copier(vkspec::Struct* t) {
+  auto it = _needs_copier.find(t->name());
+  if (it != _needs_copier.end()) {
+    return it->second;
+  }
+
+  bool result = false;
+  if (!t->is_union()) {
+    for (auto& m : t->members()) {
+      switch (graph_member(t, m)) {
+      case GraphMember::Value:
+      case GraphMember::Identity:
+        break;
+      case GraphMember::Struct:
+      case GraphMember::StructArray:
+        result = result || needs_copier(m.pure_type->to_struct());
+        break;
+      default:
+        result = true;
+        break;
+      }
+    }
+  }
+
+  _needs_copier[t->name()] = result;
+  return result;
+}
@@ -0,0 +1,62 @@
+#ifndef CPP_DEEP_COPY_INCLUDE
+#define CPP_DEEP_COPY_INCLUDE
+
+#include "vkspec.h"
+#include "cpp_struct_graph.h"
+#include "indenting_stream_buf.h"
+#include <fstream>
+#include <map>
+
+// Generates vk_deep_copy.h containing vkgen::deep_copy, which copies a struct
+// together with everything reachable through its len annotated arrays,
+// strings, struct pointers and pNext chain into a single block taken from a
+// vkgen::Arena. A first pass computes the size of the graph and a second pass
+// fills the block, so both passes visit members in the same order. The
+// accompanying vk_deep_copy.cpp explicitly instantiates deep_copy for every
+// struct, for use with VKGEN_EXTERN_TEMPLATES.
+class CppDeepCopyGenerator : public vkspec::IGenerator {
+public:
+  CppDeepCopyGenerator(std::string const& out_dir, std::string const& license, int major, int minor, int patch);
+  ~CppDeepCopyGenerator();
+
+  virtual void begin_core() override final {}
+  virtual void end_core() override final {}
+  virtual void gen_scalar_typedef(vkspec::ScalarTypedef* t) override final {}
+  virtual void gen_function_typedef(vkspec::FunctionTypedef* t) override final {}
+  virtual void gen_handle_typedef(vkspec::HandleTypedef* t) override final {}
+  virtual void gen_struct(vkspec::Struct* t) override final;
+  virtual void gen_enum(vkspec::Enum* t) override final {}
+  virtual void gen_api_constant(vkspec::ApiConstant* t) override final {}
+  virtual void gen_bitmasks(vkspec::Bitmasks* t) override final {}
+  virtual void begin_entry() override final {}
+  virtual void gen_entry_command(vkspec::Command* c) override final {}
+  virtual void end_entry() override final {}
+  virtual void begin_global_commands() override final {}
+  virtual void gen_global_command(vkspec::Command* c) override final {}
+  virtual void end_global_commands() override final {}
+  virtual void begin_instance_commands() override final {}
+  virtual void gen_instance_command(vkspec::Command* c) override final {}
+  virtual void end_instance_commands() override final {}
+  virtual void begin_device_commands() override final {}
+  virtual void gen_device_command(vkspec::Command* c) override final {}
+  virtual void end_device_commands() override final {}
+  virtual void begin_extensions() override final {}
+  virtual void end_extensions() override final;
+  virtual void begin_extension(vkspec::Extension* e) override final {}
+  virtual void end_extension(vkspec::Extension* e) override final {}
+
+private:
+  void write_copier(vkspec::Struct* t);
+  void write_next();
+  bool needs_copier(vkspec::Struct* t);
+
+private:
+  std::ofstream header;
+  std::ofstream cpp;
+  IndentingOStreambuf* ind_h = nullptr;
+  std::vector<vkspec::Struct*> _structs;
+  std::vector<vkspec::Struct*> _chain_structs; // Structs that may appear in a pNext chain
+  std::map<std::string, bool> _needs_copier; // Memoized per struct name
+};
+
+#endif
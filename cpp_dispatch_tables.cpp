@@ -147,7 +147,7 @@ void print_load_device_proc(ofstream& file, IndentingOStreambuf* ind, string con
   }
 }
 
-CppDispatchTableGenerator::CppDispatchTableGenerator(string const& out_dir, string const& license, int major, int minor, int patch) {
+CppDispatchTableGenerator::CppDispatchTableGenerator(string const& out_dir, string const& license, int major, int minor, int patch, bool shard, size_t max_commands_per_shard) : _out_dir(out_dir), _shard(shard), _max_commands_per_shard(max_commands_per_shard) {
   header.open(out_dir + "/vk_dispatch_tables.h");
   cpp.open(out_dir + "/vk_dispatch_tables.cpp");
   if (!header.is_open() || !cpp.is_open()) {
@@ -168,9 +168,6 @@ CppDispatchTableGenerator::CppDispatchTableGenerator(string const& out_dir, stri
   header << "#include \"vulkan_include.inl\"" << endl;
   header << "#include <stdexcept>" << endl;
   header << "#include <string>" << endl;
-  header << "#if defined(_WIN32)" << endl;
-  header << "#include <Windows.h>" << endl;
-  header << "#endif" << endl;
   header << endl;
   header << "namespace vkgen {" << endl;
   header << R"(
@@ -189,6 +186,11 @@ private:
   cpp << "#include \"vk_dispatch_tables.h\"" << endl;
   cpp << endl;
   cpp << "#include <stdexcept>" << endl;
+  cpp << "#if defined(_WIN32)" << endl;
+  cpp << "#include <Windows.h>" << endl;
+  cpp << "#elif defined(__linux__)" << endl;
+  cpp << "#include <dlfcn.h>" << endl;
+  cpp << "#endif" << endl;
   cpp << endl;
   cpp << "namespace vkgen {" << endl;
 }
@@ -223,13 +225,9 @@ void CppDispatchTableGenerator::gen_global_command(vkspec::Command* c) {
 void CppDispatchTableGenerator::end_global_commands() {
   header << R"(
 class GlobalFunctions {
-#if defined(_WIN32)
-  typedef HMODULE library_handle;
-#elif defined(__linux__)
+  // HMODULE on Windows. Kept opaque so that platform headers are only
+  // included by the implementation.
   typedef void* library_handle;
-#else
-#error "Unsupported OS"
-#endif
 
 public:
   GlobalFunctions(std::string const& vulkan_library);
@@ -286,7 +284,7 @@ GlobalFunctions::GlobalFunctions(std::string const& vulkan_library) {
 
 #if defined(_WIN32)
   vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
-      GetProcAddress(library_, "vkGetInstanceProcAddr"));
+      GetProcAddress(static_cast<HMODULE>(library_), "vkGetInstanceProcAddr"));
 #elif defined(__linux__)
   vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
       dlsym(library_, "vkGetInstanceProcAddr"));
@@ -310,7 +308,7 @@ GlobalFunctions::GlobalFunctions(std::string const& vulkan_library) {
   cpp << R"(
 GlobalFunctions::~GlobalFunctions() {
 #if defined(_WIN32)
-  FreeLibrary(library_);
+  FreeLibrary(static_cast<HMODULE>(library_));
 #elif defined(__linux__)
   dlclose(library_);
 #else
@@ -399,14 +397,68 @@ void CppDispatchTableGenerator::end_extensions() {
     ind_h->decrease();
 
     header << "};" << endl;
+  }
+
+  if (!_shard) {
+    for (auto& table : tables_) {
+      write_table_cpp(table, cpp, ind_cpp, 0, table.commands.size(), true);
+    }
+    return;
+  }
 
-    cpp << "/*" << endl;
-    cpp << " * ------------------------------------------------------" << endl;
-    cpp << " * " << class_name << endl;
-    cpp << " * ------------------------------------------------------" << endl;
-    cpp << "*/" << endl;
-    cpp << endl;
+  // Each table goes to its own source file, and tables with more than
+  // |_max_commands_per_shard| commands are split further. The constructor
+  // loading all pointers of a table lives in its first shard.
+  vector<string> shards = { "vk_dispatch_tables.cpp" };
+  for (auto& table : tables_) {
+    size_t count = table.commands.size();
+    size_t per_shard = (_max_commands_per_shard != 0 && count != 0) ? _max_commands_per_shard : max<size_t>(count, 1);
+    size_t parts = max<size_t>((count + per_shard - 1) / per_shard, 1);
+
+    for (size_t part = 0; part < parts; ++part) {
+      string name = "vk_dispatch_tables_" + table.dispatchable_object_snake_case;
+      if (parts > 1) {
+        name += "_" + to_string(part + 1);
+      }
+      name += ".cpp";
+
+      ofstream shard(_out_dir + "/" + name);
+      if (!shard.is_open()) {
+        throw std::runtime_error("Failed to open file for output");
+      }
+      IndentingOStreambuf ind(shard, 2);
 
+      shard << "#include \"vk_dispatch_tables.h\"" << endl;
+      shard << endl;
+      shard << "namespace vkgen {" << endl;
+      shard << endl;
+
+      size_t first = part * per_shard;
+      write_table_cpp(table, shard, &ind, first, min(first + per_shard, count), part == 0);
+
+      shard << "} // vkgen" << endl;
+
+      shards.push_back(name);
+    }
+  }
+
+  write_unity(shards);
+}
+
+// Writes the implementation of |table|, limited to the wrappers of commands
+// in [first, last). The constructor and the special cased commands are only
+// written if |first_part| is set.
+void CppDispatchTableGenerator::write_table_cpp(DispatchTable& table, ofstream& cpp, IndentingOStreambuf* ind_cpp, size_t first, size_t last, bool first_part) {
+  string class_name = table.dispatchable_object.substr(2) + "Functions";
+
+  cpp << "/*" << endl;
+  cpp << " * ------------------------------------------------------" << endl;
+  cpp << " * " << class_name << endl;
+  cpp << " * ------------------------------------------------------" << endl;
+  cpp << "*/" << endl;
+  cpp << endl;
+
+  if (first_part) {
     // Special case: add vkGetInstanceProcAddr for convenience
     if (table.dispatchable_object == "VkInstance") {
       print_func_wrapper_cpp(cpp, ind_cpp, _entry_command, class_name, table.dispatchable_object_snake_case + "_");
@@ -416,59 +468,92 @@ void CppDispatchTableGenerator::end_extensions() {
     else if (table.dispatchable_object == "VkDevice") {
       print_func_wrapper_cpp(cpp, ind_cpp, get_device_proc_, class_name, table.dispatchable_object_snake_case + "_");
     }
+  }
 
-    for (auto c : table.commands) {
-      print_func_wrapper_cpp(cpp, ind_cpp, c, class_name, table.dispatchable_object_snake_case + "_");
-    }
+  for (size_t i = first; i < last; ++i) {
+    print_func_wrapper_cpp(cpp, ind_cpp, table.commands[i], class_name, table.dispatchable_object_snake_case + "_");
+  }
+
+  if (!first_part) {
+    return;
+  }
 
-    cpp << class_name << "::" << class_name << "(";
+  cpp << class_name << "::" << class_name << "(";
 
-    if (table.dispatchable_object == "VkInstance") {
-      cpp << table.dispatchable_object << " " << table.dispatchable_object_snake_case << ", GlobalFunctions* globals";
-    } else if (table.dispatchable_object == "VkDevice") {
-      cpp << table.dispatchable_object << " " << table.dispatchable_object_snake_case << ", InstanceFunctions* instance";
-    } else if (table.classification == vkspec::CommandClassification::Instance) {
-      cpp << table.dispatchable_object << " " << table.dispatchable_object_snake_case << ", InstanceFunctions* instance";
-    } else {
-      assert(table.classification == vkspec::CommandClassification::Device);
-      cpp << table.dispatchable_object << " " << table.dispatchable_object_snake_case << ", DeviceFunctions* device";
-    }
+  if (table.dispatchable_object == "VkInstance") {
+    cpp << table.dispatchable_object << " " << table.dispatchable_object_snake_case << ", GlobalFunctions* globals";
+  } else if (table.dispatchable_object == "VkDevice") {
+    cpp << table.dispatchable_object << " " << table.dispatchable_object_snake_case << ", InstanceFunctions* instance";
+  } else if (table.classification == vkspec::CommandClassification::Instance) {
+    cpp << table.dispatchable_object << " " << table.dispatchable_object_snake_case << ", InstanceFunctions* instance";
+  } else {
+    assert(table.classification == vkspec::CommandClassification::Device);
+    cpp << table.dispatchable_object << " " << table.dispatchable_object_snake_case << ", DeviceFunctions* device";
+  }
 
-    cpp << ") {" << endl;
+  cpp << ") {" << endl;
 
-    ind_cpp->increase();
+  ind_cpp->increase();
 
-    cpp << table.dispatchable_object_snake_case << "_ = " << table.dispatchable_object_snake_case << ";" << endl;
+  cpp << table.dispatchable_object_snake_case << "_ = " << table.dispatchable_object_snake_case << ";" << endl;
 
-    if (table.dispatchable_object == "VkInstance") {
-      print_load_instance_proc(cpp, ind_cpp, "globals", "instance", _entry_command);
-      for (auto c : table.commands) {
-        print_load_instance_proc(cpp, ind_cpp, "this", nullptr, c);
-      }
+  if (table.dispatchable_object == "VkInstance") {
+    print_load_instance_proc(cpp, ind_cpp, "globals", "instance", _entry_command);
+    for (auto c : table.commands) {
+      print_load_instance_proc(cpp, ind_cpp, "this", nullptr, c);
     }
-    else if (table.dispatchable_object == "VkDevice") {
-      print_load_instance_proc(cpp, ind_cpp, "instance", nullptr, get_device_proc_);
-      for (auto c : table.commands) {
-        print_load_device_proc(cpp, ind_cpp, "this", c);
-      }
+  }
+  else if (table.dispatchable_object == "VkDevice") {
+    print_load_instance_proc(cpp, ind_cpp, "instance", nullptr, get_device_proc_);
+    for (auto c : table.commands) {
+      print_load_device_proc(cpp, ind_cpp, "this", c);
     }
-    else if (table.classification == vkspec::CommandClassification::Instance) {
-      for (auto c : table.commands) {
-        print_load_instance_proc(cpp, ind_cpp, "instance", nullptr, c);
-      }
+  }
+  else if (table.classification == vkspec::CommandClassification::Instance) {
+    for (auto c : table.commands) {
+      print_load_instance_proc(cpp, ind_cpp, "instance", nullptr, c);
     }
-    else {
-      assert(table.classification == vkspec::CommandClassification::Device);
-      for (auto c : table.commands) {
-        print_load_device_proc(cpp, ind_cpp, "device", c);
-      }
+  }
+  else {
+    assert(table.classification == vkspec::CommandClassification::Device);
+    for (auto c : table.commands) {
+      print_load_device_proc(cpp, ind_cpp, "device", c);
     }
+  }
 
-    ind_cpp->decrease();
+  ind_cpp->decrease();
+
+  cpp << "}" << endl;
+  cpp << endl;
+}
+
+void CppDispatchTableGenerator::write_unity(vector<string> const& shards) {
+  ofstream unity(_out_dir + "/vk_dispatch_tables_unity.cpp");
+  ofstream cmake(_out_dir + "/vk_dispatch_tables.cmake");
+  if (!unity.is_open() || !cmake.is_open()) {
+    throw std::runtime_error("Failed to open files for output");
+  }
+
+  unity << "// Combines the sharded dispatch table sources into a single translation unit." << endl;
+  for (auto& shard : shards) {
+    unity << "#include \"" << shard << "\"" << endl;
+  }
 
-    cpp << "}" << endl;
-    cpp << endl;
+  cmake << "# Sources of the vkgen dispatch tables. Either every shard is compiled on its" << endl;
+  cmake << "# own, or with VKGEN_UNITY_BUILD enabled only the source that includes them all." << endl;
+  cmake << "option(VKGEN_UNITY_BUILD \"Compile the vkgen dispatch tables as a single translation unit\" OFF)" << endl;
+  cmake << endl;
+  cmake << "if(VKGEN_UNITY_BUILD)" << endl;
+  cmake << "  set(VKGEN_DISPATCH_TABLE_SOURCES" << endl;
+  cmake << "    ${CMAKE_CURRENT_LIST_DIR}/vk_dispatch_tables_unity.cpp" << endl;
+  cmake << "  )" << endl;
+  cmake << "else()" << endl;
+  cmake << "  set(VKGEN_DISPATCH_TABLE_SOURCES" << endl;
+  for (auto& shard : shards) {
+    cmake << "    ${CMAKE_CURRENT_LIST_DIR}/" << shard << endl;
   }
+  cmake << "  )" << endl;
+  cmake << "endif()" << endl;
 }
 
 void CppDispatchTableGenerator::end_extension(vkspec::Extension* e) {
@@ -5,9 +5,16 @@
 #include "indenting_stream_buf.h"
 #include <fstream>
 
+// Generates vk_dispatch_tables.h and its implementation. By default the
+// implementation is written to vk_dispatch_tables.cpp. With |shard| set, that
+// file only keeps GlobalFunctions and every other table class is written to
+// its own source file, split further into files of at most
+// |max_commands_per_shard| commands if that is not 0. The shards are listed in
+// vk_dispatch_tables.cmake, and vk_dispatch_tables_unity.cpp includes them all
+// for unity builds.
 class CppDispatchTableGenerator : public vkspec::IGenerator {
 public:
-  CppDispatchTableGenerator(std::string const& out_dir, std::string const& license, int major, int minor, int patch);
+  CppDispatchTableGenerator(std::string const& out_dir, std::string const& license, int major, int minor, int patch, bool shard = false, size_t max_commands_per_shard = 0);
   ~CppDispatchTableGenerator();
 
   virtual void begin_core() override final {}
@@ -46,6 +53,8 @@ private:
 
 private:
   void preprocess_command(vkspec::Command* c);
+  void write_table_cpp(DispatchTable& table, std::ofstream& cpp, IndentingOStreambuf* ind_cpp, size_t first, size_t last, bool first_part);
+  void write_unity(std::vector<std::string> const& shards);
 
 private:
   std::ofstream header;
@@ -56,6 +65,9 @@ private:
   std::vector<vkspec::Command*> _global_commands;
   vkspec::Command* get_device_proc_ = nullptr;
   std::vector<DispatchTable> tables_;
+  std::string _out_dir;
+  bool _shard = false;
+  size_t _max_commands_per_shard = 0;
 };
 
 class CppTranslator : public vkspec::ITranslator {
@@ -85,7 +97,8 @@ class CppTranslator : public vkspec::ITranslator {
   }
 
   virtual std::string array_member(std::string const& type_name, std::string const& array_size) override final {
-    return ""; // Not implemented
+    // Array size is dealt with when printing
+    return type_name;
   }
 
   virtual std::string array_param(std::string const& type_name, std::string const& array_size, bool const_modifier) override final {
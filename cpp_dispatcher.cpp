@@ -0,0 +1,233 @@
+#include "cpp_dispatcher.h"
+
+using namespace std;
+
+CppDispatcherGenerator::CppDispatcherGenerator(string const& out_dir, string const& license, int major, int minor, int patch) {
+  header.open(out_dir + "/vk_dispatcher.h");
+  if (!header.is_open()) {
+    throw std::runtime_error("Failed to open file for output");
+  }
+
+  ind_h = new IndentingOStreambuf(header, 2);
+
+  header << license << endl;
+  header << endl;
+  header << "// Dispatchers for Vulkan " << major << "." << minor << "." << patch << ", generated from the Khronos Vulkan API XML Registry." << endl;
+  header << "// See https://github.com/andens/Vulkan-Hpp for generator details." << endl;
+  header << endl;
+  header << "#ifndef VK_DISPATCHER_INCLUDE" << endl;
+  header << "#define VK_DISPATCHER_INCLUDE" << endl;
+  header << endl;
+  header << "#include \"vk_dispatch_tables.h\"" << endl;
+  header << endl;
+  header << "namespace vkgen {" << endl;
+}
+
+CppDispatcherGenerator::~CppDispatcherGenerator() {
+  header << endl;
+  header << "} // vkgen" << endl;
+  header << endl;
+  header << "#endif // VK_DISPATCHER_INCLUDE" << endl;
+
+  delete ind_h;
+
+  header.close();
+}
+
+void CppDispatcherGenerator::gen_entry_command(vkspec::Command* c) {
+  assert(!_entry_command);
+  _entry_command = c;
+}
+
+void CppDispatcherGenerator::gen_global_command(vkspec::Command* c) {
+  _global_commands.push_back(c);
+}
+
+void CppDispatcherGenerator::gen_instance_command(vkspec::Command* c) {
+  add_command(c);
+}
+
+void CppDispatcherGenerator::gen_device_command(vkspec::Command* c) {
+  add_command(c);
+}
+
+void CppDispatcherGenerator::end_extension(vkspec::Extension* e) {
+  for (auto c : e->commands()) {
+    add_command(c);
+  }
+}
+
+void CppDispatcherGenerator::end_extensions() {
+  write_static();
+  write_dynamic();
+}
+
+void CppDispatcherGenerator::add_command(vkspec::Command* c) {
+  if (c->classification() == vkspec::CommandClassification::Device) {
+    _device_commands.push_back(c);
+  }
+  else {
+    assert(c->classification() == vkspec::CommandClassification::Instance);
+    _instance_commands.push_back(c);
+  }
+}
+
+void CppDispatcherGenerator::write_static() {
+  header << R"(
+// Calls the prototypes exported by the Vulkan loader. Wrappers use this as
+// the default dispatcher, which is the same as calling the commands directly:
+//
+//   template <typename Dispatch = vkgen::DispatchLoaderStatic>
+//   void pushConstants(..., Dispatch const& d = Dispatch()) const {
+//     d.vkCmdPushConstants(m_commandBuffer, ...);
+//   }
+#if !defined(VK_NO_PROTOTYPES)
+class DispatchLoaderStatic {
+public:
+)";
+
+  ind_h->increase();
+  write_forwarder(_entry_command);
+  for (auto c : _global_commands) {
+    write_forwarder(c);
+  }
+  for (auto c : _instance_commands) {
+    write_forwarder(c);
+  }
+  for (auto c : _device_commands) {
+    write_forwarder(c);
+  }
+  ind_h->decrease();
+
+  header << "};" << endl;
+  header << "#endif" << endl;
+}
+
+void CppDispatcherGenerator::write_dynamic() {
+  header << R"(
+// Holds command pointers fetched through the vkgen dispatch tables. Global
+// and instance level commands are resolved with vkGetInstanceProcAddr, while
+// device level commands (including everything recorded into a command buffer)
+// are resolved with vkGetDeviceProcAddr and therefore call into the driver
+// without passing through a loader trampoline. Pointers are public and named
+// after their commands so that the dispatcher can be passed wherever a
+// DispatchLoaderStatic is accepted. Only one device should be loaded into a
+// given dispatcher.
+class DispatchLoaderDynamic {
+public:
+  DispatchLoaderDynamic() = default;
+  explicit DispatchLoaderDynamic(GlobalFunctions const& globals) { init(globals); }
+  DispatchLoaderDynamic(InstanceFunctions const& instance, DeviceFunctions const& device) { init(instance); init(device); }
+
+)";
+
+  ind_h->increase();
+
+  header << "void init(GlobalFunctions const& globals) {" << endl;
+  ind_h->increase();
+  write_loads(_global_commands, "globals.vkGetInstanceProcAddr(nullptr, ");
+  ind_h->decrease();
+  header << "}" << endl;
+  header << endl;
+
+  // vkGetInstanceProcAddr is only guaranteed to return itself when queried
+  // with a valid instance, so it is loaded together with the instance
+  // level commands.
+  header << "void init(InstanceFunctions const& instance) {" << endl;
+  ind_h->increase();
+  write_loads({ _entry_command }, "instance.vkGetInstanceProcAddr(");
+  write_loads(_instance_commands, "instance.vkGetInstanceProcAddr(");
+  ind_h->decrease();
+  header << "}" << endl;
+  header << endl;
+
+  header << "void init(DeviceFunctions const& device) {" << endl;
+  ind_h->increase();
+  write_loads(_device_commands, "device.vkGetDeviceProcAddr(");
+  ind_h->decrease();
+  header << "}" << endl;
+  header << endl;
+
+  vector<vkspec::Command*> commands = { _entry_command };
+  commands.insert(commands.end(), _global_commands.begin(), _global_commands.end());
+  commands.insert(commands.end(), _instance_commands.begin(), _instance_commands.end());
+  commands.insert(commands.end(), _device_commands.begin(), _device_commands.end());
+  for (auto c : commands) {
+    if (c->extension() && c->extension()->protect() != "") {
+      ind_h->decrease();
+      header << "#if defined(" << c->extension()->protect() << ")" << endl;
+      ind_h->increase();
+    }
+
+    header << "PFN_" << c->name() << " " << c->name() << " = nullptr;" << endl;
+
+    if (c->extension() && c->extension()->protect() != "") {
+      ind_h->decrease();
+      header << "#endif" << endl;
+      ind_h->increase();
+    }
+  }
+
+  ind_h->decrease();
+  header << "};" << endl;
+}
+
+void CppDispatcherGenerator::write_forwarder(vkspec::Command* c) {
+  if (c->extension() && c->extension()->protect() != "") {
+    ind_h->decrease();
+    header << "#if defined(" << c->extension()->protect() << ")" << endl;
+    ind_h->increase();
+  }
+
+  header << c->complete_return_type() << " " << c->name() << "(";
+  string comma = "";
+  for (auto& p : c->params()) {
+    header << comma << p.complete_type << " " << p.name;
+    if (p.array_size != "") {
+      header << "[" << p.array_size << "]";
+    }
+    comma = ", ";
+  }
+  header << ") const { return ::" << c->name() << "(";
+  comma = "";
+  for (auto& p : c->params()) {
+    header << comma << p.name;
+    comma = ", ";
+  }
+  header << "); }" << endl;
+
+  if (c->extension() && c->extension()->protect() != "") {
+    ind_h->decrease();
+    header << "#endif" << endl;
+    ind_h->increase();
+  }
+}
+
+// |get_proc_addr| is the call expression up to and including the parenthesis
+// that precedes the command name.
+void CppDispatcherGenerator::write_loads(vector<vkspec::Command*> const& commands, string const& get_proc_addr) {
+  for (auto c : commands) {
+    if (c->extension() && c->extension()->protect() != "") {
+      ind_h->decrease();
+      header << "#if defined(" << c->extension()->protect() << ")" << endl;
+      ind_h->increase();
+    }
+
+    header << c->name() << " = reinterpret_cast<PFN_" << c->name() << ">(" << get_proc_addr << "\"" << c->name() << "\"));" << endl;
+
+    // Core functions must be present
+    if (!c->extension()) {
+      header << "if (!" << c->name() << ") {" << endl;
+      ind_h->increase();
+      header << "throw VulkanProcNotFound(\"" << c->name() << "\");" << endl;
+      ind_h->decrease();
+      header << "}" << endl;
+    }
+
+    if (c->extension() && c->extension()->protect() != "") {
+      ind_h->decrease();
+      header << "#endif" << endl;
+      ind_h->increase();
+    }
+  }
+}
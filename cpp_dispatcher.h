@@ -0,0 +1,63 @@
+#ifndef CPP_DISPATCHER_INCLUDE
+#define CPP_DISPATCHER_INCLUDE
+
+#include "vkspec.h"
+#include "indenting_stream_buf.h"
+#include <fstream>
+
+// Generates vk_dispatcher.h containing dispatchers for wrappers that take the
+// dispatch mechanism as a template parameter. A dispatcher exposes every
+// command under its C name and with its full C signature, so a wrapper calls
+// d.vkCmdPushConstants(commandBuffer, ...) regardless of the dispatcher used.
+// vkgen::DispatchLoaderStatic forwards to the loader prototypes and is the
+// default that keeps today's behavior. vkgen::DispatchLoaderDynamic holds
+// pointers fetched through the vkgen dispatch tables; device level commands
+// come from vkGetDeviceProcAddr and skip the loader trampoline.
+class CppDispatcherGenerator : public vkspec::IGenerator {
+public:
+  CppDispatcherGenerator(std::string const& out_dir, std::string const& license, int major, int minor, int patch);
+  ~CppDispatcherGenerator();
+
+  virtual void begin_core() override final {}
+  virtual void end_core() override final {}
+  virtual void gen_scalar_typedef(vkspec::ScalarTypedef* t) override final {}
+  virtual void gen_function_typedef(vkspec::FunctionTypedef* t) override final {}
+  virtual void gen_handle_typedef(vkspec::HandleTypedef* t) override final {}
+  virtual void gen_struct(vkspec::Struct* t) override final {}
+  virtual void gen_enum(vkspec::Enum* t) override final {}
+  virtual void gen_api_constant(vkspec::ApiConstant* t) override final {}
+  virtual void gen_bitmasks(vkspec::Bitmasks* t) override final {}
+  virtual void begin_entry() override final {}
+  virtual void gen_entry_command(vkspec::Command* c) override final;
+  virtual void end_entry() override final {}
+  virtual void begin_global_commands() override final {}
+  virtual void gen_global_command(vkspec::Command* c) override final;
+  virtual void end_global_commands() override final {}
+  virtual void begin_instance_commands() override final {}
+  virtual void gen_instance_command(vkspec::Command* c) override final;
+  virtual void end_instance_commands() override final {}
+  virtual void begin_device_commands() override final {}
+  virtual void gen_device_command(vkspec::Command* c) override final;
+  virtual void end_device_commands() override final {}
+  virtual void begin_extensions() override final {}
+  virtual void end_extensions() override final;
+  virtual void begin_extension(vkspec::Extension* e) override final {}
+  virtual void end_extension(vkspec::Extension* e) override final;
+
+private:
+  void add_command(vkspec::Command* c);
+  void write_static();
+  void write_dynamic();
+  void write_forwarder(vkspec::Command* c);
+  void write_loads(std::vector<vkspec::Command*> const& commands, std::string const& get_proc_addr);
+
+private:
+  std::ofstream header;
+  IndentingOStreambuf* ind_h = nullptr;
+  vkspec::Command* _entry_command = nullptr;
+  std::vector<vkspec::Command*> _global_commands;
+  std::vector<vkspec::Command*> _instance_commands;
+  std::vector<vkspec::Command*> _device_commands;
+};
+
+#endif
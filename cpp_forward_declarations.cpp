@@ -0,0 +1,100 @@
+#include "cpp_forward_declarations.h"
+
+using namespace std;
+
+CppForwardDeclarationGenerator::CppForwardDeclarationGenerator(string const& out_dir, string const& license, int major, int minor, int patch) {
+  header.open(out_dir + "/vk_fwd.h");
+  if (!header.is_open()) {
+    throw std::runtime_error("Failed to open file for output");
+  }
+
+  header << license << endl;
+  header << endl;
+  header << "// Forward declarations for Vulkan " << major << "." << minor << "." << patch << ", generated from the Khronos Vulkan API XML Registry." << endl;
+  header << "// See https://github.com/andens/Vulkan-Hpp for generator details." << endl;
+  header << endl;
+  header << "#ifndef VK_FWD_INCLUDE" << endl;
+  header << "#define VK_FWD_INCLUDE" << endl;
+  header << endl;
+  header << "#include <cstdint>" << endl;
+}
+
+CppForwardDeclarationGenerator::~CppForwardDeclarationGenerator() {
+  header << endl;
+  header << "#endif // VK_FWD_INCLUDE" << endl;
+
+  header.close();
+}
+
+void CppForwardDeclarationGenerator::gen_handle_typedef(vkspec::HandleTypedef* t) {
+  if (t->dispatchable()) {
+    _dispatchable_handles.push_back(t->name());
+  }
+  else {
+    _non_dispatchable_handles.push_back(t->name());
+  }
+}
+
+void CppForwardDeclarationGenerator::gen_struct(vkspec::Struct* t) {
+  _structs.push_back(t);
+}
+
+void CppForwardDeclarationGenerator::end_extensions() {
+  // Handles are declared exactly as vulkan.h does so that both headers can
+  // be included in any order.
+  header << endl;
+  for (auto& h : _dispatchable_handles) {
+    header << "typedef struct " << h << "_T* " << h << ";" << endl;
+  }
+
+  header << endl;
+  header << "#if defined(__LP64__) || defined(_WIN64) || (defined(__x86_64__) && !defined(__ILP32__) ) || defined(_M_X64) || defined(__ia64) || defined (_M_IA64) || defined(__aarch64__) || defined(__powerpc64__)" << endl;
+  for (auto& h : _non_dispatchable_handles) {
+    header << "typedef struct " << h << "_T* " << h << ";" << endl;
+  }
+  header << "#else" << endl;
+  for (auto& h : _non_dispatchable_handles) {
+    header << "typedef uint64_t " << h << ";" << endl;
+  }
+  header << "#endif" << endl;
+
+  header << endl;
+  for (auto t : _structs) {
+    string keyword = t->is_union() ? "union " : "struct ";
+    header << "typedef " << keyword << t->name() << " " << t->name() << ";" << endl;
+  }
+
+  header << endl;
+  header << "namespace vkgen {" << endl;
+  header << endl;
+
+  // vk_dispatch_tables.h
+  for (auto& h : _dispatchable_handles) {
+    header << "class " << h.substr(2) << "Functions;" << endl;
+  }
+  header << "class GlobalFunctions;" << endl;
+
+  // vk_dispatcher.h
+  header << "class DispatchLoaderStatic;" << endl;
+  header << "class DispatchLoaderDynamic;" << endl;
+
+  // vk_struct_hash.h
+  header << "template <typename T> struct hash;" << endl;
+  header << "template <typename T> struct equal_to;" << endl;
+  header << "template <typename T> struct deep_hash;" << endl;
+  header << "template <typename T> struct deep_equal_to;" << endl;
+
+  // vk_deep_copy.h
+  header << "class Arena;" << endl;
+  header << "template <typename T> struct deep_copier;" << endl;
+
+  // vk_command_stream.h
+  header << "class CommandStream;" << endl;
+
+  // vk_state_filter.h
+  header << "struct StateFilterCounters;" << endl;
+  header << "class StateFilter;" << endl;
+
+  header << endl;
+  header << "} // vkgen" << endl;
+}
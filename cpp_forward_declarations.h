@@ -0,0 +1,50 @@
+#ifndef CPP_FORWARD_DECLARATIONS_INCLUDE
+#define CPP_FORWARD_DECLARATIONS_INCLUDE
+
+#include "vkspec.h"
+#include <fstream>
+
+// Generates vk_fwd.h, declaring the Vulkan handles and structs as well as the
+// vkgen classes without including vulkan.h or any other generated header.
+// Headers that only pass these types around by pointer or reference can
+// include it instead and leave the full headers to the translation units
+// actually using them.
+class CppForwardDeclarationGenerator : public vkspec::IGenerator {
+public:
+  CppForwardDeclarationGenerator(std::string const& out_dir, std::string const& license, int major, int minor, int patch);
+  ~CppForwardDeclarationGenerator();
+
+  virtual void begin_core() override final {}
+  virtual void end_core() override final {}
+  virtual void gen_scalar_typedef(vkspec::ScalarTypedef* t) override final {}
+  virtual void gen_function_typedef(vkspec::FunctionTypedef* t) override final {}
+  virtual void gen_handle_typedef(vkspec::HandleTypedef* t) override final;
+  virtual void gen_struct(vkspec::Struct* t) override final;
+  virtual void gen_enum(vkspec::Enum* t) override final {}
+  virtual void gen_api_constant(vkspec::ApiConstant* t) override final {}
+  virtual void gen_bitmasks(vkspec::Bitmasks* t) override final {}
+  virtual void begin_entry() override final {}
+  virtual void gen_entry_command(vkspec::Command* c) override final {}
+  virtual void end_entry() override final {}
+  virtual void begin_global_commands() override final {}
+  virtual void gen_global_command(vkspec::Command* c) override final {}
+  virtual void end_global_commands() override final {}
+  virtual void begin_instance_commands() override final {}
+  virtual void gen_instance_command(vkspec::Command* c) override final {}
+  virtual void end_instance_commands() override final {}
+  virtual void begin_device_commands() override final {}
+  virtual void gen_device_command(vkspec::Command* c) override final {}
+  virtual void end_device_commands() override final {}
+  virtual void begin_extensions() override final {}
+  virtual void end_extensions() override final;
+  virtual void begin_extension(vkspec::Extension* e) override final {}
+  virtual void end_extension(vkspec::Extension* e) override final {}
+
+private:
+  std::ofstream header;
+  std::vector<std::string> _dispatchable_handles;
+  std::vector<std::string> _non_dispatchable_handles;
+  std::vector<vkspec::Struct*> _structs;
+};
+
+#endif
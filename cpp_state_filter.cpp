@@ -0,0 +1,471 @@
+#include "cpp_state_filter.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+namespace {
+
+// How a parameter is added to the key compared with the previous call
+enum class KeyParam {
+  Value, // Scalars, handles and structs passed by value
+  FixedArray, // Fixed size arrays
+  Range, // len annotated pointer
+  Pointee, // Single pointer to a struct
+  String, // Null terminated string
+  None, // Cannot be compared, so the command is not filtered
+};
+
+// Whether values of a type can be compared byte for byte. Structs reaching
+// other data through pointers, including pNext chains, cannot.
+bool is_flat(vkspec::Type* t) {
+  vkspec::Struct* s = t->to_struct();
+  if (!s) {
+    return true;
+  }
+  for (auto& m : s->members()) {
+    if (m.complete_type.find('*') != string::npos || !is_flat(m.pure_type)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+KeyParam key_param(vkspec::Command* c, vkspec::Command::Parameter const& p) {
+  if (!is_flat(p.pure_type)) {
+    return KeyParam::None;
+  }
+  if (p.array_size != "") {
+    return KeyParam::FixedArray;
+  }
+
+  size_t depth = count(p.complete_type.begin(), p.complete_type.end(), '*');
+  if (depth == 0) {
+    return KeyParam::Value;
+  }
+
+  // Pointers the command writes through are not state
+  if (depth > 1 || !p.const_modifier) {
+    return KeyParam::None;
+  }
+
+  if (p.len.empty()) {
+    return p.pure_type->to_struct() ? KeyParam::Pointee : KeyParam::None;
+  }
+  if (p.len.size() == 1 && p.len[0] == "null-terminated" && p.pure_type->name() == "char") {
+    return KeyParam::String;
+  }
+  return len_expression(c, p) == "" ? KeyParam::None : KeyParam::Range;
+}
+
+bool starts_with(string const& s, char const* prefix) {
+  return s.compare(0, strlen(prefix), prefix) == 0;
+}
+
+bool has_param(vkspec::Command* c, char const* type, char const* name = nullptr) {
+  for (auto& p : c->params()) {
+    if (p.pure_type->name() == type && (!name || p.name == name)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool is_state_setting(vkspec::Command* c) {
+  if (!starts_with(c->name(), "vkCmd")) {
+    return false;
+  }
+  if (!c->tasks().empty()) {
+    return c->tasks().size() == 1 && c->tasks()[0] == "state";
+  }
+
+  // Registries without tasks: commands binding objects or setting dynamic
+  // state may be recorded both inside and outside of render passes. This
+  // leaves out vkCmdSetEvent, which is recorded outside of them only.
+  return (starts_with(c->name(), "vkCmdBind") || starts_with(c->name(), "vkCmdSet")) && c->renderpass() == "both";
+}
+
+// Commands taking a pipeline layout and a set number bind descriptors to
+// sets, disturbing what other such commands bound
+bool binds_descriptor_sets(vkspec::Command* c) {
+  return has_param(c, "VkPipelineLayout") && (has_param(c, "uint32_t", "set") || has_param(c, "uint32_t", "firstSet"));
+}
+
+} // namespace
+
+CppStateFilterGenerator::CppStateFilterGenerator(string const& out_dir, string const& license, int major, int minor, int patch) {
+  header.open(out_dir + "/vk_state_filter.h");
+  if (!header.is_open()) {
+    throw std::runtime_error("Failed to open files for output");
+  }
+
+  ind_h = new IndentingOStreambuf(header, 2);
+
+  header << license << endl;
+  header << endl;
+  header << "// State filters for Vulkan " << major << "." << minor << "." << patch << ", generated from the Khronos Vulkan API XML Registry." << endl;
+  header << "// See https://github.com/andens/Vulkan-Hpp for generator details." << endl;
+  header << endl;
+  header << "#ifndef VK_STATE_FILTER_INCLUDE" << endl;
+  header << "#define VK_STATE_FILTER_INCLUDE" << endl;
+  header << endl;
+  header << "#include \"vk_dispatch_tables.h\"" << endl;
+  header << "#include <algorithm>" << endl;
+  header << "#include <cstdint>" << endl;
+  header << "#include <cstring>" << endl;
+  header << "#include <vector>" << endl;
+  header << endl;
+  header << "namespace vkgen {" << endl;
+}
+
+CppStateFilterGenerator::~CppStateFilterGenerator() {
+  header << endl;
+  header << "} // vkgen" << endl;
+  header << endl;
+  header << "#endif // VK_STATE_FILTER_INCLUDE" << endl;
+
+  delete ind_h;
+
+  header.close();
+}
+
+void CppStateFilterGenerator::gen_device_command(vkspec::Command* c) {
+  add_command(c);
+}
+
+void CppStateFilterGenerator::end_extension(vkspec::Extension* e) {
+  for (auto c : e->commands()) {
+    add_command(c);
+  }
+}
+
+// Same selection as CommandBufferFunctions
+void CppStateFilterGenerator::add_command(vkspec::Command* c) {
+  if (c->params().front().pure_type->name() != "VkCommandBuffer") {
+    return;
+  }
+  _commands.push_back(c);
+
+  if (!is_state_setting(c)) {
+    return;
+  }
+  for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+    if (key_param(c, *p) == KeyParam::None) {
+      return;
+    }
+  }
+
+  // A dropped call has no result to report
+  assert(c->complete_return_type() == "void");
+  _filtered.push_back(c);
+  _filtered_set.insert(c);
+}
+
+// Beginning or resetting the command buffer clears its state, and executing
+// secondary command buffers leaves it undefined
+bool CppStateFilterGenerator::invalidates_all(vkspec::Command* c) {
+  if (!starts_with(c->name(), "vkCmd")) {
+    return true;
+  }
+  for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+    if (p->pure_type->name() == "VkCommandBuffer") {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Filtered commands whose tracked state a call of |c| may change, other than
+// |c| itself
+vector<vkspec::Command*> CppStateFilterGenerator::invalidated_by(vkspec::Command* c) {
+  vector<vkspec::Command*> invalidated;
+  for (auto f : _filtered) {
+    if (f == c) {
+      continue;
+    }
+
+    // Variants of a command, such as vkCmdSetViewportWithCount or
+    // vkCmdBindVertexBuffers2, set the same state
+    bool variant = starts_with(c->name(), f->name().c_str()) || starts_with(f->name(), c->name().c_str());
+
+    // Binding a pipeline applies its static state over dynamic state and may
+    // leave push constants undefined. Bound objects are left alone.
+    bool overridden = has_param(c, "VkPipeline") && !starts_with(f->name(), "vkCmdBind");
+
+    bool disturbed = binds_descriptor_sets(c) && binds_descriptor_sets(f);
+
+    if (variant || overridden || disturbed) {
+      invalidated.push_back(f);
+    }
+  }
+  return invalidated;
+}
+
+void CppStateFilterGenerator::end_extensions() {
+  // Without commands for command buffers, as in profiles that keep none,
+  // there is no CommandBufferFunctions to filter calls to
+  if (_commands.empty()) {
+    return;
+  }
+
+  header << R"(
+// vkgen::StateFilter passes the commands recorded through it on to a command
+// buffer, except for calls of state-setting commands that would change
+// nothing. A call is dropped when its arguments, including the contents of
+// the arrays and structs they point to, are the same as those of the last
+// call of the same command that was passed on. Tracking starts over when the
+// command buffer is begun or reset and after secondary command buffers are
+// executed, and calls that may change state tracked for other commands, such
+// as pipeline binds overriding dynamic state, make the filter forget it.
+//
+// Like its command buffer, a filter is used by one thread at a time. Commands
+// recorded on the command buffer without going through the filter leave it
+// out of date, so invalidate() must be called after recording them. counters()
+// tells how many calls were passed on and how many were dropped per command.
+
+namespace detail {
+
+// The arguments of the last call of a command. Those of a new call are
+// compared with them as they are added and replace them from the first
+// difference on. Storage is kept, so that recording does not allocate once
+// the largest arguments of the command have been seen.
+class state_key {
+public:
+  void begin_call() {
+    _size = 0;
+    _changed = !_valid;
+  }
+
+  // Whether the arguments of the call differ from those of the last one
+  bool end_call() {
+    bool changed = _changed || _size != _last_size;
+    _last_size = _size;
+    _valid = true;
+    return changed;
+  }
+
+  void invalidate() { _valid = false; }
+
+  template <typename T>
+  void add(T const& value) {
+    add_bytes(&value, sizeof(T));
+  }
+
+  template <typename T>
+  void add_range(T const* values, size_t count) {
+    add(values != nullptr);
+    if (values) {
+      add_bytes(values, count * sizeof(T));
+    }
+  }
+
+  void add_range(void const* data, size_t size) {
+    add(data != nullptr);
+    if (data) {
+      add_bytes(data, size);
+    }
+  }
+
+  void add_string(char const* s) {
+    add(s != nullptr);
+    if (s) {
+      add_bytes(s, std::strlen(s) + 1);
+    }
+  }
+
+private:
+  void add_bytes(void const* data, size_t size) {
+    if (size == 0) {
+      return;
+    }
+    if (!_changed) {
+      if (_size + size <= _last_size && std::memcmp(_bytes.data() + _size, data, size) == 0) {
+        _size += size;
+        return;
+      }
+      _changed = true;
+    }
+    if (_size + size > _bytes.size()) {
+      _bytes.resize(std::max(_size + size, 2 * _bytes.size()));
+    }
+    std::memcpy(_bytes.data() + _size, data, size);
+    _size += size;
+  }
+
+private:
+  std::vector<unsigned char> _bytes;
+  size_t _size = 0; // Of the arguments added so far
+  size_t _last_size = 0;
+  bool _changed = false;
+  bool _valid = false;
+};
+
+} // detail
+
+struct StateFilterCounters {
+  uint64_t forwarded = 0; // Calls of all commands passed on to the command buffer
+
+  // Dropped calls per command
+)";
+
+  ind_h->increase();
+  for (auto c : _filtered) {
+    print_protect_begin(header, ind_h, 1, c);
+    header << "uint64_t " << c->name() << " = 0;" << endl;
+    print_protect_end(header, ind_h, 1, c);
+  }
+  header << endl;
+  header << "uint64_t eliminated() const {" << endl;
+  ind_h->increase();
+  header << "uint64_t sum = 0;" << endl;
+  for (auto c : _filtered) {
+    print_protect_begin(header, ind_h, 2, c);
+    header << "sum += " << c->name() << ";" << endl;
+    print_protect_end(header, ind_h, 2, c);
+  }
+  header << "return sum;" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  ind_h->decrease();
+  header << "};" << endl;
+
+  header << R"(
+class StateFilter {
+public:
+  explicit StateFilter(CommandBufferFunctions const& command_buffer) : _command_buffer(command_buffer) {}
+  StateFilter(StateFilter const&) = delete;
+  StateFilter& operator=(StateFilter const&) = delete;
+
+  CommandBufferFunctions const& command_buffer() const { return _command_buffer; }
+)";
+
+  ind_h->increase();
+  for (auto c : _commands) {
+    print_protect_begin(header, ind_h, 1, c);
+    print_signature(c, "");
+    header << ";" << endl;
+    print_protect_end(header, ind_h, 1, c);
+  }
+  ind_h->decrease();
+
+  header << R"(
+  void invalidate();
+  StateFilterCounters const& counters() const { return _counters; }
+  void reset_counters() { _counters = StateFilterCounters(); }
+
+private:
+  CommandBufferFunctions const& _command_buffer;
+  StateFilterCounters _counters;
+
+  // Arguments of the last call passed on, per filtered command
+)";
+
+  ind_h->increase();
+  for (auto c : _filtered) {
+    print_protect_begin(header, ind_h, 1, c);
+    header << "detail::state_key _" << c->name() << ";" << endl;
+    print_protect_end(header, ind_h, 1, c);
+  }
+  ind_h->decrease();
+  header << "};" << endl;
+
+  header << endl;
+  header << "inline void StateFilter::invalidate() {" << endl;
+  ind_h->increase();
+  for (auto c : _filtered) {
+    print_protect_begin(header, ind_h, 1, c);
+    header << "_" << c->name() << ".invalidate();" << endl;
+    print_protect_end(header, ind_h, 1, c);
+  }
+  ind_h->decrease();
+  header << "}" << endl;
+
+  for (auto c : _commands) {
+    write_wrapper(c);
+  }
+}
+
+void CppStateFilterGenerator::write_wrapper(vkspec::Command* c) {
+  header << endl;
+  print_protect_begin(header, ind_h, 0, c);
+  header << "inline ";
+  print_signature(c, "StateFilter::");
+  header << " {" << endl;
+  ind_h->increase();
+
+  if (_filtered_set.count(c)) {
+    string key = "_" + c->name();
+    header << key << ".begin_call();" << endl;
+    for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+      switch (key_param(c, *p)) {
+        case KeyParam::Value:
+          header << key << ".add(" << p->name << ");" << endl;
+          break;
+        case KeyParam::FixedArray:
+          header << key << ".add_range(" << p->name << ", " << p->array_size << ");" << endl;
+          break;
+        case KeyParam::Range:
+          header << key << ".add_range(" << p->name << ", " << len_expression(c, *p) << ");" << endl;
+          break;
+        case KeyParam::Pointee:
+          header << key << ".add_range(" << p->name << ", 1);" << endl;
+          break;
+        case KeyParam::String:
+          header << key << ".add_string(" << p->name << ");" << endl;
+          break;
+        case KeyParam::None:
+          assert(false);
+          break;
+      }
+    }
+    header << "if (!" << key << ".end_call()) {" << endl;
+    ind_h->increase();
+    header << "++_counters." << c->name() << ";" << endl;
+    header << "return;" << endl;
+    ind_h->decrease();
+    header << "}" << endl;
+  }
+
+  if (invalidates_all(c)) {
+    header << "invalidate();" << endl;
+  }
+  else {
+    for (auto f : invalidated_by(c)) {
+      if (f->extension() && f->extension()->protect() != "" && (!c->extension() || c->extension()->protect() != f->extension()->protect())) {
+        print_protect_begin(header, ind_h, 1, f);
+        header << "_" << f->name() << ".invalidate();" << endl;
+        print_protect_end(header, ind_h, 1, f);
+      }
+      else {
+        header << "_" << f->name() << ".invalidate();" << endl;
+      }
+    }
+  }
+
+  header << "++_counters.forwarded;" << endl;
+  header << (c->complete_return_type() == "void" ? "" : "return ") << "_command_buffer." << c->name() << "(";
+  string comma = "";
+  for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+    header << comma << p->name;
+    comma = ", ";
+  }
+  header << ");" << endl;
+
+  ind_h->decrease();
+  header << "}" << endl;
+  print_protect_end(header, ind_h, 0, c);
+}
+
+void CppStateFilterGenerator::print_signature(vkspec::Command* c, string const& qualifier) {
+  header << c->complete_return_type() << " " << qualifier << c->name() << "(";
+  string comma = "";
+  for (auto p = c->params().begin() + 1; p != c->params().end(); ++p) {
+    header << comma << p->complete_type << " " << p->name;
+    if (p->array_size != "") {
+      header << "[" << p->array_size << "]";
+    }
+    comma = ", ";
+  }
+  header << ")";
+}
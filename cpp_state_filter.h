@@ -0,0 +1,63 @@
+#ifndef CPP_STATE_FILTER_INCLUDE
+#define CPP_STATE_FILTER_INCLUDE
+
+#include "vkspec.h"
+#include "cpp_struct_graph.h"
+#include "indenting_stream_buf.h"
+#include <fstream>
+#include <set>
+
+// Generates vk_state_filter.h containing vkgen::StateFilter, which wraps the
+// CommandBufferFunctions of a command buffer and drops calls of state-setting
+// commands that repeat the previous call of the same command. Which commands
+// set state is taken from the tasks attribute of the registry or, in
+// registries predating it, from the names and renderpass attributes of the
+// commands. Commands whose arguments cannot be compared by value are never
+// filtered.
+class CppStateFilterGenerator : public vkspec::IGenerator {
+public:
+  CppStateFilterGenerator(std::string const& out_dir, std::string const& license, int major, int minor, int patch);
+  ~CppStateFilterGenerator();
+
+  virtual void begin_core() override final {}
+  virtual void end_core() override final {}
+  virtual void gen_scalar_typedef(vkspec::ScalarTypedef* t) override final {}
+  virtual void gen_function_typedef(vkspec::FunctionTypedef* t) override final {}
+  virtual void gen_handle_typedef(vkspec::HandleTypedef* t) override final {}
+  virtual void gen_struct(vkspec::Struct* t) override final {}
+  virtual void gen_enum(vkspec::Enum* t) override final {}
+  virtual void gen_api_constant(vkspec::ApiConstant* t) override final {}
+  virtual void gen_bitmasks(vkspec::Bitmasks* t) override final {}
+  virtual void begin_entry() override final {}
+  virtual void gen_entry_command(vkspec::Command* c) override final {}
+  virtual void end_entry() override final {}
+  virtual void begin_global_commands() override final {}
+  virtual void gen_global_command(vkspec::Command* c) override final {}
+  virtual void end_global_commands() override final {}
+  virtual void begin_instance_commands() override final {}
+  virtual void gen_instance_command(vkspec::Command* c) override final {}
+  virtual void end_instance_commands() override final {}
+  virtual void begin_device_commands() override final {}
+  virtual void gen_device_command(vkspec::Command* c) override final;
+  virtual void end_device_commands() override final {}
+  virtual void begin_extensions() override final {}
+  virtual void end_extensions() override final;
+  virtual void begin_extension(vkspec::Extension* e) override final {}
+  virtual void end_extension(vkspec::Extension* e) override final;
+
+private:
+  void add_command(vkspec::Command* c);
+  bool invalidates_all(vkspec::Command* c);
+  std::vector<vkspec::Command*> invalidated_by(vkspec::Command* c);
+  void write_wrapper(vkspec::Command* c);
+  void print_signature(vkspec::Command* c, std::string const& qualifier);
+
+private:
+  std::ofstream header;
+  IndentingOStreambuf* ind_h = nullptr;
+  std::vector<vkspec::Command*> _commands; // All commands of CommandBufferFunctions
+  std::vector<vkspec::Command*> _filtered; // The subset whose calls may be dropped
+  std::set<vkspec::Command*> _filtered_set;
+};
+
+#endif
@@ -0,0 +1,174 @@
+#include "cpp_struct_graph.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+using namespace std;
+
+GraphMember graph_member(vkspec::Struct* t, vkspec::Struct::Member const& m) {
+  size_t depth = count(m.complete_type.begin(), m.complete_type.end(), '*');
+  string pure = m.pure_type->name();
+
+  if (m.pure_type->to_function_typedef()) {
+    return GraphMember::Identity;
+  }
+
+  if (depth == 0) {
+    if (m.pure_type->to_struct()) {
+      return m.array_size != "" ? GraphMember::StructArray : GraphMember::Struct;
+    }
+    return GraphMember::Value;
+  }
+
+  if (m.name == "pNext") {
+    return GraphMember::Next;
+  }
+
+  bool terminated = !m.len.empty() && m.len.back() == "null-terminated";
+
+  if (depth == 1) {
+    if (pure == "char" && m.len.size() == 1 && terminated) {
+      return GraphMember::String;
+    }
+    if (m.len.empty()) {
+      return m.pure_type->to_struct() ? GraphMember::Pointee : GraphMember::Identity;
+    }
+    if (terminated || len_expression(t, m, "v") == "") {
+      return GraphMember::Identity;
+    }
+    return m.pure_type->to_struct() ? GraphMember::StructRange : GraphMember::Range;
+  }
+
+  if (depth == 2 && pure == "char" && m.len.size() == 2 && terminated && len_expression(t, m, "v") != "") {
+    return GraphMember::Strings;
+  }
+
+  return GraphMember::Identity;
+}
+
+// Member names are prefixed with the variable; latexmath lengths use altlen.
+string len_expression(vkspec::Struct* t, vkspec::Struct::Member const& m, string const& var) {
+  if (m.len.empty()) {
+    return "";
+  }
+
+  string len = m.len[0];
+  if (len.compare(0, 10, "latexmath:") == 0) {
+    len = m.altlen;
+  }
+  if (len == "" || len == "null-terminated") {
+    return "";
+  }
+
+  string result;
+  size_t i = 0;
+  while (i < len.size()) {
+    if (isalpha(len[i]) || len[i] == '_') {
+      size_t end = i;
+      while (end < len.size() && (isalnum(len[end]) || len[end] == '_')) {
+        ++end;
+      }
+      string identifier = len.substr(i, end - i);
+      bool member = false;
+      for (auto& other : t->members()) {
+        member = member || other.name == identifier;
+      }
+      if (!member) {
+        return ""; // Refers to something outside the struct
+      }
+      result += var + "." + identifier;
+      i = end;
+    }
+    else {
+      result += len[i++];
+    }
+  }
+
+  return result;
+}
+
+string len_expression(vkspec::Command* c, vkspec::Command::Parameter const& p) {
+  if (p.len.empty()) {
+    return "";
+  }
+
+  string const& len = p.len[0];
+  if (len == "null-terminated" || len.compare(0, 10, "latexmath:") == 0) {
+    return "";
+  }
+
+  size_t i = 0;
+  while (i < len.size()) {
+    if (isalpha(len[i]) || len[i] == '_') {
+      size_t end = i;
+      while (end < len.size() && (isalnum(len[end]) || len[end] == '_')) {
+        ++end;
+      }
+      string identifier = len.substr(i, end - i);
+      bool param = false;
+      for (auto& other : c->params()) {
+        param = param || other.name == identifier;
+      }
+      if (!param) {
+        return ""; // Refers to a member of another parameter
+      }
+      i = end;
+    }
+    else if (isdigit(len[i]) || isspace(len[i]) || strchr("+-*/()", len[i])) {
+      ++i;
+    }
+    else {
+      return "";
+    }
+  }
+
+  return len;
+}
+
+string structure_type(vkspec::Struct* t) {
+  for (auto& m : t->members()) {
+    if (m.name == "sType" && m.values != "" && m.values.find(',') == string::npos) {
+      return m.values;
+    }
+  }
+  return "";
+}
+
+void print_protect_begin(ofstream& file, vkspec::Struct* t) {
+  if (t->extension() && t->extension()->protect() != "") {
+    file << "#if defined(" << t->extension()->protect() << ")" << endl;
+  }
+}
+
+void print_protect_end(ofstream& file, vkspec::Struct* t) {
+  if (t->extension() && t->extension()->protect() != "") {
+    file << "#endif" << endl;
+  }
+}
+
+namespace {
+
+void print_unindented(ofstream& file, IndentingOStreambuf* ind, int levels, string const& line) {
+  for (int i = 0; i < levels; ++i) {
+    ind->decrease();
+  }
+  file << line << endl;
+  for (int i = 0; i < levels; ++i) {
+    ind->increase();
+  }
+}
+
+} // namespace
+
+void print_protect_begin(ofstream& file, IndentingOStreambuf* ind, int levels, vkspec::Command* c) {
+  if (c->extension() && c->extension()->protect() != "") {
+    print_unindented(file, ind, levels, "#if defined(" + c->extension()->protect() + ")");
+  }
+}
+
+void print_protect_end(ofstream& file, IndentingOStreambuf* ind, int levels, vkspec::Command* c) {
+  if (c->extension() && c->extension()->protect() != "") {
+    print_unindented(file, ind, levels, "#endif");
+  }
+}
@@ -0,0 +1,50 @@
+#ifndef CPP_STRUCT_GRAPH_INCLUDE
+#define CPP_STRUCT_GRAPH_INCLUDE
+
+#include "vkspec.h"
+#include "indenting_stream_buf.h"
+#include <fstream>
+
+// Helpers shared by generators that walk the graph of data reachable from a
+// struct: the struct itself, its len annotated arrays, strings, pointed-to
+// structs and pNext chain, and by generators that do the same for the
+// parameters of commands.
+
+// How a struct member takes part in the graph
+enum class GraphMember {
+  Value, // Scalars and fixed size arrays of scalars
+  Struct, // Nested struct by value
+  StructArray, // Fixed size array of structs
+  Range, // len annotated pointer to scalars
+  StructRange, // len annotated pointer to structs
+  Pointee, // Single pointer to a struct
+  String, // Null terminated string
+  Strings, // len annotated array of null terminated strings
+  Next, // pNext chain
+  Identity, // Other pointers, not followed
+};
+
+GraphMember graph_member(vkspec::Struct* t, vkspec::Struct::Member const& m);
+
+// Turns the first len dimension of a member into an expression on the struct
+// variable var. Returns an empty string if the length cannot be expressed.
+std::string len_expression(vkspec::Struct* t, vkspec::Struct::Member const& m, std::string const& var);
+
+// The len of a command parameter as an expression on the other parameters,
+// or an empty string if it cannot be expressed that way.
+std::string len_expression(vkspec::Command* c, vkspec::Command::Parameter const& p);
+
+// The VkStructureType value of a struct, or an empty string if it has none
+std::string structure_type(vkspec::Struct* t);
+
+// Guards for types of extensions limited to certain platforms
+void print_protect_begin(std::ofstream& file, vkspec::Struct* t);
+void print_protect_end(std::ofstream& file, vkspec::Struct* t);
+
+// Guards for commands of extensions limited to certain platforms. Preprocessor
+// lines are not indented: |ind| is the stream buffer of |file| and |levels|
+// the number of blocks the guard is nested in.
+void print_protect_begin(std::ofstream& file, IndentingOStreambuf* ind, int levels, vkspec::Command* c);
+void print_protect_end(std::ofstream& file, IndentingOStreambuf* ind, int levels, vkspec::Command* c);
+
+#endif
@@ -0,0 +1,689 @@
+#include "cpp_struct_hash.h"
+
+using namespace std;
+
+bool is_pointer_member(vkspec::Struct::Member const& m) {
+  return m.complete_type.find('*') != string::npos || m.pure_type->to_function_typedef();
+}
+
+CppStructHashGenerator::CppStructHashGenerator(string const& out_dir, string const& license, int major, int minor, int patch) {
+  header.open(out_dir + "/vk_struct_hash.h");
+  if (!header.is_open()) {
+    throw std::runtime_error("Failed to open file for output");
+  }
+
+  ind_h = new IndentingOStreambuf(header, 2);
+
+  header << license << endl;
+  header << endl;
+  header << "// Struct hashing for Vulkan " << major << "." << minor << "." << patch << ", generated from the Khronos Vulkan API XML Registry." << endl;
+  header << "// See https://github.com/andens/Vulkan-Hpp for generator details." << endl;
+  header << endl;
+  header << "#ifndef VK_STRUCT_HASH_INCLUDE" << endl;
+  header << "#define VK_STRUCT_HASH_INCLUDE" << endl;
+  header << endl;
+  header << "#include \"vulkan_include.inl\"" << endl;
+  header << "#include <cstddef>" << endl;
+  header << "#include <cstdint>" << endl;
+  header << "#include <cstring>" << endl;
+  header << "#include <functional>" << endl;
+  header << endl;
+  header << "namespace vkgen {" << endl;
+  header << R"(
+// vkgen::hash<T> and vkgen::equal_to<T> are shallow: members are compared by
+// value, while pointer members (pNext included) are compared by address and
+// the data they point to is never read. Floats compare with operator==, which
+// means 0.0f and -0.0f are equal and hash the same. A struct without floats
+// and without padding (checked at compile time through sizeof) has bitwise set
+// and is compared with memcmp and hashed as one block of memory. Unions are
+// always treated as raw bytes, so zero-initialize them before writing a member
+// that does not cover the whole union.
+//
+// vkgen::deep_hash<T> and vkgen::deep_equal_to<T> compare content instead:
+// len annotated arrays, strings and single struct pointers are followed
+// whenever they are not null, so unused pointers must be null. pNext chains
+// are walked link by link. Links with an sType unknown to the generator
+// contribute only their sType to the hash and compare by address.
+template <typename T> struct hash;
+template <typename T> struct equal_to;
+template <typename T> struct deep_hash;
+template <typename T> struct deep_equal_to;
+
+namespace detail {
+
+inline uint64_t mix(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+// Consumes eight bytes at a time. A trailing partial word is zero-extended.
+inline uint64_t hash_bytes(uint64_t seed, void const* data, size_t size) {
+  unsigned char const* p = static_cast<unsigned char const*>(data);
+  uint64_t h = seed ^ (size * 0x9e3779b97f4a7c15ULL);
+  for (; size >= 8; p += 8, size -= 8) {
+    uint64_t k;
+    std::memcpy(&k, p, 8);
+    h = mix(h ^ k);
+  }
+  if (size > 0) {
+    uint64_t k = 0;
+    std::memcpy(&k, p, size);
+    h = mix(h ^ k);
+  }
+  return h;
+}
+
+template <typename T>
+inline uint64_t hash_value(uint64_t seed, T const& v) {
+  return hash_bytes(seed, &v, sizeof(v));
+}
+
+inline uint64_t hash_value(uint64_t seed, float v) {
+  if (v == 0.0f) {
+    v = 0.0f; // Fold -0.0f into 0.0f
+  }
+  return hash_bytes(seed, &v, sizeof(v));
+}
+
+template <size_t N>
+inline uint64_t hash_value(uint64_t seed, float const (&v)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    seed = hash_value(seed, v[i]);
+  }
+  return seed;
+}
+
+template <typename H, typename T, size_t N>
+inline uint64_t combine_each(uint64_t seed, T const (&v)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    seed = H::combine(seed, v[i]);
+  }
+  return seed;
+}
+
+template <typename T>
+inline bool equal_value(T const& a, T const& b) {
+  return a == b;
+}
+
+template <typename T, size_t N>
+inline bool equal_value(T const (&a)[N], T const (&b)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    if (!(a[i] == b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename E, typename T, size_t N>
+inline bool equal_each(T const (&a)[N], T const (&b)[N]) {
+  for (size_t i = 0; i < N; ++i) {
+    if (!E()(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Pointed-to scalars are hashed as one block of memory, except for floats.
+template <typename T>
+inline uint64_t hash_range(uint64_t seed, T const* p, size_t n) {
+  return hash_bytes(seed, p, p ? n * sizeof(T) : 0);
+}
+
+inline uint64_t hash_range(uint64_t seed, void const* p, size_t n) {
+  return hash_bytes(seed, p, p ? n : 0);
+}
+
+inline uint64_t hash_range(uint64_t seed, float const* p, size_t n) {
+  if (!p) {
+    n = 0;
+  }
+  seed = hash_value(seed, n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = hash_value(seed, p[i]);
+  }
+  return seed;
+}
+
+template <typename T>
+inline bool equal_range(T const* a, T const* b, size_t n) {
+  return n == 0 || a == b || (a && b && std::memcmp(a, b, n * sizeof(T)) == 0);
+}
+
+inline bool equal_range(void const* a, void const* b, size_t n) {
+  return n == 0 || a == b || (a && b && std::memcmp(a, b, n) == 0);
+}
+
+inline bool equal_range(float const* a, float const* b, size_t n) {
+  if (n == 0 || a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!(a[i] == b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename H, typename T>
+inline uint64_t combine_range(uint64_t seed, T const* p, size_t n) {
+  if (!p) {
+    n = 0;
+  }
+  seed = hash_value(seed, n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = H::combine(seed, p[i]);
+  }
+  return seed;
+}
+
+template <typename E, typename T>
+inline bool equal_each_range(T const* a, T const* b, size_t n) {
+  if (n == 0 || a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!E()(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename H, typename T>
+inline uint64_t combine_pointee(uint64_t seed, T const* p) {
+  return p ? H::combine(mix(seed), *p) : seed;
+}
+
+template <typename E, typename T>
+inline bool equal_pointee(T const* a, T const* b) {
+  return a == b || (a && b && E()(*a, *b));
+}
+
+inline uint64_t hash_string(uint64_t seed, char const* s) {
+  return s ? hash_bytes(mix(seed), s, std::strlen(s)) : seed;
+}
+
+inline bool equal_string(char const* a, char const* b) {
+  return a == b || (a && b && std::strcmp(a, b) == 0);
+}
+
+inline uint64_t hash_strings(uint64_t seed, char const* const* p, size_t n) {
+  if (!p) {
+    n = 0;
+  }
+  seed = hash_value(seed, n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = hash_string(seed, p[i]);
+  }
+  return seed;
+}
+
+inline bool equal_strings(char const* const* a, char const* const* b, size_t n) {
+  if (n == 0 || a == b) {
+    return true;
+  }
+  if (!a || !b) {
+    return false;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    if (!equal_string(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Common beginning of all structs that can be part of a pNext chain. Shared
+// with the other vkgen headers.
+#ifndef VKGEN_CHAIN_LINK_DEFINED
+#define VKGEN_CHAIN_LINK_DEFINED
+struct chain_link {
+  VkStructureType sType;
+  void const* pNext;
+};
+#endif
+
+// Defined after all structs since any of them may be part of a chain
+inline uint64_t deep_hash_next(uint64_t seed, void const* next);
+inline bool deep_equal_next(void const* a, void const* b);
+
+} // detail
+)";
+}
+
+CppStructHashGenerator::~CppStructHashGenerator() {
+  header << endl;
+  header << "#endif // VK_STRUCT_HASH_INCLUDE" << endl;
+
+  delete ind_h;
+
+  header.close();
+}
+
+void CppStructHashGenerator::gen_struct(vkspec::Struct* t) {
+  _structs.push_back(t);
+
+  header << endl;
+  print_protect_begin(header, t);
+  write_equal_to(t);
+  header << endl;
+  write_hash(t);
+  header << endl;
+  write_deep_equal_to(t);
+  header << endl;
+  write_deep_hash(t);
+  print_protect_end(header, t);
+
+  if (!t->extends().empty() && structure_type(t) != "") {
+    _chain_structs.push_back(t);
+  }
+}
+
+void CppStructHashGenerator::end_extensions() {
+  header << endl;
+  write_deep_next();
+  header << endl;
+  header << "} // vkgen" << endl;
+  header << endl;
+  header << "namespace std {" << endl;
+  header << endl;
+
+  for (auto t : _structs) {
+    print_protect_begin(header, t);
+    header << "template <> struct hash<" << t->name() << "> : public vkgen::hash<" << t->name() << "> {};" << endl;
+    print_protect_end(header, t);
+  }
+
+  header << endl;
+  header << "} // std" << endl;
+}
+
+void CppStructHashGenerator::write_hash(vkspec::Struct* t) {
+  header << "template <> struct hash<" << t->name() << "> {" << endl;
+  ind_h->increase();
+  header << "static uint64_t combine(uint64_t seed, " << t->name() << " const& v) {" << endl;
+  ind_h->increase();
+
+  if (t->is_union()) {
+    header << "return detail::hash_bytes(seed, &v, sizeof(v));" << endl;
+  }
+  else {
+    header << "if (equal_to<" << t->name() << ">::bitwise) {" << endl;
+    ind_h->increase();
+    header << "return detail::hash_bytes(seed, &v, sizeof(v));" << endl;
+    ind_h->decrease();
+    header << "}" << endl;
+
+    for (auto& m : t->members()) {
+      if (!is_pointer_member(m) && m.pure_type->to_struct()) {
+        if (m.array_size != "") {
+          header << "seed = detail::combine_each<hash<" << m.pure_type->name() << ">>(seed, v." << m.name << ");" << endl;
+        }
+        else {
+          header << "seed = hash<" << m.pure_type->name() << ">::combine(seed, v." << m.name << ");" << endl;
+        }
+      }
+      else {
+        header << "seed = detail::hash_value(seed, v." << m.name << ");" << endl;
+      }
+    }
+
+    header << "return seed;" << endl;
+  }
+
+  ind_h->decrease();
+  header << "}" << endl;
+  header << "size_t operator()(" << t->name() << " const& v) const {" << endl;
+  ind_h->increase();
+  header << "return static_cast<size_t>(combine(0, v));" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  ind_h->decrease();
+  header << "};" << endl;
+}
+
+void CppStructHashGenerator::write_equal_to(vkspec::Struct* t) {
+  header << "template <> struct equal_to<" << t->name() << "> {" << endl;
+  ind_h->increase();
+
+  if (t->is_union()) {
+    header << "static const bool bitwise = true;" << endl;
+    header << "bool operator()(" << t->name() << " const& a, " << t->name() << " const& b) const {" << endl;
+    ind_h->increase();
+    header << "return std::memcmp(&a, &b, sizeof(a)) == 0;" << endl;
+    ind_h->decrease();
+    header << "}" << endl;
+    ind_h->decrease();
+    header << "};" << endl;
+    return;
+  }
+
+  // Floats never compare bitwise. Whether the struct has padding is left to
+  // the compiler by comparing its size to the sum of its member sizes.
+  if (holds_float(t)) {
+    header << "static const bool bitwise = false;" << endl;
+  }
+  else {
+    header << "static const bool bitwise = sizeof(" << t->name() << ") == (";
+    string plus = "";
+    for (auto& m : t->members()) {
+      header << plus << "sizeof(" << t->name() << "::" << m.name << ")";
+      plus = " + ";
+    }
+    header << ")";
+    for (auto& m : t->members()) {
+      if (!is_pointer_member(m) && m.pure_type->to_struct()) {
+        header << " && equal_to<" << m.pure_type->name() << ">::bitwise";
+      }
+    }
+    header << ";" << endl;
+  }
+
+  header << "bool operator()(" << t->name() << " const& a, " << t->name() << " const& b) const {" << endl;
+  ind_h->increase();
+  header << "if (bitwise) {" << endl;
+  ind_h->increase();
+  header << "return std::memcmp(&a, &b, sizeof(a)) == 0;" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+
+  header << "return ";
+  string and_ = "";
+  for (auto& m : t->members()) {
+    header << and_;
+    if (!is_pointer_member(m) && m.pure_type->to_struct()) {
+      if (m.array_size != "") {
+        header << "detail::equal_each<equal_to<" << m.pure_type->name() << ">>(a." << m.name << ", b." << m.name << ")";
+      }
+      else {
+        header << "equal_to<" << m.pure_type->name() << ">()(a." << m.name << ", b." << m.name << ")";
+      }
+    }
+    else {
+      header << "detail::equal_value(a." << m.name << ", b." << m.name << ")";
+    }
+    and_ = " &&\n    ";
+  }
+  header << ";" << endl;
+
+  ind_h->decrease();
+  header << "}" << endl;
+  ind_h->decrease();
+  header << "};" << endl;
+}
+
+bool CppStructHashGenerator::holds_float(vkspec::Struct* t) {
+  auto it = _holds_float.find(t->name());
+  if (it != _holds_float.end()) {
+    return it->second;
+  }
+
+  bool result = false;
+  for (auto& m : t->members()) {
+    if (is_pointer_member(m)) {
+      continue;
+    }
+    if (m.pure_type->to_c() && m.pure_type->name() == "float") {
+      result = true;
+    }
+    else if (m.pure_type->to_struct() && holds_float(m.pure_type->to_struct())) {
+      result = true;
+    }
+  }
+
+  _holds_float[t->name()] = result;
+  return result;
+}
+
+void CppStructHashGenerator::write_deep_hash(vkspec::Struct* t) {
+  header << "template <> struct deep_hash<" << t->name() << "> {" << endl;
+  ind_h->increase();
+
+  if (t->is_union()) {
+    // Union members are never pointers worth following
+    header << "static uint64_t combine(uint64_t seed, " << t->name() << " const& v) {" << endl;
+    ind_h->increase();
+    header << "return hash<" << t->name() << ">::combine(seed, v);" << endl;
+    ind_h->decrease();
+    header << "}" << endl;
+  }
+  else {
+    bool next = false;
+
+    header << "static uint64_t members(uint64_t seed, " << t->name() << " const& v) {" << endl;
+    ind_h->increase();
+    for (auto& m : t->members()) {
+      string pure = m.pure_type->name();
+      switch (graph_member(t, m)) {
+      case GraphMember::Value:
+      case GraphMember::Identity:
+        header << "seed = detail::hash_value(seed, v." << m.name << ");" << endl;
+        break;
+      case GraphMember::Struct:
+        header << "seed = deep_hash<" << pure << ">::combine(seed, v." << m.name << ");" << endl;
+        break;
+      case GraphMember::StructArray:
+        header << "seed = detail::combine_each<deep_hash<" << pure << ">>(seed, v." << m.name << ");" << endl;
+        break;
+      case GraphMember::Range:
+        header << "seed = detail::hash_range(seed, v." << m.name << ", " << len_expression(t, m, "v") << ");" << endl;
+        break;
+      case GraphMember::StructRange:
+        header << "seed = detail::combine_range<deep_hash<" << pure << ">>(seed, v." << m.name << ", " << len_expression(t, m, "v") << ");" << endl;
+        break;
+      case GraphMember::Pointee:
+        header << "seed = detail::combine_pointee<deep_hash<" << pure << ">>(seed, v." << m.name << ");" << endl;
+        break;
+      case GraphMember::String:
+        header << "seed = detail::hash_string(seed, v." << m.name << ");" << endl;
+        break;
+      case GraphMember::Strings:
+        header << "seed = detail::hash_strings(seed, v." << m.name << ", " << len_expression(t, m, "v") << ");" << endl;
+        break;
+      case GraphMember::Next:
+        next = true; // Done by combine
+        break;
+      }
+    }
+    header << "return seed;" << endl;
+    ind_h->decrease();
+    header << "}" << endl;
+
+    header << "static uint64_t combine(uint64_t seed, " << t->name() << " const& v) {" << endl;
+    ind_h->increase();
+    if (next) {
+      header << "return detail::deep_hash_next(members(seed, v), v.pNext);" << endl;
+    }
+    else {
+      header << "return members(seed, v);" << endl;
+    }
+    ind_h->decrease();
+    header << "}" << endl;
+  }
+
+  header << "size_t operator()(" << t->name() << " const& v) const {" << endl;
+  ind_h->increase();
+  header << "return static_cast<size_t>(combine(0, v));" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  ind_h->decrease();
+  header << "};" << endl;
+}
+
+void CppStructHashGenerator::write_deep_equal_to(vkspec::Struct* t) {
+  header << "template <> struct deep_equal_to<" << t->name() << "> {" << endl;
+  ind_h->increase();
+
+  if (t->is_union()) {
+    header << "bool operator()(" << t->name() << " const& a, " << t->name() << " const& b) const {" << endl;
+    ind_h->increase();
+    header << "return equal_to<" << t->name() << ">()(a, b);" << endl;
+    ind_h->decrease();
+    header << "}" << endl;
+    ind_h->decrease();
+    header << "};" << endl;
+    return;
+  }
+
+  // Members not requiring indirection are compared first. Besides being
+  // cheaper, that guarantees array lengths are equal before the arrays are
+  // compared using the lengths of a.
+  vector<string> direct;
+  vector<string> indirect;
+  bool next = false;
+
+  for (auto& m : t->members()) {
+    string pure = m.pure_type->name();
+    string a = "a." + m.name;
+    string b = "b." + m.name;
+    switch (graph_member(t, m)) {
+    case GraphMember::Value:
+    case GraphMember::Identity:
+      direct.push_back("detail::equal_value(" + a + ", " + b + ")");
+      break;
+    case GraphMember::Struct:
+      direct.push_back("deep_equal_to<" + pure + ">()(" + a + ", " + b + ")");
+      break;
+    case GraphMember::StructArray:
+      direct.push_back("detail::equal_each<deep_equal_to<" + pure + ">>(" + a + ", " + b + ")");
+      break;
+    case GraphMember::Range:
+      indirect.push_back("detail::equal_range(" + a + ", " + b + ", " + len_expression(t, m, "a") + ")");
+      break;
+    case GraphMember::StructRange:
+      indirect.push_back("detail::equal_each_range<deep_equal_to<" + pure + ">>(" + a + ", " + b + ", " + len_expression(t, m, "a") + ")");
+      break;
+    case GraphMember::Pointee:
+      indirect.push_back("detail::equal_pointee<deep_equal_to<" + pure + ">>(" + a + ", " + b + ")");
+      break;
+    case GraphMember::String:
+      indirect.push_back("detail::equal_string(" + a + ", " + b + ")");
+      break;
+    case GraphMember::Strings:
+      indirect.push_back("detail::equal_strings(" + a + ", " + b + ", " + len_expression(t, m, "a") + ")");
+      break;
+    case GraphMember::Next:
+      next = true; // Done by operator()
+      break;
+    }
+  }
+
+  header << "static bool members(" << t->name() << " const& a, " << t->name() << " const& b) {" << endl;
+  ind_h->increase();
+  header << "return ";
+  string and_ = "";
+  for (auto& e : direct) {
+    header << and_ << e;
+    and_ = " &&\n    ";
+  }
+  for (auto& e : indirect) {
+    header << and_ << e;
+    and_ = " &&\n    ";
+  }
+  header << ";" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+
+  header << "bool operator()(" << t->name() << " const& a, " << t->name() << " const& b) const {" << endl;
+  ind_h->increase();
+  if (next) {
+    header << "return members(a, b) && detail::deep_equal_next(a.pNext, b.pNext);" << endl;
+  }
+  else {
+    header << "return members(a, b);" << endl;
+  }
+  ind_h->decrease();
+  header << "}" << endl;
+  ind_h->decrease();
+  header << "};" << endl;
+}
+
+void CppStructHashGenerator::write_deep_next() {
+  header << "namespace detail {" << endl;
+  header << endl;
+
+  header << "inline uint64_t deep_hash_next(uint64_t seed, void const* next) {" << endl;
+  ind_h->increase();
+  header << "for (; next; next = static_cast<chain_link const*>(next)->pNext) {" << endl;
+  ind_h->increase();
+  header << "VkStructureType s_type = static_cast<chain_link const*>(next)->sType;" << endl;
+  header << "seed = hash_value(seed, s_type);" << endl;
+  header << "switch (s_type) {" << endl;
+  for (auto t : _chain_structs) {
+    print_protect_begin(header, t);
+    header << "case " << structure_type(t) << ":" << endl;
+    ind_h->increase();
+    header << "seed = deep_hash<" << t->name() << ">::members(seed, *static_cast<" << t->name() << " const*>(next));" << endl;
+    header << "break;" << endl;
+    ind_h->decrease();
+    print_protect_end(header, t);
+  }
+  header << "default:" << endl;
+  ind_h->increase();
+  header << "break; // Unknown structs contribute only their sType" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  header << "return seed;" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  header << endl;
+
+  header << "inline bool deep_equal_next(void const* a, void const* b) {" << endl;
+  ind_h->increase();
+  header << "for (; a && b; a = static_cast<chain_link const*>(a)->pNext, b = static_cast<chain_link const*>(b)->pNext) {" << endl;
+  ind_h->increase();
+  header << "if (a == b) {" << endl;
+  ind_h->increase();
+  header << "return true; // Shared tail" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  header << "VkStructureType s_type = static_cast<chain_link const*>(a)->sType;" << endl;
+  header << "if (s_type != static_cast<chain_link const*>(b)->sType) {" << endl;
+  ind_h->increase();
+  header << "return false;" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  header << "switch (s_type) {" << endl;
+  for (auto t : _chain_structs) {
+    print_protect_begin(header, t);
+    header << "case " << structure_type(t) << ":" << endl;
+    ind_h->increase();
+    header << "if (!deep_equal_to<" << t->name() << ">::members(*static_cast<" << t->name() << " const*>(a), *static_cast<" << t->name() << " const*>(b))) {" << endl;
+    ind_h->increase();
+    header << "return false;" << endl;
+    ind_h->decrease();
+    header << "}" << endl;
+    header << "break;" << endl;
+    ind_h->decrease();
+    print_protect_end(header, t);
+  }
+  header << "default:" << endl;
+  ind_h->increase();
+  header << "return false; // Unknown structs compare by address" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+  header << "return a == b;" << endl;
+  ind_h->decrease();
+  header << "}" << endl;
+
+  header << endl;
+  header << "} // detail" << endl;
+}
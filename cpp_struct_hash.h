@@ -0,0 +1,67 @@
+#ifndef CPP_STRUCT_HASH_INCLUDE
+#define CPP_STRUCT_HASH_INCLUDE
+
+#include "vkspec.h"
+#include "cpp_struct_graph.h"
+#include "indenting_stream_buf.h"
+#include <fstream>
+#include <map>
+
+// Generates vk_struct_hash.h containing vkgen::hash and vkgen::equal_to for
+// every struct and union in the feature, as well as std::hash specializations
+// forwarding to vkgen::hash. Comparison is shallow: pointer members, pNext
+// included, compare by address. Structs that hold no floats and have no
+// padding (the latter checked by the compiler) compare using memcmp.
+//
+// vkgen::deep_hash and vkgen::deep_equal_to additionally follow pointers:
+// len annotated arrays and strings, single pointers to structs and pNext
+// chains, where links are identified by sType among the structs declaring
+// structextends.
+class CppStructHashGenerator : public vkspec::IGenerator {
+public:
+  CppStructHashGenerator(std::string const& out_dir, std::string const& license, int major, int minor, int patch);
+  ~CppStructHashGenerator();
+
+  virtual void begin_core() override final {}
+  virtual void end_core() override final {}
+  virtual void gen_scalar_typedef(vkspec::ScalarTypedef* t) override final {}
+  virtual void gen_function_typedef(vkspec::FunctionTypedef* t) override final {}
+  virtual void gen_handle_typedef(vkspec::HandleTypedef* t) override final {}
+  virtual void gen_struct(vkspec::Struct* t) override final;
+  virtual void gen_enum(vkspec::Enum* t) override final {}
+  virtual void gen_api_constant(vkspec::ApiConstant* t) override final {}
+  virtual void gen_bitmasks(vkspec::Bitmasks* t) override final {}
+  virtual void begin_entry() override final {}
+  virtual void gen_entry_command(vkspec::Command* c) override final {}
+  virtual void end_entry() override final {}
+  virtual void begin_global_commands() override final {}
+  virtual void gen_global_command(vkspec::Command* c) override final {}
+  virtual void end_global_commands() override final {}
+  virtual void begin_instance_commands() override final {}
+  virtual void gen_instance_command(vkspec::Command* c) override final {}
+  virtual void end_instance_commands() override final {}
+  virtual void begin_device_commands() override final {}
+  virtual void gen_device_command(vkspec::Command* c) override final {}
+  virtual void end_device_commands() override final {}
+  virtual void begin_extensions() override final {}
+  virtual void end_extensions() override final;
+  virtual void begin_extension(vkspec::Extension* e) override final {}
+  virtual void end_extension(vkspec::Extension* e) override final {}
+
+private:
+  void write_hash(vkspec::Struct* t);
+  void write_equal_to(vkspec::Struct* t);
+  void write_deep_hash(vkspec::Struct* t);
+  void write_deep_equal_to(vkspec::Struct* t);
+  void write_deep_next();
+  bool holds_float(vkspec::Struct* t);
+
+private:
+  std::ofstream header;
+  IndentingOStreambuf* ind_h = nullptr;
+  std::vector<vkspec::Struct*> _structs;
+  std::vector<vkspec::Struct*> _chain_structs; // Structs that may appear in a pNext chain
+  std::map<std::string, bool> _holds_float; // Memoized per struct name
+};
+
+#endif
@@ -0,0 +1,15 @@
+#include "generator_driver.h"
+#include "job_queue.h"
+
+using namespace std;
+
+GeneratorDriver::GeneratorDriver(unsigned int threads, Stats* stats) : _threads(threads), _stats(stats) {
+}
+
+void GeneratorDriver::run() {
+  // Jobs are registered roughly from most to least expensive, so the slowest
+  // generator starts first.
+  vector<function<void()>> jobs;
+  jobs.swap(_jobs);
+  run_jobs(jobs, _threads);
+}
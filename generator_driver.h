@@ -0,0 +1,47 @@
+#ifndef GENERATOR_DRIVER_INCLUDE
+#define GENERATOR_DRIVER_INCLUDE
+
+#include "vkspec.h"
+#include "stats.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+// Runs generators concurrently on a pool of threads. Feature::generate only
+// reads the feature, and every generator owns the streams it writes to, so
+// traversals of the same feature are independent of each other. Generators
+// are constructed and destroyed on the worker that runs them, which means
+// opening, writing and closing the output files also happens in parallel.
+// Features must not be modified while run is executing.
+class GeneratorDriver {
+public:
+  // 0 threads picks one thread per core. If |stats| is given, each generator
+  // is recorded as a phase of its own, counting the CPU time and allocations
+  // of the thread running it.
+  explicit GeneratorDriver(unsigned int threads = 0, Stats* stats = nullptr);
+
+  // Registers a generator to be constructed from |args| and run over
+  // |feature|. The arguments are copied, so they may refer to temporaries.
+  // |name| identifies the generator in stats.
+  template <typename Generator, typename... Args>
+  void add(std::string const& name, vkspec::Feature* feature, Args const&... args) {
+    Stats* stats = _stats;
+    _jobs.push_back([=]() {
+      Stats::Scope scope(stats, "generate: " + name, Stats::Counting::Thread);
+      Generator generator(args...);
+      feature->generate(&generator);
+    });
+  }
+
+  // Runs all registered generators and waits for them to finish. If any
+  // generator throws, the exception of the first one (in registration order)
+  // is rethrown after the others have completed.
+  void run();
+
+private:
+  unsigned int _threads;
+  Stats* _stats;
+  std::vector<std::function<void()>> _jobs;
+};
+
+#endif
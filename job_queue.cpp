@@ -0,0 +1,43 @@
+#include "job_queue.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+using namespace std;
+
+void run_jobs(vector<function<void()>> const& jobs, unsigned int threads) {
+  if (threads == 0) {
+    threads = max(thread::hardware_concurrency(), 1u);
+  }
+
+  vector<exception_ptr> errors(jobs.size());
+  atomic<size_t> next(0);
+
+  auto worker = [&]() {
+    for (size_t i = next++; i < jobs.size(); i = next++) {
+      try {
+        jobs[i]();
+      }
+      catch (...) {
+        errors[i] = current_exception();
+      }
+    }
+  };
+
+  vector<thread> workers;
+  size_t count = min<size_t>(threads, jobs.size());
+  for (size_t i = 1; i < count; ++i) {
+    workers.emplace_back(worker);
+  }
+  worker(); // The calling thread takes part as well
+  for (auto& t : workers) {
+    t.join();
+  }
+
+  for (auto& e : errors) {
+    if (e) {
+      rethrow_exception(e);
+    }
+  }
+}
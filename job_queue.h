@@ -0,0 +1,15 @@
+#ifndef JOB_QUEUE_INCLUDE
+#define JOB_QUEUE_INCLUDE
+
+#include <functional>
+#include <vector>
+
+// Runs |jobs| on up to |threads| threads, the calling thread included (0 picks
+// one thread per core). Workers claim the next unstarted job from a shared
+// counter, so a worker that finishes early keeps taking jobs from the others
+// until none are left. Jobs are claimed in order, which puts expensive jobs
+// first if they are queued first. If any job throws, the exception of the
+// first one (in queue order) is rethrown after all jobs have completed.
+void run_jobs(std::vector<std::function<void()>> const& jobs, unsigned int threads = 0);
+
+#endif
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include <cassert>
+#include <fstream>
+#include <memory>
 //#include <iterator>
 //#include <list>
 //#include <exception>
@@ -20,6 +22,14 @@
 #include "vkspec.h"
 #include "rust_generator.h"
 #include "cpp_dispatch_tables.h"
+#include "cpp_dispatcher.h"
+#include "cpp_struct_hash.h"
+#include "cpp_deep_copy.h"
+#include "cpp_forward_declarations.h"
+#include "cpp_command_stream.h"
+#include "cpp_state_filter.h"
+#include "generator_driver.h"
+#include "stats.h"
 
 int main(int argc, char **argv)
 {
@@ -27,30 +37,125 @@ int main(int argc, char **argv)
   // Extract translators to themselves
   // Probably useful with something like factory that can run a certain generator
 	try {
-		std::string filename = (argc == 1) ? VK_SPEC : argv[1];
+		std::string filename = VK_SPEC;
 
-        {
-          RustTranslator translator;
-          vkspec::Registry reg(&translator);
-          reg.parse(filename);
-          vkspec::Feature* feature = reg.build_feature("vulkan");
+        // --out=<dir> writes the outputs to another directory than the one
+        // configured at build time.
+        std::string out_dir = VULKAN_DIR;
 
-          std::string out = std::string(VULKAN_DIR) + "/vulkan.rs";
-          std::cout << "Writing vulkan.rs to " << out << std::endl;
+        // --shard-dispatch-tables writes each dispatch table class to its own
+        // source file. With =N, tables are split further into files of at most
+        // N commands.
+        bool shard_dispatch_tables = false;
+        size_t max_commands_per_shard = 0;
 
-          RustGenerator generator(out, reg.license(), feature->major(), feature->minor(), feature->patch());
-          feature->generate(&generator);
+        // --profile=<file> restricts all outputs to the API subset described
+        // in the file, see vkspec::Profile.
+        std::unique_ptr<vkspec::Profile> profile;
+
+        // --threads=N limits parsing and generation to N threads. The default
+        // of 0 uses one thread per core, and 1 runs everything serially.
+        unsigned int threads = 0;
+
+        // --stats prints the time, allocations and peak memory of each phase
+        // and generator, and writes the same report as JSON to
+        // vkgen_stats.json, or to the file given with --stats=<file>.
+        std::unique_ptr<Stats> stats;
+        std::string stats_file = "vkgen_stats.json";
+
+        // --shuffle=<seed> parses the registry with its elements reordered,
+        // see vkspec::Registry::shuffle_elements. The outputs must not change.
+        bool shuffle = false;
+        unsigned int shuffle_seed = 0;
+
+        for (int i = 1; i < argc; ++i) {
+          std::string arg = argv[i];
+          std::string const shard_option = "--shard-dispatch-tables";
+          if (arg == shard_option) {
+            shard_dispatch_tables = true;
+          }
+          else if (arg.compare(0, shard_option.size() + 1, shard_option + "=") == 0) {
+            shard_dispatch_tables = true;
+            max_commands_per_shard = std::stoul(arg.substr(shard_option.size() + 1));
+          }
+          else if (arg.compare(0, 10, "--profile=") == 0) {
+            profile.reset(new vkspec::Profile(vkspec::Profile::load(arg.substr(10))));
+          }
+          else if (arg.compare(0, 10, "--threads=") == 0) {
+            threads = std::stoul(arg.substr(10));
+          }
+          else if (arg.compare(0, 6, "--out=") == 0) {
+            out_dir = arg.substr(6);
+          }
+          else if (arg.compare(0, 10, "--shuffle=") == 0) {
+            shuffle = true;
+            shuffle_seed = std::stoul(arg.substr(10));
+          }
+          else if (arg == "--stats") {
+            stats.reset(new Stats());
+          }
+          else if (arg.compare(0, 8, "--stats=") == 0) {
+            stats.reset(new Stats());
+            stats_file = arg.substr(8);
+          }
+          else {
+            filename = arg;
+          }
+        }
+
+        // Both registries are kept alive until the generators have run. Each
+        // generator only reads its feature and writes its own files, so all
+        // of them run concurrently.
+        std::unique_ptr<Stats::Scope> total(new Stats::Scope(stats.get(), "total"));
+
+        RustTranslator rust_translator;
+        vkspec::Registry rust_reg(&rust_translator, threads);
+        rust_reg.collect_stats(stats.get(), "rust: ");
+        if (shuffle) {
+          rust_reg.shuffle_elements(shuffle_seed);
+        }
+        rust_reg.parse(filename);
+        vkspec::Feature* rust_feature = rust_reg.build_feature("vulkan", profile.get());
+
+        CppTranslator cpp_translator;
+        vkspec::Registry cpp_reg(&cpp_translator, threads);
+        cpp_reg.collect_stats(stats.get(), "cpp: ");
+        if (shuffle) {
+          cpp_reg.shuffle_elements(shuffle_seed);
         }
+        cpp_reg.parse(filename);
+        vkspec::Feature* cpp_feature = cpp_reg.build_feature("vulkan", profile.get());
 
-        {
-          CppTranslator translator;
-          vkspec::Registry reg(&translator);
-          reg.parse(filename);
-          vkspec::Feature* feature = reg.build_feature("vulkan");
+        std::cout << "Writing vulkan.rs and its modules to " << out_dir << std::endl;
 
-          CppDispatchTableGenerator generator(VULKAN_DIR, reg.license(), feature->major(), feature->minor(), feature->patch());
-          feature->generate(&generator);
+        // The Rust generator does the most work and is registered first so
+        // that it starts right away.
+        GeneratorDriver driver(threads, stats.get());
+        driver.add<RustGenerator>("rust", rust_feature, out_dir, rust_reg.license(), rust_feature->major(), rust_feature->minor(), rust_feature->patch());
+        driver.add<CppDispatchTableGenerator>("cpp dispatch tables", cpp_feature, out_dir, cpp_reg.license(), cpp_feature->major(), cpp_feature->minor(), cpp_feature->patch(), shard_dispatch_tables, max_commands_per_shard);
+        driver.add<CppDispatcherGenerator>("cpp dispatcher", cpp_feature, out_dir, cpp_reg.license(), cpp_feature->major(), cpp_feature->minor(), cpp_feature->patch());
+        driver.add<CppStructHashGenerator>("cpp struct hash", cpp_feature, out_dir, cpp_reg.license(), cpp_feature->major(), cpp_feature->minor(), cpp_feature->patch());
+        driver.add<CppDeepCopyGenerator>("cpp deep copy", cpp_feature, out_dir, cpp_reg.license(), cpp_feature->major(), cpp_feature->minor(), cpp_feature->patch());
+        driver.add<CppForwardDeclarationGenerator>("cpp forward declarations", cpp_feature, out_dir, cpp_reg.license(), cpp_feature->major(), cpp_feature->minor(), cpp_feature->patch());
+        driver.add<CppCommandStreamGenerator>("cpp command stream", cpp_feature, out_dir, cpp_reg.license(), cpp_feature->major(), cpp_feature->minor(), cpp_feature->patch());
+        driver.add<CppStateFilterGenerator>("cpp state filter", cpp_feature, out_dir, cpp_reg.license(), cpp_feature->major(), cpp_feature->minor(), cpp_feature->patch());
+        driver.run();
+        total.reset();
+
+        if (stats) {
+          std::cout << std::endl;
+          stats->write_text(std::cout);
+          std::cout << std::endl;
+
+          std::ofstream json(stats_file);
+          if (!json.is_open()) {
+            throw std::runtime_error("Failed to open " + stats_file + " for writing stats");
+          }
+          stats->write_json(json);
+          std::cout << "Stats written to " << stats_file << std::endl;
         }
+
+        std::cout << "Peak memory usage: " << peak_memory_usage() / 1024 << " KiB" << std::endl;
 	}
 	catch (std::exception const& e)
 	{
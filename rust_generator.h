@@ -3,10 +3,13 @@
 
 #include "vkspec.h"
 #include "indenting_stream_buf.h"
+#include <algorithm>
+#include <cctype>
 #include <fstream>
+#include <map>
+#include <set>
 
-const std::string macro_use = R"(pub use ::std::ffi::CString;
-pub use ::std::ops::{BitOr, BitAnd};
+const std::string macro_use = R"(pub use ::std::ops::{BitOr, BitAnd};
 pub use ::std::{fmt, mem};)";
 
 const std::string function_macro = R"(
@@ -33,22 +36,13 @@ pub use ::std::os::raw::{c_void, c_char, c_int, c_ulong};)";
 const std::string flags_macro_comment = R"(/*
 For regular enums, a repr(C) enum is used, which seems to be the way to go.
 Things become a bit more difficult for flags because Rust requires enum values
-to be valid variants, which is not the case when oring them together. Some
-tests by transmuting worked, but sometimes Rust would cast to some actual
-variant and this was not always obvious (matching for example). Instead, the
-flag enums use the newtype pattern to build a struct that wraps an integer.
-This struct enables bitwise operations, provides type safety, and scopes so
-that only particular values can be created, just like an enum. The problem now
-is that since we are working with a struct using a single member and not the
-underlying type, the ABI may not be the same as when working with the wrapped
-type directly. This could cause problems when passing this new type to C. A
-suggestion about transparency attribute has been proposed that would solve this
-problem, but it's slow going: https://github.com/rust-lang/rfcs/pull/1758. As
-long as it works for me I'll leave it like this. Note that the type keyword
-does not help here as it is just an alias and not an actual new type. When it
-comes to the variants, for now I can create them using functions. It's
-expected that associated constants (const values inside a struct) will land in
-the 1.20 version of the compiler which could replace the functions.
+to be valid variants, which is not the case when oring them together. Instead,
+the flag types use the newtype pattern to build a struct that wraps an
+integer. Being repr(transparent), the struct is guaranteed to have the same
+ABI as the wrapped VkFlags, so it can be passed to C as is. The flags are
+associated constants and the bit operations are const fns, so combinations
+of flags can be computed at compile time. The BitOr and BitAnd operators are
+provided for convenience outside of constant expressions.
 */)";
 
 const std::string flags_macro = R"(
@@ -65,16 +59,72 @@ macro_rules! flag_definitions {
 
 macro_rules! bitmask {
     ($bitmask:ident) => (
-        #[repr(C)]
-        #[derive(Debug, Copy, Clone, PartialEq)]
+        #[repr(transparent)]
+        #[derive(Debug, Copy, Clone, PartialEq, Eq, Hash, Default)]
         pub struct $bitmask {
             flags: VkFlags,
         }
 
+        #[allow(dead_code)]
         impl $bitmask {
-            #[allow(dead_code)] // Don't know why this one warns... it's public
-            pub fn none() -> $bitmask {
-                $bitmask { flags: 0 }
+            pub const NONE: $bitmask = $bitmask { flags: 0 };
+
+            #[inline]
+            pub const fn from_raw(flags: VkFlags) -> $bitmask {
+                $bitmask { flags: flags }
+            }
+
+            #[inline]
+            pub const fn as_raw(self) -> VkFlags {
+                self.flags
+            }
+
+            #[inline]
+            pub const fn is_empty(self) -> bool {
+                self.flags == 0
+            }
+
+            #[inline]
+            pub const fn contains(self, other: $bitmask) -> bool {
+                self.flags & other.flags == other.flags
+            }
+
+            #[inline]
+            pub const fn intersects(self, other: $bitmask) -> bool {
+                self.flags & other.flags != 0
+            }
+
+            #[inline]
+            pub const fn union(self, other: $bitmask) -> $bitmask {
+                $bitmask { flags: self.flags | other.flags }
+            }
+
+            #[inline]
+            pub const fn intersection(self, other: $bitmask) -> $bitmask {
+                $bitmask { flags: self.flags & other.flags }
+            }
+
+            #[inline]
+            pub const fn difference(self, other: $bitmask) -> $bitmask {
+                $bitmask { flags: self.flags & !other.flags }
+            }
+        }
+
+        impl BitOr for $bitmask {
+            type Output = Self;
+
+            #[inline]
+            fn bitor(self, rhs: Self) -> Self {
+                self.union(rhs)
+            }
+        }
+
+        impl BitAnd for $bitmask {
+            type Output = Self;
+
+            #[inline]
+            fn bitand(self, rhs: Self) -> Self {
+                self.intersection(rhs)
             }
         }
     )
@@ -89,33 +139,32 @@ macro_rules! flag_traits {
         }
     );
     ($bitmask:ident, $bit_definitions:ident, { $($flag:ident = $flag_val:expr,)* }) => (
-        impl BitOr for $bitmask {
-            type Output = Self;
+        impl $bitmask {
+            $(
+                pub const $flag: $bitmask = $bitmask { flags: $flag_val };
+            )*
+        }
 
-            fn bitor(self, rhs: Self) -> Self {
-                $bitmask { flags: self.flags | rhs.flags }
+        impl From<$bit_definitions> for $bitmask {
+            #[inline]
+            fn from(bit: $bit_definitions) -> $bitmask {
+                $bitmask { flags: bit as VkFlags }
             }
         }
 
         impl BitOr<$bit_definitions> for $bitmask {
             type Output = Self;
 
+            #[inline]
             fn bitor(self, rhs: $bit_definitions) -> Self {
                 $bitmask { flags: self.flags | (rhs as VkFlags) }
             }
         }
 
-        impl BitAnd for $bitmask {
-            type Output = Self;
-
-            fn bitand(self, rhs: Self) -> Self {
-                $bitmask { flags: self.flags & rhs.flags }
-            }
-        }
-
         impl BitAnd<$bit_definitions> for $bitmask {
             type Output = Self;
 
+            #[inline]
             fn bitand(self, rhs: $bit_definitions) -> Self {
                 $bitmask { flags: self.flags & (rhs as VkFlags) }
             }
@@ -129,9 +178,7 @@ macro_rules! flag_traits {
                             "    [{}] ", stringify!($flag), "\n",
                         )* "}}"
                     )
-                    //$(, if *self & $type_name::$flag() == $type_name::$flag() { if self.flags != 0 && $type_name::$flag().flags == 0 { " " } else { "x" } } else { " " } )*
-                    //$(, if *self & $type_name::$flag() == $type_name::$flag() { "x" } else { " " } )*
-                    $(, if self.flags & ($bit_definitions::$flag as VkFlags) == ($bit_definitions::$flag as VkFlags) { "x" } else { " " } )*
+                    $(, if self.contains($bitmask::$flag) { "x" } else { " " } )*
                 )
             }
         }
@@ -173,7 +220,7 @@ macro_rules! global_dispatch_table {
                         // of failure assures that success means that all
                         // pointers are valid to call.
                         $(
-                            $fun: match vulkan_entry.vkGetInstanceProcAddr(0, CString::new(stringify!($fun)).unwrap().as_ptr()) {
+                            $fun: match vulkan_entry.vkGetInstanceProcAddr(0, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
                                 Some(f) => mem::transmute(f),
                                 None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
                             },
@@ -212,7 +259,7 @@ macro_rules! instance_dispatch_table {
                 unsafe {
                     Ok(InstanceDispatchTable {
                         $(
-                            $fun: match vulkan_entry.vkGetInstanceProcAddr(instance, CString::new(stringify!($fun)).unwrap().as_ptr()) {
+                            $fun: match vulkan_entry.vkGetInstanceProcAddr(instance, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
                                 Some(f) => mem::transmute(f),
                                 None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
                             },
@@ -248,7 +295,7 @@ macro_rules! device_dispatch_table {
                 unsafe {
                     Ok(DeviceDispatchTable {
                         $(
-                            $fun: match instance_table.vkGetDeviceProcAddr(device, CString::new(stringify!($fun)).unwrap().as_ptr()) {
+                            $fun: match instance_table.vkGetDeviceProcAddr(device, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
                                 Some(f) => mem::transmute(f),
                                 None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
                             },
@@ -264,25 +311,89 @@ macro_rules! device_dispatch_table {
                 }
             )*
         }
+
+        lazy_device_dispatch_table!{
+            $($fun => ($($param_id: $param_type),*) -> $return_type,)*
+        }
+    )
+})";
+
+const std::string lazy_device_dispatch_table_macro = R"(
+// Generates LazyDeviceDispatchTable, an alternative to DeviceDispatchTable
+// that resolves each command the first time it is called rather than all of
+// them up front. Every slot is an atomic pointer that starts out null and is
+// set once the command has been resolved, so calling through the table only
+// costs a load and a null test. Calling a command the driver does not have
+// panics. The table holds no references and only atomics, so it is Sync and
+// can be shared between threads, for example in a static OnceLock.
+macro_rules! lazy_device_dispatch_table {
+    { $($fun:ident => ($($param_id:ident: $param_type:ty),*) -> $return_type:ty,)* } => (
+        pub struct LazyDeviceDispatchTable {
+            device: VkDevice,
+            get_device_proc_addr: vk_fun!((device: VkDevice, pName: *const c_char) -> Option<PFN_vkVoidFunction>),
+            $(
+                $fun: ::std::sync::atomic::AtomicPtr<c_void>,
+            )*
+        }
+
+        impl LazyDeviceDispatchTable {
+            pub fn new(instance_table: &InstanceDispatchTable, device: VkDevice) -> LazyDeviceDispatchTable {
+                LazyDeviceDispatchTable {
+                    device: device,
+                    get_device_proc_addr: instance_table.vkGetDeviceProcAddr,
+                    $(
+                        $fun: ::std::sync::atomic::AtomicPtr::new(::std::ptr::null_mut()),
+                    )*
+                }
+            }
+
+            // Kept out of line so that the calling methods stay small. Racing
+            // threads may both resolve a command, but they store the same
+            // pointer.
+            #[cold]
+            #[inline(never)]
+            unsafe fn resolve(&self, slot: &::std::sync::atomic::AtomicPtr<c_void>, name: &'static str) -> *mut c_void {
+                match (self.get_device_proc_addr)(self.device, name.as_ptr() as *const c_char) {
+                    Some(f) => {
+                        let p = f as *mut c_void;
+                        slot.store(p, ::std::sync::atomic::Ordering::Release);
+                        p
+                    },
+                    None => panic!("Could not load {}", &name[..name.len() - 1]),
+                }
+            }
+
+            $(
+                #[inline]
+                pub unsafe fn $fun(&self $(, $param_id: $param_type)*) -> $return_type {
+                    let mut p = self.$fun.load(::std::sync::atomic::Ordering::Acquire);
+                    if p.is_null() {
+                        p = self.resolve(&self.$fun, concat!(stringify!($fun), "\0"));
+                    }
+                    let f: vk_fun!(($($param_id: $param_type),*) -> $return_type) = mem::transmute(p);
+                    f($($param_id),*)
+                }
+            )*
+        }
     )
 })";
 
 const std::string load_function_macro = R"(
 macro_rules! load_function {
     (instance, $fun:ident, $vulkan_entry:ident, $instance:ident) => (
-        match $vulkan_entry.vkGetInstanceProcAddr($instance, CString::new(stringify!($fun)).unwrap().as_ptr()) {
+        match $vulkan_entry.vkGetInstanceProcAddr($instance, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
             Some(f) => mem::transmute(f),
             None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
         }
     );
     (instance, $fun:ident, $vulkan_entry:ident, $instance:ident, $instance_table:ident, $device:ident) => (
-        match $vulkan_entry.vkGetInstanceProcAddr($instance, CString::new(stringify!($fun)).unwrap().as_ptr()) {
+        match $vulkan_entry.vkGetInstanceProcAddr($instance, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
             Some(f) => mem::transmute(f),
             None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
         }
     );
     (device, $fun:ident, $vulkan_entry:ident, $instance:ident, $instance_table:ident, $device:ident) => (
-        match $instance_table.vkGetDeviceProcAddr($device, CString::new(stringify!($fun)).unwrap().as_ptr()) {
+        match $instance_table.vkGetDeviceProcAddr($device, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
             Some(f) => mem::transmute(f),
             None => return Err(String::from(concat!("Could not load ", stringify!($fun)))),
         }
@@ -344,25 +455,128 @@ macro_rules! extension_dispatch_table {
     )
 })";
 
-class RustGenerator : public vkspec::IGenerator {
-public:
-  RustGenerator(std::string const& out_file, std::string const& license, int major, int minor, int patch) {
-    _file.open(out_file);
-    if (!_file.is_open()) {
-      throw std::runtime_error("Failed to open file for output");
-    }
+const std::string load_optional_function_macro = R"(
+// Like load_function!, but yields None instead of failing when the loader
+// does not know about the function.
+macro_rules! load_optional_function {
+    (instance, $fun:ident, $vulkan_entry:ident, $instance:ident, $instance_table:ident, $device:ident) => (
+        match $vulkan_entry.vkGetInstanceProcAddr($instance, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+            Some(f) => Some(mem::transmute(f)),
+            None => None,
+        }
+    );
+    (device, $fun:ident, $vulkan_entry:ident, $instance:ident, $instance_table:ident, $device:ident) => (
+        match $instance_table.vkGetDeviceProcAddr($device, concat!(stringify!($fun), "\0").as_ptr() as *const c_char) {
+            Some(f) => Some(mem::transmute(f)),
+            None => None,
+        }
+    );
+})";
 
-    _indent = new IndentingOStreambuf(_file, 4);
+const std::string device_dispatch_macro = R"(
+// Generates DeviceDispatch, an alternative to creating one table per device
+// extension. It wraps the core device table and has an optional slot for
+// every device extension command, filled in a single pass for the
+// extensions in the enabled set and left as None for the others. Slots are
+// public so that presence can be checked with is_some(), which is just a
+// null test since Option of a function pointer has the same representation
+// as the pointer itself. Core commands are reached through Deref.
+macro_rules! device_dispatch {
+    { $(#[$cfg:meta] $ext:ident => { $([$fun_type:ident] $fun:ident => ($($param_id:ident: $param_type:ty),*) -> $return_type:ty,)* },)* } => (
+        pub struct DeviceDispatch {
+            core: DeviceDispatchTable,
+            $($(
+                #[$cfg]
+                pub $fun: Option<vk_fun!(($($param_id: $param_type),*) -> $return_type)>,
+            )*)*
+        }
 
-    _file << license << std::endl;
-    _file << std::endl;
-    _file << "// Rust bindings for Vulkan " << major << "." << minor << "." << patch << ", generated from the Khronos Vulkan API XML Registry." << std::endl;
-    _file << "// See https://github.com/andens/Vulkan-Hpp for generator details." << std::endl;
-    _file << std::endl;
+        impl DeviceDispatch {
+            #[allow(unused_variables)]
+            pub fn new(vulkan_entry: &VulkanEntry, instance: VkInstance, instance_table: &InstanceDispatchTable, device: VkDevice, enabled_extensions: &[&str]) -> Result<DeviceDispatch, String> {
+                let enabled = |name: &str| enabled_extensions.iter().any(|e| *e == name);
+
+                #[allow(unused_mut)]
+                let mut table = DeviceDispatch {
+                    core: DeviceDispatchTable::new(instance_table, device)?,
+                    $($(
+                        #[$cfg]
+                        $fun: None,
+                    )*)*
+                };
+
+                #[allow(unused_unsafe)] // When no extension is compiled in
+                unsafe {
+                    $(
+                        #[$cfg]
+                        if enabled(stringify!($ext)) {
+                            $(
+                                table.$fun = load_optional_function!($fun_type, $fun, vulkan_entry, instance, instance_table, device);
+                            )*
+                        }
+                    )*
+                }
+
+                Ok(table)
+            }
+
+            // Calling a command whose extension was not enabled is a
+            // programming error and panics.
+            $($(
+                #[$cfg]
+                #[inline]
+                pub unsafe fn $fun(&self $(, $param_id: $param_type)*) -> $return_type {
+                    (self.$fun.expect(concat!(stringify!($fun), " is not loaded")))($($param_id),*)
+                }
+            )*)*
+        }
+
+        impl ::std::ops::Deref for DeviceDispatch {
+            type Target = DeviceDispatchTable;
+
+            fn deref(&self) -> &DeviceDispatchTable {
+                &self.core
+            }
+        }
+    )
+})";
+
+const std::string chain_link = R"(
+// Common beginning of structs that can be part of a pNext chain, used by
+// builders to link them together.
+#[repr(C)]
+pub struct ChainLink {
+    pub sType: VkStructureType,
+    pub pNext: *mut ChainLink,
+})";
+
+class RustGenerator : public vkspec::IGenerator {
+public:
+  // The bindings are written as a module tree in out_dir: vulkan.rs holds
+  // the macros and declares the core and extensions modules, which live in
+  // vulkan_core.rs and vulkan_extensions.rs. The latter declares one module
+  // per extension, each in its own file and compiled only when the Cargo
+  // feature named after the extension is enabled, and for platform
+  // extensions only on that platform. The features, with the extensions
+  // they depend on, are written to vulkan_features.toml.
+  RustGenerator(std::string const& out_dir, std::string const& license, int major, int minor, int patch) : _out_dir(out_dir), _license(license), _major(major), _minor(minor), _patch(patch) {
+    _open("vulkan.rs");
     _file << "#![allow(non_camel_case_types)]" << std::endl;
     _file << "#![allow(non_snake_case)]" << std::endl;
     _file << std::endl;
     _write_macros();
+    _file << std::endl;
+    _file << "#[path = \"vulkan_core.rs\"]" << std::endl;
+    _file << "pub mod core;" << std::endl;
+    _file << std::endl;
+    _file << "#[path = \"vulkan_extensions.rs\"]" << std::endl;
+    _file << "pub mod extensions;" << std::endl;
+    _file << std::endl;
+    _file << "// Compile time checks that struct layouts match C, printed by the program" << std::endl;
+    _file << "// generated in vulkan_layout.c when built for the target platform." << std::endl;
+    _file << "#[cfg(feature = \"layout_assertions\")]" << std::endl;
+    _file << "#[path = \"vulkan_layout.rs\"]" << std::endl;
+    _file << "mod layout;" << std::endl;
   }
 
   ~RustGenerator() {
@@ -371,10 +585,7 @@ public:
   }
 
   virtual void RustGenerator::begin_core() override final {
-    _file << std::endl;
-    _file << "pub mod core {" << std::endl;
-
-    _indent->increase();
+    _open("vulkan_core.rs");
 
     _file << use_statements << std::endl;
 
@@ -383,11 +594,11 @@ public:
     _file << "pub fn VK_MAKE_VERSION(major: u32, minor: u32, patch: u32) -> u32 {" << std::endl;
     _file << "    (major << 22) | (minor << 12) | patch" << std::endl;
     _file << "}" << std::endl;
+
+    _file << chain_link << std::endl;
   }
 
   virtual void RustGenerator::end_core() override final {
-    _indent->decrease();
-    _file << "} // mod core" << std::endl;
   }
 
   virtual void RustGenerator::gen_scalar_typedef(vkspec::ScalarTypedef* t) override final {
@@ -404,6 +615,11 @@ public:
       _file << std::endl;
     }
 
+    _depend_on(t->pure_return_type());
+    for (auto& p : t->params()) {
+      _depend_on(p.pure_type);
+    }
+
     _file << "pub type " << t->name() << " = vk_fun!((";
     if (!t->params().empty()) {
       _file << t->params()[0].name << ": " << t->params()[0].complete_type;
@@ -431,6 +647,10 @@ public:
   }
 
   virtual void RustGenerator::gen_struct(vkspec::Struct* t) override final {
+    for (auto& m : t->members()) {
+      _depend_on(m.pure_type);
+    }
+
     _file << std::endl;
     _file << "#[repr(C)]" << std::endl;
 
@@ -438,8 +658,11 @@ public:
       _write_union(t);
     } else {
       _write_struct(t);
+      _write_builder(t);
     }
 
+    _generated_structs.insert(t->name());
+    _layout_structs.push_back(t);
     _previous_type = Type::Struct;
   }
 
@@ -625,6 +848,8 @@ public:
     }
     _indent->decrease();
     _file << "}" << std::endl;
+
+    _write_enumerate_helpers("GlobalDispatchTable", _global_commands);
   }
 
   virtual void RustGenerator::begin_instance_commands() override final {
@@ -659,6 +884,8 @@ public:
     }
     _indent->decrease();
     _file << "}" << std::endl;
+
+    _write_enumerate_helpers("InstanceDispatchTable", _instance_commands);
   }
 
 
@@ -686,22 +913,84 @@ public:
     }
     _indent->decrease();
     _file << "}" << std::endl;
+
+    _write_enumerate_helpers("DeviceDispatchTable", _device_commands);
+    _write_enumerate_helpers("LazyDeviceDispatchTable", _device_commands);
   }
 
   virtual void RustGenerator::begin_extensions() override final {
+  }
+
+  virtual void RustGenerator::end_extensions() override final {
+    _open("vulkan_extensions.rs");
+    _file << "#![allow(unused_imports)]" << std::endl;
     _file << std::endl;
-    _file << "pub mod extensions {" << std::endl;
-    _indent->increase();
     _file << "use super::macros::*;" << std::endl;
     _file << "use super::core::*;" << std::endl;
-  }
 
-  virtual void RustGenerator::end_extensions() override final {
+    for (auto e : _extensions) {
+      _file << std::endl;
+      _file << "#[cfg(" << _cfg(e) << ")]" << std::endl;
+      _file << "#[path = \"" << _module_file(e) << "\"]" << std::endl;
+      _file << "mod " << _module_name(e) << ";" << std::endl;
+      _file << "#[cfg(" << _cfg(e) << ")]" << std::endl;
+      _file << "pub use self::" << _module_name(e) << "::*;" << std::endl;
+    }
+
+    // Emitted last since an extending struct may be generated before the
+    // struct it extends.
+    _file << std::endl;
+    for (auto& e : _struct_extends) {
+      if (_generated_structs.count(e.second->name())) {
+        std::vector<std::string> cfgs;
+        if (e.first->extension()) {
+          cfgs.push_back(_cfg(e.first->extension()));
+        }
+        if (e.second->extension() && e.second->extension() != e.first->extension()) {
+          cfgs.push_back(_cfg(e.second->extension()));
+        }
+        if (cfgs.size() == 1) {
+          _file << "#[cfg(" << cfgs[0] << ")]" << std::endl;
+        }
+        else if (cfgs.size() == 2) {
+          _file << "#[cfg(all(" << cfgs[0] << ", " << cfgs[1] << "))]" << std::endl;
+        }
+        _file << "unsafe impl Extends" << e.second->name() << " for " << e.first->name() << " {}" << std::endl;
+      }
+    }
+
+    _file << std::endl;
+    _file << "device_dispatch!{" << std::endl;
+    _indent->increase();
+    for (auto e : _device_extensions) {
+      _file << "#[cfg(" << _cfg(e) << ")] " << e->name() << " => {" << std::endl;
+      _indent->increase();
+      for (auto c : e->commands()) {
+        _write_extension_command(c);
+      }
+      _indent->decrease();
+      _file << "}," << std::endl;
+    }
     _indent->decrease();
-    _file << "} // mod extensions" << std::endl;
+    _file << "}" << std::endl;
+
+    _write_features();
+    _write_layout_program();
   }
 
   virtual void RustGenerator::begin_extension(vkspec::Extension* e) override final {
+    _current_extension = e;
+    _extensions.push_back(e);
+    for (auto& r : e->required_extensions()) {
+      _dependencies[e->name()].insert(r);
+    }
+
+    _open(_module_file(e));
+    _file << "#![allow(unused_imports)]" << std::endl;
+    _file << std::endl;
+    _file << "use super::super::macros::*;" << std::endl;
+    _file << "use super::super::core::*;" << std::endl;
+    _file << "use super::*;" << std::endl;
     _file << std::endl;
     _file << "/*" << std::endl;
     _file << " * ------------------------------------------------------" << std::endl;
@@ -726,22 +1015,23 @@ public:
     _file << "extension_dispatch_table!{" << e->name() << " | " << type << ", {" << std::endl;
     _indent->increase();
     for (auto c : e->commands()) {
-      _file << "[" << ((c->classification() == vkspec::CommandClassification::Instance) ? "instance" : "device") << "] ";
-      _file << c->name() << " => (";
-      if (!c->params().empty()) {
-        std::string name = c->params()[0].name;
-        if (name == "type") { name = "type_"; }
-        _file << name << ": " << c->params()[0].complete_type;
-        for (auto it = c->params().begin() + 1; it != c->params().end(); ++it) {
-          name = it->name;
-          if (name == "type") { name = "type_"; }
-          _file << ", " << name << ": " << it->complete_type;
-        }
+      _depend_on(c->pure_return_type());
+      for (auto& p : c->params()) {
+        _depend_on(p.pure_type);
       }
-      _file << ") -> " << c->complete_return_type() << "," << std::endl;
+      _write_extension_command(c);
     }
     _indent->decrease();
     _file << "}}" << std::endl;
+
+    _write_enumerate_helpers(e->name(), e->commands());
+
+    if (e->classification() == vkspec::ExtensionClassification::Device && !e->commands().empty()) {
+      _device_extensions.push_back(e);
+      _write_enumerate_helpers("DeviceDispatch", e->commands());
+    }
+
+    _current_extension = nullptr;
   }
 
 private:
@@ -757,8 +1047,194 @@ private:
   };
 
 private:
+  // Closes the current file and starts writing to a new one in the output
+  // directory, beginning with the license and generator notice.
+  void _open(std::string const& file_name) {
+    delete _indent;
+    _indent = nullptr;
+    if (_file.is_open()) {
+      _file.close();
+    }
+
+    _file.open(_out_dir + "/" + file_name);
+    if (!_file.is_open()) {
+      throw std::runtime_error("Failed to open file for output");
+    }
+
+    _indent = new IndentingOStreambuf(_file, 4);
+
+    _file << _license << std::endl;
+    _file << std::endl;
+    _file << "// Rust bindings for Vulkan " << _major << "." << _minor << "." << _patch << ", generated from the Khronos Vulkan API XML Registry." << std::endl;
+    _file << "// See https://github.com/andens/Vulkan-Hpp for generator details." << std::endl;
+    _file << std::endl;
+  }
+
+  void _write_features() {
+    std::ofstream features(_out_dir + "/vulkan_features.toml");
+    if (!features.is_open()) {
+      throw std::runtime_error("Failed to open file for output");
+    }
+
+    features << "# Cargo features for the Rust bindings for Vulkan " << _major << "." << _minor << "." << _patch << ", generated from the Khronos Vulkan API XML Registry." << std::endl;
+    features << "# Add these to the [features] section of the crate including vulkan.rs." << std::endl;
+    features << std::endl;
+
+    std::set<std::string> generated;
+    for (auto e : _extensions) {
+      generated.insert(e->name());
+    }
+
+    for (auto e : _extensions) {
+      features << e->name() << " = [";
+      bool first = true;
+      for (auto& d : _dependencies[e->name()]) {
+        if (generated.count(d)) {
+          features << (first ? "" : ", ") << "\"" << d << "\"";
+          first = false;
+        }
+      }
+      features << "]" << std::endl;
+    }
+
+    for (auto& p : _platform_features) {
+      features << p << " = []" << std::endl;
+    }
+
+    features << "layout_assertions = []" << std::endl;
+  }
+
+  // Writes a C program printing the layout of every struct as seen by the C
+  // compiler, in the form of Rust constant assertions. Its output goes to
+  // vulkan_layout.rs, which is compiled with the layout_assertions feature.
+  // Unions are only checked for size and alignment since their members are
+  // accessor methods in Rust.
+  void _write_layout_program() {
+    std::ofstream program(_out_dir + "/vulkan_layout.c");
+    if (!program.is_open()) {
+      throw std::runtime_error("Failed to open file for output");
+    }
+
+    program << _license << std::endl;
+    program << std::endl;
+    program << "// Layout checks for the Rust bindings for Vulkan " << _major << "." << _minor << "." << _patch << ", generated from the Khronos Vulkan API XML Registry." << std::endl;
+    program << "// See https://github.com/andens/Vulkan-Hpp for generator details." << std::endl;
+    program << std::endl;
+    program << "#include <stddef.h>" << std::endl;
+    program << "#include <stdio.h>" << std::endl;
+    program << "#include \"vulkan_include.inl\"" << std::endl;
+    program << std::endl;
+    program << "#define ALIGNOF(T) offsetof(struct { char c; T t; }, t)" << std::endl;
+    program << "#define CHECK_TYPE(T) fprintf(out, \"%sconst _: () = assert!(size_of::<\" #T \">() == %lu && align_of::<\" #T \">() == %lu);\\n\", cfg, (unsigned long)sizeof(T), (unsigned long)ALIGNOF(T))" << std::endl;
+    program << "#define CHECK_MEMBER(T, M, RUST_M) fprintf(out, \"%sconst _: () = assert!(offset_of!(\" #T \", \" RUST_M \") == %lu);\\n\", cfg, (unsigned long)offsetof(T, M))" << std::endl;
+    program << std::endl;
+    program << "int main(int argc, char** argv) {" << std::endl;
+    program << "  FILE* out = (argc > 1) ? fopen(argv[1], \"w\") : stdout;" << std::endl;
+    program << "  char const* cfg = \"\"; /* Attribute making the check conditional like the struct */" << std::endl;
+    program << "  if (!out) {" << std::endl;
+    program << "    fprintf(stderr, \"Failed to open %s for output\\n\", argv[1]);" << std::endl;
+    program << "    return 1;" << std::endl;
+    program << "  }" << std::endl;
+    program << std::endl;
+    program << "  fprintf(out, \"// Layout assertions for the Rust bindings for Vulkan " << _major << "." << _minor << "." << _patch << ", printed by vulkan_layout.c.\\n\");" << std::endl;
+    program << "  fprintf(out, \"\\n\");" << std::endl;
+    program << "  fprintf(out, \"#![allow(unused_imports)]\\n\");" << std::endl;
+    program << "  fprintf(out, \"\\n\");" << std::endl;
+    program << "  fprintf(out, \"use super::core::*;\\n\");" << std::endl;
+    program << "  fprintf(out, \"use super::extensions::*;\\n\");" << std::endl;
+    program << "  fprintf(out, \"use std::mem::{align_of, offset_of, size_of};\\n\");" << std::endl;
+
+    for (auto t : _layout_structs) {
+      std::string cfg;
+      std::string protect;
+      if (t->extension()) {
+        cfg = "#[cfg(" + _cfg(t->extension()) + ")] ";
+        protect = t->extension()->protect();
+      }
+
+      std::string escaped;
+      for (char c : cfg) {
+        if (c == '"') {
+          escaped += '\\';
+        }
+        escaped += c;
+      }
+
+      program << std::endl;
+      if (protect != "") {
+        program << "#if defined(" << protect << ")" << std::endl;
+      }
+      program << "  fprintf(out, \"\\n\");" << std::endl;
+      program << "  cfg = \"" << escaped << "\";" << std::endl;
+      program << "  CHECK_TYPE(" << t->name() << ");" << std::endl;
+      if (!t->is_union()) {
+        for (auto& m : t->members()) {
+          program << "  CHECK_MEMBER(" << t->name() << ", " << m.name << ", \"" << _field_name(m.name) << "\");" << std::endl;
+        }
+      }
+      if (protect != "") {
+        program << "#endif" << std::endl;
+      }
+    }
+
+    program << std::endl;
+    program << "  if (out != stdout) {" << std::endl;
+    program << "    fclose(out);" << std::endl;
+    program << "  }" << std::endl;
+    program << "  return 0;" << std::endl;
+    program << "}" << std::endl;
+  }
+
+  // Records that the extension being generated uses a type from another one.
+  // Extensions do not always list everything they need in requires.
+  void _depend_on(vkspec::Type* t) {
+    if (_current_extension && t && t->extension() && t->extension() != _current_extension) {
+      _dependencies[_current_extension->name()].insert(t->extension()->name());
+    }
+  }
+
+  std::string _module_name(vkspec::Extension* e) {
+    std::string name = e->name();
+    std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+    return name;
+  }
+
+  std::string _module_file(vkspec::Extension* e) {
+    return "vulkan_" + _module_name(e) + ".rs";
+  }
+
+  // The condition under which an extension module is compiled.
+  std::string _cfg(vkspec::Extension* e) {
+    std::string cfg = "feature = \"" + e->name() + "\"";
+    std::string platform = _platform_cfg(e->protect());
+    if (platform != "") {
+      cfg = "all(" + cfg + ", " + platform + ")";
+    }
+    return cfg;
+  }
+
+  // Maps the preprocessor define protecting a platform specific extension to
+  // the corresponding Rust target. Unknown platforms get a feature of their
+  // own that has to be enabled explicitly.
+  std::string _platform_cfg(std::string const& protect) {
+    std::string unix_desktop = "all(unix, not(target_os = \"android\"), not(target_os = \"macos\"), not(target_os = \"ios\"))";
+    if (protect == "") return "";
+    else if (protect == "VK_USE_PLATFORM_WIN32_KHR") return "windows";
+    else if (protect == "VK_USE_PLATFORM_ANDROID_KHR") return "target_os = \"android\"";
+    else if (protect == "VK_USE_PLATFORM_MACOS_MVK") return "target_os = \"macos\"";
+    else if (protect == "VK_USE_PLATFORM_IOS_MVK") return "target_os = \"ios\"";
+    else if (protect == "VK_USE_PLATFORM_XLIB_KHR") return unix_desktop;
+    else if (protect == "VK_USE_PLATFORM_XLIB_XRANDR_EXT") return unix_desktop;
+    else if (protect == "VK_USE_PLATFORM_XCB_KHR") return unix_desktop;
+    else if (protect == "VK_USE_PLATFORM_WAYLAND_KHR") return unix_desktop;
+    else if (protect == "VK_USE_PLATFORM_MIR_KHR") return unix_desktop;
+    _platform_features.insert(protect);
+    return "feature = \"" + protect + "\"";
+  }
+
   void _write_macros() {
     _file << "#[macro_use]" << std::endl;
+    _file << "#[allow(unused_macros)] // Some are only used by extensions, which may all be disabled" << std::endl;
     _file << "mod macros {" << std::endl;
 
     _indent->increase();
@@ -771,15 +1247,34 @@ private:
     _file << global_dispatch_table_macro << std::endl;
     _file << instance_dispatch_table_macro << std::endl;
     _file << device_dispatch_table_macro << std::endl;
+    _file << lazy_device_dispatch_table_macro << std::endl;
     _file << load_function_macro << std::endl;
     _file << extension_table_ctor_macro << std::endl;
     _file << extension_dispatch_table_macro << std::endl;
+    _file << load_optional_function_macro << std::endl;
+    _file << device_dispatch_macro << std::endl;
 
     _indent->decrease();
 
     _file << "} // mod macros" << std::endl;
   }
 
+  void _write_extension_command(vkspec::Command* c) {
+    _file << "[" << ((c->classification() == vkspec::CommandClassification::Instance) ? "instance" : "device") << "] ";
+    _file << c->name() << " => (";
+    if (!c->params().empty()) {
+      std::string name = c->params()[0].name;
+      if (name == "type") { name = "type_"; }
+      _file << name << ": " << c->params()[0].complete_type;
+      for (auto it = c->params().begin() + 1; it != c->params().end(); ++it) {
+        name = it->name;
+        if (name == "type") { name = "type_"; }
+        _file << ", " << name << ": " << it->complete_type;
+      }
+    }
+    _file << ") -> " << c->complete_return_type() << "," << std::endl;
+  }
+
   void _write_union(vkspec::Struct* t) {
     _file << "pub struct " << t->name() << " {" << std::endl;
     _indent->increase();
@@ -822,6 +1317,14 @@ private:
 
     _indent->decrease();
     _file << "}" << std::endl;
+
+    _file << "impl Default for " << t->name() << " {" << std::endl;
+    _indent->increase();
+    _file << "fn default() -> " << t->name() << " {" << std::endl;
+    _file << "    unsafe { mem::zeroed() }" << std::endl;
+    _file << "}" << std::endl;
+    _indent->decrease();
+    _file << "}" << std::endl;
   }
 
   void _write_struct(vkspec::Struct* t) {
@@ -840,6 +1343,349 @@ private:
 
     _indent->decrease();
     _file << "}" << std::endl;
+
+    _file << "impl Default for " << t->name() << " {" << std::endl;
+    _indent->increase();
+    _file << "fn default() -> " << t->name() << " {" << std::endl;
+    _indent->increase();
+    _file << t->name() << " {" << std::endl;
+    _indent->increase();
+    for (auto& m : t->members()) {
+      _file << _field_name(m.name) << ": " << _default_value(m) << "," << std::endl;
+    }
+    _indent->decrease();
+    _file << "}" << std::endl;
+    _indent->decrease();
+    _file << "}" << std::endl;
+    _indent->decrease();
+    _file << "}" << std::endl;
+  }
+
+  // Commands ending in a count pointer followed by an array whose len is
+  // that count get a <command>_into helper that fills a Vec. The Vec is
+  // cleared but keeps its capacity, so when it is reused and large enough a
+  // single call suffices. Otherwise the count is queried, the Vec grown and
+  // the call retried, also when VK_INCOMPLETE is returned because the count
+  // changed in between. Commands returning nothing cannot report an
+  // incomplete result and always query the count first.
+  void _write_enumerate_helpers(std::string const& table, std::vector<vkspec::Command*> const& commands) {
+    std::vector<vkspec::Command*> enumerations;
+    for (auto c : commands) {
+      auto& params = c->params();
+      if (params.size() < 2 || (c->complete_return_type() != "VkResult" && c->complete_return_type() != "()")) {
+        continue;
+      }
+      auto& count = params[params.size() - 2];
+      auto& array = params.back();
+      if (array.len.size() == 1 && array.len[0] == count.name && array.complete_type.compare(0, 5, "*mut ") == 0 &&
+          (count.complete_type == "*mut u32" || count.complete_type == "*mut usize")) {
+        enumerations.push_back(c);
+      }
+    }
+
+    if (enumerations.empty()) {
+      return;
+    }
+
+    _file << std::endl;
+    _file << "impl " << table << " {" << std::endl;
+    _indent->increase();
+
+    for (auto c : enumerations) {
+      auto& params = c->params();
+      auto& count = params[params.size() - 2];
+      auto& array = params.back();
+      std::string count_type = count.complete_type.substr(5);
+      std::string element = array.complete_type.substr(5);
+      std::string cast;
+      if (element == "c_void") {
+        element = "u8";
+        cast = " as *mut c_void";
+      }
+
+      // Output structs with an sType must have it set before the call
+      bool initialize = false;
+      if (array.pure_type->to_struct()) {
+        for (auto& m : array.pure_type->to_struct()->members()) {
+          initialize = initialize || m.name == "sType";
+        }
+      }
+
+      std::string args;
+      _file << "pub unsafe fn " << c->name() << "_into(&self";
+      for (auto it = params.begin(); it != params.end() - 2; ++it) {
+        std::string name = _field_name(it->name);
+        _file << ", " << name << ": " << it->complete_type;
+        args += name + ", ";
+      }
+      _file << ", out: &mut Vec<" << element << ">)";
+      if (c->complete_return_type() != "()") {
+        _file << " -> " << c->complete_return_type();
+      }
+      _file << " {" << std::endl;
+      _indent->increase();
+
+      _file << "out.clear();" << std::endl;
+
+      if (c->complete_return_type() == "()") {
+        _file << "let mut count: " << count_type << " = 0;" << std::endl;
+        _file << "self." << c->name() << "(" << args << "&mut count, ::std::ptr::null_mut());" << std::endl;
+        _file << "out.reserve(count as usize);" << std::endl;
+        if (initialize) {
+          _file << "out.resize_with(count as usize, Default::default);" << std::endl;
+        }
+        _file << "self." << c->name() << "(" << args << "&mut count, out.as_mut_ptr()" << cast << ");" << std::endl;
+        _file << (initialize ? "out.truncate(count as usize);" : "out.set_len(count as usize);") << std::endl;
+      }
+      else {
+        _file << "loop {" << std::endl;
+        _indent->increase();
+        _file << "let mut count = out.capacity() as " << count_type << ";" << std::endl;
+        _file << "if count > 0 {" << std::endl;
+        _indent->increase();
+        if (initialize) {
+          _file << "out.resize_with(count as usize, Default::default);" << std::endl;
+        }
+        _file << "match self." << c->name() << "(" << args << "&mut count, out.as_mut_ptr()" << cast << ") {" << std::endl;
+        _indent->increase();
+        _file << "VkResult::VK_SUCCESS => {" << std::endl;
+        _file << "    " << (initialize ? "out.truncate(count as usize);" : "out.set_len(count as usize);") << std::endl;
+        _file << "    return VkResult::VK_SUCCESS;" << std::endl;
+        _file << "}," << std::endl;
+        _file << "VkResult::VK_INCOMPLETE => {}," << std::endl;
+        _file << "other => return other," << std::endl;
+        _indent->decrease();
+        _file << "}" << std::endl;
+        if (initialize) {
+          _file << "out.clear();" << std::endl;
+        }
+        _indent->decrease();
+        _file << "}" << std::endl;
+        _file << "match self." << c->name() << "(" << args << "&mut count, ::std::ptr::null_mut()) {" << std::endl;
+        _file << "    VkResult::VK_SUCCESS => {}," << std::endl;
+        _file << "    other => return other," << std::endl;
+        _file << "}" << std::endl;
+        _file << "if count == 0 {" << std::endl;
+        _file << "    return VkResult::VK_SUCCESS;" << std::endl;
+        _file << "}" << std::endl;
+        _file << "out.reserve(count as usize);" << std::endl;
+        _indent->decrease();
+        _file << "}" << std::endl;
+      }
+
+      _indent->decrease();
+      _file << "}" << std::endl;
+    }
+
+    _indent->decrease();
+    _file << "}" << std::endl;
+  }
+
+  // Builders borrow everything they point to for the lifetime 'a, so the
+  // built struct cannot outlive its arrays, strings and pNext chain. Array
+  // members with a len naming another member are set from a slice, which
+  // also sets the count.
+  void _write_builder(vkspec::Struct* t) {
+    std::string builder = t->name() + "Builder";
+    bool chained = false;
+
+    _file << "#[repr(transparent)]" << std::endl;
+    _file << "pub struct " << builder << "<'a> {" << std::endl;
+    _indent->increase();
+    _file << "inner: " << t->name() << "," << std::endl;
+    _file << "marker: ::std::marker::PhantomData<&'a ()>," << std::endl;
+    _indent->decrease();
+    _file << "}" << std::endl;
+
+    _file << "impl " << t->name() << " {" << std::endl;
+    _indent->increase();
+    _file << "pub fn builder<'a>() -> " << builder << "<'a> {" << std::endl;
+    _file << "    " << builder << " { inner: " << t->name() << "::default(), marker: ::std::marker::PhantomData }" << std::endl;
+    _file << "}" << std::endl;
+    _indent->decrease();
+    _file << "}" << std::endl;
+
+    _file << "impl<'a> " << builder << "<'a> {" << std::endl;
+    _indent->increase();
+
+    for (auto& m : t->members()) {
+      std::string field = _field_name(m.name);
+
+      if (m.name == "sType") {
+        continue;
+      }
+
+      if (m.name == "pNext") {
+        chained = true;
+        continue;
+      }
+
+      if (_slice_count(t, m)) {
+        continue;
+      }
+
+      std::string const_prefix = "*const ";
+      std::string mut_prefix = "*mut ";
+      bool is_const = m.complete_type.compare(0, const_prefix.size(), const_prefix) == 0;
+      bool is_mut = m.complete_type.compare(0, mut_prefix.size(), mut_prefix) == 0;
+      bool optional = !m.optional.empty() && m.optional[0];
+
+      if (auto count = _slice_length(t, m)) {
+        std::string element = m.complete_type.substr(is_const ? const_prefix.size() : mut_prefix.size());
+        std::string cast;
+        if (element == "c_void") {
+          element = "u8";
+          cast = std::string(" as ") + (is_const ? "*const" : "*mut") + " c_void";
+        }
+        _file << "pub fn " << field << "(mut self, v: &'a " << (is_const ? "" : "mut ") << "[" << element << "]) -> Self {" << std::endl;
+        _indent->increase();
+        _file << "self.inner." << _field_name(count->name) << " = v.len() as " << count->complete_type << ";" << std::endl;
+        _file << "self.inner." << field << " = v." << (is_const ? "as_ptr()" : "as_mut_ptr()") << cast << ";" << std::endl;
+        _file << "self" << std::endl;
+        _indent->decrease();
+        _file << "}" << std::endl;
+      }
+      else if (is_const && m.pure_type->name() == "c_char" && m.len.size() == 1 && m.len[0] == "null-terminated") {
+        if (optional) {
+          _file << "pub fn " << field << "(mut self, v: Option<&'a ::std::ffi::CStr>) -> Self {" << std::endl;
+          _file << "    self.inner." << field << " = v.map_or(::std::ptr::null(), |s| s.as_ptr());" << std::endl;
+        }
+        else {
+          _file << "pub fn " << field << "(mut self, v: &'a ::std::ffi::CStr) -> Self {" << std::endl;
+          _file << "    self.inner." << field << " = v.as_ptr();" << std::endl;
+        }
+        _file << "    self" << std::endl;
+        _file << "}" << std::endl;
+      }
+      else if ((is_const || is_mut) && m.len.empty() && m.pure_type->to_struct() && m.complete_type.find('*', 1) == std::string::npos) {
+        std::string reference = std::string("&'a ") + (is_const ? "" : "mut ") + m.pure_type->name();
+        std::string pointer = std::string(is_const ? "*const " : "*mut ") + m.pure_type->name();
+        if (optional) {
+          _file << "pub fn " << field << "(mut self, v: Option<" << reference << ">) -> Self {" << std::endl;
+          _file << "    self.inner." << field << " = v.map_or(::std::ptr::" << (is_const ? "null()" : "null_mut()") << ", |r| r as " << pointer << ");" << std::endl;
+        }
+        else {
+          _file << "pub fn " << field << "(mut self, v: " << reference << ") -> Self {" << std::endl;
+          _file << "    self.inner." << field << " = v as " << pointer << ";" << std::endl;
+        }
+        _file << "    self" << std::endl;
+        _file << "}" << std::endl;
+      }
+      else {
+        std::string type = m.complete_type;
+        if (m.pure_type->to_function_typedef()) {
+          type = "Option<" + m.complete_type + ">";
+        }
+        _file << "pub fn " << field << "(mut self, v: " << type << ") -> Self {" << std::endl;
+        _file << "    self.inner." << field << " = v;" << std::endl;
+        _file << "    self" << std::endl;
+        _file << "}" << std::endl;
+      }
+    }
+
+    // Structs accepted by push_next are those declaring, through
+    // structextends, that they may be part of this struct's pNext chain.
+    // The pushed struct is inserted, together with its own chain, at the
+    // front of the chain.
+    if (chained) {
+      _file << "pub fn push_next<T: Extends" << t->name() << ">(mut self, next: &'a mut T) -> Self {" << std::endl;
+      _indent->increase();
+      _file << "unsafe {" << std::endl;
+      _indent->increase();
+      _file << "let next = next as *mut T as *mut ChainLink;" << std::endl;
+      _file << "let mut last = next;" << std::endl;
+      _file << "while !(*last).pNext.is_null() {" << std::endl;
+      _file << "    last = (*last).pNext;" << std::endl;
+      _file << "}" << std::endl;
+      _file << "(*last).pNext = self.inner.pNext as *mut ChainLink;" << std::endl;
+      _file << "self.inner.pNext = next as _;" << std::endl;
+      _indent->decrease();
+      _file << "}" << std::endl;
+      _file << "self" << std::endl;
+      _indent->decrease();
+      _file << "}" << std::endl;
+    }
+
+    _file << "// Gives up the borrow; the caller must keep referenced data alive." << std::endl;
+    _file << "pub fn build(self) -> " << t->name() << " {" << std::endl;
+    _file << "    self.inner" << std::endl;
+    _file << "}" << std::endl;
+
+    _indent->decrease();
+    _file << "}" << std::endl;
+
+    _file << "impl<'a> ::std::ops::Deref for " << builder << "<'a> {" << std::endl;
+    _indent->increase();
+    _file << "type Target = " << t->name() << ";" << std::endl;
+    _file << "fn deref(&self) -> &" << t->name() << " {" << std::endl;
+    _file << "    &self.inner" << std::endl;
+    _file << "}" << std::endl;
+    _indent->decrease();
+    _file << "}" << std::endl;
+
+    if (chained) {
+      _file << "pub unsafe trait Extends" << t->name() << " {}" << std::endl;
+    }
+
+    for (auto e : t->extends()) {
+      _struct_extends.push_back(std::make_pair(t, e));
+    }
+  }
+
+  // Returns the member holding the element count if m is a pointer whose len
+  // is just the name of another member.
+  vkspec::Struct::Member const* _slice_length(vkspec::Struct* t, vkspec::Struct::Member const& m) {
+    if (m.complete_type[0] != '*' || m.len.empty() || m.pure_type->to_function_typedef()) {
+      return nullptr;
+    }
+    for (auto& other : t->members()) {
+      if (other.name == m.len[0] && other.complete_type[0] != '*' && other.array_size == "") {
+        return &other;
+      }
+    }
+    return nullptr;
+  }
+
+  // Whether m is the count of some slice member, in which case it is set
+  // together with the slice instead of having its own setter.
+  bool _slice_count(vkspec::Struct* t, vkspec::Struct::Member const& m) {
+    for (auto& other : t->members()) {
+      auto count = _slice_length(t, other);
+      if (count && count->name == m.name) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::string _default_value(vkspec::Struct::Member const& m) {
+    if (m.name == "sType" && m.values != "" && m.values.find(',') == std::string::npos) {
+      return "VkStructureType::" + m.values;
+    }
+    if (m.array_size != "") {
+      return "unsafe { mem::zeroed() }";
+    }
+    if (m.complete_type.compare(0, 7, "*const ") == 0) {
+      return "::std::ptr::null()";
+    }
+    if (m.complete_type.compare(0, 5, "*mut ") == 0) {
+      return "::std::ptr::null_mut()";
+    }
+    if (m.pure_type->to_function_typedef()) {
+      return "None";
+    }
+    // Zero is not a valid variant of every enum, so use the first one
+    if (m.pure_type->to_enum()) {
+      if (m.pure_type->to_enum()->members().empty()) {
+        return "unsafe { mem::zeroed() }";
+      }
+      return m.pure_type->name() + "::" + m.pure_type->to_enum()->members()[0].name;
+    }
+    return "Default::default()";
+  }
+
+  std::string _field_name(std::string const& name) {
+    return name == "type" ? "type_" : name;
   }
 
 private:
@@ -850,6 +1696,19 @@ private:
   std::vector<vkspec::Command*> _global_commands;
   std::vector<vkspec::Command*> _instance_commands;
   std::vector<vkspec::Command*> _device_commands;
+  std::vector<vkspec::Extension*> _device_extensions; // Device extensions with commands
+  std::set<std::string> _generated_structs;
+  std::vector<std::pair<vkspec::Struct*, vkspec::Struct*>> _struct_extends; // (extending struct, extended struct)
+  std::string _out_dir;
+  std::string _license;
+  int _major = 0;
+  int _minor = 0;
+  int _patch = 0;
+  vkspec::Extension* _current_extension = nullptr;
+  std::vector<vkspec::Extension*> _extensions;
+  std::map<std::string, std::set<std::string>> _dependencies; // Extension name to names of extensions it uses
+  std::set<std::string> _platform_features;
+  std::vector<vkspec::Struct*> _layout_structs;
 };
 
 class RustTranslator : public vkspec::ITranslator {
@@ -0,0 +1,256 @@
+#include "stats.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#include <time.h>
+#endif
+
+using namespace std;
+
+// Every allocation of the program is counted by the thread making it, so
+// that threads allocating at the same time never write to shared cache
+// lines. Each thread links its counters into a list on its first
+// allocation. Process totals are only needed when a Stats::Scope begins or
+// ends, and are then summed over the list plus what exited threads left.
+namespace {
+  struct ThreadCounters {
+    ThreadCounters();
+    ~ThreadCounters();
+
+    // Only written by the owning thread, so increments need no atomic
+    // read-modify-write. Atomic for the sums made by other threads.
+    void add(size_t size) {
+      allocations.store(allocations.load(memory_order_relaxed) + 1, memory_order_relaxed);
+      allocated_bytes.store(allocated_bytes.load(memory_order_relaxed) + size, memory_order_relaxed);
+    }
+
+    atomic<uint64_t> allocations;
+    atomic<uint64_t> allocated_bytes;
+    ThreadCounters* next = nullptr;
+  };
+
+  mutex threads_mutex;
+  ThreadCounters* threads = nullptr;
+  uint64_t exited_allocations = 0;
+  uint64_t exited_allocated_bytes = 0;
+
+  // Set once the counters of the thread are destroyed, after which its
+  // remaining allocations count towards the exited threads
+  thread_local bool thread_exited = false;
+
+  ThreadCounters::ThreadCounters() : allocations(0), allocated_bytes(0) {
+    lock_guard<mutex> lock(threads_mutex);
+    next = threads;
+    threads = this;
+  }
+
+  ThreadCounters::~ThreadCounters() {
+    lock_guard<mutex> lock(threads_mutex);
+    ThreadCounters** link = &threads;
+    while (*link != this) {
+      link = &(*link)->next;
+    }
+    *link = next;
+    exited_allocations += allocations.load(memory_order_relaxed);
+    exited_allocated_bytes += allocated_bytes.load(memory_order_relaxed);
+    thread_exited = true;
+  }
+
+  ThreadCounters& thread_counters() {
+    static thread_local ThreadCounters counters;
+    return counters;
+  }
+
+  void count_allocation(size_t size) {
+    if (!thread_exited) {
+      thread_counters().add(size);
+    }
+    else {
+      lock_guard<mutex> lock(threads_mutex);
+      ++exited_allocations;
+      exited_allocated_bytes += size;
+    }
+  }
+
+  // Allocations and allocated bytes of the process or the calling thread
+  void allocation_counts(Stats::Counting counting, uint64_t& allocations, uint64_t& allocated_bytes) {
+    if (counting == Stats::Counting::Thread) {
+      ThreadCounters& counters = thread_counters();
+      allocations = counters.allocations.load(memory_order_relaxed);
+      allocated_bytes = counters.allocated_bytes.load(memory_order_relaxed);
+      return;
+    }
+
+    lock_guard<mutex> lock(threads_mutex);
+    allocations = exited_allocations;
+    allocated_bytes = exited_allocated_bytes;
+    for (ThreadCounters* t = threads; t; t = t->next) {
+      allocations += t->allocations.load(memory_order_relaxed);
+      allocated_bytes += t->allocated_bytes.load(memory_order_relaxed);
+    }
+  }
+}
+
+void* operator new(size_t size) {
+  count_allocation(size);
+
+  void* p = malloc(size ? size : 1);
+  if (!p) {
+    throw bad_alloc();
+  }
+  return p;
+}
+
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+size_t peak_memory_usage() {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return 0;
+  }
+  return counters.PeakWorkingSetSize;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#if defined(__APPLE__)
+  return usage.ru_maxrss; // Bytes on macOS
+#else
+  return usage.ru_maxrss * 1024; // Kilobytes elsewhere
+#endif
+#endif
+}
+
+// CPU time in milliseconds spent by the process or the calling thread.
+static double cpu_time(Stats::Counting counting) {
+#if defined(_WIN32)
+  FILETIME creation, exit, kernel, user;
+  BOOL ok = counting == Stats::Counting::Process ?
+    GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user) :
+    GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+  if (!ok) {
+    return 0.0;
+  }
+  auto ticks = [](FILETIME const& t) { return (static_cast<uint64_t>(t.dwHighDateTime) << 32) | t.dwLowDateTime; };
+  return (ticks(kernel) + ticks(user)) / 10000.0; // 100 ns ticks
+#else
+  timespec t;
+  if (clock_gettime(counting == Stats::Counting::Process ? CLOCK_PROCESS_CPUTIME_ID : CLOCK_THREAD_CPUTIME_ID, &t) != 0) {
+    return 0.0;
+  }
+  return t.tv_sec * 1000.0 + t.tv_nsec / 1000000.0;
+#endif
+}
+
+Stats::Scope::Scope(Stats* stats, string const& name, Counting counting) : _stats(stats), _counting(counting) {
+  if (!_stats) {
+    return;
+  }
+
+  _index = _stats->_begin(name);
+  allocation_counts(_counting, _allocations_start, _allocated_bytes_start);
+  _cpu_start = cpu_time(_counting);
+  _wall_start = chrono::steady_clock::now();
+}
+
+Stats::Scope::~Scope() {
+  if (!_stats) {
+    return;
+  }
+
+  Phase phase;
+  phase.wall_ms = chrono::duration<double, milli>(chrono::steady_clock::now() - _wall_start).count();
+  phase.cpu_ms = cpu_time(_counting) - _cpu_start;
+  uint64_t allocations = 0;
+  uint64_t allocated_bytes = 0;
+  allocation_counts(_counting, allocations, allocated_bytes);
+  phase.allocations = allocations - _allocations_start;
+  phase.allocated_bytes = allocated_bytes - _allocated_bytes_start;
+  phase.peak_rss = peak_memory_usage();
+  _stats->_end(_index, phase);
+}
+
+size_t Stats::_begin(string const& name) {
+  lock_guard<mutex> lock(_mutex);
+  Phase phase;
+  phase.name = name;
+  _phases.push_back(phase);
+  return _phases.size() - 1;
+}
+
+void Stats::_end(size_t index, Phase const& phase) {
+  lock_guard<mutex> lock(_mutex);
+  string name = _phases[index].name;
+  _phases[index] = phase;
+  _phases[index].name = name;
+}
+
+vector<Stats::Phase> Stats::phases() const {
+  lock_guard<mutex> lock(_mutex);
+  return _phases;
+}
+
+void Stats::write_text(ostream& out) const {
+  vector<Phase> phases = this->phases();
+
+  size_t width = 5;
+  for (auto& p : phases) {
+    width = max(width, p.name.size());
+  }
+
+  auto flags = out.flags();
+  out << left << setw(width) << "phase" << right
+      << setw(12) << "wall ms" << setw(12) << "cpu ms" << setw(14) << "allocations"
+      << setw(14) << "alloc KiB" << setw(14) << "peak RSS KiB" << endl;
+  out << fixed << setprecision(1);
+  for (auto& p : phases) {
+    out << left << setw(width) << p.name << right
+        << setw(12) << p.wall_ms << setw(12) << p.cpu_ms << setw(14) << p.allocations
+        << setw(14) << p.allocated_bytes / 1024 << setw(14) << p.peak_rss / 1024 << endl;
+  }
+  out.flags(flags);
+}
+
+void Stats::write_json(ostream& out) const {
+  vector<Phase> phases = this->phases();
+
+  auto flags = out.flags();
+  out << fixed << setprecision(3);
+  out << "{" << endl;
+  out << "  \"phases\": [";
+  string comma = "";
+  for (auto& p : phases) {
+    string name;
+    for (char c : p.name) {
+      if (c == '"' || c == '\\') {
+        name += '\\';
+      }
+      name += c;
+    }
+
+    out << comma << endl;
+    out << "    { \"name\": \"" << name << "\""
+        << ", \"wall_ms\": " << p.wall_ms
+        << ", \"cpu_ms\": " << p.cpu_ms
+        << ", \"allocations\": " << p.allocations
+        << ", \"allocated_bytes\": " << p.allocated_bytes
+        << ", \"peak_rss_bytes\": " << p.peak_rss << " }";
+    comma = ",";
+  }
+  out << endl << "  ]" << endl;
+  out << "}" << endl;
+  out.flags(flags);
+}
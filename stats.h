@@ -0,0 +1,71 @@
+#ifndef STATS_INCLUDE
+#define STATS_INCLUDE
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Returns the peak resident set size of the process in bytes.
+size_t peak_memory_usage();
+
+// Collects wall time, CPU time, allocations and peak memory of named phases
+// of a generator run. A phase is measured by a Stats::Scope that lives for
+// the duration of the phase. Scopes may be opened from several threads at
+// once; the report lists phases in the order they were started.
+class Stats {
+public:
+  struct Phase {
+    std::string name;
+    double wall_ms = 0.0;
+    double cpu_ms = 0.0;
+    uint64_t allocations = 0;
+    uint64_t allocated_bytes = 0;
+    size_t peak_rss = 0; // Process peak when the phase ended
+  };
+
+  // What CPU time and allocations of a scope are counted against.
+  enum class Counting {
+    Process, // The whole process, for phases that spread work over threads
+    Thread, // The calling thread only, for phases running next to others
+  };
+
+  // Measures from construction to destruction and records the result in
+  // |stats| under |name|. Does nothing if |stats| is null, so phases can be
+  // scoped unconditionally.
+  class Scope {
+  public:
+    Scope(Stats* stats, std::string const& name, Counting counting = Counting::Process);
+    ~Scope();
+
+  private:
+    Scope(Scope const&) = delete;
+    void operator=(Scope const&) = delete;
+
+  private:
+    Stats* _stats;
+    size_t _index = 0;
+    Counting _counting;
+    std::chrono::steady_clock::time_point _wall_start;
+    double _cpu_start = 0.0;
+    uint64_t _allocations_start = 0;
+    uint64_t _allocated_bytes_start = 0;
+  };
+
+  std::vector<Phase> phases() const;
+
+  void write_text(std::ostream& out) const;
+  void write_json(std::ostream& out) const;
+
+private:
+  size_t _begin(std::string const& name);
+  void _end(size_t index, Phase const& phase);
+
+private:
+  mutable std::mutex _mutex;
+  std::vector<Phase> _phases;
+};
+
+#endif
@@ -1,15 +1,19 @@
 #include "vkspec.h"
+#include "job_queue.h"
+#include "stats.h"
 
 #include <algorithm>
 #include <cassert>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <random>
 #include <regex>
 #include <sstream>
 
 namespace vkspec {
 
-    Registry::Registry(ITranslator* translator) : _translator(translator) {
+    Registry::Registry(ITranslator* translator, unsigned int threads) : _translator(translator), _threads(threads) {
       // I'm working under the assumption that the C and OS types used will
       // be a comparatively small set so that I can deal with those manually.
       // This way I can assume that types not existing at the time I need them
@@ -22,9 +26,9 @@ namespace vkspec {
         // when a translation is forgotten.
         CType* c_type = new CType(c, "?");
         c_type->_opaque = opaque;
-        assert(_items.insert(std::make_pair(c, c_type)).second == true);
-        assert(_types.insert(std::make_pair(c, c_type)).second == true);
-        assert(_c_types.insert(std::make_pair(c, c_type)).second == true);
+        _insert_unique(_items, std::make_pair(c, c_type));
+        _insert_unique(_types, std::make_pair(c, c_type));
+        _insert_unique(_c_types, std::make_pair(c, c_type));
       };
       
       define_c("void");
@@ -67,31 +71,53 @@ namespace vkspec {
 
 		std::cout << "Loading vk.xml from " << spec << std::endl;
 
-		tinyxml2::XMLError error = _doc.LoadFile(spec.c_str());
-		if (error != tinyxml2::XML_SUCCESS)
 		{
-			throw std::runtime_error("VkGenerate: failed to load file " + spec + ". Error code: " + std::to_string(error));
+			Stats::Scope scope(_stats, _stats_label + "load xml");
+			_doc.reset(new tinyxml2::XMLDocument());
+			tinyxml2::XMLError error = _doc->LoadFile(spec.c_str());
+			if (error != tinyxml2::XML_SUCCESS)
+			{
+				throw std::runtime_error("VkGenerate: failed to load file " + spec + ". Error code: " + std::to_string(error));
+			}
 		}
 
 		// The very first element is expected to be a registry, and it should
 		// be the only root element.
-		tinyxml2::XMLElement * registryElement = _doc.FirstChildElement();
+		tinyxml2::XMLElement * registryElement = _doc->FirstChildElement();
 		assert(strcmp(registryElement->Value(), "registry") == 0);
 		assert(!registryElement->NextSiblingElement());
 
-		_parse_item_declarations(registryElement);
+		if (_shuffle) {
+			_shuffle_document(registryElement);
+		}
 
-		// Sort extensions on number before going further (should already be
-		// sorted but you never know). That way I can process them in order
-		// which is useful when determining which extension types were added by
-		// what extension.
-		_sort_extensions();
+		{
+			Stats::Scope scope(_stats, _stats_label + "declarations");
+			_parse_item_declarations(registryElement);
+
+			// Sort extensions on number before going further (should already be
+			// sorted but you never know). That way I can process them in order
+			// which is useful when determining which extension types were added by
+			// what extension.
+			_sort_extensions();
+		}
 
 		// Parse type definitions. We are now able to get any type we depend on
 		// since they were created in the pass before.
-		_parse_item_definitions(registryElement);
+		{
+			Stats::Scope scope(_stats, _stats_label + "definitions");
+			_parse_item_definitions(registryElement);
 
-		_mark_command_classifications();
+			_mark_command_classifications();
+		}
+
+		// Everything except feature and extension definitions has been read,
+		// and those keep a copy of their elements. The document is by far the
+		// largest allocation, so it is dropped right away.
+		{
+			Stats::Scope scope(_stats, _stats_label + "release xml");
+			_release_document();
+		}
 
 		_parsed = true;
 
@@ -100,7 +126,7 @@ namespace vkspec {
 		}
 	}
 
-	Feature * Registry::build_feature(std::string const& feature) {
+	Feature * Registry::build_feature(std::string const& feature, Profile const* profile) {
 		if (!_feature_acquired) {
 			auto feature_it = std::find_if(_features.begin(), _features.end(), [&feature](Feature* f) -> bool {
 				return f->_name == feature;
@@ -112,7 +138,7 @@ namespace vkspec {
 			}
 
 			_feature_acquired = true;
-			_build_feature(*feature_it);
+			_build_feature(*feature_it, profile);
 			return *feature_it;
 		}
 		else {
@@ -120,6 +146,51 @@ namespace vkspec {
 		}
 	}
 
+	void Registry::_release_document() {
+		for (auto f : _features) {
+			f->_definition = XmlElement(f->_xml_node);
+		}
+		for (auto e : _extensions) {
+			e->_definition = XmlElement(e->_xml_node);
+		}
+		for (auto f : _features) {
+			f->_xml_node = nullptr;
+		}
+		for (auto& item : _items) {
+			item.second->_xml_node = nullptr;
+		}
+		_doc.reset();
+	}
+
+	void Registry::_shuffle_document(tinyxml2::XMLElement* registry_element) {
+		std::mt19937 random(_shuffle_seed);
+
+		// Moving an element to the end of its parent in shuffled order leaves
+		// everything before |first| where it was.
+		auto shuffle_children = [&random](tinyxml2::XMLElement* parent, tinyxml2::XMLElement* first) {
+			std::vector<tinyxml2::XMLElement*> children;
+			for (tinyxml2::XMLElement* child = first; child; child = child->NextSiblingElement()) {
+				children.push_back(child);
+			}
+			std::shuffle(children.begin(), children.end(), random);
+			for (auto child : children) {
+				parent->InsertEndChild(child);
+			}
+		};
+
+		// Sections of the registry may come in any order, except for the
+		// license comment that must stay first. Types, commands, tags and
+		// extensions are looked up by name or sorted, while the order of enum
+		// values and of require blocks decides the order of the outputs.
+		shuffle_children(registry_element, registry_element->FirstChildElement()->NextSiblingElement());
+		for (tinyxml2::XMLElement* child = registry_element->FirstChildElement(); child; child = child->NextSiblingElement()) {
+			char const* value = child->Value();
+			if (strcmp(value, "types") == 0 || strcmp(value, "commands") == 0 || strcmp(value, "tags") == 0 || strcmp(value, "extensions") == 0) {
+				shuffle_children(child, child->FirstChildElement());
+			}
+		}
+	}
+
 	void Registry::_parse_item_declarations(tinyxml2::XMLElement* registry_element) {
 		// The root tag contains zero or more of the following tags. Order may
 		// change. Here we parse item declarations, but do not define them. That
@@ -136,30 +207,32 @@ namespace vkspec {
       }
 		for (tinyxml2::XMLElement * child = registry_element->FirstChildElement(); child; child = child->NextSiblingElement())
 		{
-			assert(child->Value());
-			const std::string value = child->Value();
+			// Element names and attributes are compared in place in the document
+			// buffer, and only copied once they are stored in the registry.
+			char const* value = child->Value();
+			assert(value);
 
-			if (value == "tags") {
+			if (strcmp(value, "tags") == 0) {
 				// Author IDs for extensions and layers
 				_read_tags(child);
 			}
-			else if (value == "types") {
+			else if (strcmp(value, "types") == 0) {
 				// Types used in the API
 				_read_types(child);
 			}
-			else if (value == "enums") {
+			else if (strcmp(value, "enums") == 0) {
 				// Enum definitions, but we only declare them for now
 				_read_enums(child);
 			}
-			else if (value == "commands") {
+			else if (strcmp(value, "commands") == 0) {
 				// Declarations of commands used in the API
 				_read_commands(child);
 			}
-			else if (value == "extensions") {
+			else if (strcmp(value, "extensions") == 0) {
 				// Extension interfaces
 				_read_extensions(child);
 			}
-			else if (value == "feature") {
+			else if (strcmp(value, "feature") == 0) {
 				_read_feature(child);
 			}
 			else {
@@ -171,7 +244,7 @@ namespace vkspec {
               // be great if Khronos could just provide clear rules about which
               // order things happen in and generally structure the registry in
               // a way that makes parsing straight forward without guesswork.
-				assert(value == "vendorids" || value == "comment");
+				assert(strcmp(value, "vendorids") == 0 || strcmp(value, "comment") == 0);
 			}
 		}
 	}
@@ -213,48 +286,45 @@ namespace vkspec {
 		for (tinyxml2::XMLElement * child = element->FirstChildElement(); child; child = child->NextSiblingElement())
 		{
 			assert(child->Value() && (strcmp(child->Value(), "type") == 0 || strcmp(child->Value(), "comment") == 0));
-			std::string type = child->Value();
-            if (type == "comment") {
+            if (strcmp(child->Value(), "comment") == 0) {
               continue;
             }
 
 			// A present category indicates a type has a more complex definition.
 			// I.e, it's not just a basic C type.
-			if (child->Attribute("category"))
+			if (char const* category = child->Attribute("category"))
 			{
-				std::string category = child->Attribute("category");
-
-				if (category == "basetype")
+				if (strcmp(category, "basetype") == 0)
 				{
 					// C code for scalar typedefs.
 					_read_type_basetype(child);
 				}
-				else if (category == "bitmask")
+				else if (strcmp(category, "bitmask") == 0)
 				{
 					// C typedefs for enums that are bitmasks.
 					_read_type_bitmask(child);
 				}
-				else if (category == "define")
+				else if (strcmp(category, "define") == 0)
 				{
 					// C code for #define directives. Generally not interested in
 					// defines, but we can get Vulkan header version here.
 					_read_type_define(child);
 				}
-				else if (category == "funcpointer")
+				else if (strcmp(category, "funcpointer") == 0)
 				{
 					// C typedefs for function pointers.
 					_read_type_funcpointer(child);
 				}
-				else if (category == "handle")
+				else if (strcmp(category, "handle") == 0)
 				{
 					// C macros that define handle types such as VkInstance
 					_read_type_handle(child);
 				}
-				else if (category == "struct")
+				else if (strcmp(category, "struct") == 0)
 				{
 					_read_type_struct(child, false);
 				}
-				else if (category == "union")
+				else if (strcmp(category, "union") == 0)
 				{
 					_read_type_struct(child, true);
 				}
@@ -264,7 +334,7 @@ namespace vkspec {
 					// so I ignore them here and use enums instead where I can
 					// save the element containing definitions.
 					// include: C code for #include directives
-					assert((category == "enum") || (category == "include"));
+					assert(strcmp(category, "enum") == 0 || strcmp(category, "include") == 0);
 				}
 			}
 			// Unspecified category: non-structured definition. These should be some
@@ -272,11 +342,11 @@ namespace vkspec {
 			else
 			{
 				assert(child->FirstChildElement() == nullptr);
-				assert(child->Attribute("name"));
-				std::string name = child->Attribute("name");
+				char const* name = child->Attribute("name");
+				assert(name);
 
 				if (_c_types.find(name) == _c_types.end()) {
-					throw std::runtime_error("Translation for C type '" + name + "' not provided.");
+					throw std::runtime_error("Translation for C type '" + std::string(name) + "' not provided.");
 				}
 			}
 		}
@@ -289,8 +359,8 @@ namespace vkspec {
 		std::string name = name_element->GetText();
 
 		ScalarTypedef* t = new ScalarTypedef(name, element);
-		assert(_items.insert(std::make_pair(name, t)).second == true);
-		assert(_types.insert(std::make_pair(name, t)).second == true);
+		_insert_unique(_items, std::make_pair(name, t));
+		_insert_unique(_types, std::make_pair(name, t));
 		_scalar_typedefs.push_back(t);
 	}
 
@@ -301,8 +371,8 @@ namespace vkspec {
 		std::string name = name_element->GetText();
 
 		Bitmasks* b = new Bitmasks(name, element);
-		assert(_items.insert(std::make_pair(name, b)).second == true);
-		assert(_types.insert(std::make_pair(name, b)).second == true);
+		_insert_unique(_items, std::make_pair(name, b));
+		_insert_unique(_types, std::make_pair(name, b));
 		_bitmasks.push_back(b);
 	}
 
@@ -324,8 +394,8 @@ namespace vkspec {
 		std::string name = name_element->GetText();
 
 		FunctionTypedef* f = new FunctionTypedef(name, element);
-		assert(_items.insert(std::make_pair(name, f)).second == true);
-		assert(_types.insert(std::make_pair(name, f)).second == true);
+		_insert_unique(_items, std::make_pair(name, f));
+		_insert_unique(_types, std::make_pair(name, f));
 		_function_typedefs.push_back(f);
 	}
 
@@ -336,8 +406,8 @@ namespace vkspec {
 		std::string name = name_element->GetText();
 
 		HandleTypedef* h = new HandleTypedef(name, element);
-		assert(_items.insert(std::make_pair(name, h)).second == true);
-		assert(_types.insert(std::make_pair(name, h)).second == true);
+		_insert_unique(_items, std::make_pair(name, h));
+		_insert_unique(_types, std::make_pair(name, h));
 		_handle_typedefs.push_back(h);
 	}
 
@@ -347,8 +417,8 @@ namespace vkspec {
 		std::string name = element->Attribute("name");
 
 		Struct* s = new Struct(name, element, isUnion);
-		assert(_items.insert(std::make_pair(name, s)).second == true);
-		assert(_types.insert(std::make_pair(name, s)).second == true);
+		_insert_unique(_items, std::make_pair(name, s));
+		_insert_unique(_types, std::make_pair(name, s));
 		_structs.push_back(s);
 	}
 
@@ -379,8 +449,8 @@ namespace vkspec {
 
 		bool bitmask = type == "bitmask";
 		Enum* e = new Enum(name, element, bitmask);
-		assert(_items.insert(std::make_pair(name, e)).second == true);
-		assert(_types.insert(std::make_pair(name, e)).second == true);
+		_insert_unique(_items, std::make_pair(name, e));
+		_insert_unique(_types, std::make_pair(name, e));
 		_enums.push_back(e);
 	}
 
@@ -390,8 +460,8 @@ namespace vkspec {
 			std::string constant = child->Attribute("name");
 
 			ApiConstant* c = new ApiConstant(constant, child);
-			assert(_items.insert(std::make_pair(constant, c)).second == true);
-			assert(_types.insert(std::make_pair(constant, c)).second == true);
+			_insert_unique(_items, std::make_pair(constant, c));
+			_insert_unique(_types, std::make_pair(constant, c));
 			_api_constants.push_back(c);
 		}
 	}
@@ -419,9 +489,10 @@ namespace vkspec {
 		std::string name = name_element->GetText();
 
 		Command* c = new Command(name, element);
-		assert(_items.insert(std::make_pair(name, c)).second == true);
+		_insert_unique(_items, std::make_pair(name, c));
 		// Note: not a type, so no insertion to _types
 		_commands.push_back(c);
+		_command_lookup[name] = c;
 	}
 
 	void Registry::_read_extensions(tinyxml2::XMLElement * element)
@@ -444,8 +515,11 @@ namespace vkspec {
         if (element->Attribute("protect")) {
           e->_protect = element->Attribute("protect");
         }
+		if (element->Attribute("requires")) {
+			e->_required_extensions = _split_list(element->Attribute("requires"));
+		}
 
-		assert(_items.insert(std::make_pair(name, e)).second == true);
+		_insert_unique(_items, std::make_pair(name, e));
 		// Note: not a type, so no insertion to _types
 		_extensions.push_back(e);
 	}
@@ -464,7 +538,7 @@ namespace vkspec {
 		int minor = std::stoi(match[2].str());
 
 		Feature* f = new Feature(api, name, major, minor, element);
-		assert(_items.insert(std::make_pair(api, f)).second == true);
+		_insert_unique(_items, std::make_pair(api, f));
 		_features.push_back(f);
 	}
 
@@ -475,38 +549,48 @@ namespace vkspec {
 	}
 
 	void Registry::_parse_item_definitions(tinyxml2::XMLElement* registry_element) {
+		// Every item was declared in the previous pass, so a definition only
+		// looks up other items in _types and writes to the item being defined.
+		// Items are therefore defined concurrently, one job per item. Jobs are
+		// queued in the order definitions used to be parsed in, and the result
+		// of each job stays with its item in the declaration vectors, so the
+		// registry ends up the same regardless of which thread ran what.
+		std::vector<std::function<void()>> jobs;
+
 		for (auto t : _scalar_typedefs) {
-			_parse_scalar_typedef_definition(t);
+			jobs.push_back([this, t]() { _parse_scalar_typedef_definition(t); });
 		}
 
 		for (auto b : _bitmasks) {
-			_parse_bitmasks_definition(b);
+			jobs.push_back([this, b]() { _parse_bitmasks_definition(b); });
 		}
 
 		for (auto f : _function_typedefs) {
-			_parse_function_typedef_definition(f);
+			jobs.push_back([this, f]() { _parse_function_typedef_definition(f); });
 		}
 
 		for (auto h : _handle_typedefs) {
-			_parse_handle_typedef_definition(h);
+			jobs.push_back([this, h]() { _parse_handle_typedef_definition(h); });
 		}
 
 		for (auto s : _structs) {
-			_parse_struct_definition(s);
+			jobs.push_back([this, s]() { _parse_struct_definition(s); });
 		}
 
 		for (auto a : _api_constants) {
-			_parse_api_constant_definition(a);
+			jobs.push_back([this, a]() { _parse_api_constant_definition(a); });
 		}
 
 		for (auto e : _enums) {
-			_parse_enum_definition(e);
+			jobs.push_back([this, e]() { _parse_enum_definition(e); });
 		}
 
 		for (auto c : _commands) {
-			_parse_command_definition(c);
+			jobs.push_back([this, c]() { _parse_command_definition(c); });
 		}
 
+		run_jobs(jobs, _threads);
+
 		// Features are defined at a later time and extensions are defined in
 		// that process as well.
 	}
@@ -557,13 +641,9 @@ namespace vkspec {
 		// a little more type safety I need to at least make bitflags without
 		// members so that the type exists.
 		Enum* bit_definitions = nullptr;
-		char const* requires = b->_xml_node->Attribute("requires");
-		if (requires) {
-			auto enum_it = std::find_if(_enums.begin(), _enums.end(), [requires](Enum* e) -> bool {
-				return e->_name == requires;
-			});
-			assert(enum_it != _enums.end());
-			bit_definitions = *enum_it;
+		char const* required_type = b->_xml_node->Attribute("requires");
+		if (required_type) {
+			bit_definitions = _find_enum(required_type);
 		}
 
 		b->_actual_type = type_it->second;
@@ -586,8 +666,14 @@ namespace vkspec {
 
 		// This will match 'typedef TYPE* (VKAPI_PTR *' and contain TYPE in match
 		// group 1 with optional * in group 2.
-		std::regex re(R"(^typedef ([^ ^\*]+)(\*)? \(VKAPI_PTR \*$)");
-		auto it = std::sregex_iterator(text.begin(), text.end(), re);
+		// The expressions are compiled once and shared by all threads parsing
+		// definitions.
+		static const std::regex return_type_re(R"(^typedef ([^ ^\*]+)(\*)? \(VKAPI_PTR \*$)");
+		static const std::regex first_param_re(R"(\)\(\n[ ]+(const )?)");
+		static const std::regex param_re(R"(^(\*)?[ ]+([a-zA-Z]+)(.*)$)");
+		static const std::regex next_param_re(R"(^\n[ ]+(const )?$)");
+
+		auto it = std::sregex_iterator(text.begin(), text.end(), return_type_re);
 		auto end = std::sregex_iterator();
 		assert(it != end);
 		std::smatch match = *it;
@@ -605,8 +691,7 @@ namespace vkspec {
 		if (text != ")(void);") {
 			// In this case we will begin parameters, so we check if the first has
 			// a const modifier.
-			re = std::regex(R"(\)\(\n[ ]+(const )?)");
-			auto it = std::sregex_iterator(text.begin(), text.end(), re);
+			auto it = std::sregex_iterator(text.begin(), text.end(), first_param_re);
 			assert(it != end);
 			match = *it;
 			nextParamConst = match[1].matched;
@@ -636,8 +721,7 @@ namespace vkspec {
 			// name (group 2), and the rest (group 3). It doesn't seem that newline
 			// is a part of this. It's probably good because then I can easily work
 			// directly with suffix instead of more regex magic.
-			re = std::regex(R"(^(\*)?[ ]+([a-zA-Z]+)(.*)$)");
-			it = std::sregex_iterator(text.begin(), text.end(), re);
+			it = std::sregex_iterator(text.begin(), text.end(), param_re);
 			assert(it != end);
 			match = *it;
 			bool pointer = match[1].matched;
@@ -650,8 +734,7 @@ namespace vkspec {
 
 				// Match on the suffix to know if the upcoming parameter is const.
 				std::string suffix = match.suffix().str();
-				re = std::regex(R"(^\n[ ]+(const )?$)");
-				it = std::sregex_iterator(suffix.begin(), suffix.end(), re);
+				it = std::sregex_iterator(suffix.begin(), suffix.end(), next_param_re);
 				assert(it != end);
 				match = *it;
 				nextParamConst = match[1].matched;
@@ -737,12 +820,23 @@ namespace vkspec {
           assert(strcmp(child->Value(), "member") == 0);
           _read_type_struct_member(s, child);
 		}
+
+		if (s->_xml_node->Attribute("structextends")) {
+			for (auto& e : _split_list(s->_xml_node->Attribute("structextends"))) {
+				auto it = _types.find(e);
+				if (it == _types.end() || !it->second->to_struct()) {
+					throw std::runtime_error("spec error: struct " + name + " extends unknown struct " + e);
+				}
+				s->_extends.push_back(it->second->to_struct());
+			}
+		}
 	}
 
 	// Read a member tag of a struct, adding members to the provided struct.
 	void Registry::_read_type_struct_member(Struct* theStruct, tinyxml2::XMLElement * element) {
-		// The attributes of member tags seem to mostly concern documentation
-		// generation, so they are not of interest for the bindings.
+		// Most attributes of member tags concern documentation generation. The
+		// ones describing pointed-to data (len, altlen, optional) and the sType
+		// value are kept for generators that walk struct graphs.
 
 		// Read the type, parsing modifiers to get a string of the type.
 		std::string complete_type;
@@ -766,6 +860,21 @@ namespace vkspec {
 		m.pure_type = pure_type;
 		m.name = member_name;
 		m.array_dependency = c;
+		m.array_size = array_size;
+		if (element->Attribute("len")) {
+			m.len = _split_list(element->Attribute("len"));
+		}
+		if (element->Attribute("altlen")) {
+			m.altlen = element->Attribute("altlen");
+		}
+		if (element->Attribute("values")) {
+			m.values = element->Attribute("values");
+		}
+		if (element->Attribute("optional")) {
+			for (auto& o : _split_list(element->Attribute("optional"))) {
+				m.optional.push_back(o == "true");
+			}
+		}
 
 		theStruct->_members.push_back(m);
 	}
@@ -835,8 +944,10 @@ namespace vkspec {
 		// in places of type uint32_t, and ULL is used in places where the type
 		// is VkDeviceSize, which is typedefed to uint64_t.
 
-		std::regex re(R"(^(-)?[0-9]+$)");
-		auto it = std::sregex_iterator(value.begin(), value.end(), re);
+		static const std::regex integer_re(R"(^(-)?[0-9]+$)");
+		static const std::regex float_re(R"(^[0-9]+\.[0-9]+f$)");
+
+		auto it = std::sregex_iterator(value.begin(), value.end(), integer_re);
 		auto end = std::sregex_iterator();
 
 		// Matched a regular integer
@@ -849,8 +960,7 @@ namespace vkspec {
 			return;
 		}
 
-		re = std::regex(R"(^[0-9]+\.[0-9]+f$)");
-		it = std::sregex_iterator(value.begin(), value.end(), re);
+		it = std::sregex_iterator(value.begin(), value.end(), float_re);
 
 		// Matched float
 		if (it != end) {
@@ -919,6 +1029,13 @@ namespace vkspec {
 
 		_read_command_proto(proto, c);
 		_read_command_params(proto, c);
+
+		if (c->_xml_node->Attribute("renderpass")) {
+			c->_renderpass = c->_xml_node->Attribute("renderpass");
+		}
+		if (c->_xml_node->Attribute("tasks")) {
+			c->_tasks = _split_list(c->_xml_node->Attribute("tasks"));
+		}
 	}
 
 	void Registry::_read_command_proto(tinyxml2::XMLElement * element, Command* c)
@@ -984,6 +1101,14 @@ namespace vkspec {
 		p.array_dependency = a;
         p.const_modifier = const_modifier;
         p.array_size = array_size;
+		if (element->Attribute("len")) {
+			p.len = _split_list(element->Attribute("len"));
+		}
+		if (element->Attribute("optional")) {
+			for (auto& o : _split_list(element->Attribute("optional"))) {
+				p.optional.push_back(o == "true");
+			}
+		}
 
 		c->_params.push_back(p);
 	}
@@ -1091,6 +1216,20 @@ namespace vkspec {
 		return arraySize;
 	}
 
+	// Split a comma separated attribute such as len or structextends
+	std::vector<std::string> Registry::_split_list(std::string const& list)
+	{
+		std::vector<std::string> result;
+		auto begin = list.begin();
+		auto pos = list.end();
+		do {
+			pos = std::find(begin, list.end(), ',');
+			result.push_back(std::string(begin, pos));
+			begin = (pos == list.end()) ? pos : pos + 1;
+		} while (pos != list.end());
+		return result;
+	}
+
 	// trim from end
 	std::string Registry::_trim_end(std::string const& input)
 	{
@@ -1139,48 +1278,119 @@ namespace vkspec {
 		}
 	}
 
-	void Registry::_build_feature(Feature * f) {
+	void Registry::_build_feature(Feature * f, Profile const* profile) {
 		f->_patch = _patch;
 
-		_parse_feature_definition(f);
+		{
+			Stats::Scope scope(_stats, _stats_label + "feature definition");
+			_parse_feature_definition(f);
 
-		// Feature definitions list the core items used
-		f->_mark_all_core();
+			// Feature definitions list the core items used
+			f->_mark_all_core();
+		}
 
-		for (auto e : _extensions) {
-			std::regex re("(^" + e->_supported + "$)");
-			auto it = std::sregex_iterator(f->_name.begin(), f->_name.end(), re);
-			auto end = std::sregex_iterator();
+		{
+			Stats::Scope scope(_stats, _stats_label + "extension matching");
+			std::set<std::string> selected;
+			if (profile) {
+				selected = _select_extensions(f, *profile);
+			}
 
-			if (it != end) { // Matches api tag of feature
-				_parse_extension_definition(e);
-				f->_use_extension(e);
+			for (auto e : _extensions) {
+				std::regex re("(^" + e->_supported + "$)");
+				auto it = std::sregex_iterator(f->_name.begin(), f->_name.end(), re);
+				auto end = std::sregex_iterator();
+
+				if (it != end && (!profile || selected.count(e->_name))) { // Matches api tag of feature
+					_parse_extension_definition(e);
+					f->_use_extension(e);
+				}
 			}
 		}
 
+		// Commands and types outside of the profile are removed before
+		// grouping so that they never make it into the dependency chain.
+		if (profile && !profile->commands.empty()) {
+			Stats::Scope scope(_stats, _stats_label + "apply profile");
+			f->_apply_profile(*profile);
+		}
+
 		// By now all types have been added and a dependency chain has been
 		// built, and we can clean it up a bit.
-		f->_group_dependencies(_c_types);
+		{
+			Stats::Scope scope(_stats, _stats_label + "group dependencies");
+			f->_group_dependencies(_c_types);
 
-		// Sorts the types added by each extension to match the dependency chain
-		f->_sort_extension_types();
+			// Sorts the types added by each extension to match the dependency chain
+			f->_sort_extension_types();
+		}
 
-		f->_sanity_check(_tags, _c_types);
+		{
+			Stats::Scope scope(_stats, _stats_label + "sanity check");
+			f->_sanity_check(_tags, _c_types);
+		}
+	}
+
+	// Extension definitions are not parsed until an extension is used, so the
+	// commands added by an extension are found in its XML.
+	std::set<std::string> Registry::_select_extensions(Feature* f, Profile const& profile) {
+		std::map<std::string, Extension*> available;
+		for (auto e : _extensions) {
+			std::regex re("(^" + e->_supported + "$)");
+			if (std::regex_match(f->_name, re)) {
+				available[e->_name] = e;
+			}
+		}
+
+		std::vector<std::string> pending;
+		for (auto& name : profile.extensions) {
+			if (available.find(name) == available.end()) {
+				throw std::runtime_error("Extension '" + name + "' of the profile is not available for feature '" + f->_name + "'");
+			}
+			pending.push_back(name);
+		}
+
+		for (auto& name : profile.commands) {
+			for (auto& a : available) {
+				for (auto& require : a.second->_definition.children()) {
+					for (auto& child : require.children()) {
+						if (child.value() == "command" && name == child.attribute("name")) {
+							pending.push_back(a.first);
+						}
+					}
+				}
+			}
+		}
+
+		std::set<std::string> selected;
+		while (!pending.empty()) {
+			std::string name = pending.back();
+			pending.pop_back();
+			if (selected.insert(name).second) {
+				for (auto& r : available[name]->_required_extensions) {
+					if (available.find(r) != available.end()) {
+						pending.push_back(r);
+					}
+				}
+			}
+		}
+
+		return selected;
 	}
 
 	void Registry::_parse_feature_definition(Feature * f) {
-		for (tinyxml2::XMLElement* child = f->_xml_node->FirstChildElement(); child; child = child->NextSiblingElement()) {
-			assert(strcmp(child->Value(), "require") == 0);
-			assert(!child->Attribute("profile")); // Profiles are not used yet, so they are not implemented
-			assert(!child->Attribute("api")); // Not supported in feature tags
+		for (auto& child : f->_definition.children()) {
+			assert(child.value() == "require");
+			assert(!child.attribute("profile")); // Profiles are not used yet, so they are not implemented
+			assert(!child.attribute("api")); // Not supported in feature tags
 
 			_read_feature_require(child, f);
 		}
 	}
 
-	void Registry::_read_feature_require(tinyxml2::XMLElement * element, Feature * f) {
-		for (tinyxml2::XMLElement* child = element->FirstChildElement(); child; child = child->NextSiblingElement()) {
-			std::string value = child->Value();
+	void Registry::_read_feature_require(XmlElement const& element, Feature * f) {
+		for (auto& child : element.children()) {
+			std::string const& value = child.value();
 
 			if (value == "command") {
 				_read_feature_command(child, f);
@@ -1195,23 +1405,18 @@ namespace vkspec {
 		}
 	}
 
-	void Registry::_read_feature_command(tinyxml2::XMLElement * element, Feature * f) {
-		assert(element->Attribute("name"));
-		std::string name = element->Attribute("name");
-		auto cmd_it = std::find_if(_commands.begin(), _commands.end(), [name](Command* c) -> bool {
-			return c->_name == name;
-		});
-		assert(cmd_it != _commands.end());
-		f->_require_command(*cmd_it);
+	void Registry::_read_feature_command(XmlElement const& element, Feature * f) {
+		assert(element.attribute("name"));
+		f->_require_command(_find_command(element.attribute("name")));
 	}
 
-	void Registry::_read_feature_type(tinyxml2::XMLElement * element, Feature * f) {
+	void Registry::_read_feature_type(XmlElement const& element, Feature * f) {
 		// Mostly includes and defines that can be ignored manually I guess.
 		// Every now and then there is an actual type that should have been
 		// parsed before, and then it seems to be types not used directly by
 		// the API. Other types are picked up as dependencies of commands.
 
-		std::set<std::string> ignored = {
+		static const std::set<std::string> ignored = {
 			"vk_platform", // include type
 			"VK_API_VERSION", // C define to pack version number into a uint32_t (deprecated)
 			"VK_API_VERSION_1_0", // C define to pack this version
@@ -1222,8 +1427,8 @@ namespace vkspec {
 			"VK_NULL_HANDLE", // Defined to 0
 		};
 
-		assert(element->Attribute("name"));
-		std::string name = element->Attribute("name");
+		char const* name = element.attribute("name");
+		assert(name);
 
 		if (ignored.find(name) != ignored.end()) {
 			return;
@@ -1234,40 +1439,28 @@ namespace vkspec {
 		f->_require_type(type_it->second);
 	}
 
-	void Registry::_read_feature_enum(tinyxml2::XMLElement * element, Feature * f) {
+	void Registry::_read_feature_enum(XmlElement const& element, Feature * f) {
 		// I have only ever seen reference enums here, that is, pulling in an
 		// already existing definition. It makes sense, since the extension enum
 		// information says it's an inline definition inside an extensions block.
 
-		const tinyxml2::XMLAttribute* first = element->FirstAttribute();
-		assert(first);
-		const tinyxml2::XMLAttribute* second = first->Next();
-
-		std::string enum_name;
-		if (strcmp(first->Name(), "name") == 0) {
-			enum_name = first->Value();
-
-			if (second) {
-				assert(strcmp(second->Name(), "comment") == 0);
-				assert(!second->Next());
-			}
-		}
-		else {
-			assert(strcmp(first->Name(), "comment") == 0);
-			assert(second && strcmp(second->Name(), "name") == 0 && !second->Next());
-			enum_name = second->Value();
+		auto& attributes = element.attributes();
+		assert(!attributes.empty() && attributes.size() <= 2);
+		for (auto& a : attributes) {
+			assert(a.first == "name" || a.first == "comment");
 		}
 
+		char const* enum_name = element.attribute("name");
+		assert(enum_name);
+
 		// I think these should always be API constants. Actual enums are read
 		// as types. Unless of course a subset is required, in which case I would
 		// have to revise how I deal with enums. This would likely lead to adding
 		// an Enumeration item type so that I can find them individually and
 		// have enum members be objects of this type.
-		auto item_it = std::find_if(_api_constants.begin(), _api_constants.end(), [&enum_name](ApiConstant* a) -> bool {
-			return a->_name == enum_name;
-		});
-		assert(item_it != _api_constants.end());
-		f->_require_enum(*item_it);
+		auto type_it = _types.find(enum_name);
+		assert(type_it != _types.end() && type_it->second->to_api_constant());
+		f->_require_enum(type_it->second->to_api_constant());
 	}
 
 	void Registry::_parse_extension_definition(Extension* e) {
@@ -1276,18 +1469,18 @@ namespace vkspec {
 
         // Remove this and the else body below when this one has a type
         if (e->_name == "VK_AMD_mixed_attachment_samples") {
-          assert(!e->_xml_node->Attribute("type"));
+          assert(!e->_definition.attribute("type"));
         }
 
-		if (e->_xml_node->Attribute("type")) {
-			std::string extension_type = e->_xml_node->Attribute("type");
+		if (e->_definition.attribute("type")) {
+			std::string extension_type = e->_definition.attribute("type");
 			assert(extension_type == "instance" || extension_type == "device");
 			e->_classification = extension_type == "instance" ? ExtensionClassification::Instance : ExtensionClassification::Device;
 		}
 		else {
           // Omission of type attribute only seems to happen mostly for
           // disabled extensions.
-          if (strcmp(e->_xml_node->Attribute("supported"), "disabled") == 0) {
+          if (e->_supported == "disabled") {
             e->_classification = ExtensionClassification::Disabled;
           }
           else {
@@ -1300,21 +1493,21 @@ namespace vkspec {
 		// present for the definition. This could be for example VK_USE_PLATFORM_WIN32
 		// in order to use Windows surface or external semaphores.
 
-		tinyxml2::XMLElement * child = e->_xml_node->FirstChildElement();
-		assert(child && (strcmp(child->Value(), "require") == 0) && !child->NextSiblingElement());
+		auto& children = e->_definition.children();
+		assert(children.size() == 1 && children[0].value() == "require");
 
-		_read_extension_require(child, e);
+		_read_extension_require(children[0], e);
 	}
 
 	// Defines what types, enumerants, and commands are used by an extension
-	void Registry::_read_extension_require(tinyxml2::XMLElement * element, Extension* e)
+	void Registry::_read_extension_require(XmlElement const& element, Extension* e)
 	{
 		// Not used at the moment
-		assert(!element->Attribute("api"));
+		assert(!element.attribute("api"));
 
-		for (tinyxml2::XMLElement * child = element->FirstChildElement(); child; child = child->NextSiblingElement())
+		for (auto& child : element.children())
 		{
-			std::string value = child->Value();
+			std::string const& value = child.value();
 
 			if (value == "command")
 			{
@@ -1332,21 +1525,16 @@ namespace vkspec {
 		}
 	}
 
-	void Registry::_read_extension_command(tinyxml2::XMLElement * element, Extension* e)
+	void Registry::_read_extension_command(XmlElement const& element, Extension* e)
 	{
-		char const* name = element->Attribute("name");
-		assert(name);
-		auto cmd_it = std::find_if(_commands.begin(), _commands.end(), [name](Command* c) -> bool {
-			return c->_name == name;
-		});
-		assert(cmd_it != _commands.end());
-		Command* c = *cmd_it;
+		assert(element.attribute("name"));
+		Command* c = _find_command(element.attribute("name"));
 		e->_commands.push_back(c);
 		assert(!c->_extension);
 		c->_extension = e;
 	}
 
-	void Registry::_read_extension_type(tinyxml2::XMLElement * element, Extension* e)
+	void Registry::_read_extension_type(XmlElement const& element, Extension* e)
 	{
 		// Some types are not found by analyzing dependencies, but the extension
 		// may still require some types. These are provided explicitly. One of
@@ -1354,81 +1542,69 @@ namespace vkspec {
 		// to VkBindImageMemoryInfoKHX and thus is never a direct dependency of
 		// another type. However, the extension (VK_KHX_device_group) still adds
 		// it, so we collect these types here for when analyzing dependencies.
-		assert(element->Attribute("name"));
-		auto type_it = _types.find(element->Attribute("name"));
+		assert(element.attribute("name"));
+		auto type_it = _types.find(element.attribute("name"));
 		assert(type_it != _types.end());
 		e->_required_types.push_back(type_it->second);
 	}
 
-	void Registry::_read_extension_enum(tinyxml2::XMLElement * element, Extension* e)
+	void Registry::_read_extension_enum(XmlElement const& element, Extension* e)
 	{
-		assert(element->Attribute("name"));
-		std::string name = element->Attribute("name");
+		assert(element.attribute("name"));
+		std::string name = element.attribute("name");
 
-		if (element->Attribute("extends"))
+		if (element.attribute("extends"))
 		{
-			assert(!!element->Attribute("bitpos") + !!element->Attribute("offset") + !!element->Attribute("value") == 1);
-			if (element->Attribute("bitpos")) {
+			assert(!!element.attribute("bitpos") + !!element.attribute("offset") + !!element.attribute("value") == 1);
+			if (element.attribute("bitpos")) {
 				// Find the extended enum so we can add the member to it.
-				std::string extends = element->Attribute("extends");
-				auto enum_it = std::find_if(_enums.begin(), _enums.end(), [&extends](Enum* e) -> bool {
-					return extends == e->_name;
-				});
-				assert(enum_it != _enums.end());
-				assert((*enum_it)->_bitmask);
+				Enum* extended = _find_enum(element.attribute("extends"));
+				assert(extended->_bitmask);
 
 				Enum::Member m;
 				m.name = name;
-				m.value = _bitpos_to_value(element->Attribute("bitpos"));
+				m.value = _bitpos_to_value(element.attribute("bitpos"));
 
-				(*enum_it)->_members.push_back(m);
+				extended->_members.push_back(m);
 			}
-			else if (element->Attribute("offset")) {
+			else if (element.attribute("offset")) {
 				// The value depends on extension number and offset. See
 				// https://www.khronos.org/registry/vulkan/specs/1.0/styleguide.html#_assigning_extension_token_values
 				// for calculation.
-				int value = 1000000000 + (e->_number - 1) * 1000 + std::stoi(element->Attribute("offset"));
+				int value = 1000000000 + (e->_number - 1) * 1000 + std::stoi(element.attribute("offset"));
 
-				if (element->Attribute("dir") && strcmp(element->Attribute("dir"), "-") == 0) {
+				if (element.attribute("dir") && strcmp(element.attribute("dir"), "-") == 0) {
 					value = -value;
 				}
 
 				std::string value_string = std::to_string(value);
 
 				// Like above, find extended enum to add value
-				std::string extends = element->Attribute("extends");
-				auto enum_it = std::find_if(_enums.begin(), _enums.end(), [&extends](Enum* e) -> bool {
-					return extends == e->_name;
-				});
-				assert(enum_it != _enums.end());
-				assert(!(*enum_it)->_bitmask);
+				Enum* extended = _find_enum(element.attribute("extends"));
+				assert(!extended->_bitmask);
 
 				Enum::Member m;
 				m.name = name;
 				m.value = value_string;
 
-				(*enum_it)->_members.push_back(m);
+				extended->_members.push_back(m);
 			}
 			else {
-				assert(element->Attribute("value"));
+				assert(element.attribute("value"));
 				// This is a special case for an enum variant that used to be core.
 				// It uses value instead of offset.
-				std::string extends = element->Attribute("extends");
-				auto enum_it = std::find_if(_enums.begin(), _enums.end(), [&extends](Enum* e) -> bool {
-					return extends == e->_name;
-				});
-				assert(enum_it != _enums.end());
-				assert(!(*enum_it)->_bitmask);
+				Enum* extended = _find_enum(element.attribute("extends"));
+				assert(!extended->_bitmask);
 
 				Enum::Member m;
 				m.name = name;
-				m.value = element->Attribute("value");
+				m.value = element.attribute("value");
 
-				(*enum_it)->_members.push_back(m);
+				extended->_members.push_back(m);
 			}
 		}
 		// Inline definition of extension-specific constant.
-		else if (element->Attribute("value")) {
+		else if (element.attribute("value")) {
 			// Unimplemented.
 			// All extensions have a constant for spec version and one for the extension
 			// name as a string literal. Other than that, some have redefines. I guess
@@ -1437,7 +1613,7 @@ namespace vkspec {
 			//std::cout << "Unimplemented: extension enum with inline constants" << std::endl;
 		}
 		// Inline definition of extension-specific bitmask value.
-		else if (element->Attribute("bitpos")) {
+		else if (element.attribute("bitpos")) {
 			assert(false); // Not implemented
 		}
 		// Should be a reference enum, which only supports name and comment. These
@@ -1445,14 +1621,82 @@ namespace vkspec {
 		// seem to be used for purposes of listing items the extension depends on,
 		// and since they are defined elsewhere I ignore them.
 		else {
-			const tinyxml2::XMLAttribute* att = element->FirstAttribute();
-			assert(strcmp(att->Name(), "name") == 0 || strcmp(att->Name(), "comment") == 0);
-			att = att->Next();
-			if (att) {
-				assert(strcmp(att->Name(), "name") == 0 || strcmp(att->Name(), "comment") == 0);
-				assert(!att->Next());
+			auto& attributes = element.attributes();
+			assert(attributes.size() <= 2);
+			for (auto& a : attributes) {
+				assert(a.first == "name" || a.first == "comment");
 			}
 		}
 	}
 
+	Command* Registry::_find_command(char const* name) {
+		auto cmd_it = _command_lookup.find(name);
+		assert(cmd_it != _command_lookup.end());
+		return cmd_it->second;
+	}
+
+	Enum* Registry::_find_enum(char const* name) {
+		auto type_it = _types.find(name);
+		assert(type_it != _types.end() && type_it->second->to_enum());
+		return type_it->second->to_enum();
+	}
+
+	XmlElement::XmlElement(tinyxml2::XMLElement const* element) : _value(element->Value()) {
+		for (auto a = element->FirstAttribute(); a; a = a->Next()) {
+			_attributes.push_back(std::make_pair(std::string(a->Name()), std::string(a->Value())));
+		}
+		for (auto child = element->FirstChildElement(); child; child = child->NextSiblingElement()) {
+			_children.push_back(XmlElement(child));
+		}
+	}
+
+	char const* XmlElement::attribute(char const* name) const {
+		for (auto& a : _attributes) {
+			if (a.first == name) {
+				return a.second.c_str();
+			}
+		}
+		return nullptr;
+	}
+
+	Profile Profile::load(std::string const& path) {
+		std::ifstream file(path);
+		if (!file.is_open()) {
+			throw std::runtime_error("Failed to open profile '" + path + "'");
+		}
+
+		Profile profile;
+		std::string line;
+		int line_number = 0;
+		while (std::getline(file, line)) {
+			++line_number;
+			std::istringstream words(line);
+			std::string kind, name, rest;
+			words >> kind >> name >> rest;
+
+			if (kind.empty() || kind[0] == '#') {
+				continue;
+			}
+
+			if (name.empty() || !rest.empty()) {
+				throw std::runtime_error(path + ":" + std::to_string(line_number) + ": expected '<kind> <name>'");
+			}
+
+			if (kind == "extension") {
+				profile.extensions.insert(name);
+			}
+			else if (kind == "command") {
+				profile.commands.insert(name);
+			}
+			else if (kind == "type") {
+				profile.types.insert(name);
+			}
+			else {
+				throw std::runtime_error(path + ":" + std::to_string(line_number) + ": unknown kind '" + kind + "'");
+			}
+		}
+
+		return profile;
+	}
+
 } // vkspec
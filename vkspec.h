@@ -24,15 +24,28 @@
 #include <cassert>
 #include <functional>
 #include <map>
+#include <memory>
 #include <regex>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include <tinyxml2.h>
 
+class Stats;
+
 namespace vkspec {
 
+// Inserts into a map or set that must not hold the key yet. The insertion is
+// kept out of assert, which does nothing when NDEBUG is defined.
+template <typename Container, typename Value>
+void _insert_unique(Container& container, Value const& value) {
+	bool inserted = container.insert(value).second;
+	assert(inserted);
+	(void)inserted;
+}
+
 enum class CommandClassification {
 	Entry,
 	Global,
@@ -65,8 +78,31 @@ enum class SortOrder {
 	Struct,
 };
 
+// Owned copy of an XML element, its attributes and its child elements (text
+// is not kept). Features and extensions are defined lazily when a feature is
+// built, so their elements are copied to let the registry release the
+// document as soon as parsing is done.
+class XmlElement {
+public:
+	XmlElement() = default;
+	explicit XmlElement(tinyxml2::XMLElement const* element);
+
+	std::string const& value() const { return _value; }
+	// Returns nullptr if the attribute is not present.
+	char const* attribute(char const* name) const;
+	std::vector<std::pair<std::string, std::string>> const& attributes() const { return _attributes; }
+	std::vector<XmlElement> const& children() const { return _children; }
+
+private:
+	std::string _value;
+	std::vector<std::pair<std::string, std::string>> _attributes;
+	std::vector<XmlElement> _children;
+};
+
 class Extension;
 class Item {
+	friend class Registry;
+
 public:
 	// Returns the type name, which is translated for C types. When parsing the
 	// registry, the parser should access _name for the type used in the spec.
@@ -80,7 +116,7 @@ protected:
 	std::string _name;
 	Extension* _extension = nullptr; // Owning extension, if any
 	ApiPart _api_part = ApiPart::Unspecified;
-	tinyxml2::XMLElement* _xml_node;
+	tinyxml2::XMLElement* _xml_node; // Only valid while the registry is being parsed
 
 private:
 	Item(Item const&) = delete;
@@ -287,11 +323,17 @@ public:
 		Type* pure_type;
 		std::string name;
 		ApiConstant* array_dependency;
+		std::string array_size;
+		std::vector<std::string> len; // Comma separated len attribute, e.g. {"enabledLayerCount", "null-terminated"}
+		std::string altlen; // C expression replacing a latexmath len
+		std::string values; // Legal values, used for sType
+		std::vector<bool> optional; // Whether each level of indirection may be omitted, e.g. {false, true}
 	};
 
 	virtual Struct* to_struct() { return this; }
 	bool is_union() { return _is_union; }
 	std::vector<Member> const& members() { return _members; }
+	std::vector<Struct*> const& extends() { return _extends; } // Structs whose pNext chain this struct may be part of
 
 private:
 	Struct(std::string const& name, tinyxml2::XMLElement* type_element, bool is_union) : Type(name, type_element), _is_union(is_union) {}
@@ -322,6 +364,7 @@ private:
 
 private:
 	std::vector<Member> _members;
+	std::vector<Struct*> _extends;
 	bool _is_union = false;
 };
 
@@ -429,6 +472,8 @@ public:
 		ApiConstant* array_dependency;
         bool const_modifier;
         std::string array_size;
+		std::vector<std::string> len; // Comma separated len attribute
+		std::vector<bool> optional; // Comma separated optional attribute
 	};
 
 	CommandClassification classification() {
@@ -437,6 +482,8 @@ public:
 	std::vector<Parameter> const& params() { return _params; }
 	std::string const& complete_return_type() { return _return_type_complete; }
 	Type* pure_return_type() { return _return_type_pure; }
+	std::string const& renderpass() { return _renderpass; } // Where vkCmd* commands may be recorded: "inside", "outside" or "both"
+	std::vector<std::string> const& tasks() { return _tasks; } // Comma separated tasks attribute, e.g. {"state"}. Missing in older registries.
 
 private:
 	Command(std::string const& name, tinyxml2::XMLElement* command_element) : Item(name, command_element) {}
@@ -445,6 +492,8 @@ private:
 	std::string _return_type_complete;
 	Type* _return_type_pure = nullptr;
 	std::vector<Parameter> _params;
+	std::string _renderpass;
+	std::vector<std::string> _tasks;
 	CommandClassification _classification = CommandClassification::Unspecified;
 };
 
@@ -454,6 +503,7 @@ class Extension : public Item {
 
 public:
     std::string const& protect() { return _protect; }
+	std::vector<std::string> const& required_extensions() { return _required_extensions; } // Names of extensions this one depends on
 	ExtensionClassification classification() { return _classification; }
 	std::vector<Command*> const& commands() { return _commands; }
 
@@ -465,10 +515,12 @@ private:
 	std::string _supported;
 	std::string _tag;
     std::string _protect;
+	std::vector<std::string> _required_extensions;
 	ExtensionClassification _classification = ExtensionClassification::Unspecified;
 	std::vector<Command*> _commands;
 	std::vector<Type*> _required_types; // Provided explicitly by registry
 	std::vector<Type*> _types; // Types introduced by this extension
+	XmlElement _definition; // Copy of the extension element
 };
 
 class IGenerator {
@@ -500,6 +552,25 @@ public:
 	virtual void end_extension(Extension* e) = 0;
 };
 
+// Restricts a feature to a subset of the API. Extensions are used if they
+// are listed, if they add a listed command, or if a used extension requires
+// them. If any commands are listed, only those are kept, together with the
+// commands needed to load the rest and to get from the loader to a device
+// (see Feature::_loader_commands), so that every dispatch table keeps its
+// parent. Types that are not reachable from the kept commands, the listed
+// types or the types required by used extensions are removed. A profile
+// without commands keeps all of the core API.
+struct Profile {
+	// Reads a profile from a file where each line is either empty, a comment
+	// starting with #, or one of "extension <name>", "command <name>" or
+	// "type <name>".
+	static Profile load(std::string const& path);
+
+	std::set<std::string> extensions;
+	std::set<std::string> commands;
+	std::set<std::string> types;
+};
+
 class Feature : public Item {
 	friend class Registry;
 
@@ -741,6 +812,113 @@ private:
 			}
 		}
 	}
+	// Commands kept by every profile. Dispatch tables are loaded through the
+	// table of their parent object, so the commands creating and destroying
+	// instances and devices and finding physical devices keep the chain from
+	// the loader to a device intact.
+	static std::set<std::string> const& _loader_commands() {
+		static std::set<std::string> const commands = {
+			"vkCreateInstance",
+			"vkDestroyInstance",
+			"vkEnumeratePhysicalDevices",
+			"vkCreateDevice",
+			"vkDestroyDevice",
+			"vkGetDeviceProcAddr",
+		};
+		return commands;
+	}
+	// Removes commands not listed in the profile and every type that is no
+	// longer reachable after that.
+	void _apply_profile(Profile const& profile) {
+		for (auto& name : profile.commands) {
+			if (_commands.end() == std::find_if(_commands.begin(), _commands.end(), [&name](Command* c) -> bool { return c->_name == name; })) {
+				throw std::runtime_error("Command '" + name + "' of the profile is not part of the feature");
+			}
+		}
+
+		auto dropped = [&profile](Command* c) -> bool {
+			return profile.commands.count(c->_name) == 0 && c->_classification != CommandClassification::Entry && _loader_commands().count(c->_name) == 0;
+		};
+		_commands.erase(std::remove_if(_commands.begin(), _commands.end(), dropped), _commands.end());
+		for (auto e : _extensions) {
+			e->_commands.erase(std::remove_if(e->_commands.begin(), e->_commands.end(), dropped), e->_commands.end());
+		}
+
+		std::vector<Type*> reachable;
+		for (auto c : _commands) {
+			c->_return_type_pure->_build_dependency_chain(reachable);
+			for (auto& p : c->_params) {
+				if (p.array_dependency) {
+					((Type*)p.array_dependency)->_build_dependency_chain(reachable);
+				}
+				p.pure_type->_build_dependency_chain(reachable);
+			}
+		}
+		for (auto e : _extensions) {
+			for (auto t : e->_required_types) {
+				t->_build_dependency_chain(reachable);
+			}
+		}
+		for (auto& name : profile.types) {
+			auto type_it = _types.find(name);
+			if (type_it == _types.end()) {
+				throw std::runtime_error("Type '" + name + "' of the profile is not part of the feature");
+			}
+			type_it->second->_build_dependency_chain(reachable);
+		}
+
+		std::set<std::string> reachable_names;
+		for (auto t : reachable) {
+			reachable_names.insert(t->_name);
+		}
+
+		// Structs that may be chained to a reachable struct are reachable
+		// through its pNext member. Bitmasks are reachable when their flag
+		// bits are, since generators emit the bits along with the bitmasks.
+		// Keeping a type can make more types reachable, both through its
+		// members and through its own extenders, so this repeats until
+		// nothing is added.
+		bool added = true;
+		while (added) {
+			added = false;
+			for (auto& type : _types) {
+				if (reachable_names.count(type.first) != 0) {
+					continue;
+				}
+
+				bool keep = false;
+				if (Struct* s = type.second->to_struct()) {
+					for (auto extended : s->extends()) {
+						keep = keep || reachable_names.count(extended->_name) != 0;
+					}
+				}
+				if (Bitmasks* b = type.second->to_bitmasks()) {
+					keep = b->flags() && reachable_names.count(b->flags()->_name) != 0;
+				}
+
+				if (keep) {
+					std::vector<Type*> chain;
+					type.second->_build_dependency_chain(chain);
+					for (auto t : chain) {
+						reachable_names.insert(t->_name);
+					}
+					added = true;
+				}
+			}
+		}
+
+		auto unreachable = [&reachable_names](Type* t) -> bool {
+			return reachable_names.count(t->_name) == 0;
+		};
+
+		_dependency_chain.erase(std::remove_if(_dependency_chain.begin(), _dependency_chain.end(), unreachable), _dependency_chain.end());
+		for (auto e : _extensions) {
+			e->_types.erase(std::remove_if(e->_types.begin(), e->_types.end(), unreachable), e->_types.end());
+		}
+		for (auto it = _types.begin(); it != _types.end();) {
+			it = unreachable(it->second) ? _types.erase(it) : std::next(it);
+		}
+	}
 	// I guess another strategy that would be more comprehensible is to scan in
 	// the sort order. First push all scalar typedefs (first in the sort order)
 	// whose dependencies have been added. Then push all handles (second sort)
@@ -769,11 +947,15 @@ private:
 		int new_types = 0;
 
 		// Ultimately, everything depend on C types which are expected to have
-		// no dependencies themselves, so we begin by adding those.
+		// no dependencies themselves, so we begin by adding those. C types only
+		// used by parts of the API left out by a profile are skipped.
 		for (auto& c : c_types) {
+			if (std::find(ungrouped_dependency_chain.begin(), ungrouped_dependency_chain.end(), c.second) == ungrouped_dependency_chain.end()) {
+				continue;
+			}
 			_types.insert(c); // Just to make sure it is here
 			_dependency_chain.push_back(c.second);
-			assert(all_added_dependencies.insert(c.first).second == true);
+			_insert_unique(all_added_dependencies, c.first);
 		}
 
 		// Now the algorithm is as follows. Several iterations is done. We push
@@ -793,7 +975,7 @@ private:
 				}
 
 				if (type->_dependency_condition(all_added_dependencies, current_added_dependencies)) {
-					assert(current_added_dependencies.insert(type->_name).second == true);
+					_insert_unique(current_added_dependencies, type->_name);
 					_dependency_chain.push_back(type);
 					new_types++;
 				}
@@ -938,6 +1120,7 @@ private:
 	std::vector<Type*> _dependency_chain;
 	std::vector<Command*> _commands;
 	std::vector<Extension*> _extensions;
+	XmlElement _definition; // Copy of the feature element
 };
 
 enum class PointerType {
@@ -960,16 +1143,38 @@ public:
 
 class Registry {
 public:
-    Registry(ITranslator* translator);
+    // Item definitions are parsed on |threads| threads (0 picks one thread
+    // per core). Translator methods may thus be called concurrently.
+    Registry(ITranslator* translator, unsigned int threads = 0);
 
 	void parse(std::string const& spec);
-	Feature* build_feature(std::string const& feature);
+	// If |profile| is given, the feature is restricted to the subset of the
+	// API it describes.
+	Feature* build_feature(std::string const& feature, Profile const* profile = nullptr);
 
 	std::string const& license(void) const {
 		return _license_header;
 	}
 
+	// Records the time and memory spent in each phase of parsing and building
+	// the feature in |stats|. Phase names are prefixed by |label| to tell
+	// registries apart.
+	void collect_stats(Stats* stats, std::string const& label) {
+		_stats = stats;
+		_stats_label = label;
+	}
+
+	// Reorders registry elements whose order carries no meaning before they
+	// are parsed, using |seed| to pick the order. The results must be the
+	// same for every seed, which checks that nothing depends on where things
+	// happen to be in vk.xml.
+	void shuffle_elements(unsigned int seed) {
+		_shuffle = true;
+		_shuffle_seed = seed;
+	}
+
 private:
+	void _shuffle_document(tinyxml2::XMLElement* registry_element);
 	void _parse_item_declarations(tinyxml2::XMLElement* registry_element);
 	void _read_comment(tinyxml2::XMLElement * element);
 	void _read_tags(tinyxml2::XMLElement * element);
@@ -1007,26 +1212,31 @@ private:
 	tinyxml2::XMLNode* _read_command_param_type(tinyxml2::XMLNode* node, std::string& complete_type, Type*& pure_type, bool& const_modifier);
 
 	std::string _read_array_size(tinyxml2::XMLNode * node, std::string& name, ApiConstant*& api_constant);
+	std::vector<std::string> _split_list(std::string const& list);
 	std::string _trim_end(std::string const& input);
 	std::string _extract_tag(std::string const& name);
 	std::string _bitpos_to_value(std::string const& bitpos);
 
 	void _mark_command_classifications();
+	void _release_document();
 
-	void _build_feature(Feature* f);
+	void _build_feature(Feature* f, Profile const* profile);
+	std::set<std::string> _select_extensions(Feature* f, Profile const& profile);
 	void _parse_feature_definition(Feature* f);
-	void _read_feature_require(tinyxml2::XMLElement* element, Feature* f);
-	void _read_feature_command(tinyxml2::XMLElement* element, Feature* f);
-	void _read_feature_type(tinyxml2::XMLElement* element, Feature* f);
-	void _read_feature_enum(tinyxml2::XMLElement* element, Feature* f);
+	void _read_feature_require(XmlElement const& element, Feature* f);
+	void _read_feature_command(XmlElement const& element, Feature* f);
+	void _read_feature_type(XmlElement const& element, Feature* f);
+	void _read_feature_enum(XmlElement const& element, Feature* f);
 	void _parse_extension_definition(Extension* e);
-	void _read_extension_require(tinyxml2::XMLElement * element, Extension* e);
-	void _read_extension_command(tinyxml2::XMLElement * element, Extension* e);
-	void _read_extension_type(tinyxml2::XMLElement * element, Extension* e);
-	void _read_extension_enum(tinyxml2::XMLElement * element, Extension* e);
+	void _read_extension_require(XmlElement const& element, Extension* e);
+	void _read_extension_command(XmlElement const& element, Extension* e);
+	void _read_extension_type(XmlElement const& element, Extension* e);
+	void _read_extension_enum(XmlElement const& element, Extension* e);
+	Command* _find_command(char const* name);
+	Enum* _find_enum(char const* name);
 
 private:
-	tinyxml2::XMLDocument _doc;
+	std::unique_ptr<tinyxml2::XMLDocument> _doc; // Released once parsing is done
 
 	std::map<std::string, Item*> _items; // All items used in the registry
 	std::map<std::string, Type*> _types; // All types used in the registry (no commands, extensions, constants, etc)
@@ -1039,10 +1249,16 @@ private:
 	std::vector<ApiConstant*> _api_constants;
 	std::vector<Enum*> _enums;
 	std::vector<Command*> _commands;
+	std::map<std::string, Command*> _command_lookup; // Commands by name for resolving require blocks
 	std::vector<Extension*> _extensions;
 	std::vector<Feature*> _features;
 
 	ITranslator* _translator;
+	unsigned int _threads;
+	Stats* _stats = nullptr;
+	std::string _stats_label;
+	bool _shuffle = false;
+	unsigned int _shuffle_seed = 0;
 	int _patch;
 	std::string _license_header;
 	std::set<std::string> _tags;
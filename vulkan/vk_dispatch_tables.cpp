@@ -1,6 +1,11 @@
 #include "vk_dispatch_tables.h"
 
 #include <stdexcept>
+#if defined(_WIN32)
+#include <Windows.h>
+#elif defined(__linux__)
+#include <dlfcn.h>
+#endif
 
 namespace vkgen {
 
@@ -25,7 +30,7 @@ GlobalFunctions::GlobalFunctions(std::string const& vulkan_library) {
 
 #if defined(_WIN32)
   vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
-      GetProcAddress(library_, "vkGetInstanceProcAddr"));
+      GetProcAddress(static_cast<HMODULE>(library_), "vkGetInstanceProcAddr"));
 #elif defined(__linux__)
   vkGetInstanceProcAddr_ = reinterpret_cast<PFN_vkGetInstanceProcAddr>(
       dlsym(library_, "vkGetInstanceProcAddr"));
@@ -53,7 +58,7 @@ GlobalFunctions::GlobalFunctions(std::string const& vulkan_library) {
 
 GlobalFunctions::~GlobalFunctions() {
 #if defined(_WIN32)
-  FreeLibrary(library_);
+  FreeLibrary(static_cast<HMODULE>(library_));
 #elif defined(__linux__)
   dlclose(library_);
 #else
@@ -21,9 +21,6 @@
 #include "vulkan_include.inl"
 #include <stdexcept>
 #include <string>
-#if defined(_WIN32)
-#include <Windows.h>
-#endif
 
 namespace vkgen {
 
@@ -39,13 +36,9 @@ private:
 };
 
 class GlobalFunctions {
-#if defined(_WIN32)
-  typedef HMODULE library_handle;
-#elif defined(__linux__)
+  // HMODULE on Windows. Kept opaque so that platform headers are only
+  // included by the implementation.
   typedef void* library_handle;
-#else
-#error "Unsupported OS"
-#endif
 
 public:
   GlobalFunctions(std::string const& vulkan_library);